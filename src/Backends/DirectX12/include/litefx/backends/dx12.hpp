@@ -229,6 +229,7 @@ namespace LiteFX::Rendering::Backends {
 
     private:
         Array<D3D12_RAYTRACING_GEOMETRY_DESC> buildInfo() const;
+        void updateState(const DirectX12CommandBuffer& commandBuffer, SharedPtr<const IDirectX12Buffer> buffer, UInt64 offset, UInt64 size);
 
     private:
         SharedPtr<const IBuffer> getBuffer() const noexcept override;
@@ -300,6 +301,18 @@ namespace LiteFX::Rendering::Backends {
         /// <inheritdoc />
         virtual bool remove(const Instance& instance) noexcept override;
 
+        /// <inheritdoc />
+        void useInstanceBuffer(SharedPtr<const IDirectX12Buffer> buffer, UInt32 instances, UInt32 firstInstance = 0);
+
+        /// <inheritdoc />
+        SharedPtr<const IDirectX12Buffer> instanceBuffer() const noexcept;
+
+        /// <inheritdoc />
+        UInt32 firstInstance() const noexcept override;
+
+        /// <inheritdoc />
+        UInt32 instanceCount() const noexcept override;
+
     private:
         Array<D3D12_RAYTRACING_INSTANCE_DESC> buildInfo() const;
 
@@ -308,6 +321,8 @@ namespace LiteFX::Rendering::Backends {
         void doBuild(const ICommandBuffer& commandBuffer, SharedPtr<const IBuffer> scratchBuffer, SharedPtr<const IBuffer> buffer, UInt64 offset, UInt64 maxSize) override;
         void doUpdate(const ICommandBuffer& commandBuffer, SharedPtr<const IBuffer> scratchBuffer, SharedPtr<const IBuffer> buffer, UInt64 offset, UInt64 maxSize) override;
         void doCopy(const ICommandBuffer& commandBuffer, ITopLevelAccelerationStructure& destination, bool compress, SharedPtr<const IBuffer> buffer, UInt64 offset, bool copyBuildInfo) const override;
+        void doUseInstanceBuffer(SharedPtr<const IBuffer> buffer, UInt32 instances, UInt32 firstInstance) override;
+        SharedPtr<const IBuffer> getInstanceBuffer() const noexcept override;
     };
 
     /// <summary>
@@ -408,6 +423,20 @@ namespace LiteFX::Rendering::Backends {
         /// <param name="entryPoint">The name of the module entry point.</param>
         /// <param name="shaderLocalDescriptor">The descriptor that binds shader-local data for ray-tracing shaders.</param>
         explicit DirectX12ShaderModule(const DirectX12Device& device, ShaderStage type, std::istream& stream, const String& name, const String& entryPoint = "main", const Optional<DescriptorBindingPoint>& shaderLocalDescriptor = std::nullopt);
+
+        /// <summary>
+        /// Initializes a new DirectX 12 shader module from a shader archive.
+        /// </summary>
+        /// <remarks>
+        /// The entry point is read from the archive. The bytecode is copied into the module, so the archive does not need to be kept alive.
+        /// </remarks>
+        /// <param name="device">The parent device, this shader module has been created from.</param>
+        /// <param name="type">The shader stage, this module is used in.</param>
+        /// <param name="archive">The shader archive that contains the module.</param>
+        /// <param name="name">The name of the module within the archive.</param>
+        /// <param name="shaderLocalDescriptor">The descriptor that binds shader-local data for ray-tracing shaders.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if the archive does not contain a module with the name <paramref name="name" />.</exception>
+        explicit DirectX12ShaderModule(const DirectX12Device& device, ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor = std::nullopt);
         DirectX12ShaderModule(const DirectX12ShaderModule&) noexcept = delete;
         DirectX12ShaderModule(DirectX12ShaderModule&&) noexcept = delete;
         virtual ~DirectX12ShaderModule() noexcept;
@@ -1133,6 +1162,18 @@ namespace LiteFX::Rendering::Backends {
         /// <inheritdoc />
         void bind(const DirectX12DescriptorSet& descriptorSet, const DirectX12PipelineState& pipeline) const noexcept override;
 
+        /// <inheritdoc />
+        /// <remarks>
+        /// DirectX 12 does not support dynamic descriptors. The descriptor set is bound without offsets and an exception is thrown, if <paramref name="dynamicOffsets" /> is not empty.
+        /// </remarks>
+        void bind(const DirectX12DescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets) const override;
+
+        /// <inheritdoc />
+        /// <remarks>
+        /// DirectX 12 does not support dynamic descriptors. The descriptor set is bound without offsets and an error is logged, if <paramref name="dynamicOffsets" /> is not empty.
+        /// </remarks>
+        void bind(const DirectX12DescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets, const DirectX12PipelineState& pipeline) const noexcept override;
+
 		/// <inheritdoc />
 		void bind(Span<const DirectX12DescriptorSet*> descriptorSets, const DirectX12PipelineState& pipeline) const noexcept override;
 
@@ -1196,6 +1237,9 @@ namespace LiteFX::Rendering::Backends {
         /// <inheritdoc />
         void buildAccelerationStructure(DirectX12TopLevelAccelerationStructure& tlas, const SharedPtr<const IDirectX12Buffer> scratchBuffer, const IDirectX12Buffer& buffer, UInt64 offset = 0) const override;
 
+        /// <inheritdoc />
+        void buildAccelerationStructures(Span<DirectX12BottomLevelAccelerationStructure* const> blas, const SharedPtr<const IDirectX12Buffer> scratchBuffer, Span<const UInt64> scratchOffsets, const SharedPtr<const IDirectX12Buffer> buffer, Span<const UInt64> offsets) const override;
+
         /// <inheritdoc />
         void updateAccelerationStructure(DirectX12BottomLevelAccelerationStructure& blas, const SharedPtr<const IDirectX12Buffer> scratchBuffer, const IDirectX12Buffer& buffer, UInt64 offset = 0) const override;
 
@@ -1884,6 +1928,19 @@ namespace LiteFX::Rendering::Backends {
 
         /// <inheritdoc />
         virtual UniquePtr<DirectX12TopLevelAccelerationStructure> createTopLevelAccelerationStructure(StringView name, AccelerationStructureFlags flags = AccelerationStructureFlags::None) const override;
+
+    public:
+        /// <inheritdoc />
+        GraphicsMemoryStatistics memoryStatistics() const override;
+
+        /// <inheritdoc />
+        String dumpMemoryAllocations() const override;
+
+        /// <inheritdoc />
+        Float memoryBudgetThreshold() const noexcept override;
+
+        /// <inheritdoc />
+        void setMemoryBudgetThreshold(Float threshold) override;
     };
 
     /// <summary>
@@ -338,6 +338,16 @@ Array<D3D12_RAYTRACING_GEOMETRY_DESC> DirectX12BottomLevelAccelerationStructure:
     return m_impl->build();
 }
 
+void DirectX12BottomLevelAccelerationStructure::updateState(const DirectX12CommandBuffer& commandBuffer, SharedPtr<const IDirectX12Buffer> buffer, UInt64 offset, UInt64 size)
+{
+    m_impl->m_offset = offset;
+    m_impl->m_buffer = buffer;
+    m_impl->m_size = size;
+
+    if (LITEFX_FLAG_IS_SET(m_impl->m_flags, AccelerationStructureFlags::AllowCompaction))
+        m_impl->queuePostbuildInfoCommands(commandBuffer);
+}
+
 SharedPtr<const IBuffer> DirectX12BottomLevelAccelerationStructure::getBuffer() const noexcept
 {
     return std::static_pointer_cast<const IBuffer>(m_impl->m_buffer);
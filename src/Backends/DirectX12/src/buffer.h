@@ -33,6 +33,9 @@ namespace LiteFX::Rendering::Backends {
 		/// <inheritdoc />
 		BufferType type() const noexcept override;
 
+		/// <inheritdoc />
+		UInt64 offset() const noexcept override;
+
 		// IDeviceMemory interface.
 	public:
 		/// <inheritdoc />
@@ -105,17 +105,81 @@ public:
 		m_sharedResources.push_back(scratchBuffer);
 	}
 
+	inline Array<UInt64> buildAccelerationStructures(Span<DirectX12BottomLevelAccelerationStructure* const> blas, const SharedPtr<const IDirectX12Buffer> scratchBuffer, Span<const UInt64> scratchOffsets, const SharedPtr<const IDirectX12Buffer> buffer, Span<const UInt64> offsets)
+	{
+		if (scratchBuffer == nullptr) [[unlikely]]
+			throw ArgumentNotInitializedException("scratchBuffer");
+
+		if (buffer == nullptr) [[unlikely]]
+			throw ArgumentNotInitializedException("buffer");
+
+		if (scratchOffsets.size() != blas.size() || offsets.size() != blas.size()) [[unlikely]]
+			throw InvalidArgumentException("offsets", "The number of offsets ({0}) and scratch offsets ({1}) must match the number of acceleration structures ({2}).", offsets.size(), scratchOffsets.size(), blas.size());
+
+		// NOTE: DirectX 12 does not support building multiple acceleration structures with a single command, so we record one command per acceleration structure. As all of them write 
+		//       to distinct memory ranges, no barriers are required in between, so the driver is free to overlap them.
+		auto& device = m_queue.device();
+		Array<UInt64> sizes(blas.size());
+
+		for (size_t i{ 0 }; i < blas.size(); ++i)
+		{
+			auto& as = *blas[i];
+			UInt64 scratchSize;
+			device.computeAccelerationStructureSizes(as, sizes[i], scratchSize);
+
+			if ((offsets[i] % D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT) != 0 || (scratchOffsets[i] % D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT) != 0) [[unlikely]]
+				throw InvalidArgumentException("offsets", "The offset ({0}) and scratch offset ({1}) of the acceleration structure at index {2} must be aligned to {3} bytes.", offsets[i], scratchOffsets[i], i, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT);
+
+			if (buffer->size() < offsets[i] + sizes[i]) [[unlikely]]
+				throw ArgumentOutOfRangeException("buffer", 0ull, (UInt64)buffer->size(), offsets[i] + sizes[i], "The buffer does not contain enough memory after offset {0} to fully contain the acceleration structure at index {1}.", offsets[i], i);
+
+			if (scratchBuffer->size() < scratchOffsets[i] + scratchSize) [[unlikely]]
+				throw ArgumentOutOfRangeException("scratchBuffer", 0ull, (UInt64)scratchBuffer->size(), scratchOffsets[i] + scratchSize, "The scratch buffer does not contain enough memory after offset {0} to build the acceleration structure at index {1}.", scratchOffsets[i], i);
+
+			auto descriptions = as.buildInfo();
+
+			D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC blasDesc = {
+				.DestAccelerationStructureData = buffer->virtualAddress() + offsets[i],
+				.Inputs = {
+					.Type = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL,
+					.Flags = std::bit_cast<D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS>(as.flags()),
+					.NumDescs = static_cast<UInt32>(descriptions.size()),
+					.DescsLayout = D3D12_ELEMENTS_LAYOUT_ARRAY,
+					.pGeometryDescs = descriptions.data()
+				},
+				.ScratchAccelerationStructureData = scratchBuffer->virtualAddress() + scratchOffsets[i]
+			};
+
+			m_parent->handle()->BuildRaytracingAccelerationStructure(&blasDesc, 0, nullptr);
+		}
+
+		// Store the scratch buffer.
+		m_sharedResources.push_back(scratchBuffer);
+
+		return sizes;
+	}
+
 	inline void buildAccelerationStructure(DirectX12TopLevelAccelerationStructure& tlas, const SharedPtr<const IDirectX12Buffer> scratchBuffer, const IDirectX12Buffer& buffer, UInt64 offset, bool update)
 	{
 		if (scratchBuffer == nullptr) [[unlikely]]
 			throw ArgumentNotInitializedException("scratchBuffer");
 
-		// Create a buffer to store the instance build info.
-		auto buildInfo = tlas.buildInfo();
-		auto instanceBuffer = m_queue.device().factory().createBuffer(BufferType::Storage, ResourceHeap::Dynamic, sizeof(D3D12_RAYTRACING_INSTANCE_DESC) * buildInfo.size(), 1, ResourceUsage::AccelerationStructureBuildInput);
+		// Use the instance buffer of the TLAS, if it has one. Otherwise create a buffer to store the instance build info.
+		auto instanceBuffer = tlas.instanceBuffer();
+		D3D12_GPU_VIRTUAL_ADDRESS instanceAddress{ 0 };
+
+		if (instanceBuffer != nullptr)
+			instanceAddress = instanceBuffer->virtualAddress() + static_cast<UInt64>(tlas.firstInstance()) * sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
+		else
+		{
+			auto buildInfo = tlas.buildInfo();
+			auto buffer = m_queue.device().factory().createBuffer(BufferType::Storage, ResourceHeap::Dynamic, sizeof(D3D12_RAYTRACING_INSTANCE_DESC) * buildInfo.size(), 1, ResourceUsage::AccelerationStructureBuildInput);
 
-		// Map the instance buffer.
-		instanceBuffer->map(buildInfo.data(), sizeof(D3D12_RAYTRACING_INSTANCE_DESC) * buildInfo.size());
+			// Map the instance buffer.
+			buffer->map(buildInfo.data(), sizeof(D3D12_RAYTRACING_INSTANCE_DESC) * buildInfo.size());
+			instanceBuffer = asShared(std::move(buffer));
+			instanceAddress = instanceBuffer->virtualAddress();
+		}
 
 		// Build the TLAS.
 		D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC tlasDesc = {
@@ -123,9 +187,9 @@ public:
 			.Inputs = {
 				.Type = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL,
 				.Flags = std::bit_cast<D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS>(tlas.flags()),
-				.NumDescs = static_cast<UInt32>(tlas.instances().size()),
+				.NumDescs = tlas.instanceCount(),
 				.DescsLayout = D3D12_ELEMENTS_LAYOUT_ARRAY,
-				.InstanceDescs = instanceBuffer->virtualAddress()
+				.InstanceDescs = instanceAddress
 			},
 			.SourceAccelerationStructureData = update ? tlas.buffer()->virtualAddress() : 0ull,
 			.ScratchAccelerationStructureData = scratchBuffer->virtualAddress()
@@ -138,7 +202,7 @@ public:
 		m_parent->handle()->BuildRaytracingAccelerationStructure(&tlasDesc, 0, nullptr);
 
 		// Store the scratch buffer.
-		m_sharedResources.push_back(asShared(std::move(instanceBuffer)));
+		m_sharedResources.push_back(instanceBuffer);
 		m_sharedResources.push_back(scratchBuffer);
 	}
 };
@@ -480,6 +544,22 @@ void DirectX12CommandBuffer::bind(const DirectX12DescriptorSet& descriptorSet, c
 	m_impl->m_queue.device().bindDescriptorSet(*this, descriptorSet, pipeline);
 }
 
+void DirectX12CommandBuffer::bind(const DirectX12DescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets) const
+{
+	if (!dynamicOffsets.empty()) [[unlikely]]
+		throw RuntimeException("Dynamic descriptor offsets are not supported by the DirectX 12 backend.");
+
+	this->bind(descriptorSet);
+}
+
+void DirectX12CommandBuffer::bind(const DirectX12DescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets, const DirectX12PipelineState& pipeline) const noexcept
+{
+	if (!dynamicOffsets.empty()) [[unlikely]]
+		LITEFX_ERROR(DIRECTX12_LOG, "Dynamic descriptor offsets are not supported by the DirectX 12 backend. {0} offsets will be ignored.", dynamicOffsets.size());
+
+	m_impl->m_queue.device().bindDescriptorSet(*this, descriptorSet, pipeline);
+}
+
 void DirectX12CommandBuffer::bind(Span<const DirectX12DescriptorSet*> descriptorSets, const DirectX12PipelineState& pipeline) const noexcept
 {
 	std::ranges::for_each(descriptorSets | std::views::filter([](auto descriptorSet) { return descriptorSet != nullptr; }), [this](auto descriptorSet) { m_impl->m_queue.device().bindDescriptorSet(*this, *descriptorSet, *m_impl->m_lastPipeline); });
@@ -593,6 +673,15 @@ void DirectX12CommandBuffer::buildAccelerationStructure(DirectX12TopLevelAcceler
 	m_impl->buildAccelerationStructure(tlas, scratchBuffer, buffer, offset, false);
 }
 
+void DirectX12CommandBuffer::buildAccelerationStructures(Span<DirectX12BottomLevelAccelerationStructure* const> blas, const SharedPtr<const IDirectX12Buffer> scratchBuffer, Span<const UInt64> scratchOffsets, const SharedPtr<const IDirectX12Buffer> buffer, Span<const UInt64> offsets) const
+{
+	auto sizes = m_impl->buildAccelerationStructures(blas, scratchBuffer, scratchOffsets, buffer, offsets);
+
+	// Store the buffer and the offsets and emit the post-build info commands for acceleration structures that allow compaction.
+	for (size_t i{ 0 }; i < blas.size(); ++i)
+		blas[i]->updateState(*this, buffer, offsets[i], sizes[i]);
+}
+
 void DirectX12CommandBuffer::updateAccelerationStructure(DirectX12BottomLevelAccelerationStructure& blas, const SharedPtr<const IDirectX12Buffer> scratchBuffer, const IDirectX12Buffer& buffer, UInt64 offset) const
 {
 	m_impl->buildAccelerationStructure(blas, scratchBuffer, buffer, offset, true);
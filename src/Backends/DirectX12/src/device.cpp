@@ -693,13 +693,11 @@ void DirectX12Device::computeAccelerationStructureSizes(const DirectX12BottomLev
 
 void DirectX12Device::computeAccelerationStructureSizes(const DirectX12TopLevelAccelerationStructure& tlas, UInt64& bufferSize, UInt64& scratchSize, bool forUpdate) const 
 {
-	auto& instances = tlas.instances();
-
 	D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO prebuildInfo;
     D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS inputs = {
         .Type = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL,
         .Flags = std::bit_cast<D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS>(tlas.flags()),
-        .NumDescs = static_cast<UInt32>(instances.size()),
+        .NumDescs = tlas.instanceCount(),
         .DescsLayout = D3D12_ELEMENTS_LAYOUT_ARRAY
     };
 
@@ -15,6 +15,7 @@ public:
 private:
 	const DirectX12Device& m_device;
 	AllocatorPtr m_allocator;
+	MemoryTracker m_tracker;
 
 public:
 	DirectX12GraphicsFactoryImpl(DirectX12GraphicsFactory* parent, const DirectX12Device& device) :
@@ -32,6 +33,53 @@ public:
 		raiseIfFailed(D3D12MA::CreateAllocator(&allocatorDesc, &allocator), "Unable to create D3D12 memory allocator.");
 		m_allocator.reset(allocator, D3D12MADeleter{});
 	}
+
+public:
+	template <typename TResource>
+	TResource allocate(ResourceHeap heap, Optional<BufferType> type, UInt64 size, D3D12MA::ALLOCATION_DESC& allocationDesc, std::function<TResource()> allocate)
+	{
+		// The allocation record is stored in the private data of the allocation and released by the resource, when it gets destroyed.
+		auto allocation = m_tracker.track(heap, type, size);
+		allocationDesc.pPrivateData = allocation;
+		TResource resource;
+
+		try
+		{
+			resource = allocate();
+		}
+		catch (...)
+		{
+			MemoryTracker::release(allocation);
+			throw;
+		}
+
+		this->checkBudgets();
+		return resource;
+	}
+
+	Array<MemoryHeapBudget> budgets() const
+	{
+		// D3D12MA reports the budget of the local (video) memory segment group and the non-local (system) memory segment group.
+		D3D12MA::Budget localBudget, nonLocalBudget;
+		m_allocator->GetBudget(&localBudget, &nonLocalBudget);
+
+		return {
+			{ .Heap = 0, .DeviceLocal = true, .Usage = localBudget.UsageBytes, .Budget = localBudget.BudgetBytes },
+			{ .Heap = 1, .DeviceLocal = false, .Usage = nonLocalBudget.UsageBytes, .Budget = nonLocalBudget.BudgetBytes }
+		};
+	}
+
+	void checkBudgets()
+	{
+		// Only invoke the event, if there are subscribers to skip querying the budgets.
+		if (!m_parent->budgetExceeded)
+			return;
+
+		auto threshold = m_tracker.budgetThreshold();
+
+		for (const auto& budget : m_tracker.checkBudgets(this->budgets()))
+			m_parent->budgetExceeded.invoke(m_parent, { budget, threshold });
+	}
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -112,7 +160,7 @@ UniquePtr<IDirectX12Buffer> DirectX12GraphicsFactory::createBuffer(const String&
 		throw InvalidArgumentException("heap", "The buffer heap {0} is not supported.", heap);
 	}
 
-	return DirectX12Buffer::allocate(name, m_impl->m_allocator, type, elements, elementSize, elementAlignment, usage, resourceDesc, allocationDesc);
+	return m_impl->allocate<UniquePtr<IDirectX12Buffer>>(heap, type, resourceDesc.Width, allocationDesc, [&]() { return DirectX12Buffer::allocate(name, m_impl->m_allocator, type, elements, elementSize, elementAlignment, usage, resourceDesc, allocationDesc); });
 }
 
 UniquePtr<IDirectX12VertexBuffer> DirectX12GraphicsFactory::createVertexBuffer(const DirectX12VertexBufferLayout& layout, ResourceHeap heap, UInt32 elements, ResourceUsage usage) const
@@ -163,7 +211,7 @@ UniquePtr<IDirectX12VertexBuffer> DirectX12GraphicsFactory::createVertexBuffer(c
 		throw InvalidArgumentException("heap", "The buffer heap {0} is not supported.", heap);
 	}
 
-	return DirectX12VertexBuffer::allocate(name, layout, m_impl->m_allocator, elements, usage, resourceDesc, allocationDesc);
+	return m_impl->allocate<UniquePtr<IDirectX12VertexBuffer>>(heap, BufferType::Vertex, resourceDesc.Width, allocationDesc, [&]() { return DirectX12VertexBuffer::allocate(name, layout, m_impl->m_allocator, elements, usage, resourceDesc, allocationDesc); });
 }
 
 UniquePtr<IDirectX12IndexBuffer> DirectX12GraphicsFactory::createIndexBuffer(const DirectX12IndexBufferLayout& layout, ResourceHeap heap, UInt32 elements, ResourceUsage usage) const
@@ -214,7 +262,7 @@ UniquePtr<IDirectX12IndexBuffer> DirectX12GraphicsFactory::createIndexBuffer(con
 		throw InvalidArgumentException("heap", "The buffer heap {0} is not supported.", heap);
 	}
 
-	return DirectX12IndexBuffer::allocate(name, layout, m_impl->m_allocator, elements, usage, resourceDesc, allocationDesc);
+	return m_impl->allocate<UniquePtr<IDirectX12IndexBuffer>>(heap, BufferType::Index, resourceDesc.Width, allocationDesc, [&]() { return DirectX12IndexBuffer::allocate(name, layout, m_impl->m_allocator, elements, usage, resourceDesc, allocationDesc); });
 }
 
 UniquePtr<IDirectX12Image> DirectX12GraphicsFactory::createTexture(Format format, const Size3d& size, ImageDimensions dimension, UInt32 levels, UInt32 layers, MultiSamplingLevel samples, ResourceUsage usage) const
@@ -262,8 +310,13 @@ UniquePtr<IDirectX12Image> DirectX12GraphicsFactory::createTexture(const String&
 	};
 
 	D3D12MA::ALLOCATION_DESC allocationDesc { .HeapType = D3D12_HEAP_TYPE_DEFAULT };
+
+	// Query the size of the image upfront, so that it can be tracked.
+	auto allocationInfo = m_impl->m_device.handle()->GetResourceAllocationInfo2(0, 1, &resourceDesc, nullptr);
 	
-	return DirectX12Image::allocate(name, m_impl->m_device, m_impl->m_allocator, { width, height, depth }, format, dimension, levels, layers, samples, usage, resourceDesc, allocationDesc);
+	return m_impl->allocate<UniquePtr<IDirectX12Image>>(ResourceHeap::Resource, std::nullopt, allocationInfo.SizeInBytes, allocationDesc, [&]() -> UniquePtr<IDirectX12Image> { 
+		return DirectX12Image::allocate(name, m_impl->m_device, m_impl->m_allocator, { width, height, depth }, format, dimension, levels, layers, samples, usage, resourceDesc, allocationDesc);
+	});
 }
 
 Enumerable<UniquePtr<IDirectX12Image>> DirectX12GraphicsFactory::createTextures(UInt32 elements, Format format, const Size3d& size, ImageDimensions dimension, UInt32 levels, UInt32 layers, MultiSamplingLevel samples, ResourceUsage usage) const
@@ -300,4 +353,30 @@ UniquePtr<DirectX12BottomLevelAccelerationStructure> DirectX12GraphicsFactory::c
 UniquePtr<DirectX12TopLevelAccelerationStructure> DirectX12GraphicsFactory::createTopLevelAccelerationStructure(StringView name, AccelerationStructureFlags flags) const
 {
 	return makeUnique<DirectX12TopLevelAccelerationStructure>(flags, name);
-}
\ No newline at end of file
+}
+
+GraphicsMemoryStatistics DirectX12GraphicsFactory::memoryStatistics() const
+{
+	auto statistics = m_impl->m_tracker.statistics();
+	statistics.Budgets = m_impl->budgets();
+	return statistics;
+}
+
+String DirectX12GraphicsFactory::dumpMemoryAllocations() const
+{
+	WCHAR* json { nullptr };
+	m_impl->m_allocator->BuildStatsString(&json, TRUE);
+	auto result = Narrow(json);
+	m_impl->m_allocator->FreeStatsString(json);
+	return result;
+}
+
+Float DirectX12GraphicsFactory::memoryBudgetThreshold() const noexcept
+{
+	return m_impl->m_tracker.budgetThreshold();
+}
+
+void DirectX12GraphicsFactory::setMemoryBudgetThreshold(Float threshold)
+{
+	m_impl->m_tracker.setBudgetThreshold(threshold);
+}
@@ -49,7 +49,12 @@ DirectX12Image::DirectX12Image(const DirectX12Device& device, ComPtr<ID3D12Resou
 	}
 }
 
-DirectX12Image::~DirectX12Image() noexcept = default;
+DirectX12Image::~DirectX12Image() noexcept
+{
+	// Release the memory tracking record, if the image has been allocated by a graphics factory.
+	if (m_impl->m_allocation != nullptr)
+		MemoryTracker::release(static_cast<MemoryTracker::Allocation*>(m_impl->m_allocation->GetPrivateData()));
+}
 
 UInt32 DirectX12Image::elements() const noexcept
 {
@@ -191,6 +196,10 @@ UniquePtr<DirectX12Image> DirectX12Image::allocate(const String& name, const Dir
 	ComPtr<ID3D12Resource> resource;
 	D3D12MA::Allocation* allocation;
 	raiseIfFailed(allocator->CreateResource3(&allocationDesc, &resourceDesc, isDepthStencil ? D3D12_BARRIER_LAYOUT_DEPTH_STENCIL_READ : D3D12_BARRIER_LAYOUT_COMMON, nullptr, 0, nullptr, &allocation, IID_PPV_ARGS(&resource)), "Unable to create image resource.");
+
+	if (!name.empty())
+		allocation->SetName(Widen(name).c_str());
+
 	LITEFX_DEBUG(DIRECTX12_LOG, "Allocated image {0} with {1} bytes {{ Extent: {2}x{3} Px, Format: {4}, Levels: {5}, Layers: {6}, Samples: {8}, Usage: {7} }}", name.empty() ? std::format("{0}", reinterpret_cast<void*>(resource.Get())) : name, ::getSize(format) * extent.width() * extent.height(), extent.width(), extent.height(), format, levels, layers, usage, samples);
 	
 	return makeUnique<DirectX12Image>(device, std::move(resource), extent, format, dimension, levels, layers, samples, usage, allocator, AllocationPtr(allocation), name);
@@ -49,6 +49,21 @@ public:
 
 		return blob;
 	}
+
+	ComPtr<IDxcBlob> initialize(const ShaderArchive& archive)
+	{
+		// TODO: We share the library handle over the whole api by moving them to the device level at least.
+		ComPtr<IDxcLibrary> library;
+		raiseIfFailed(::DxcCreateInstance(CLSID_DxcLibrary, IID_PPV_ARGS(&library)), "Unable to access DirectX shader compiler library.");
+
+		// Copy the bytecode directly from the archive, so that the archive does not need to be kept alive.
+		m_entryPoint = archive.entry(m_fileName).EntryPoint;
+		auto bytecode = archive.bytecode(m_fileName);
+		ComPtr<IDxcBlobEncoding> blob;
+		raiseIfFailed(library->CreateBlobWithEncodingOnHeapCopy(bytecode.data(), static_cast<UINT32>(bytecode.size()), CP_ACP, &blob), "Unable to load shader {0} from archive {1}.", m_fileName, archive.fileName());
+
+		return blob;
+	}
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -67,6 +82,15 @@ DirectX12ShaderModule::DirectX12ShaderModule(const DirectX12Device& device, Shad
 	this->handle() = m_impl->initialize(stream);
 }
 
+DirectX12ShaderModule::DirectX12ShaderModule(const DirectX12Device& device, ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor) :
+	m_impl(makePimpl<DirectX12ShaderModuleImpl>(this, device, type, name, "main", shaderLocalDescriptor)), ComResource<IDxcBlob>(nullptr)
+{
+	if (archive == nullptr) [[unlikely]]
+		throw ArgumentNotInitializedException("archive", "The shader archive must be initialized.");
+
+	this->handle() = m_impl->initialize(*archive);
+}
+
 DirectX12ShaderModule::~DirectX12ShaderModule() noexcept = default;
 
 ShaderStage DirectX12ShaderModule::type() const noexcept
@@ -584,4 +584,9 @@ UniquePtr<DirectX12ShaderModule> DirectX12ShaderProgramBuilder::makeShaderModule
 {
     return makeUnique<DirectX12ShaderModule>(m_impl->m_device, type, stream, name, entryPoint, shaderLocalDescriptor);
 }
+
+UniquePtr<DirectX12ShaderModule> DirectX12ShaderProgramBuilder::makeShaderModule(ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor)
+{
+    return makeUnique<DirectX12ShaderModule>(m_impl->m_device, type, archive, name, shaderLocalDescriptor);
+}
 #endif // defined(LITEFX_BUILD_DEFINE_BUILDERS)
\ No newline at end of file
@@ -14,6 +14,8 @@ public:
 private:
     Array<Instance> m_instances { };
     AccelerationStructureFlags m_flags;
+    SharedPtr<const IDirectX12Buffer> m_instanceBuffer;
+    UInt32 m_firstInstance { }, m_instanceCount { }, m_builtInstances { };
     SharedPtr<const IDirectX12Buffer> m_buffer;
     UniquePtr<IDirectX12Buffer> m_postBuildBuffer, m_postBuildResults;
     UInt64 m_offset { }, m_size { };
@@ -27,6 +29,11 @@ public:
     }
 
 public:
+    inline UInt32 instanceCount() const noexcept
+    {
+        return m_instanceBuffer != nullptr ? m_instanceCount : static_cast<UInt32>(m_instances.size());
+    }
+
     Array<D3D12_RAYTRACING_INSTANCE_DESC> buildInfo() const
     {
         return m_instances | std::views::transform([](const Instance& instance) {
@@ -88,6 +95,8 @@ public:
     }
 };
 
+static_assert(sizeof(D3D12_RAYTRACING_INSTANCE_DESC) == sizeof(ITopLevelAccelerationStructure::PackedInstance), "The packed instance layout does not match the DirectX 12 instance layout.");
+
 // ------------------------------------------------------------------------------------------------
 // Shared interface.
 // ------------------------------------------------------------------------------------------------
@@ -153,6 +162,7 @@ void DirectX12TopLevelAccelerationStructure::build(const DirectX12CommandBuffer&
     m_impl->m_offset = offset;
     m_impl->m_buffer = buffer;
     m_impl->m_size = requiredMemory;
+    m_impl->m_builtInstances = m_impl->instanceCount();
 
     // If the acceleration structure allows for compaction, create a query pool in order to query the compacted size later.
     if (LITEFX_FLAG_IS_SET(m_impl->m_flags, AccelerationStructureFlags::AllowCompaction))
@@ -168,6 +178,9 @@ void DirectX12TopLevelAccelerationStructure::update(const DirectX12CommandBuffer
     if (!LITEFX_FLAG_IS_SET(m_impl->m_flags, AccelerationStructureFlags::AllowUpdate)) [[unlikely]]
         throw RuntimeException("The acceleration structure does not allow updates. Specify `AccelerationStructureFlags::AllowUpdate` during creation.");
 
+    if (m_impl->instanceCount() != m_impl->m_builtInstances) [[unlikely]]
+        throw RuntimeException("The number of instances changed from {0} to {1} since the acceleration structure has been built. Rebuild the acceleration structure instead of updating it.", m_impl->m_builtInstances, m_impl->instanceCount());
+
     // Validate the arguments and create the buffers if required.
     UInt64 requiredMemory, requiredScratchMemory;
     auto& device = static_cast<const DirectX12Queue&>(commandBuffer.queue()).device();
@@ -227,6 +240,7 @@ void DirectX12TopLevelAccelerationStructure::copy(const DirectX12CommandBuffer&
     destination.m_impl->m_offset = offset;
     destination.m_impl->m_buffer = buffer;
     destination.m_impl->m_size = requiredMemory;
+    destination.m_impl->m_builtInstances = m_impl->m_builtInstances;
 
     // Perform the update.
     commandBuffer.copyAccelerationStructure(*this, destination, compress);
@@ -237,7 +251,12 @@ void DirectX12TopLevelAccelerationStructure::copy(const DirectX12CommandBuffer&
 
     // Copy build data, if requested.
     if (copyBuildInfo)
+    {
         destination.m_impl->m_instances = m_impl->m_instances;
+        destination.m_impl->m_instanceBuffer = m_impl->m_instanceBuffer;
+        destination.m_impl->m_firstInstance = m_impl->m_firstInstance;
+        destination.m_impl->m_instanceCount = m_impl->m_instanceCount;
+    }
 }
 
 const Array<Instance>& DirectX12TopLevelAccelerationStructure::instances() const noexcept
@@ -250,12 +269,17 @@ void DirectX12TopLevelAccelerationStructure::addInstance(const Instance& instanc
     if (m_impl->m_buffer != nullptr) [[unlikely]]
         throw RuntimeException("An acceleration structure cannot be modified after buffers for it have been created.");
 
+    if (m_impl->m_instanceBuffer != nullptr) [[unlikely]]
+        throw RuntimeException("Instances cannot be added to an acceleration structure that reads its instances from an instance buffer.");
+
     m_impl->m_instances.push_back(instance);
 }
 
 void DirectX12TopLevelAccelerationStructure::clear() noexcept
 {
     m_impl->m_instances.clear();
+    m_impl->m_instanceBuffer = nullptr;
+    m_impl->m_firstInstance = m_impl->m_instanceCount = 0;
 }
 
 bool DirectX12TopLevelAccelerationStructure::remove(const Instance& instance) noexcept
@@ -269,6 +293,44 @@ bool DirectX12TopLevelAccelerationStructure::remove(const Instance& instance) no
     return false;
 }
 
+void DirectX12TopLevelAccelerationStructure::useInstanceBuffer(SharedPtr<const IDirectX12Buffer> buffer, UInt32 instances, UInt32 firstInstance)
+{
+    if (buffer == nullptr)
+    {
+        m_impl->m_instanceBuffer = nullptr;
+        m_impl->m_firstInstance = m_impl->m_instanceCount = 0;
+        return;
+    }
+
+    if (!m_impl->m_instances.empty()) [[unlikely]]
+        throw RuntimeException("An instance buffer cannot be used for an acceleration structure that already contains instances.");
+
+    if (buffer->alignedElementSize() != sizeof(D3D12_RAYTRACING_INSTANCE_DESC)) [[unlikely]]
+        throw InvalidArgumentException("buffer", "The elements of the instance buffer must be tightly packed instances of {0} bytes, but the aligned element size was {1} bytes.", sizeof(D3D12_RAYTRACING_INSTANCE_DESC), buffer->alignedElementSize());
+
+    if (static_cast<UInt64>(firstInstance) + instances > buffer->elements()) [[unlikely]]
+        throw ArgumentOutOfRangeException("instances", 0ull, static_cast<UInt64>(buffer->elements()), static_cast<UInt64>(firstInstance) + instances, "The instance buffer does not contain enough elements to read {0} instances, starting at instance {1}.", instances, firstInstance);
+
+    m_impl->m_instanceBuffer = buffer;
+    m_impl->m_firstInstance = firstInstance;
+    m_impl->m_instanceCount = instances;
+}
+
+SharedPtr<const IDirectX12Buffer> DirectX12TopLevelAccelerationStructure::instanceBuffer() const noexcept
+{
+    return m_impl->m_instanceBuffer;
+}
+
+UInt32 DirectX12TopLevelAccelerationStructure::firstInstance() const noexcept
+{
+    return m_impl->m_firstInstance;
+}
+
+UInt32 DirectX12TopLevelAccelerationStructure::instanceCount() const noexcept
+{
+    return m_impl->instanceCount();
+}
+
 Array<D3D12_RAYTRACING_INSTANCE_DESC> DirectX12TopLevelAccelerationStructure::buildInfo() const
 {
     return m_impl->buildInfo();
@@ -292,4 +354,19 @@ void DirectX12TopLevelAccelerationStructure::doUpdate(const ICommandBuffer& comm
 void DirectX12TopLevelAccelerationStructure::doCopy(const ICommandBuffer& commandBuffer, ITopLevelAccelerationStructure& destination, bool compress, SharedPtr<const IBuffer> buffer, UInt64 offset, bool copyBuildInfo) const
 {
     this->copy(dynamic_cast<const DirectX12CommandBuffer&>(commandBuffer), dynamic_cast<DirectX12TopLevelAccelerationStructure&>(destination), compress, std::dynamic_pointer_cast<const IDirectX12Buffer>(buffer), offset, copyBuildInfo);
+}
+
+void DirectX12TopLevelAccelerationStructure::doUseInstanceBuffer(SharedPtr<const IBuffer> buffer, UInt32 instances, UInt32 firstInstance)
+{
+    if (buffer == nullptr)
+        this->useInstanceBuffer(nullptr, instances, firstInstance);
+    else if (auto instanceBuffer = std::dynamic_pointer_cast<const IDirectX12Buffer>(buffer); instanceBuffer == nullptr) [[unlikely]]
+        throw InvalidArgumentException("buffer", "The instance buffer must be a DirectX 12 buffer.");
+    else
+        this->useInstanceBuffer(instanceBuffer, instances, firstInstance);
+}
+
+SharedPtr<const IBuffer> DirectX12TopLevelAccelerationStructure::getInstanceBuffer() const noexcept
+{
+    return std::static_pointer_cast<const IBuffer>(m_impl->m_instanceBuffer);
 }
\ No newline at end of file
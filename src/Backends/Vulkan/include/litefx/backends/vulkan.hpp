@@ -239,6 +239,8 @@ namespace LiteFX::Rendering::Backends {
     private:
         Array<std::pair<UInt32, VkAccelerationStructureGeometryKHR>> buildInfo() const;
         void updateState(const VulkanDevice* device, VkAccelerationStructureKHR handle) noexcept;
+        void updateState(SharedPtr<const IVulkanBuffer> buffer, UInt64 offset, UInt64 size);
+        void writeCompactedSize(const VulkanCommandBuffer& commandBuffer) const noexcept;
 
     private:
         SharedPtr<const IBuffer> getBuffer() const noexcept override;
@@ -310,6 +312,18 @@ namespace LiteFX::Rendering::Backends {
         /// <inheritdoc />
         virtual bool remove(const Instance& mesh) noexcept override;
 
+        /// <inheritdoc />
+        void useInstanceBuffer(SharedPtr<const IVulkanBuffer> buffer, UInt32 instances, UInt32 firstInstance = 0);
+
+        /// <inheritdoc />
+        SharedPtr<const IVulkanBuffer> instanceBuffer() const noexcept;
+
+        /// <inheritdoc />
+        UInt32 firstInstance() const noexcept override;
+
+        /// <inheritdoc />
+        UInt32 instanceCount() const noexcept override;
+
     private:
         Array<VkAccelerationStructureInstanceKHR> buildInfo() const noexcept;
         void updateState(const VulkanDevice* device, VkAccelerationStructureKHR handle) noexcept;
@@ -319,6 +333,8 @@ namespace LiteFX::Rendering::Backends {
         void doBuild(const ICommandBuffer& commandBuffer, SharedPtr<const IBuffer> scratchBuffer, SharedPtr<const IBuffer> buffer, UInt64 offset, UInt64 maxSize) override;
         void doUpdate(const ICommandBuffer& commandBuffer, SharedPtr<const IBuffer> scratchBuffer, SharedPtr<const IBuffer> buffer, UInt64 offset, UInt64 maxSize) override;
         void doCopy(const ICommandBuffer& commandBuffer, ITopLevelAccelerationStructure& destination, bool compress, SharedPtr<const IBuffer> buffer, UInt64 offset, bool copyBuildInfo) const override;
+        void doUseInstanceBuffer(SharedPtr<const IBuffer> buffer, UInt32 instances, UInt32 firstInstance) override;
+        SharedPtr<const IBuffer> getInstanceBuffer() const noexcept override;
     };
 
     /// <summary>
@@ -381,6 +397,22 @@ namespace LiteFX::Rendering::Backends {
         /// <inheritdoc />
         void transition(const IVulkanImage& image, UInt32 level, UInt32 levels, UInt32 layer, UInt32 layers, UInt32 plane, ResourceAccess accessBefore, ResourceAccess accessAfter, ImageLayout fromLayout, ImageLayout toLayout) override;
 
+    public:
+        /// <summary>
+        /// Inserts a transition for <paramref name="buffer" />, that transfers its ownership from one queue family to another.
+        /// </summary>
+        /// <remarks>
+        /// A queue family ownership transfer requires the same barrier to be executed twice: first on a queue of the source family (release) and afterwards on a queue of
+        /// the target family (acquire). Buffers that are not created with <see cref="ResourceUsage::Concurrent" /> are transferred automatically by 
+        /// <see cref="VulkanQueue" />, so this overload is only required for buffer accesses, that are not tracked by the command buffers.
+        /// </remarks>
+        /// <param name="buffer">The buffer resource to transition.</param>
+        /// <param name="accessBefore">The access types previously used to access the buffer.</param>
+        /// <param name="accessAfter">The access types the buffer is accessed with after the barrier.</param>
+        /// <param name="sourceQueueFamily">The index of the queue family that releases the ownership of the buffer.</param>
+        /// <param name="targetQueueFamily">The index of the queue family that acquires the ownership of the buffer.</param>
+        void transition(const IVulkanBuffer& buffer, ResourceAccess accessBefore, ResourceAccess accessAfter, UInt32 sourceQueueFamily, UInt32 targetQueueFamily);
+
     public:
         /// <summary>
         /// Adds the barrier to a command buffer and updates the resource target states.
@@ -420,6 +452,20 @@ namespace LiteFX::Rendering::Backends {
         /// <param name="entryPoint">The name of the module entry point.</param>
         /// <param name="shaderLocalDescriptor">The descriptor that binds shader-local data for ray-tracing shaders.</param>
         explicit VulkanShaderModule(const VulkanDevice& device, ShaderStage type, std::istream& stream, const String& name, const String& entryPoint = "main", const Optional<DescriptorBindingPoint>& shaderLocalDescriptor = std::nullopt);
+
+        /// <summary>
+        /// Initializes a new Vulkan shader module from a shader archive.
+        /// </summary>
+        /// <remarks>
+        /// The entry point is read from the archive. The module does not copy the bytecode, but keeps the archive alive until the bytecode is released.
+        /// </remarks>
+        /// <param name="device">The parent device, this shader module has been created from.</param>
+        /// <param name="type">The shader stage, this module is used in.</param>
+        /// <param name="archive">The shader archive that contains the module.</param>
+        /// <param name="name">The name of the module within the archive.</param>
+        /// <param name="shaderLocalDescriptor">The descriptor that binds shader-local data for ray-tracing shaders.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if the archive does not contain a module with the name <paramref name="name" />.</exception>
+        explicit VulkanShaderModule(const VulkanDevice& device, ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor = std::nullopt);
         VulkanShaderModule(const VulkanShaderModule&) noexcept = delete;
         VulkanShaderModule(VulkanShaderModule&&) noexcept = delete;
         virtual ~VulkanShaderModule() noexcept;
@@ -442,8 +488,40 @@ namespace LiteFX::Rendering::Backends {
         /// <summary>
         /// Returns the shader byte code.
         /// </summary>
+        /// <remarks>
+        /// Modules loaded from a file map the file into memory instead of reading it, so the returned view points into the mapped file. If the bytecode has been released
+        /// before, the file is mapped again. Modules loaded from a shader archive return a view into the archive.
+        /// </remarks>
         /// <returns>The shader byte code.</returns>
-        virtual const String& bytecode() const noexcept;
+        /// <exception cref="RuntimeException">Thrown, if the bytecode has been released and the shader file could not be mapped again.</exception>
+        /// <seealso cref="releaseBytecode" />
+        virtual StringView bytecode() const;
+
+        /// <summary>
+        /// Returns the hash of the shader byte code.
+        /// </summary>
+        /// <remarks>
+        /// The hash is computed when the module is loaded and remains valid after the bytecode has been released. It is used to look up cached reflection results.
+        /// </remarks>
+        /// <returns>The hash of the shader byte code.</returns>
+        virtual UInt64 bytecodeHash() const noexcept;
+
+        /// <summary>
+        /// Returns the size of the shader byte code in bytes.
+        /// </summary>
+        /// <returns>The size of the shader byte code in bytes.</returns>
+        virtual UInt64 bytecodeSize() const noexcept;
+
+        /// <summary>
+        /// Releases the shader byte code, if it is no longer required.
+        /// </summary>
+        /// <remarks>
+        /// The shader module handle does not depend on the bytecode, so it only needs to be kept for reflection. <see cref="VulkanShaderProgram::reflectPipelineLayout" />
+        /// releases the bytecode of all modules after their reflection results have been cached. Only bytecode that can be restored by <see cref="bytecode" /> is 
+        /// released, i.e., the file mapping of modules loaded from a file and the view into the archive of modules loaded from a shader archive. Modules loaded from 
+        /// a stream keep their bytecode.
+        /// </remarks>
+        virtual void releaseBytecode() const noexcept;
 
         /// <summary>
         /// Returns the shader stage creation info for convenience.
@@ -501,6 +579,54 @@ namespace LiteFX::Rendering::Backends {
         SharedPtr<IPipelineLayout> parsePipelineLayout() const override {
             return std::static_pointer_cast<IPipelineLayout>(this->reflectPipelineLayout());
         }
+
+    public:
+        /// <summary>
+        /// Reflects the shader module <paramref name="bytecode" /> and stores the result in the reflection cache, without creating a pipeline layout.
+        /// </summary>
+        /// <remarks>
+        /// Reflection results are cached per bytecode hash and shared between all shader programs. Calling <see cref="reflectPipelineLayout" /> only parses the SPIR-V of
+        /// modules that are not yet cached. Use this method to warm up the cache, for example from a build step that produces a cache file with <see cref="saveReflectionCache" />.
+        /// </remarks>
+        /// <param name="bytecode">The SPIR-V bytecode of the shader module.</param>
+        /// <exception cref="RuntimeException">Thrown, if the bytecode could not be reflected.</exception>
+        /// <seealso cref="reflectPipelineLayout" />
+        static void cacheReflection(StringView bytecode);
+
+        /// <summary>
+        /// Reads reflection results from <paramref name="stream" /> and adds them to the reflection cache.
+        /// </summary>
+        /// <remarks>
+        /// Loading a cache file on startup allows pipeline layouts to be created without parsing any SPIR-V. Entries that are already cached are not overwritten.
+        /// </remarks>
+        /// <param name="stream">The binary stream to read the cache from.</param>
+        /// <exception cref="RuntimeException">Thrown, if the stream does not contain a valid reflection cache of a supported version.</exception>
+        /// <seealso cref="saveReflectionCache" />
+        static void loadReflectionCache(std::istream& stream);
+
+        /// <summary>
+        /// Adds the precomputed reflection results stored in <paramref name="archive" /> to the reflection cache.
+        /// </summary>
+        /// <remarks>
+        /// If the archive does not contain any reflection data, the cache is not changed.
+        /// </remarks>
+        /// <param name="archive">The shader archive to read the reflection results from.</param>
+        /// <exception cref="RuntimeException">Thrown, if the reflection data of the archive is not a valid reflection cache of a supported version.</exception>
+        /// <seealso cref="ShaderArchive::reflectionData" />
+        static void loadReflectionCache(const ShaderArchive& archive);
+
+        /// <summary>
+        /// Writes all reflection results in the reflection cache to <paramref name="stream" /> in a compact binary format.
+        /// </summary>
+        /// <param name="stream">The binary stream to write the cache to.</param>
+        /// <exception cref="RuntimeException">Thrown, if the cache could not be written to the stream.</exception>
+        /// <seealso cref="loadReflectionCache" />
+        static void saveReflectionCache(std::ostream& stream);
+
+        /// <summary>
+        /// Removes all reflection results from the reflection cache.
+        /// </summary>
+        static void clearReflectionCache() noexcept;
     };
 
     /// <summary>
@@ -971,6 +1097,14 @@ namespace LiteFX::Rendering::Backends {
         /// <param name="commandBuffer">The command buffer to issue the bind command on.</param>
         /// <param name="descriptorSets">The descriptor sets to bind.</param>
         virtual void bind(const VulkanCommandBuffer& commandBuffer, Span<const VulkanDescriptorSet*> descriptorSets) const noexcept = 0;
+
+        /// <summary>
+        /// Binds a descriptor set that contains dynamic descriptors on a command buffer.
+        /// </summary>
+        /// <param name="commandBuffer">The command buffer to issue the bind command on.</param>
+        /// <param name="descriptorSet">The descriptor set to bind.</param>
+        /// <param name="dynamicOffsets">The offsets of the dynamic descriptors within the descriptor set.</param>
+        virtual void bind(const VulkanCommandBuffer& commandBuffer, const VulkanDescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets) const noexcept = 0;
     };
 
     /// <summary>
@@ -1125,6 +1259,12 @@ namespace LiteFX::Rendering::Backends {
 		/// <inheritdoc />
 		void bind(const VulkanDescriptorSet& descriptorSet, const VulkanPipelineState& pipeline) const noexcept override;
 
+        /// <inheritdoc />
+        void bind(const VulkanDescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets) const override;
+
+        /// <inheritdoc />
+        void bind(const VulkanDescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets, const VulkanPipelineState& pipeline) const noexcept override;
+
         /// <inheritdoc />
         void bind(Span<const VulkanDescriptorSet*> descriptorSets, const VulkanPipelineState& pipeline) const noexcept override;
 
@@ -1185,6 +1325,9 @@ namespace LiteFX::Rendering::Backends {
         /// <inheritdoc />
         void buildAccelerationStructure(VulkanTopLevelAccelerationStructure& tlas, const SharedPtr<const IVulkanBuffer> scratchBuffer, const IVulkanBuffer& buffer, UInt64 offset) const override;
 
+        /// <inheritdoc />
+        void buildAccelerationStructures(Span<VulkanBottomLevelAccelerationStructure* const> blas, const SharedPtr<const IVulkanBuffer> scratchBuffer, Span<const UInt64> scratchOffsets, const SharedPtr<const IVulkanBuffer> buffer, Span<const UInt64> offsets) const override;
+
         /// <inheritdoc />
         void updateAccelerationStructure(VulkanBottomLevelAccelerationStructure& blas, const SharedPtr<const IVulkanBuffer> scratchBuffer, const IVulkanBuffer& buffer, UInt64 offset) const override;
 
@@ -1201,7 +1344,22 @@ namespace LiteFX::Rendering::Backends {
         void traceRays(UInt32 width, UInt32 height, UInt32 depth, const ShaderBindingTableOffsets& offsets, const IVulkanBuffer& rayGenerationShaderBindingTable, const IVulkanBuffer* missShaderBindingTable, const IVulkanBuffer* hitShaderBindingTable, const IVulkanBuffer* callableShaderBindingTable) const noexcept override;
 
     private:
+        friend class VulkanQueue;
+        friend class VulkanRenderPass;
+
         void releaseSharedState() const override;
+
+        /// <summary>
+        /// Returns all buffers used by the command buffer, that are owned by a single queue family at a time.
+        /// </summary>
+        /// <returns>The exclusively shared buffers used by the command buffer.</returns>
+        Span<const IVulkanBuffer* const> exclusiveBuffers() const noexcept;
+
+        /// <summary>
+        /// Adds the exclusively shared buffers used by a secondary command buffer, that is executed by this command buffer.
+        /// </summary>
+        /// <param name="commandBuffer">The secondary command buffer.</param>
+        void inheritExclusiveBuffers(const VulkanCommandBuffer& commandBuffer) const;
     };
 
     /// <summary>
@@ -1371,6 +1529,9 @@ namespace LiteFX::Rendering::Backends {
 
         /// <inheritdoc />
         void bind(const VulkanCommandBuffer& commandBuffer, Span<const VulkanDescriptorSet*> descriptorSets) const noexcept override;
+
+        /// <inheritdoc />
+        void bind(const VulkanCommandBuffer& commandBuffer, const VulkanDescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets) const noexcept override;
     };
 
     /// <summary>
@@ -1417,6 +1578,9 @@ namespace LiteFX::Rendering::Backends {
 
         /// <inheritdoc />
         void bind(const VulkanCommandBuffer& commandBuffer, Span<const VulkanDescriptorSet*> descriptorSets) const noexcept override;
+
+        /// <inheritdoc />
+        void bind(const VulkanCommandBuffer& commandBuffer, const VulkanDescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets) const noexcept override;
     };
     
     /// <summary>
@@ -1485,6 +1649,225 @@ namespace LiteFX::Rendering::Backends {
 
         /// <inheritdoc />
         void bind(const VulkanCommandBuffer& commandBuffer, Span<const VulkanDescriptorSet*> descriptorSets) const noexcept override;
+
+        /// <inheritdoc />
+        void bind(const VulkanCommandBuffer& commandBuffer, const VulkanDescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets) const noexcept override;
+    };
+
+    /// <summary>
+    /// Allocates transient images and buffers into shared memory blocks, so that resources whose lifetimes within a frame do not overlap alias the same memory.
+    /// </summary>
+    /// <remarks>
+    /// Resources are created without any memory bound to them. Each resource declares the index of its first and last use within a frame. After all resources have been created,
+    /// calling <see cref="allocate" /> places them using a <see cref="TransientMemoryPlanner" />, allocates the shared memory blocks and binds the resources. Resources must not be
+    /// used before they have been allocated. In order to add more resources after allocation, the allocator must be cleared and all resources need to be re-created.
+    /// 
+    /// The contents of aliased memory are undefined whenever another resource has been used in between. Use <see cref="transition" /> to record the aliasing barriers before each 
+    /// resource is first used within a frame. Resources keep their memory alive, so they can safely outlive the allocator or a call to <see cref="clear" />.
+    /// </remarks>
+    /// <seealso cref="VulkanFrameBuffer" />
+    class LITEFX_VULKAN_API VulkanTransientAllocator final {
+        LITEFX_IMPLEMENTATION(VulkanTransientAllocatorImpl);
+
+    public:
+        /// <summary>
+        /// Initializes a new transient resource allocator.
+        /// </summary>
+        /// <param name="device">The device to allocate the resources on.</param>
+        explicit VulkanTransientAllocator(const VulkanDevice& device);
+        VulkanTransientAllocator(const VulkanTransientAllocator&) = delete;
+        VulkanTransientAllocator(VulkanTransientAllocator&&) = delete;
+        virtual ~VulkanTransientAllocator() noexcept;
+
+    public:
+        /// <summary>
+        /// Creates a transient texture, that is bound to shared memory when calling <see cref="allocate" />.
+        /// </summary>
+        /// <param name="name">The name of the texture.</param>
+        /// <param name="format">The format of the texture.</param>
+        /// <param name="size">The dimensions of the texture.</param>
+        /// <param name="dimension">The dimensionality of the texture.</param>
+        /// <param name="levels">The number of mip map levels of the texture.</param>
+        /// <param name="layers">The number of layers (slices) in this texture.</param>
+        /// <param name="samples">The number of samples of the texture.</param>
+        /// <param name="usage">The intended usage for the texture.</param>
+        /// <param name="firstUse">The index of the first use of the texture within a frame.</param>
+        /// <param name="lastUse">The index of the last use of the texture within a frame.</param>
+        /// <returns>The instance of the texture.</returns>
+        /// <exception cref="RuntimeException">Thrown, if the allocator has already been allocated.</exception>
+        SharedPtr<IVulkanImage> createTexture(const String& name, Format format, const Size3d& size, ImageDimensions dimension, UInt32 levels, UInt32 layers, MultiSamplingLevel samples, ResourceUsage usage, UInt32 firstUse, UInt32 lastUse);
+
+        /// <summary>
+        /// Creates a transient buffer, that is bound to shared memory when calling <see cref="allocate" />.
+        /// </summary>
+        /// <param name="name">The name of the buffer.</param>
+        /// <param name="type">The type of the buffer.</param>
+        /// <param name="elementSize">The size of an element in the buffer (in bytes).</param>
+        /// <param name="elements">The number of elements in the buffer.</param>
+        /// <param name="usage">The buffer usage.</param>
+        /// <param name="firstUse">The index of the first use of the buffer within a frame.</param>
+        /// <param name="lastUse">The index of the last use of the buffer within a frame.</param>
+        /// <returns>The instance of the buffer.</returns>
+        /// <exception cref="RuntimeException">Thrown, if the allocator has already been allocated.</exception>
+        SharedPtr<IVulkanBuffer> createBuffer(const String& name, BufferType type, size_t elementSize, UInt32 elements, ResourceUsage usage, UInt32 firstUse, UInt32 lastUse);
+
+        /// <summary>
+        /// Places all resources into shared memory blocks, allocates the blocks and binds the resources to them.
+        /// </summary>
+        /// <exception cref="RuntimeException">Thrown, if the allocator has already been allocated.</exception>
+        void allocate();
+
+        /// <summary>
+        /// Returns <c>true</c>, if the resources of the allocator have been allocated.
+        /// </summary>
+        /// <returns><c>true</c>, if the resources of the allocator have been allocated.</returns>
+        bool allocated() const noexcept;
+
+        /// <summary>
+        /// Releases all resources from the allocator, so that new resources can be created.
+        /// </summary>
+        void clear() noexcept;
+
+        /// <summary>
+        /// Records the aliasing barriers for all resources that are first used at <paramref name="use" /> and share their memory with other resources.
+        /// </summary>
+        /// <remarks>
+        /// Images are transitioned from an undefined layout into the layout frame buffer images are expected to be in (i.e., <see cref="ImageLayout::DepthRead" /> for depth/stencil
+        /// images and <see cref="ImageLayout::ShaderResource" /> for all other images). The synchronization scopes of the barrier must include the last use of the aliased resources.
+        /// </remarks>
+        /// <param name="barrier">The barrier to record the transitions into.</param>
+        /// <param name="use">The index of the use within the frame.</param>
+        void transition(VulkanBarrier& barrier, UInt32 use) const;
+
+        /// <summary>
+        /// Returns the memory statistics of the last allocation.
+        /// </summary>
+        /// <returns>The memory statistics of the last allocation.</returns>
+        const TransientMemoryStatistics& statistics() const noexcept;
+    };
+
+    /// <summary>
+    /// Sub-allocates many logical buffers from a few large Vulkan buffers.
+    /// </summary>
+    /// <remarks>
+    /// Each buffer created by a graphics factory owns its own `VkBuffer` and memory allocation. For many small buffers, such as per-object uniform buffers or the index buffers
+    /// of individual meshes, this wastes memory to alignment padding and causes frequent re-binding of buffers. A buffer arena instead creates large backing buffers (blocks) and 
+    /// returns views into them. A view implements <see cref="IVulkanBuffer" /> and returns the backing buffer from `handle` and its location within it from 
+    /// <see cref="IBuffer::offset" />, so it can be used for descriptor updates, vertex and index buffer bindings and transfers like any other buffer.
+    /// 
+    /// Allocations are placed using a <see cref="BufferSuballocator" />. Using <see cref="BufferArenaPolicy::FreeList" />, a view releases its range when it is destroyed. Using
+    /// <see cref="BufferArenaPolicy::Linear" />, ranges are only released by calling <see cref="reset" />, which is intended to be called once per frame, after the views of the 
+    /// frame are no longer in use by the device. Views keep their blocks alive, so they can safely outlive the arena.
+    /// 
+    /// Backing buffers are created with <see cref="ResourceUsage::Concurrent" />, as views of the same block may be used on different queues at the same time.
+    /// 
+    /// A linear uniform arena can serve as per-frame allocator for per-draw constants in combination with <see cref="DescriptorType::DynamicConstantBuffer" /> descriptors. Update
+    /// the descriptor once with any view of a block, then allocate and map one view per draw and bind the descriptor set with the view's <see cref="IBuffer::offset" /> as 
+    /// dynamic offset. This only works for views that share the backing buffer of the view the descriptor has been updated with, so the block size should be chosen large 
+    /// enough to hold the constants of a whole frame.
+    /// </remarks>
+    /// <seealso cref="BufferSuballocator" />
+    class LITEFX_VULKAN_API VulkanBufferArena final {
+        LITEFX_IMPLEMENTATION(VulkanBufferArenaImpl);
+
+    public:
+        /// <summary>
+        /// Initializes a new buffer arena.
+        /// </summary>
+        /// <param name="device">The device to allocate the backing buffers on.</param>
+        /// <param name="type">The type of the buffers allocated from the arena.</param>
+        /// <param name="heap">The heap to allocate the backing buffers from.</param>
+        /// <param name="blockSize">The size (in bytes) of each backing buffer.</param>
+        /// <param name="policy">The policy used to place buffers within the backing buffers.</param>
+        /// <param name="usage">The usage of the backing buffers.</param>
+        /// <param name="name">The name of the arena, which is used to name the backing buffers.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="blockSize" /> is <c>0</c>.</exception>
+        explicit VulkanBufferArena(const VulkanDevice& device, BufferType type, ResourceHeap heap, UInt64 blockSize, BufferArenaPolicy policy = BufferArenaPolicy::FreeList, ResourceUsage usage = ResourceUsage::Default, const String& name = "");
+        VulkanBufferArena(const VulkanBufferArena&) = delete;
+        VulkanBufferArena(VulkanBufferArena&&) = delete;
+        virtual ~VulkanBufferArena() noexcept;
+
+    public:
+        /// <summary>
+        /// Returns the type of the buffers allocated from the arena.
+        /// </summary>
+        /// <returns>The type of the buffers allocated from the arena.</returns>
+        BufferType type() const noexcept;
+
+        /// <summary>
+        /// Returns the heap the backing buffers are allocated from.
+        /// </summary>
+        /// <returns>The heap the backing buffers are allocated from.</returns>
+        ResourceHeap heap() const noexcept;
+
+        /// <summary>
+        /// Returns the policy used to place buffers within the backing buffers.
+        /// </summary>
+        /// <returns>The policy used to place buffers within the backing buffers.</returns>
+        BufferArenaPolicy policy() const noexcept;
+
+        /// <summary>
+        /// Returns the size (in bytes) of each backing buffer.
+        /// </summary>
+        /// <returns>The size of each backing buffer.</returns>
+        UInt64 blockSize() const noexcept;
+
+        /// <summary>
+        /// Returns the number of backing buffers allocated by the arena.
+        /// </summary>
+        /// <returns>The number of backing buffers allocated by the arena.</returns>
+        UInt32 blocks() const noexcept;
+
+        /// <summary>
+        /// Returns the number of bytes that are currently allocated from the backing buffers, excluding alignment padding.
+        /// </summary>
+        /// <returns>The number of bytes that are currently allocated from the backing buffers.</returns>
+        UInt64 usedMemory() const noexcept;
+
+        /// <summary>
+        /// Allocates a buffer from the arena.
+        /// </summary>
+        /// <remarks>
+        /// The elements of the buffer are aligned in the same way as for buffers created by the graphics factory. If no backing buffer has enough space left, a new one is 
+        /// allocated.
+        /// </remarks>
+        /// <param name="elementSize">The size of an element in the buffer (in bytes).</param>
+        /// <param name="elements">The number of elements in the buffer.</param>
+        /// <param name="name">The name of the buffer.</param>
+        /// <returns>A view of the allocated range.</returns>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if the buffer is larger than the block size.</exception>
+        UniquePtr<IVulkanBuffer> allocate(size_t elementSize, UInt32 elements = 1, const String& name = "");
+
+        /// <summary>
+        /// Allocates a vertex buffer from the arena.
+        /// </summary>
+        /// <param name="layout">The layout of the vertex buffer.</param>
+        /// <param name="elements">The number of vertices in the buffer.</param>
+        /// <param name="name">The name of the buffer.</param>
+        /// <returns>A view of the allocated range.</returns>
+        /// <exception cref="RuntimeException">Thrown, if the arena does not allocate vertex buffers.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if the buffer is larger than the block size.</exception>
+        UniquePtr<IVulkanVertexBuffer> allocateVertexBuffer(const VulkanVertexBufferLayout& layout, UInt32 elements = 1, const String& name = "");
+
+        /// <summary>
+        /// Allocates an index buffer from the arena.
+        /// </summary>
+        /// <param name="layout">The layout of the index buffer.</param>
+        /// <param name="elements">The number of indices in the buffer.</param>
+        /// <param name="name">The name of the buffer.</param>
+        /// <returns>A view of the allocated range.</returns>
+        /// <exception cref="RuntimeException">Thrown, if the arena does not allocate index buffers.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if the buffer is larger than the block size.</exception>
+        UniquePtr<IVulkanIndexBuffer> allocateIndexBuffer(const VulkanIndexBufferLayout& layout, UInt32 elements = 1, const String& name = "");
+
+        /// <summary>
+        /// Releases all buffers of a linear arena at once, so that their memory can be re-used.
+        /// </summary>
+        /// <remarks>
+        /// Views that have been allocated before remain valid objects, but their ranges are re-used by subsequent allocations. The backing buffers are kept.
+        /// </remarks>
+        /// <exception cref="RuntimeException">Thrown, if the arena does not use the <see cref="BufferArenaPolicy::Linear" /> policy.</exception>
+        void reset();
     };
 
     /// <summary>
@@ -1537,6 +1920,49 @@ namespace LiteFX::Rendering::Backends {
         /// <exception cref="InvalidArgumentException">Thrown, if the provided render target is not mapped to an image within the frame buffer.</exception>
         VkImageView imageView(const RenderTarget& renderTarget) const;
 
+        /// <summary>
+        /// Returns the size the images of the frame buffer have been allocated with.
+        /// </summary>
+        /// <remarks>
+        /// The capacity is at least as large as the frame buffer <see cref="size" />. Render passes only render into the top-left area of the images, that matches the size of the 
+        /// frame buffer. Shaders that sample frame buffer images need to scale their texture coordinates by the ratio between the size and the capacity.
+        /// </remarks>
+        /// <returns>The size the images of the frame buffer have been allocated with.</returns>
+        /// <seealso cref="setCapacityGranularity" />
+        const Size2d& capacity() const noexcept;
+
+        /// <summary>
+        /// Returns the granularity (in pixels) the capacity of the frame buffer is rounded up to.
+        /// </summary>
+        /// <returns>The granularity the capacity of the frame buffer is rounded up to.</returns>
+        UInt32 capacityGranularity() const noexcept;
+
+        /// <summary>
+        /// Sets the granularity (in pixels) the capacity of the frame buffer is rounded up to.
+        /// </summary>
+        /// <remarks>
+        /// By default, the granularity is one pixel, which means that the images are re-allocated whenever the frame buffer is resized. If a larger granularity (e.g., 256 pixels) 
+        /// is set, the images are only re-allocated, if the new size exceeds the capacity, or if the capacity would be more than twice as large as needed. This prevents re-allocating
+        /// all images multiple times per second, whilst a window is resized interactively. Images that are replaced are released after the graphics queue has finished all frames 
+        /// that were in flight when the frame buffer has been resized.
+        /// 
+        /// If the frame buffer does not yet contain any images, the capacity is updated immediately, otherwise the new granularity is applied with the next re-allocation.
+        /// </remarks>
+        /// <param name="granularity">The granularity the capacity of the frame buffer is rounded up to.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if the granularity is zero.</exception>
+        /// <seealso cref="capacity" />
+        void setCapacityGranularity(UInt32 granularity);
+
+        /// <summary>
+        /// Returns a counter that is incremented whenever the image views or render target mappings of the frame buffer change.
+        /// </summary>
+        /// <remarks>
+        /// Adding images, re-allocating them and changing render target mappings re-creates the image views of the frame buffer. Render passes cache the attachment state of 
+        /// a frame buffer and use the generation to detect, when the cached image view handles are no longer valid.
+        /// </remarks>
+        /// <returns>The current generation of the frame buffer.</returns>
+        UInt64 generation() const noexcept;
+
         // FrameBuffer interface.
     public:
         /// <inheritdoc />
@@ -1597,6 +2023,52 @@ namespace LiteFX::Rendering::Backends {
 
         /// <inheritdoc />
         void resize(const Size2d& renderArea) override;
+
+        // Transient images.
+    public:
+        /// <summary>
+        /// Adds a transient image, that shares its memory with other transient images whose lifetimes do not overlap.
+        /// </summary>
+        /// <remarks>
+        /// As all transient images share their memory, adding a transient image re-creates all other transient images of the frame buffer. Before a transient image is first used
+        /// within a frame, <see cref="transitionTransientImages" /> must be called to record the aliasing barriers.
+        /// </remarks>
+        /// <param name="name">The name of the image.</param>
+        /// <param name="format">The format of the image.</param>
+        /// <param name="firstUse">The index of the first use of the image within a frame, for example the index of the first render pass that writes to it.</param>
+        /// <param name="lastUse">The index of the last use of the image within a frame.</param>
+        /// <param name="samples">The number of samples of the image.</param>
+        /// <param name="usage">The usage flags for the image.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if another image with the same name has already been added.</exception>
+        /// <seealso cref="VulkanTransientAllocator" />
+        void addImage(const String& name, Format format, UInt32 firstUse, UInt32 lastUse, MultiSamplingLevel samples = MultiSamplingLevel::x1, ResourceUsage usage = ResourceUsage::FrameBufferImage);
+
+        /// <summary>
+        /// Adds a transient image for a render target, that shares its memory with other transient images whose lifetimes do not overlap.
+        /// </summary>
+        /// <param name="name">The name of the image.</param>
+        /// <param name="renderTarget">The render target to map the image to.</param>
+        /// <param name="firstUse">The index of the first use of the image within a frame, for example the index of the first render pass that writes to it.</param>
+        /// <param name="lastUse">The index of the last use of the image within a frame.</param>
+        /// <param name="samples">The number of samples of the image.</param>
+        /// <param name="usage">The usage flags for the image.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if another image with the same name has already been added.</exception>
+        /// <seealso cref="VulkanTransientAllocator" />
+        void addImage(const String& name, const RenderTarget& renderTarget, UInt32 firstUse, UInt32 lastUse, MultiSamplingLevel samples = MultiSamplingLevel::x1, ResourceUsage usage = ResourceUsage::FrameBufferImage);
+
+        /// <summary>
+        /// Records the aliasing barriers for all transient images that are first used at <paramref name="use" />.
+        /// </summary>
+        /// <param name="barrier">The barrier to record the transitions into.</param>
+        /// <param name="use">The index of the use within the frame.</param>
+        /// <seealso cref="VulkanTransientAllocator::transition" />
+        void transitionTransientImages(VulkanBarrier& barrier, UInt32 use) const;
+
+        /// <summary>
+        /// Returns the memory statistics of the transient images, i.e., the memory required with and without aliasing.
+        /// </summary>
+        /// <returns>The memory statistics of the transient images.</returns>
+        TransientMemoryStatistics transientMemoryStatistics() const noexcept;
     };
 
     /// <summary>
@@ -1679,6 +2151,26 @@ namespace LiteFX::Rendering::Backends {
         /// <returns>A reference to the queue's parent device.</returns>
         virtual const VulkanDevice& device() const noexcept;
 
+        /// <summary>
+        /// Returns the mode that describes how commands are recorded during the render pass.
+        /// </summary>
+        /// <remarks>
+        /// If the render pass has been built with <see cref="RenderPassRecordingMode::Parallel" />, this returns the mode that has been selected when building 
+        /// the render pass, i.e. either <see cref="RenderPassRecordingMode::Inline" /> or <see cref="RenderPassRecordingMode::Secondary" />.
+        /// </remarks>
+        /// <returns>The mode that describes how commands are recorded during the render pass.</returns>
+        virtual RenderPassRecordingMode recordingMode() const noexcept;
+
+        /// <summary>
+        /// Returns the inheritance info that is used to begin secondary command buffers on the active frame buffer of the render pass.
+        /// </summary>
+        /// <remarks>
+        /// The inheritance info is computed once for each frame buffer the render pass is executed on and only updated, if the frame buffer is resized.
+        /// </remarks>
+        /// <returns>The inheritance info that is used to begin secondary command buffers on the active frame buffer.</returns>
+        /// <exception cref="RuntimeException">Thrown, if the render pass has not been begun.</exception>
+        virtual const VkCommandBufferInheritanceRenderingInfo& inheritanceInfo() const;
+
         // RenderPass interface.
     public:
         /// <inheritdoc />
@@ -1875,6 +2367,19 @@ namespace LiteFX::Rendering::Backends {
 
         /// <inheritdoc />
         virtual UniquePtr<VulkanTopLevelAccelerationStructure> createTopLevelAccelerationStructure(StringView name, AccelerationStructureFlags flags = AccelerationStructureFlags::None) const override;
+
+    public:
+        /// <inheritdoc />
+        GraphicsMemoryStatistics memoryStatistics() const override;
+
+        /// <inheritdoc />
+        String dumpMemoryAllocations() const override;
+
+        /// <inheritdoc />
+        Float memoryBudgetThreshold() const noexcept override;
+
+        /// <inheritdoc />
+        void setMemoryBudgetThreshold(Float threshold) override;
     };
 
     /// <summary>
@@ -1939,6 +2444,36 @@ namespace LiteFX::Rendering::Backends {
         /// <returns>The indices of the queue families that support queue workloads specified by <paramref name="type" />.</returns>
         Enumerable<UInt32> queueFamilyIndices(QueueType type = QueueType::None) const noexcept;
 
+        /// <summary>
+        /// Returns a descriptor set layout that is shared between all layouts with the same description as <paramref name="layout" />.
+        /// </summary>
+        /// <remarks>
+        /// Two descriptor set layouts are considered equal, if they describe the same space and shader stages and all descriptors match in binding, type, count, element size
+        /// and static sampler state. If no equal layout is alive, <paramref name="layout" /> is stored and returned. The device only holds weak references, so a shared layout
+        /// is released as soon as the last pipeline layout that uses it is released. Pipeline layouts automatically intern their descriptor set layouts when they are created,
+        /// which allows descriptor sets and descriptor pools to be shared between pipelines with equal descriptor sets.
+        /// </remarks>
+        /// <param name="layout">The descriptor set layout to intern.</param>
+        /// <returns>The shared descriptor set layout that is equal to <paramref name="layout" />.</returns>
+        /// <exception cref="ArgumentNotInitializedException">Thrown, if <paramref name="layout" /> is not initialized.</exception>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="layout" /> has been created from another device.</exception>
+        SharedPtr<const VulkanDescriptorSetLayout> internDescriptorSetLayout(SharedPtr<const VulkanDescriptorSetLayout> layout) const;
+
+        /// <summary>
+        /// Returns a pipeline layout that is shared between all pipeline layouts with the same descriptor set layouts and push constant ranges as <paramref name="layout" />.
+        /// </summary>
+        /// <remarks>
+        /// Layouts returned from <see cref="VulkanShaderProgram::reflectPipelineLayout" /> are interned automatically. Layouts created using a 
+        /// <see cref="VulkanPipelineLayoutBuilder" /> can be passed to this method, to share them with other pipelines. Pipelines that share a layout can keep their descriptor
+        /// sets bound, when switching between them.
+        /// </remarks>
+        /// <param name="layout">The pipeline layout to intern.</param>
+        /// <returns>The shared pipeline layout that is equal to <paramref name="layout" />.</returns>
+        /// <exception cref="ArgumentNotInitializedException">Thrown, if <paramref name="layout" /> is not initialized.</exception>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="layout" /> has been created from another device.</exception>
+        /// <seealso cref="internDescriptorSetLayout" />
+        SharedPtr<VulkanPipelineLayout> internPipelineLayout(SharedPtr<VulkanPipelineLayout> layout) const;
+
         // GraphicsDevice interface.
     public:
         /// <inheritdoc />
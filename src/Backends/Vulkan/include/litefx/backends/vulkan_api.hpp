@@ -51,6 +51,7 @@ namespace LiteFX::Rendering::Backends {
     class VulkanRenderPipeline;
     class VulkanComputePipeline;
     class VulkanRayTracingPipeline;
+    class VulkanTransientAllocator;
     class VulkanFrameBuffer;
     class VulkanRenderPass;
     class VulkanSwapChain;
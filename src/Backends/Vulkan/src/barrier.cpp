@@ -4,7 +4,7 @@
 using namespace LiteFX::Rendering::Backends;
 
 using GlobalBarrier = Tuple<ResourceAccess, ResourceAccess>;
-using BufferBarrier = Tuple<ResourceAccess, ResourceAccess, const IVulkanBuffer&, UInt32>;
+using BufferBarrier = Tuple<ResourceAccess, ResourceAccess, const IVulkanBuffer&, UInt32, UInt32, UInt32>;
 using ImageBarrier = Tuple<ResourceAccess, ResourceAccess, const IVulkanImage&, Optional<ImageLayout>, ImageLayout, UInt32, UInt32, UInt32, UInt32, UInt32>;
 
 // ------------------------------------------------------------------------------------------------
@@ -71,12 +71,17 @@ void VulkanBarrier::wait(ResourceAccess accessBefore, ResourceAccess accessAfter
 
 void VulkanBarrier::transition(const IVulkanBuffer& buffer, ResourceAccess accessBefore, ResourceAccess accessAfter)
 {
-    m_impl->m_bufferBarriers.push_back({ accessBefore, accessAfter, buffer, std::numeric_limits<UInt32>::max() });
+    m_impl->m_bufferBarriers.push_back({ accessBefore, accessAfter, buffer, std::numeric_limits<UInt32>::max(), VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED });
 }
 
 void VulkanBarrier::transition(const IVulkanBuffer& buffer, UInt32 element, ResourceAccess accessBefore, ResourceAccess accessAfter)
 {
-    m_impl->m_bufferBarriers.push_back({ accessBefore, accessAfter, buffer, element });
+    m_impl->m_bufferBarriers.push_back({ accessBefore, accessAfter, buffer, element, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED });
+}
+
+void VulkanBarrier::transition(const IVulkanBuffer& buffer, ResourceAccess accessBefore, ResourceAccess accessAfter, UInt32 sourceQueueFamily, UInt32 targetQueueFamily)
+{
+    m_impl->m_bufferBarriers.push_back({ accessBefore, accessAfter, buffer, std::numeric_limits<UInt32>::max(), sourceQueueFamily, targetQueueFamily });
 }
 
 void VulkanBarrier::transition(const IVulkanImage& image, ResourceAccess accessBefore, ResourceAccess accessAfter, ImageLayout layout)
@@ -123,9 +128,10 @@ void VulkanBarrier::execute(const VulkanCommandBuffer& commandBuffer) const noex
             .srcAccessMask = Vk::getResourceAccess(std::get<0>(barrier)),
             .dstStageMask = syncAfter,
             .dstAccessMask = Vk::getResourceAccess(std::get<1>(barrier)),
-            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .srcQueueFamilyIndex = std::get<4>(barrier),
+            .dstQueueFamilyIndex = std::get<5>(barrier),
             .buffer = std::as_const(std::get<2>(barrier)).handle(),
+            .offset = std::get<2>(barrier).offset(),
             .size = std::get<2>(barrier).size()
         };
 	}) | std::ranges::to<Array<VkBufferMemoryBarrier2>>();
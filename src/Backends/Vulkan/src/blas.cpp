@@ -94,6 +94,22 @@ public:
             }
         }() | std::ranges::to<Array<std::pair<UInt32, VkAccelerationStructureGeometryKHR>>>();
     }
+
+    void resetQueryPool(const VulkanDevice& device)
+    {
+        if (m_queryPool == VK_NULL_HANDLE)
+        {
+            VkQueryPoolCreateInfo queryPoolInfo = {
+                .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+                .queryType = VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR,
+                .queryCount = 1
+            };
+
+            raiseIfFailed(::vkCreateQueryPool(device.handle(), &queryPoolInfo, nullptr, &m_queryPool), "Unable to create query pool for compaction size queries.");
+        }
+
+        ::vkResetQueryPool(device.handle(), m_queryPool, 0, 1);
+    }
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -167,20 +183,7 @@ void VulkanBottomLevelAccelerationStructure::build(const VulkanCommandBuffer& co
 
     // If the acceleration structure allows for compaction, create a query pool in order to query the compacted size later.
     if (LITEFX_FLAG_IS_SET(m_impl->m_flags, AccelerationStructureFlags::AllowCompaction))
-    {
-        if (m_impl->m_queryPool == VK_NULL_HANDLE)
-        {
-            VkQueryPoolCreateInfo queryPoolInfo = {
-                .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
-                .queryType = VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR,
-                .queryCount = 1
-            };
-
-            raiseIfFailed(::vkCreateQueryPool(device.handle(), &queryPoolInfo, nullptr, &m_impl->m_queryPool), "Unable to create query pool for compaction size queries.");
-        }
-
-        ::vkResetQueryPool(device.handle(), m_impl->m_queryPool, 0, 1);
-    }
+        m_impl->resetQueryPool(device);
 
     // Perform the build.
     commandBuffer.buildAccelerationStructure(*this, scratchBuffer, *buffer, offset);
@@ -307,7 +310,7 @@ void VulkanBottomLevelAccelerationStructure::copy(const VulkanCommandBuffer& com
     VkAccelerationStructureCreateInfoKHR info = {
         .sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR,
         .buffer = buffer->handle(),
-        .offset = offset,
+        .offset = buffer->offset() + offset,
         .size = requiredMemory[0],
         .type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR
     };
@@ -414,6 +417,22 @@ void VulkanBottomLevelAccelerationStructure::updateState(const VulkanDevice* dev
     this->handle() = handle;
 }
 
+void VulkanBottomLevelAccelerationStructure::updateState(SharedPtr<const IVulkanBuffer> buffer, UInt64 offset, UInt64 size)
+{
+    m_impl->m_offset = offset;
+    m_impl->m_buffer = buffer;
+    m_impl->m_size = size;
+
+    if (LITEFX_FLAG_IS_SET(m_impl->m_flags, AccelerationStructureFlags::AllowCompaction))
+        m_impl->resetQueryPool(*m_impl->m_device);
+}
+
+void VulkanBottomLevelAccelerationStructure::writeCompactedSize(const VulkanCommandBuffer& commandBuffer) const noexcept
+{
+    if (LITEFX_FLAG_IS_SET(m_impl->m_flags, AccelerationStructureFlags::AllowCompaction))
+        ::vkCmdWriteAccelerationStructuresProperties(commandBuffer.handle(), 1, &this->handle(), VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, m_impl->m_queryPool, 0);
+}
+
 SharedPtr<const IBuffer> VulkanBottomLevelAccelerationStructure::getBuffer() const noexcept
 {
     return std::static_pointer_cast<const IBuffer>(m_impl->m_buffer);
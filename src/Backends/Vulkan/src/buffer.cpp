@@ -1,4 +1,5 @@
 #include "buffer.h"
+#include <atomic>
 
 using namespace LiteFX::Rendering::Backends;
 
@@ -18,6 +19,7 @@ private:
 	VmaAllocation m_allocation;
 	ResourceUsage m_usage;
 	const VulkanDevice& m_device;
+	std::atomic<const VulkanQueue*> m_owner{ nullptr };
 
 public:
 	VulkanBufferImpl(VulkanBuffer* parent, BufferType type, UInt32 elements, size_t elementSize, size_t alignment, ResourceUsage usage, const VulkanDevice& device, const VmaAllocator& allocator, const VmaAllocation& allocation) :
@@ -39,6 +41,14 @@ VulkanBuffer::VulkanBuffer(VkBuffer buffer, BufferType type, UInt32 elements, si
 
 VulkanBuffer::~VulkanBuffer() noexcept
 {
+	// Release the memory tracking record, if the buffer has been allocated by a graphics factory.
+	if (m_impl->m_allocation != nullptr)
+	{
+		VmaAllocationInfo allocationInfo;
+		::vmaGetAllocationInfo(m_impl->m_allocator, m_impl->m_allocation, &allocationInfo);
+		MemoryTracker::release(static_cast<MemoryTracker::Allocation*>(allocationInfo.pUserData));
+	}
+
 	::vmaDestroyBuffer(m_impl->m_allocator, this->handle(), m_impl->m_allocation);
 	LITEFX_TRACE(VULKAN_LOG, "Destroyed buffer {0}", reinterpret_cast<void*>(this->handle()));
 }
@@ -48,6 +58,11 @@ BufferType VulkanBuffer::type() const noexcept
 	return m_impl->m_type;
 }
 
+UInt64 VulkanBuffer::offset() const noexcept
+{
+	return 0;
+}
+
 UInt32 VulkanBuffer::elements() const noexcept
 {
 	return m_impl->m_elements;
@@ -78,6 +93,22 @@ ResourceUsage VulkanBuffer::usage() const noexcept
 	return m_impl->m_usage;
 }
 
+const VulkanQueue* VulkanBuffer::owner() const noexcept
+{
+	return m_impl->m_owner.load();
+}
+
+void VulkanBuffer::setOwner(const VulkanQueue* queue) const noexcept
+{
+	m_impl->m_owner.store(queue);
+}
+
+bool VulkanBuffer::claim(const VulkanQueue* queue) const noexcept
+{
+	const VulkanQueue* unowned { nullptr };
+	return m_impl->m_owner.compare_exchange_strong(unowned, queue);
+}
+
 UInt64 VulkanBuffer::virtualAddress() const noexcept
 {
 	VkBufferDeviceAddressInfo info = {
@@ -130,6 +161,36 @@ void VulkanBuffer::map(Span<void*> data, size_t elementSize, UInt32 firstElement
 	std::ranges::for_each(data, [this, &elementSize, &write, i = firstElement](void* mem) mutable { this->map(mem, elementSize, i++, write); });
 }
 
+void VulkanBuffer::write(const void* const data, size_t size, UInt64 offset)
+{
+	if (offset + size > this->size()) [[unlikely]]
+		throw ArgumentOutOfRangeException("offset", "The range [{0}, {1}) exceeds the buffer memory of {2} bytes.", offset, offset + size, this->size());
+
+	char* buffer;		// A pointer to the whole (aligned) buffer memory.
+	raiseIfFailed(::vmaMapMemory(m_impl->m_allocator, m_impl->m_allocation, reinterpret_cast<void**>(&buffer)), "Unable to map buffer memory.");
+	auto result = ::memcpy_s(reinterpret_cast<void*>(buffer + offset), this->size() - offset, data, size);
+
+	::vmaUnmapMemory(m_impl->m_allocator, m_impl->m_allocation);
+
+	if (result != 0) [[unlikely]]
+		throw RuntimeException("Error mapping buffer to device memory: {#X}.", result);
+}
+
+void VulkanBuffer::read(void* data, size_t size, UInt64 offset) const
+{
+	if (offset + size > this->size()) [[unlikely]]
+		throw ArgumentOutOfRangeException("offset", "The range [{0}, {1}) exceeds the buffer memory of {2} bytes.", offset, offset + size, this->size());
+
+	char* buffer;		// A pointer to the whole (aligned) buffer memory.
+	raiseIfFailed(::vmaMapMemory(m_impl->m_allocator, m_impl->m_allocation, reinterpret_cast<void**>(&buffer)), "Unable to map buffer memory.");
+	auto result = ::memcpy_s(data, size, reinterpret_cast<const void*>(buffer + offset), size);
+
+	::vmaUnmapMemory(m_impl->m_allocator, m_impl->m_allocation);
+
+	if (result != 0) [[unlikely]]
+		throw RuntimeException("Error mapping buffer to device memory: {#X}.", result);
+}
+
 UniquePtr<IVulkanBuffer> VulkanBuffer::allocate(BufferType type, UInt32 elements, size_t elementSize, size_t alignment, ResourceUsage usage, const VulkanDevice& device, const VmaAllocator& allocator, const VkBufferCreateInfo& createInfo, const VmaAllocationCreateInfo& allocationInfo, VmaAllocationInfo* allocationResult)
 {
 	return VulkanBuffer::allocate("", type, elements, elementSize, alignment, usage, device, allocator, createInfo, allocationInfo, allocationResult);
@@ -141,6 +202,10 @@ UniquePtr<IVulkanBuffer> VulkanBuffer::allocate(const String& name, BufferType t
 	VmaAllocation allocation;
 
 	raiseIfFailed(::vmaCreateBuffer(allocator, &createInfo, &allocationInfo, &buffer, &allocation, allocationResult), "Unable to allocate buffer.");
+
+	if (!name.empty())
+		::vmaSetAllocationName(allocator, allocation, name.c_str());
+
 	LITEFX_DEBUG(VULKAN_LOG, "Allocated buffer {0} with {4} bytes {{ Type: {1}, Elements: {2}, Element Size: {3}, Usage: {5} }}", name.empty() ? std::format("{0}", reinterpret_cast<void*>(buffer)) : name, type, elements, elementSize, elements * elementSize, usage);
 
 	return makeUnique<VulkanBuffer>(buffer, type, elements, elementSize, alignment, usage, device, allocator, allocation, name);
@@ -191,6 +256,10 @@ UniquePtr<IVulkanVertexBuffer> VulkanVertexBuffer::allocate(const String& name,
 	VmaAllocation allocation;
 
 	raiseIfFailed(::vmaCreateBuffer(allocator, &createInfo, &allocationInfo, &buffer, &allocation, allocationResult), "Unable to allocate vertex buffer.");
+
+	if (!name.empty())
+		::vmaSetAllocationName(allocator, allocation, name.c_str());
+
 	LITEFX_DEBUG(VULKAN_LOG, "Allocated buffer {0} with {4} bytes {{ Type: {1}, Elements: {2}, Element Size: {3}, Usage: {5} }}", name.empty() ? std::format("{0}", reinterpret_cast<void*>(buffer)) : name, BufferType::Vertex, elements, layout.elementSize(), layout.elementSize() * elements, usage);
 
 	return makeUnique<VulkanVertexBuffer>(buffer, layout, elements, usage, device, allocator, allocation, name);
@@ -241,6 +310,10 @@ UniquePtr<IVulkanIndexBuffer> VulkanIndexBuffer::allocate(const String& name, co
 	VmaAllocation allocation;
 
 	raiseIfFailed(::vmaCreateBuffer(allocator, &createInfo, &allocationInfo, &buffer, &allocation, allocationResult), "Unable to allocate index buffer.");
+
+	if (!name.empty())
+		::vmaSetAllocationName(allocator, allocation, name.c_str());
+
 	LITEFX_DEBUG(VULKAN_LOG, "Allocated buffer {0} with {4} bytes {{ Type: {1}, Elements: {2}, Element Size: {3}, Usage: {5} }}", name.empty() ? std::format("{0}", reinterpret_cast<void*>(buffer)) : name, BufferType::Index, elements, layout.elementSize(), layout.elementSize() * elements, usage);
 
 	return makeUnique<VulkanIndexBuffer>(buffer, layout, elements, usage, device, allocator, allocation, name);
@@ -24,6 +24,9 @@ namespace LiteFX::Rendering::Backends {
 		/// <inheritdoc />
 		BufferType type() const noexcept override;
 
+		/// <inheritdoc />
+		UInt64 offset() const noexcept override;
+
 		// IDeviceMemory interface.
 	public:
 		/// <inheritdoc />
@@ -62,6 +65,47 @@ namespace LiteFX::Rendering::Backends {
 		void map(Span<void*> data, size_t elementSize, UInt32 firstElement = 0, bool write = true) override;
 
 		// VulkanBuffer.
+	public:
+		/// <summary>
+		/// Returns the queue that currently owns the buffer, or `nullptr`, if the buffer has not yet been used by any queue.
+		/// </summary>
+		/// <remarks>
+		/// Only buffers that are not created with <see cref="ResourceUsage::Concurrent" /> have an owner. The owner is managed by <see cref="VulkanQueue" />.
+		/// </remarks>
+		/// <returns>A pointer to the queue that currently owns the buffer.</returns>
+		const VulkanQueue* owner() const noexcept;
+
+		/// <summary>
+		/// Sets the queue that owns the buffer.
+		/// </summary>
+		/// <param name="queue">The queue that owns the buffer.</param>
+		void setOwner(const VulkanQueue* queue) const noexcept;
+
+		/// <summary>
+		/// Sets the queue that owns the buffer, if it is not yet owned by another queue.
+		/// </summary>
+		/// <param name="queue">The queue that claims the ownership of the buffer.</param>
+		/// <returns><c>true</c>, if the queue is the new owner of the buffer, <c>false</c> otherwise.</returns>
+		bool claim(const VulkanQueue* queue) const noexcept;
+
+		/// <summary>
+		/// Copies data into a byte range of the buffer memory, regardless of the element layout.
+		/// </summary>
+		/// <param name="data">The data to copy into the buffer.</param>
+		/// <param name="size">The number of bytes to copy.</param>
+		/// <param name="offset">The offset (in bytes) of the range within the buffer memory.</param>
+		/// <exception cref="ArgumentOutOfRangeException">Thrown, if the range exceeds the buffer memory.</exception>
+		void write(const void* const data, size_t size, UInt64 offset);
+
+		/// <summary>
+		/// Copies data from a byte range of the buffer memory, regardless of the element layout.
+		/// </summary>
+		/// <param name="data">The memory to copy the data into.</param>
+		/// <param name="size">The number of bytes to copy.</param>
+		/// <param name="offset">The offset (in bytes) of the range within the buffer memory.</param>
+		/// <exception cref="ArgumentOutOfRangeException">Thrown, if the range exceeds the buffer memory.</exception>
+		void read(void* data, size_t size, UInt64 offset) const;
+
 	public:
 		static UniquePtr<IVulkanBuffer> allocate(BufferType type, UInt32 elements, size_t elementSize, size_t alignment, ResourceUsage usage, const VulkanDevice& device, const VmaAllocator& allocator, const VkBufferCreateInfo& createInfo, const VmaAllocationCreateInfo& allocationInfo, VmaAllocationInfo* allocationResult = nullptr);
 		static UniquePtr<IVulkanBuffer> allocate(const String& name, BufferType type, UInt32 elements, size_t elementSize, size_t alignment, ResourceUsage usage, const VulkanDevice& device, const VmaAllocator& allocator, const VkBufferCreateInfo& createInfo, const VmaAllocationCreateInfo& allocationInfo, VmaAllocationInfo* allocationResult = nullptr);
@@ -0,0 +1,341 @@
+#include <litefx/backends/vulkan.hpp>
+#include "buffer.h"
+#include <mutex>
+
+using namespace LiteFX::Rendering::Backends;
+
+// ------------------------------------------------------------------------------------------------
+// Shared memory.
+// ------------------------------------------------------------------------------------------------
+
+// A backing buffer of an arena, together with the sub-allocator that places the views within it.
+struct VulkanBufferArenaBlock {
+    UniquePtr<IVulkanBuffer> Buffer;
+    VulkanBuffer* Memory { nullptr };
+    UniquePtr<BufferSuballocator> Allocator;
+};
+
+// Owns the backing buffers of an arena. Each view keeps a reference to the blocks, so that they are not released while the view is still alive.
+struct VulkanBufferArenaMemory {
+    std::mutex Mutex;
+    BufferArenaPolicy Policy;
+    Array<UniquePtr<VulkanBufferArenaBlock>> Blocks;
+};
+
+class VulkanBufferView : public virtual IVulkanBuffer, public Resource<VkBuffer>, public virtual StateResource {
+private:
+    SharedPtr<VulkanBufferArenaMemory> m_memory;
+    VulkanBufferArenaBlock& m_block;
+    UInt64 m_offset;
+    BufferType m_type;
+    UInt32 m_elements;
+    size_t m_elementSize, m_alignment;
+    ResourceUsage m_usage;
+
+public:
+    VulkanBufferView(SharedPtr<VulkanBufferArenaMemory> memory, VulkanBufferArenaBlock& block, UInt64 offset, BufferType type, UInt32 elements, size_t elementSize, size_t alignment, ResourceUsage usage, const String& name) :
+        Resource<VkBuffer>(block.Buffer->handle()), m_memory(std::move(memory)), m_block(block), m_offset(offset), m_type(type), m_elements(elements), m_elementSize(elementSize), m_alignment(alignment), m_usage(usage)
+    {
+        if (!name.empty())
+            this->name() = name;
+    }
+
+    VulkanBufferView(VulkanBufferView&&) = delete;
+    VulkanBufferView(const VulkanBufferView&) = delete;
+
+    virtual ~VulkanBufferView() noexcept
+    {
+        // NOTE: Linear arenas only release their memory when they are reset.
+        if (m_memory->Policy == BufferArenaPolicy::FreeList)
+        {
+            std::lock_guard<std::mutex> lock(m_memory->Mutex);
+            m_block.Allocator->free(m_offset);
+        }
+    }
+
+    // IBuffer interface.
+public:
+    BufferType type() const noexcept override
+    {
+        return m_type;
+    }
+
+    UInt64 offset() const noexcept override
+    {
+        return m_offset;
+    }
+
+    // IDeviceMemory interface.
+public:
+    UInt32 elements() const noexcept override
+    {
+        return m_elements;
+    }
+
+    size_t size() const noexcept override
+    {
+        return static_cast<size_t>(m_elements) * this->alignedElementSize();
+    }
+
+    size_t elementSize() const noexcept override
+    {
+        return m_elementSize;
+    }
+
+    size_t elementAlignment() const noexcept override
+    {
+        return m_alignment;
+    }
+
+    size_t alignedElementSize() const noexcept override
+    {
+        return m_alignment == 0 ? m_elementSize : (m_elementSize + m_alignment - 1) & ~(m_alignment - 1);
+    }
+
+    ResourceUsage usage() const noexcept override
+    {
+        return m_usage;
+    }
+
+    UInt64 virtualAddress() const noexcept override
+    {
+        return m_block.Buffer->virtualAddress() + m_offset;
+    }
+
+    // IMappable interface.
+private:
+    UInt64 rangeOffset(size_t size, UInt32 element) const
+    {
+        if (element >= m_elements) [[unlikely]]
+            throw ArgumentOutOfRangeException("element", 0u, m_elements, element, "The element {0} is out of range. The buffer only contains {1} elements.", element, m_elements);
+
+        // Prevent writes into the ranges of other views within the same block.
+        auto offset = static_cast<size_t>(element) * this->alignedElementSize();
+
+        if (offset + size > this->size()) [[unlikely]]
+            throw ArgumentOutOfRangeException("size", "Mapping {0} bytes at element {1} exceeds the buffer size of {2} bytes.", size, element, this->size());
+
+        return m_offset + offset;
+    }
+
+public:
+    void map(const void* const data, size_t size, UInt32 element = 0) override
+    {
+        m_block.Memory->write(data, size, this->rangeOffset(size, element));
+    }
+
+    void map(Span<const void* const> data, size_t elementSize, UInt32 firstElement = 0) override
+    {
+        std::ranges::for_each(data, [this, &elementSize, i = firstElement](const void* const mem) mutable { this->map(mem, elementSize, i++); });
+    }
+
+    void map(void* data, size_t size, UInt32 element = 0, bool write = true) override
+    {
+        if (write)
+            m_block.Memory->write(data, size, this->rangeOffset(size, element));
+        else
+            m_block.Memory->read(data, size, this->rangeOffset(size, element));
+    }
+
+    void map(Span<void*> data, size_t elementSize, UInt32 firstElement = 0, bool write = true) override
+    {
+        std::ranges::for_each(data, [this, &elementSize, &write, i = firstElement](void* mem) mutable { this->map(mem, elementSize, i++, write); });
+    }
+};
+
+class VulkanVertexBufferView final : public VulkanBufferView, public virtual IVulkanVertexBuffer {
+private:
+    const VulkanVertexBufferLayout& m_layout;
+
+public:
+    VulkanVertexBufferView(SharedPtr<VulkanBufferArenaMemory> memory, VulkanBufferArenaBlock& block, UInt64 offset, const VulkanVertexBufferLayout& layout, UInt32 elements, ResourceUsage usage, const String& name) :
+        VulkanBufferView(std::move(memory), block, offset, BufferType::Vertex, elements, layout.elementSize(), 0, usage, name), m_layout(layout)
+    {
+    }
+
+public:
+    const VulkanVertexBufferLayout& layout() const noexcept override
+    {
+        return m_layout;
+    }
+};
+
+class VulkanIndexBufferView final : public VulkanBufferView, public virtual IVulkanIndexBuffer {
+private:
+    const VulkanIndexBufferLayout& m_layout;
+
+public:
+    VulkanIndexBufferView(SharedPtr<VulkanBufferArenaMemory> memory, VulkanBufferArenaBlock& block, UInt64 offset, const VulkanIndexBufferLayout& layout, UInt32 elements, ResourceUsage usage, const String& name) :
+        VulkanBufferView(std::move(memory), block, offset, BufferType::Index, elements, layout.elementSize(), 0, usage, name), m_layout(layout)
+    {
+    }
+
+public:
+    const VulkanIndexBufferLayout& layout() const noexcept override
+    {
+        return m_layout;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class VulkanBufferArena::VulkanBufferArenaImpl : public Implement<VulkanBufferArena> {
+public:
+    friend class VulkanBufferArena;
+
+private:
+    const VulkanDevice& m_device;
+    BufferType m_type;
+    ResourceHeap m_heap;
+    UInt64 m_blockSize;
+    ResourceUsage m_usage;
+    String m_name;
+    SharedPtr<VulkanBufferArenaMemory> m_memory;
+
+public:
+    VulkanBufferArenaImpl(VulkanBufferArena* parent, const VulkanDevice& device, BufferType type, ResourceHeap heap, UInt64 blockSize, BufferArenaPolicy policy, ResourceUsage usage, const String& name) :
+        base(parent), m_device(device), m_type(type), m_heap(heap), m_blockSize(blockSize), m_usage(usage), m_name(name), m_memory(makeShared<VulkanBufferArenaMemory>())
+    {
+        m_memory->Policy = policy;
+    }
+
+public:
+    size_t elementAlignment() const noexcept
+    {
+        // NOTE: Use the same alignment as the factory, so that views can be used in place of regular buffers.
+        const auto& limits = m_device.adapter().limits();
+
+        switch (m_type)
+        {
+        case BufferType::Uniform:
+        case BufferType::AccelerationStructure:
+            return static_cast<size_t>(limits.minUniformBufferOffsetAlignment);
+        case BufferType::Storage:
+        case BufferType::ShaderBindingTable:
+        case BufferType::Indirect:
+            return static_cast<size_t>(limits.minStorageBufferOffsetAlignment);
+        case BufferType::Texel:
+            return static_cast<size_t>(limits.minTexelBufferOffsetAlignment);
+        default:
+            return 0;
+        }
+    }
+
+    std::pair<VulkanBufferArenaBlock*, UInt64> allocate(size_t size, size_t alignment)
+    {
+        // Index buffer offsets must be a multiple of the index size and buffer-image copies require a multiple of 4 bytes, so views are never placed at smaller alignments.
+        auto rangeAlignment = std::max<UInt64>(alignment, 4);
+
+        if (size > m_blockSize) [[unlikely]]
+            throw ArgumentOutOfRangeException("elements", "The buffer requires {0} bytes, which exceeds the block size of {1} bytes.", size, m_blockSize);
+
+        std::lock_guard<std::mutex> lock(m_memory->Mutex);
+
+        for (auto& block : m_memory->Blocks)
+        {
+            if (auto offset = block->Allocator->allocate(size, rangeAlignment); offset.has_value())
+                return { block.get(), *offset };
+        }
+
+        // Allocate a new backing buffer. Views of the same block may be used by different queues, so the backing buffers are always shared between queue families.
+        auto blockName = m_name.empty() ? String{} : std::format("{0} Block {1}", m_name, m_memory->Blocks.size());
+        auto buffer = m_device.factory().createBuffer(blockName, m_type, m_heap, m_blockSize, 1, m_usage | ResourceUsage::Concurrent);
+        auto memory = dynamic_cast<VulkanBuffer*>(buffer.get());
+
+        if (memory == nullptr) [[unlikely]]
+            throw RuntimeException("The backing buffer of the arena has not been allocated by the graphics factory.");
+
+        auto& block = m_memory->Blocks.emplace_back(makeUnique<VulkanBufferArenaBlock>(std::move(buffer), memory, makeUnique<BufferSuballocator>(m_blockSize, m_memory->Policy)));
+        LITEFX_DEBUG(VULKAN_LOG, "Allocated block {0} of buffer arena {1} with {2} bytes {{ Type: {3}, Policy: {4} }}", m_memory->Blocks.size() - 1, m_name.empty() ? std::format("{0}", static_cast<const void*>(this)) : m_name, m_blockSize, m_type, m_memory->Policy);
+
+        auto offset = block->Allocator->allocate(size, rangeAlignment);
+
+        if (!offset.has_value()) [[unlikely]]
+            throw RuntimeException("Unable to allocate {0} bytes from a new block of buffer arena {1}.", size, m_name);
+
+        return { block.get(), offset.value() };
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+VulkanBufferArena::VulkanBufferArena(const VulkanDevice& device, BufferType type, ResourceHeap heap, UInt64 blockSize, BufferArenaPolicy policy, ResourceUsage usage, const String& name) :
+    m_impl(makePimpl<VulkanBufferArenaImpl>(this, device, type, heap, blockSize, policy, usage, name))
+{
+    if (blockSize == 0) [[unlikely]]
+        throw InvalidArgumentException("blockSize", "The block size of a buffer arena must not be 0.");
+}
+
+VulkanBufferArena::~VulkanBufferArena() noexcept = default;
+
+BufferType VulkanBufferArena::type() const noexcept
+{
+    return m_impl->m_type;
+}
+
+ResourceHeap VulkanBufferArena::heap() const noexcept
+{
+    return m_impl->m_heap;
+}
+
+BufferArenaPolicy VulkanBufferArena::policy() const noexcept
+{
+    return m_impl->m_memory->Policy;
+}
+
+UInt64 VulkanBufferArena::blockSize() const noexcept
+{
+    return m_impl->m_blockSize;
+}
+
+UInt32 VulkanBufferArena::blocks() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_memory->Mutex);
+    return static_cast<UInt32>(m_impl->m_memory->Blocks.size());
+}
+
+UInt64 VulkanBufferArena::usedMemory() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_memory->Mutex);
+    return std::ranges::fold_left(m_impl->m_memory->Blocks | std::views::transform([](const auto& block) { return block->Allocator->used(); }), 0ull, std::plus<>{});
+}
+
+UniquePtr<IVulkanBuffer> VulkanBufferArena::allocate(size_t elementSize, UInt32 elements, const String& name)
+{
+    auto alignment = m_impl->elementAlignment();
+    auto alignedSize = alignment == 0 ? elementSize : (elementSize + alignment - 1) & ~(alignment - 1);
+    auto [block, offset] = m_impl->allocate(alignedSize * elements, alignment);
+
+    return makeUnique<VulkanBufferView>(m_impl->m_memory, *block, offset, m_impl->m_type, elements, elementSize, alignment, m_impl->m_usage | ResourceUsage::Concurrent, name);
+}
+
+UniquePtr<IVulkanVertexBuffer> VulkanBufferArena::allocateVertexBuffer(const VulkanVertexBufferLayout& layout, UInt32 elements, const String& name)
+{
+    if (m_impl->m_type != BufferType::Vertex) [[unlikely]]
+        throw RuntimeException("Unable to allocate a vertex buffer from an arena for buffers of type {0}.", m_impl->m_type);
+
+    auto [block, offset] = m_impl->allocate(layout.elementSize() * elements, 0);
+    return makeUnique<VulkanVertexBufferView>(m_impl->m_memory, *block, offset, layout, elements, m_impl->m_usage | ResourceUsage::Concurrent, name);
+}
+
+UniquePtr<IVulkanIndexBuffer> VulkanBufferArena::allocateIndexBuffer(const VulkanIndexBufferLayout& layout, UInt32 elements, const String& name)
+{
+    if (m_impl->m_type != BufferType::Index) [[unlikely]]
+        throw RuntimeException("Unable to allocate an index buffer from an arena for buffers of type {0}.", m_impl->m_type);
+
+    auto [block, offset] = m_impl->allocate(layout.elementSize() * elements, 0);
+    return makeUnique<VulkanIndexBufferView>(m_impl->m_memory, *block, offset, layout, elements, m_impl->m_usage | ResourceUsage::Concurrent, name);
+}
+
+void VulkanBufferArena::reset()
+{
+    if (m_impl->m_memory->Policy != BufferArenaPolicy::Linear) [[unlikely]]
+        throw RuntimeException("Only linear buffer arenas can be reset. Release the individual buffers instead.");
+
+    std::lock_guard<std::mutex> lock(m_impl->m_memory->Mutex);
+    std::ranges::for_each(m_impl->m_memory->Blocks, [](auto& block) { block->Allocator->reset(); });
+}
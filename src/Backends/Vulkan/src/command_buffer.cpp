@@ -24,6 +24,7 @@ private:
 	bool m_recording{ false }, m_secondary{ false };
 	VkCommandPool m_commandPool;
 	Array<SharedPtr<const IStateResource>> m_sharedResources;
+	Array<const IVulkanBuffer*> m_exclusiveBuffers;
 	const VulkanPipelineState* m_lastPipeline = nullptr;
 
 public:
@@ -38,6 +39,14 @@ public:
 	}
 
 public:
+	inline void track(const IVulkanBuffer& buffer)
+	{
+		// Remember buffers that are owned by a single queue family, so that the queue can acquire their ownership before the command buffer gets executed. Buffers 
+		// are usually bound multiple times in a row (e.g., vertex buffers for subsequent draw calls), so only check for direct repetitions here.
+		if (!LITEFX_FLAG_IS_SET(buffer.usage(), ResourceUsage::Concurrent) && (m_exclusiveBuffers.empty() || m_exclusiveBuffers.back() != &buffer))
+			m_exclusiveBuffers.push_back(&buffer);
+	}
+
 	void release() 
 	{
 		::vkFreeCommandBuffers(m_queue.device().handle(), m_commandPool, 1, &m_parent->handle());
@@ -87,7 +96,7 @@ public:
 		VkAccelerationStructureCreateInfoKHR info = {
 			.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR,
 			.buffer = buffer.handle(),
-			.offset = offset,
+			.offset = buffer.offset() + offset,
 			.size = size,
 			.type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR
 		};
@@ -122,20 +131,109 @@ public:
 		m_sharedResources.push_back(scratchBuffer);
 	}
 
+	inline Array<UInt64> buildAccelerationStructures(Span<VulkanBottomLevelAccelerationStructure* const> blas, const SharedPtr<const IVulkanBuffer> scratchBuffer, Span<const UInt64> scratchOffsets, const SharedPtr<const IVulkanBuffer> buffer, Span<const UInt64> offsets)
+	{
+		if (scratchBuffer == nullptr) [[unlikely]]
+			throw ArgumentNotInitializedException("scratchBuffer");
+
+		if (buffer == nullptr) [[unlikely]]
+			throw ArgumentNotInitializedException("buffer");
+
+		if (scratchOffsets.size() != blas.size() || offsets.size() != blas.size()) [[unlikely]]
+			throw InvalidArgumentException("offsets", "The number of offsets ({0}) and scratch offsets ({1}) must match the number of acceleration structures ({2}).", offsets.size(), scratchOffsets.size(), blas.size());
+
+		// Create the acceleration structure handles and collect the build infos for all acceleration structures.
+		auto& device = m_queue.device();
+		const auto count = blas.size();
+		Array<UInt64> sizes(count);
+		Array<Array<VkAccelerationStructureGeometryKHR>> descriptions(count);
+		Array<Array<VkAccelerationStructureBuildRangeInfoKHR>> ranges(count);
+		Array<const VkAccelerationStructureBuildRangeInfoKHR*> rangePointers(count);
+		Array<VkAccelerationStructureBuildGeometryInfoKHR> inputs(count);
+
+		for (size_t i{ 0 }; i < count; ++i)
+		{
+			auto& as = *blas[i];
+			UInt64 scratchSize;
+			device.computeAccelerationStructureSizes(as, sizes[i], scratchSize);
+
+			// NOTE: 256 bytes is the hard requirement for acceleration structure offsets and the upper bound for `minAccelerationStructureScratchOffsetAlignment`.
+			if ((offsets[i] % 256) != 0 || (scratchOffsets[i] % 256) != 0) [[unlikely]]
+				throw InvalidArgumentException("offsets", "The offset ({0}) and scratch offset ({1}) of the acceleration structure at index {2} must be aligned to {3} bytes.", offsets[i], scratchOffsets[i], i, 256);
+
+			if (buffer->size() < offsets[i] + sizes[i]) [[unlikely]]
+				throw ArgumentOutOfRangeException("buffer", 0ull, (UInt64)buffer->size(), offsets[i] + sizes[i], "The buffer does not contain enough memory after offset {0} to fully contain the acceleration structure at index {1}.", offsets[i], i);
+
+			if (scratchBuffer->size() < scratchOffsets[i] + scratchSize) [[unlikely]]
+				throw ArgumentOutOfRangeException("scratchBuffer", 0ull, (UInt64)scratchBuffer->size(), scratchOffsets[i] + scratchSize, "The scratch buffer does not contain enough memory after offset {0} to build the acceleration structure at index {1}.", scratchOffsets[i], i);
+
+			VkAccelerationStructureKHR handle;
+			VkAccelerationStructureCreateInfoKHR info = {
+				.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR,
+				.buffer = buffer->handle(),
+				.offset = buffer->offset() + offsets[i],
+				.size = sizes[i],
+				.type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR
+			};
+
+			raiseIfFailed(::vkCreateAccelerationStructure(device.handle(), &info, nullptr, &handle), "Unable to update acceleration structure handle.");
+
+			auto buildInfo = as.buildInfo();
+			descriptions[i] = buildInfo | std::views::values | std::ranges::to<Array<VkAccelerationStructureGeometryKHR>>();
+			ranges[i] = buildInfo | std::views::keys |
+				std::views::transform([](UInt32 primitives) { return VkAccelerationStructureBuildRangeInfoKHR { .primitiveCount = primitives }; }) |
+				std::ranges::to<Array<VkAccelerationStructureBuildRangeInfoKHR>>();
+			rangePointers[i] = ranges[i].data();
+
+			inputs[i] = {
+				.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR,
+				.type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR,
+				.flags = std::bit_cast<VkBuildAccelerationStructureFlagsKHR>(as.flags()),
+				.mode = VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR,
+				.dstAccelerationStructure = handle,
+				.geometryCount = static_cast<UInt32>(descriptions[i].size()),
+				.pGeometries = descriptions[i].data(),
+				.scratchData = scratchBuffer->virtualAddress() + scratchOffsets[i]
+			};
+
+			// Store the acceleration structure handle.
+			as.updateState(&device, handle);
+		}
+
+		// Build all acceleration structures with a single command.
+		if (count > 0)
+			::vkCmdBuildAccelerationStructures(m_parent->handle(), static_cast<UInt32>(count), inputs.data(), rangePointers.data());
+
+		// Store the scratch buffer.
+		m_sharedResources.push_back(scratchBuffer);
+
+		return sizes;
+	}
+
 	inline void buildAccelerationStructure(VulkanTopLevelAccelerationStructure& tlas, const SharedPtr<const IVulkanBuffer> scratchBuffer, const IVulkanBuffer& buffer, UInt64 offset, bool update)
 	{
 		if (scratchBuffer == nullptr) [[unlikely]]
 			throw ArgumentNotInitializedException("scratchBuffer");
 
-		// Create a buffer to store the instance data.
+		// Use the instance buffer of the TLAS, if it has one. Otherwise create a buffer to store the instance data.
 		auto& device = m_queue.device();
-		auto buildInfo = tlas.buildInfo();
-		auto instanceBuffer = device.factory().createBuffer(BufferType::Storage, ResourceHeap::Dynamic, sizeof(VkAccelerationStructureInstanceKHR) * buildInfo.size(), 1, ResourceUsage::AccelerationStructureBuildInput);
+		auto instanceBuffer = tlas.instanceBuffer();
+		UInt64 instanceAddress{ 0 };
+
+		if (instanceBuffer != nullptr)
+			instanceAddress = instanceBuffer->virtualAddress() + static_cast<UInt64>(tlas.firstInstance()) * sizeof(VkAccelerationStructureInstanceKHR);
+		else
+		{
+			auto buildInfo = tlas.buildInfo();
+			auto buffer = device.factory().createBuffer(BufferType::Storage, ResourceHeap::Dynamic, sizeof(VkAccelerationStructureInstanceKHR) * buildInfo.size(), 1, ResourceUsage::AccelerationStructureBuildInput);
 
-		// Map the instance buffer.
-		instanceBuffer->map(buildInfo.data(), sizeof(VkAccelerationStructureInstanceKHR) * buildInfo.size());
+			// Map the instance buffer.
+			buffer->map(buildInfo.data(), sizeof(VkAccelerationStructureInstanceKHR) * buildInfo.size());
+			instanceBuffer = asShared(std::move(buffer));
+			instanceAddress = instanceBuffer->virtualAddress();
+		}
 
-		VkAccelerationStructureBuildRangeInfoKHR ranges { static_cast<UInt32>(tlas.instances().size()) };
+		VkAccelerationStructureBuildRangeInfoKHR ranges { tlas.instanceCount() };
 		auto rangePointer = &ranges;
 
 		// Create new acceleration structure handle.
@@ -146,7 +244,7 @@ public:
 		VkAccelerationStructureCreateInfoKHR info = {
 			.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR,
 			.buffer = buffer.handle(),
-			.offset = offset,
+			.offset = buffer.offset() + offset,
 			.size = size,
 			.type = VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR
 		};
@@ -158,7 +256,7 @@ public:
 			.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR,
 			.arrayOfPointers = false,
 			.data = {
-				.deviceAddress = instanceBuffer->virtualAddress()
+				.deviceAddress = instanceAddress
 			}
 		};
 
@@ -188,7 +286,7 @@ public:
 		tlas.updateState(&device, handle);
 
 		// Store the scratch buffer.
-		m_sharedResources.push_back(asShared(std::move(instanceBuffer)));
+		m_sharedResources.push_back(instanceBuffer);
 		m_sharedResources.push_back(scratchBuffer);
 	}
 };
@@ -227,45 +325,15 @@ void VulkanCommandBuffer::begin() const
 
 	// If it was possible to reset the command buffer, we can also safely release shared resources from previous recordings.
 	m_impl->m_sharedResources.clear();
+	m_impl->m_exclusiveBuffers.clear();
 }
 
 void VulkanCommandBuffer::begin(const VulkanRenderPass& renderPass) const
 {
-	// Get the render target formats.
-	auto& frameBuffer = renderPass.activeFrameBuffer();
-	auto renderTargets = renderPass.renderTargets();
-	auto formats = renderTargets |
-		std::views::filter([](auto& renderTarget) { return renderTarget.type() != RenderTargetType::DepthStencil; }) |
-		std::views::transform([](auto& renderTarget) { return Vk::getFormat(renderTarget.format()); }) |
-		std::ranges::to<Array<VkFormat>>();
-	auto depthStencilFormats = renderTargets |
-		std::views::filter([](auto& renderTarget) { return renderTarget.type() == RenderTargetType::DepthStencil; }) |
-		std::views::transform([](auto& renderTarget) { return renderTarget.format(); }) |
-		std::ranges::to<Array<Format>>();
-	auto depthFormat = depthStencilFormats.size() > 0 && ::hasDepth(depthStencilFormats.front()) ? Vk::getFormat(depthStencilFormats.front()) : VK_FORMAT_UNDEFINED;
-	auto stencilFormat = depthStencilFormats.size() > 0 && ::hasStencil(depthStencilFormats.front()) ? Vk::getFormat(depthStencilFormats.front()) : VK_FORMAT_UNDEFINED;
-
-	// Get the multi sampling level.
-	auto samples = renderTargets |
-		std::views::transform([&frameBuffer](auto& renderTarget) { return Vk::getSamples(frameBuffer[renderTarget].samples()); }) |
-		std::ranges::to<Array<VkSampleCountFlagBits>>();
-
-	if (std::ranges::adjacent_find(samples, std::not_equal_to { }) != samples.end()) [[unlikely]]
-		throw RuntimeException("All render targets of the current render pass must use the multi sampling level.");
-
-	// Create an inheritance info for the parent buffer.
-	VkCommandBufferInheritanceRenderingInfo renderingInfo = {
-		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO,
-		.colorAttachmentCount = static_cast<UInt32>(formats.size()),
-		.pColorAttachmentFormats = formats.data(),
-		.depthAttachmentFormat = depthFormat,
-		.stencilAttachmentFormat = stencilFormat,
-		.rasterizationSamples = samples.front()
-	};
-
+	// Create an inheritance info for the parent buffer. The rendering info is cached by the render pass for the active frame buffer.
 	VkCommandBufferInheritanceInfo inheritanceInfo {
 		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
-		.pNext = &renderingInfo
+		.pNext = &renderPass.inheritanceInfo()
 	};
 
 	// Set the buffer into recording state.
@@ -279,6 +347,7 @@ void VulkanCommandBuffer::begin(const VulkanRenderPass& renderPass) const
 	raiseIfFailed(::vkBeginCommandBuffer(this->handle(), &beginInfo), "Unable to begin command recording.");
 
 	m_impl->m_recording = true;
+	m_impl->m_exclusiveBuffers.clear();
 }
 
 void VulkanCommandBuffer::end() const
@@ -420,17 +489,19 @@ void VulkanCommandBuffer::transfer(const IVulkanBuffer& source, const IVulkanBuf
 		throw ArgumentOutOfRangeException("targetElement", "The target buffer has only {0} elements, but a transfer for {1} elements starting from element {2} has been requested.", target.elements(), elements, targetElement);
 
 	VkBufferCopy copyInfo {
-		.srcOffset = sourceElement * source.alignedElementSize(),
-		.dstOffset = targetElement * target.alignedElementSize(),
+		.srcOffset = source.offset() + sourceElement * source.alignedElementSize(),
+		.dstOffset = target.offset() + targetElement * target.alignedElementSize(),
 		.size      = elements      * source.alignedElementSize()
 	};
 
 	::vkCmdCopyBuffer(this->handle(), std::as_const(source).handle(), std::as_const(target).handle(), 1, &copyInfo);
+	m_impl->track(source);
+	m_impl->track(target);
 }
 
 void VulkanCommandBuffer::transfer(const void* const data, size_t size, const IVulkanBuffer& target, UInt32 targetElement, UInt32 elements) const
 {
-	auto stagingBuffer = asShared(std::move(m_impl->m_queue.device().factory().createBuffer(target.type(), ResourceHeap::Staging, target.elementSize(), elements)));
+	auto stagingBuffer = asShared(std::move(m_impl->m_queue.device().factory().createBuffer(target.type(), ResourceHeap::Staging, target.elementSize(), elements, ResourceUsage::TransferSource | ResourceUsage::Concurrent)));
 	stagingBuffer->map(data, size, 0);
 
 	this->transfer(stagingBuffer, target, 0, targetElement, elements);
@@ -439,7 +510,7 @@ void VulkanCommandBuffer::transfer(const void* const data, size_t size, const IV
 void VulkanCommandBuffer::transfer(Span<const void* const> data, size_t elementSize, const IVulkanBuffer& target, UInt32 firstElement) const
 {
 	auto elements = static_cast<UInt32>(data.size());
-	auto stagingBuffer = asShared(std::move(m_impl->m_queue.device().factory().createBuffer(target.type(), ResourceHeap::Staging, target.elementSize(), elements)));
+	auto stagingBuffer = asShared(std::move(m_impl->m_queue.device().factory().createBuffer(target.type(), ResourceHeap::Staging, target.elementSize(), elements, ResourceUsage::TransferSource | ResourceUsage::Concurrent)));
 	stagingBuffer->map(data, elementSize, 0);
 
 	this->transfer(stagingBuffer, target, 0, firstElement, elements);
@@ -459,7 +530,7 @@ void VulkanCommandBuffer::transfer(const IVulkanBuffer& source, const IVulkanIma
 		target.resolveSubresource(subresource, plane, layer, level);
 
 		return VkBufferImageCopy {
-			.bufferOffset = source.alignedElementSize() * sourceElement,
+			.bufferOffset = source.offset() + source.alignedElementSize() * sourceElement,
 			.bufferRowLength = 0,
 			.bufferImageHeight = 0,
 			.imageSubresource = VkImageSubresourceLayers {
@@ -474,11 +545,12 @@ void VulkanCommandBuffer::transfer(const IVulkanBuffer& source, const IVulkanIma
 	});
 
 	::vkCmdCopyBufferToImage(this->handle(), std::as_const(source).handle(), std::as_const(target).handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<UInt32>(copyInfos.size()), copyInfos.data());
+	m_impl->track(source);
 }
 
 void VulkanCommandBuffer::transfer(const void* const data, size_t size, const IVulkanImage& target, UInt32 subresource) const
 {
-	auto stagingBuffer = asShared(std::move(m_impl->m_queue.device().factory().createBuffer(BufferType::Other, ResourceHeap::Staging, size)));
+	auto stagingBuffer = asShared(std::move(m_impl->m_queue.device().factory().createBuffer(BufferType::Other, ResourceHeap::Staging, size, 1, ResourceUsage::TransferSource | ResourceUsage::Concurrent)));
 	stagingBuffer->map(data, size, 0);
 
 	this->transfer(stagingBuffer, target, 0, subresource, 1);
@@ -487,7 +559,7 @@ void VulkanCommandBuffer::transfer(const void* const data, size_t size, const IV
 void VulkanCommandBuffer::transfer(Span<const void* const> data, size_t elementSize, const IVulkanImage& target, UInt32 firstSubresource, UInt32 subresources) const
 {
 	auto elements = static_cast<UInt32>(data.size());
-	auto stagingBuffer = asShared(std::move(m_impl->m_queue.device().factory().createBuffer(BufferType::Other, ResourceHeap::Staging, elementSize, elements)));
+	auto stagingBuffer = asShared(std::move(m_impl->m_queue.device().factory().createBuffer(BufferType::Other, ResourceHeap::Staging, elementSize, elements, ResourceUsage::TransferSource | ResourceUsage::Concurrent)));
 	stagingBuffer->map(data, elementSize, 0);
 
 	this->transfer(stagingBuffer, target, 0, firstSubresource, subresources);
@@ -501,6 +573,10 @@ void VulkanCommandBuffer::transfer(const IVulkanImage& source, const IVulkanImag
 	if (target.elements() < targetSubresource + subresources) [[unlikely]]
 		throw ArgumentOutOfRangeException("targetElement", "The target image has only {0} sub-resources, but a transfer for {1} sub-resources starting from sub-resources {2} has been requested.", target.elements(), subresources, targetSubresource);
 
+	if (source.extent().width() > target.extent().width() || source.extent().height() > target.extent().height() || source.extent().depth() > target.extent().depth()) [[unlikely]]
+		throw InvalidArgumentException("target", "The target image ({0}x{1}x{2}) is smaller than the source image ({3}x{4}x{5}).", 
+			target.extent().width(), target.extent().height(), target.extent().depth(), source.extent().width(), source.extent().height(), source.extent().depth());
+
 	Array<VkImageCopy> copyInfos(subresources);
 	std::ranges::generate(copyInfos, [&, this, i = 0]() mutable {
 		UInt32 sourceRsc = sourceSubresource + i, sourceLayer = 0, sourceLevel = 0, sourcePlane = 0;
@@ -546,7 +622,7 @@ void VulkanCommandBuffer::transfer(const IVulkanImage& source, const IVulkanBuff
 		source.resolveSubresource(subresource, plane, layer, level);
 
 		return VkBufferImageCopy {
-			.bufferOffset = target.alignedElementSize() * subresource,
+			.bufferOffset = target.offset() + target.alignedElementSize() * subresource,
 			.bufferRowLength = 0,
 			.bufferImageHeight = 0,
 			.imageSubresource = VkImageSubresourceLayers {
@@ -561,6 +637,7 @@ void VulkanCommandBuffer::transfer(const IVulkanImage& source, const IVulkanBuff
 	});
 
 	::vkCmdCopyImageToBuffer(this->handle(), std::as_const(source).handle(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, std::as_const(target).handle(), static_cast<UInt32>(copyInfos.size()), copyInfos.data());
+	m_impl->track(target);
 }
 
 void VulkanCommandBuffer::transfer(SharedPtr<const IVulkanBuffer> source, const IVulkanBuffer& target, UInt32 sourceElement, UInt32 targetElement, UInt32 elements) const
@@ -622,15 +699,30 @@ void VulkanCommandBuffer::bind(Span<const VulkanDescriptorSet*> descriptorSets,
 	pipeline.bind(*this, descriptorSets);
 }
 
+void VulkanCommandBuffer::bind(const VulkanDescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets) const
+{
+	if (m_impl->m_lastPipeline) [[likely]]
+		m_impl->m_lastPipeline->bind(*this, descriptorSet, dynamicOffsets);
+	else
+		throw RuntimeException("No pipeline has been used on the command buffer before attempting to bind the descriptor set.");
+}
+
+void VulkanCommandBuffer::bind(const VulkanDescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets, const VulkanPipelineState& pipeline) const noexcept
+{
+	pipeline.bind(*this, descriptorSet, dynamicOffsets);
+}
+
 void VulkanCommandBuffer::bind(const IVulkanVertexBuffer& buffer) const noexcept
 {
-	constexpr VkDeviceSize offsets[] = { 0 };
+	const VkDeviceSize offsets[] = { buffer.offset() };
 	::vkCmdBindVertexBuffers(this->handle(), buffer.layout().binding(), 1, &buffer.handle(), offsets);
+	m_impl->track(buffer);
 }
 
 void VulkanCommandBuffer::bind(const IVulkanIndexBuffer& buffer) const noexcept
 {
-	::vkCmdBindIndexBuffer(this->handle(), buffer.handle(), 0, buffer.layout().indexType() == IndexType::UInt16 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+	::vkCmdBindIndexBuffer(this->handle(), buffer.handle(), buffer.offset(), buffer.layout().indexType() == IndexType::UInt16 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
+	m_impl->track(buffer);
 }
 
 void VulkanCommandBuffer::dispatch(const Vector3u& threadCount) const noexcept
@@ -640,7 +732,7 @@ void VulkanCommandBuffer::dispatch(const Vector3u& threadCount) const noexcept
 
 void VulkanCommandBuffer::dispatchIndirect(const IVulkanBuffer& batchBuffer, UInt32 batchCount, UInt64 offset) const noexcept
 {
-	::vkCmdDispatchIndirect(this->handle(), batchBuffer.handle(), offset);
+	::vkCmdDispatchIndirect(this->handle(), batchBuffer.handle(), batchBuffer.offset() + offset);
 }
 
 void VulkanCommandBuffer::dispatchMesh(const Vector3u& threadCount) const noexcept
@@ -650,12 +742,12 @@ void VulkanCommandBuffer::dispatchMesh(const Vector3u& threadCount) const noexce
 
 void VulkanCommandBuffer::dispatchMeshIndirect(const IVulkanBuffer& batchBuffer, UInt32 batchCount, UInt64 offset) const noexcept
 {
-	::vkCmdDrawMeshTasksIndirect(this->handle(), batchBuffer.handle(), offset, batchCount, batchBuffer.elementSize());
+	::vkCmdDrawMeshTasksIndirect(this->handle(), batchBuffer.handle(), batchBuffer.offset() + offset, batchCount, batchBuffer.elementSize());
 }
 
 void VulkanCommandBuffer::dispatchMeshIndirect(const IVulkanBuffer& batchBuffer, const IVulkanBuffer& countBuffer, UInt64 offset, UInt64 countOffset, UInt32 maxBatches) const noexcept
 {
-	::vkCmdDrawMeshTasksIndirectCount(this->handle(), batchBuffer.handle(), offset, countBuffer.handle(), countOffset, std::min(maxBatches, static_cast<UInt32>(batchBuffer.alignedElementSize() / sizeof(IndirectDispatchBatch))), sizeof(IndirectDispatchBatch));
+	::vkCmdDrawMeshTasksIndirectCount(this->handle(), batchBuffer.handle(), batchBuffer.offset() + offset, countBuffer.handle(), countBuffer.offset() + countOffset, std::min(maxBatches, static_cast<UInt32>(batchBuffer.alignedElementSize() / sizeof(IndirectDispatchBatch))), sizeof(IndirectDispatchBatch));
 }
 
 void VulkanCommandBuffer::draw(UInt32 vertices, UInt32 instances, UInt32 firstVertex, UInt32 firstInstance) const noexcept
@@ -665,12 +757,12 @@ void VulkanCommandBuffer::draw(UInt32 vertices, UInt32 instances, UInt32 firstVe
 
 void VulkanCommandBuffer::drawIndirect(const IVulkanBuffer& batchBuffer, UInt32 batchCount, UInt64 offset) const noexcept
 {
-	::vkCmdDrawIndirect(this->handle(), batchBuffer.handle(), offset, batchCount, batchBuffer.elementSize());
+	::vkCmdDrawIndirect(this->handle(), batchBuffer.handle(), batchBuffer.offset() + offset, batchCount, batchBuffer.elementSize());
 }
 
 void VulkanCommandBuffer::drawIndirect(const IVulkanBuffer& batchBuffer, const IVulkanBuffer& countBuffer, UInt64 offset, UInt64 countOffset, UInt32 maxBatches) const noexcept
 {
-	::vkCmdDrawIndirectCount(this->handle(), batchBuffer.handle(), offset, countBuffer.handle(), countOffset, std::min(maxBatches, static_cast<UInt32>(batchBuffer.alignedElementSize() / sizeof(IndirectBatch))), sizeof(IndirectBatch));
+	::vkCmdDrawIndirectCount(this->handle(), batchBuffer.handle(), batchBuffer.offset() + offset, countBuffer.handle(), countBuffer.offset() + countOffset, std::min(maxBatches, static_cast<UInt32>(batchBuffer.alignedElementSize() / sizeof(IndirectBatch))), sizeof(IndirectBatch));
 }
 
 void VulkanCommandBuffer::drawIndexed(UInt32 indices, UInt32 instances, UInt32 firstIndex, Int32 vertexOffset, UInt32 firstInstance) const noexcept
@@ -680,12 +772,12 @@ void VulkanCommandBuffer::drawIndexed(UInt32 indices, UInt32 instances, UInt32 f
 
 void VulkanCommandBuffer::drawIndexedIndirect(const IVulkanBuffer& batchBuffer, UInt32 batchCount, UInt64 offset) const noexcept
 {
-	::vkCmdDrawIndexedIndirect(this->handle(), batchBuffer.handle(), offset, batchCount, batchBuffer.elementSize());
+	::vkCmdDrawIndexedIndirect(this->handle(), batchBuffer.handle(), batchBuffer.offset() + offset, batchCount, batchBuffer.elementSize());
 }
 
 void VulkanCommandBuffer::drawIndexedIndirect(const IVulkanBuffer& batchBuffer, const IVulkanBuffer& countBuffer, UInt64 offset, UInt64 countOffset, UInt32 maxBatches) const noexcept
 {
-	::vkCmdDrawIndexedIndirectCount(this->handle(), batchBuffer.handle(), offset, countBuffer.handle(), countOffset, std::min(maxBatches, static_cast<UInt32>(batchBuffer.alignedElementSize() / sizeof(IndirectIndexedBatch))), sizeof(IndirectIndexedBatch));
+	::vkCmdDrawIndexedIndirectCount(this->handle(), batchBuffer.handle(), batchBuffer.offset() + offset, countBuffer.handle(), countBuffer.offset() + countOffset, std::min(maxBatches, static_cast<UInt32>(batchBuffer.alignedElementSize() / sizeof(IndirectIndexedBatch))), sizeof(IndirectIndexedBatch));
 }
 
 void VulkanCommandBuffer::pushConstants(const VulkanPushConstantsLayout& layout, const void* const memory) const noexcept
@@ -704,6 +796,7 @@ void VulkanCommandBuffer::writeTimingEvent(SharedPtr<const TimingEvent> timingEv
 void VulkanCommandBuffer::execute(SharedPtr<const VulkanCommandBuffer> commandBuffer) const
 {
 	::vkCmdExecuteCommands(this->handle(), 1, &commandBuffer->handle());
+	this->inheritExclusiveBuffers(*commandBuffer);
 }
 
 void VulkanCommandBuffer::execute(Enumerable<SharedPtr<const VulkanCommandBuffer>> commandBuffers) const
@@ -713,6 +806,7 @@ void VulkanCommandBuffer::execute(Enumerable<SharedPtr<const VulkanCommandBuffer
 		std::ranges::to<Array<VkCommandBuffer>>();
 
 	::vkCmdExecuteCommands(this->handle(), static_cast<UInt32>(secondaryHandles.size()), secondaryHandles.data());
+	std::ranges::for_each(commandBuffers, [this](auto commandBuffer) { this->inheritExclusiveBuffers(*commandBuffer); });
 }
 
 void VulkanCommandBuffer::releaseSharedState() const
@@ -720,6 +814,16 @@ void VulkanCommandBuffer::releaseSharedState() const
 	m_impl->m_sharedResources.clear();
 }
 
+Span<const IVulkanBuffer* const> VulkanCommandBuffer::exclusiveBuffers() const noexcept
+{
+	return m_impl->m_exclusiveBuffers;
+}
+
+void VulkanCommandBuffer::inheritExclusiveBuffers(const VulkanCommandBuffer& commandBuffer) const
+{
+	std::ranges::copy(commandBuffer.m_impl->m_exclusiveBuffers, std::back_inserter(m_impl->m_exclusiveBuffers));
+}
+
 void VulkanCommandBuffer::buildAccelerationStructure(VulkanBottomLevelAccelerationStructure& blas, const SharedPtr<const IVulkanBuffer> scratchBuffer, const IVulkanBuffer& buffer, UInt64 offset) const
 {
 	m_impl->buildAccelerationStructure(blas, scratchBuffer, buffer, offset, false);
@@ -730,6 +834,29 @@ void VulkanCommandBuffer::buildAccelerationStructure(VulkanTopLevelAccelerationS
 	m_impl->buildAccelerationStructure(tlas, scratchBuffer, buffer, offset, false);
 }
 
+void VulkanCommandBuffer::buildAccelerationStructures(Span<VulkanBottomLevelAccelerationStructure* const> blas, const SharedPtr<const IVulkanBuffer> scratchBuffer, Span<const UInt64> scratchOffsets, const SharedPtr<const IVulkanBuffer> buffer, Span<const UInt64> offsets) const
+{
+	auto sizes = m_impl->buildAccelerationStructures(blas, scratchBuffer, scratchOffsets, buffer, offsets);
+	bool compaction { false };
+
+	for (size_t i{ 0 }; i < blas.size(); ++i)
+	{
+		blas[i]->updateState(buffer, offsets[i], sizes[i]);
+		compaction |= LITEFX_FLAG_IS_SET(blas[i]->flags(), AccelerationStructureFlags::AllowCompaction);
+	}
+
+	// Write out the acceleration structure properties to make the compacted sizes available. A single barrier is sufficient, as all acceleration structures are stored in the same buffer.
+	if (compaction)
+	{
+		auto barrier = m_impl->m_queue.device().makeBarrier(PipelineStage::AccelerationStructureBuild, PipelineStage::AccelerationStructureBuild);
+		barrier->transition(*buffer, ResourceAccess::AccelerationStructureWrite, ResourceAccess::AccelerationStructureRead);
+		this->barrier(*barrier);
+
+		for (auto as : blas)
+			as->writeCompactedSize(*this);
+	}
+}
+
 void VulkanCommandBuffer::updateAccelerationStructure(VulkanBottomLevelAccelerationStructure& blas, const SharedPtr<const IVulkanBuffer> scratchBuffer, const IVulkanBuffer& buffer, UInt64 offset) const
 {
 	m_impl->buildAccelerationStructure(blas, scratchBuffer, buffer, offset, true);
@@ -656,6 +656,38 @@ VkFormat LiteFX::Rendering::Backends::Vk::getFormat(BufferFormat format)
 		return VK_FORMAT_R32G32B32A32_SINT;
 	case BufferFormat::XYZW32U:
 		return VK_FORMAT_R32G32B32A32_UINT;
+	case BufferFormat::X8SN:
+		return VK_FORMAT_R8_SNORM;
+	case BufferFormat::XY8SN:
+		return VK_FORMAT_R8G8_SNORM;
+	case BufferFormat::XYZ8SN:
+		return VK_FORMAT_R8G8B8_SNORM;
+	case BufferFormat::XYZW8SN:
+		return VK_FORMAT_R8G8B8A8_SNORM;
+	case BufferFormat::X8UN:
+		return VK_FORMAT_R8_UNORM;
+	case BufferFormat::XY8UN:
+		return VK_FORMAT_R8G8_UNORM;
+	case BufferFormat::XYZ8UN:
+		return VK_FORMAT_R8G8B8_UNORM;
+	case BufferFormat::XYZW8UN:
+		return VK_FORMAT_R8G8B8A8_UNORM;
+	case BufferFormat::X16SN:
+		return VK_FORMAT_R16_SNORM;
+	case BufferFormat::XY16SN:
+		return VK_FORMAT_R16G16_SNORM;
+	case BufferFormat::XYZ16SN:
+		return VK_FORMAT_R16G16B16_SNORM;
+	case BufferFormat::XYZW16SN:
+		return VK_FORMAT_R16G16B16A16_SNORM;
+	case BufferFormat::X16UN:
+		return VK_FORMAT_R16_UNORM;
+	case BufferFormat::XY16UN:
+		return VK_FORMAT_R16G16_UNORM;
+	case BufferFormat::XYZ16UN:
+		return VK_FORMAT_R16G16B16_UNORM;
+	case BufferFormat::XYZW16UN:
+		return VK_FORMAT_R16G16B16A16_UNORM;
 	default:
 		throw std::invalid_argument("Unsupported format.");
 	}
@@ -24,10 +24,13 @@ public:
         switch (m_descriptorType)
         {
         case DescriptorType::ConstantBuffer:
+        case DescriptorType::DynamicConstantBuffer:
             m_bufferType = BufferType::Uniform;
             break;
         case DescriptorType::RWStructuredBuffer:
         case DescriptorType::StructuredBuffer:
+        case DescriptorType::RWDynamicStructuredBuffer:
+        case DescriptorType::DynamicStructuredBuffer:
         case DescriptorType::RWByteAddressBuffer:
         case DescriptorType::ByteAddressBuffer:
             m_bufferType = BufferType::Storage;
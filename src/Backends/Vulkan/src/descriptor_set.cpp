@@ -79,6 +79,27 @@ void VulkanDescriptorSet::update(UInt32 binding, const IVulkanBuffer& buffer, UI
         descriptorWrite.descriptorCount = elementCount;
         descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
 
+        bufferInfos.resize(elementCount);
+        std::ranges::generate(bufferInfos, [&buffer, &bufferElement, i = 0]() mutable {
+            return VkDescriptorBufferInfo {
+                .buffer = buffer.handle(),
+                .offset = buffer.offset() + buffer.alignedElementSize() * static_cast<size_t>(bufferElement + i++),
+                .range = buffer.elementSize()
+            };
+        });
+
+        descriptorWrite.pBufferInfo = bufferInfos.data();
+        break;
+    }
+    case DescriptorType::DynamicConstantBuffer:
+    case DescriptorType::DynamicStructuredBuffer:
+    case DescriptorType::RWDynamicStructuredBuffer:
+    {
+        descriptorWrite.descriptorCount = elementCount;
+        descriptorWrite.descriptorType = descriptorLayout.descriptorType() == DescriptorType::DynamicConstantBuffer ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+
+        // NOTE: The offset of the buffer within its backend resource is not part of the descriptor, as it is provided as dynamic offset when binding the descriptor set. This 
+        //       way, a descriptor written once can address any buffer that is sub-allocated from the same resource.
         bufferInfos.resize(elementCount);
         std::ranges::generate(bufferInfos, [&buffer, &bufferElement, i = 0]() mutable {
             return VkDescriptorBufferInfo {
@@ -103,7 +124,7 @@ void VulkanDescriptorSet::update(UInt32 binding, const IVulkanBuffer& buffer, UI
         std::ranges::generate(bufferInfos, [&buffer, &bufferElement, i = 0]() mutable {
             return VkDescriptorBufferInfo {
                 .buffer = buffer.handle(),
-                .offset = buffer.alignedElementSize() * static_cast<size_t>(bufferElement + i++),
+                .offset = buffer.offset() + buffer.alignedElementSize() * static_cast<size_t>(bufferElement + i++),
                 .range = buffer.elementSize()
             };
         });
@@ -121,7 +142,7 @@ void VulkanDescriptorSet::update(UInt32 binding, const IVulkanBuffer& buffer, UI
             .flags = 0,
             .buffer = buffer.handle(),
             .format = VK_FORMAT_UNDEFINED,
-            .offset = buffer.alignedElementSize() * bufferElement,     // TODO: Handle alignment properly, as texel buffers do not need to be aligned (afaik).
+            .offset = buffer.offset() + buffer.alignedElementSize() * bufferElement,     // TODO: Handle alignment properly, as texel buffers do not need to be aligned (afaik).
             .range = buffer.alignedElementSize() * elementCount
         };
 
@@ -142,7 +163,7 @@ void VulkanDescriptorSet::update(UInt32 binding, const IVulkanBuffer& buffer, UI
             .flags = 0,
             .buffer = buffer.handle(),
             .format = VK_FORMAT_UNDEFINED,
-            .offset = buffer.alignedElementSize() * bufferElement,     // TODO: Handle alignment properly, as texel buffers do not need to be aligned (afaik).
+            .offset = buffer.offset() + buffer.alignedElementSize() * bufferElement,     // TODO: Handle alignment properly, as texel buffers do not need to be aligned (afaik).
             .range = buffer.alignedElementSize() * elementCount
         };
 
@@ -25,7 +25,9 @@ private:
         { VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, 0 },
         { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 0 },
         { VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER, 0 },
-        { VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, 0 }
+        { VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, 0 },
+        { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 0 },
+        { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 0 }
     };
     Dictionary<VkDescriptorType, UInt32> m_poolSizeMapping {
         { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 0 },
@@ -35,13 +37,16 @@ private:
         { VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, 4 },
         { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 5 },
         { VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER, 6 },
-        { VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, 7 }
+        { VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, 7 },
+        { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 8 },
+        { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 9 }
     };
     ShaderStage m_stages;
     UInt32 m_space;
     mutable std::mutex m_mutex;
     const VulkanDevice& m_device;
     bool m_usesDescriptorIndexing = false;
+    bool m_updateAfterBind = true;
     Dictionary<const VkDescriptorSet*, const VkDescriptorPool*> m_descriptorSetSources;
 
 public:
@@ -139,6 +144,9 @@ public:
             case DescriptorType::InputAttachment:       binding.descriptorType = VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;     break;
             case DescriptorType::Sampler:               binding.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;              break;
             case DescriptorType::AccelerationStructure: binding.descriptorType = VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR; break;
+            case DescriptorType::DynamicConstantBuffer: binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC; break;
+            case DescriptorType::DynamicStructuredBuffer:
+            case DescriptorType::RWDynamicStructuredBuffer: binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC; break;
             default: LITEFX_WARNING(VULKAN_LOG, "The descriptor type is unsupported. Binding will be skipped.");       return;
             }
 
@@ -147,8 +155,17 @@ public:
             else
                 binding.pImmutableSamplers = &layout->staticSampler()->handle();
             
+            // NOTE: Dynamic descriptors cannot be updated after they have been bound, so they cannot be part of an update-after-bind layout (see VUID-VkDescriptorSetLayoutCreateInfo-flags-03000).
+            if (binding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC || binding.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC)
+            {
+                if (binding.descriptorCount == std::numeric_limits<UInt32>::max()) [[unlikely]]
+                    throw InvalidArgumentException("descriptorLayouts", "The dynamic descriptor at binding {0} cannot be an unbounded runtime array.", bindingPoint);
+
+                bindingFlags.push_back(0);
+                m_updateAfterBind = false;
+            }
             // If the descriptor is an unbounded runtime array, disable validation warnings about partially bound elements.
-            if (binding.descriptorCount != std::numeric_limits<UInt32>::max())
+            else if (binding.descriptorCount != std::numeric_limits<UInt32>::max())
             {
                 bindingFlags.push_back({ VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT });
 
@@ -227,7 +244,13 @@ public:
         };
 
         // Allow for descriptors to update after they have been bound. This also means, we have to manually take care of not to update a descriptor before it got used.
-        descriptorSetLayoutInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+        if (m_updateAfterBind)
+            descriptorSetLayoutInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+        else
+        {
+            // Remove the update-after-bind flag from all other bindings, as it requires the layout to be created with the update-after-bind pool flag.
+            std::ranges::for_each(bindingFlags, [](VkDescriptorBindingFlags& flags) { flags &= ~static_cast<VkDescriptorBindingFlags>(VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT); });
+        }
 
         VkDescriptorSetLayout layout;
         raiseIfFailed(::vkCreateDescriptorSetLayout(m_device.handle(), &descriptorSetLayoutInfo, nullptr, &layout), "Unable to create descriptor set layout.");
@@ -249,7 +272,7 @@ public:
         poolInfo.poolSizeCount = poolSizes.size();
         poolInfo.pPoolSizes = poolSizes.data();
         poolInfo.maxSets = descriptorSets;
-        poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+        poolInfo.flags = m_updateAfterBind ? VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT : 0;
 
         VkDescriptorPool descriptorPool;
         raiseIfFailed(::vkCreateDescriptorPool(m_device.handle(), &poolInfo, nullptr, &descriptorPool), "Unable to create buffer pool.");
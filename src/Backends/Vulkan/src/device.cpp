@@ -129,10 +129,79 @@ private:
     UniquePtr<VulkanSurface> m_surface;
     UniquePtr<VulkanGraphicsFactory> m_factory;
 
+    mutable std::mutex m_layoutMutex;
+    Dictionary<String, WeakPtr<const VulkanDescriptorSetLayout>> m_descriptorSetLayouts;
+    Dictionary<String, WeakPtr<VulkanPipelineLayout>> m_pipelineLayouts;
+
 #ifndef NDEBUG
     PFN_vkDebugMarkerSetObjectNameEXT debugMarkerSetObjectName = nullptr;
 #endif
 
+private:
+    // NOTE: Layouts are identified by a key that contains their complete description, so that equal keys always describe compatible layouts.
+    template <typename... TValues>
+    static inline void appendKey(String& key, TValues... values) noexcept
+    {
+        (key.append(reinterpret_cast<const char*>(&values), sizeof(values)), ...);
+    }
+
+    static String layoutKey(const VulkanDescriptorSetLayout& layout) noexcept
+    {
+        String key;
+        appendKey(key, layout.space(), layout.shaderStages());
+
+        for (auto descriptor : layout.descriptors())
+        {
+            appendKey(key, descriptor->binding(), descriptor->descriptorType(), descriptor->descriptors(), descriptor->elementSize(), descriptor->inputAttachmentIndex());
+
+            // Static samplers are part of the layout, so their state must match as well.
+            if (auto sampler = descriptor->staticSampler(); sampler == nullptr)
+                appendKey(key, false);
+            else
+                appendKey(key, true, sampler->getMinifyingFilter(), sampler->getMagnifyingFilter(), sampler->getBorderModeU(), sampler->getBorderModeV(), sampler->getBorderModeW(),
+                    sampler->getAnisotropy(), sampler->getMipMapMode(), sampler->getMipMapBias(), sampler->getMaxLOD(), sampler->getMinLOD());
+        }
+
+        return key;
+    }
+
+    static String layoutKey(const VulkanPipelineLayout& layout) noexcept
+    {
+        // Descriptor set layouts are interned when the pipeline layout is initialized, so they can be compared by identity.
+        String key;
+
+        for (auto descriptorSet : layout.descriptorSets())
+            appendKey(key, descriptorSet);
+
+        if (auto pushConstants = layout.pushConstants(); pushConstants != nullptr)
+        {
+            appendKey(key, pushConstants->size());
+
+            for (auto range : pushConstants->ranges())
+                appendKey(key, range->stage(), range->offset(), range->size());
+        }
+
+        return key;
+    }
+
+    template <typename TLayout>
+    static SharedPtr<TLayout> intern(Dictionary<String, WeakPtr<TLayout>>& layouts, SharedPtr<TLayout>&& layout, const String& key)
+    {
+        if (auto match = layouts.find(key); match != layouts.end())
+        {
+            if (auto shared = match->second.lock(); shared != nullptr)
+                return shared;
+        }
+        else
+        {
+            // Remove layouts that have been released in the meantime, before adding a new one.
+            std::erase_if(layouts, [](const auto& entry) { return entry.second.expired(); });
+        }
+
+        layouts[key] = layout;
+        return std::move(layout);
+    }
+
 public:
     VulkanDeviceImpl(VulkanDevice* parent, const VulkanGraphicsAdapter& adapter, UniquePtr<VulkanSurface>&& surface, const GraphicsDeviceFeatures& features, Span<String> extensions) :
         base(parent), m_adapter(adapter), m_surface(std::move(surface))
@@ -200,9 +269,15 @@ private:
         m_extensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
 #endif // LITEFX_BUILD_DIRECTX_12_BACKEND
 
-#ifndef NDEBUG
         auto availableExtensions = m_adapter.getAvailableDeviceExtensions();
 
+        // Used to query memory budgets, if available. Skip it, if it has already been requested by the application.
+        auto isMemoryBudget = [](const String& extension) { return extension == VK_EXT_MEMORY_BUDGET_EXTENSION_NAME; };
+
+        if (std::ranges::any_of(availableExtensions, isMemoryBudget) && std::ranges::none_of(m_extensions, isMemoryBudget))
+            m_extensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+
+#ifndef NDEBUG
         // Required to set debug names.
         if (auto match = std::ranges::find_if(availableExtensions, [](const String& extension) { return extension == VK_EXT_DEBUG_MARKER_EXTENSION_NAME; }); match != availableExtensions.end())
             m_extensions.push_back(VK_EXT_DEBUG_MARKER_EXTENSION_NAME);
@@ -590,6 +665,32 @@ Enumerable<UInt32> VulkanDevice::queueFamilyIndices(QueueType type) const noexce
         std::ranges::to<Enumerable<UInt32>>();
 }
 
+SharedPtr<const VulkanDescriptorSetLayout> VulkanDevice::internDescriptorSetLayout(SharedPtr<const VulkanDescriptorSetLayout> layout) const
+{
+    if (layout == nullptr) [[unlikely]]
+        throw ArgumentNotInitializedException("layout", "The descriptor set layout must be initialized.");
+
+    if (&layout->device() != this) [[unlikely]]
+        throw InvalidArgumentException("layout", "The descriptor set layout has been created from another device.");
+
+    auto key = VulkanDeviceImpl::layoutKey(*layout);
+    std::lock_guard<std::mutex> lock(m_impl->m_layoutMutex);
+    return VulkanDeviceImpl::intern(m_impl->m_descriptorSetLayouts, std::move(layout), key);
+}
+
+SharedPtr<VulkanPipelineLayout> VulkanDevice::internPipelineLayout(SharedPtr<VulkanPipelineLayout> layout) const
+{
+    if (layout == nullptr) [[unlikely]]
+        throw ArgumentNotInitializedException("layout", "The pipeline layout must be initialized.");
+
+    if (&layout->device() != this) [[unlikely]]
+        throw InvalidArgumentException("layout", "The pipeline layout has been created from another device.");
+
+    auto key = VulkanDeviceImpl::layoutKey(*layout);
+    std::lock_guard<std::mutex> lock(m_impl->m_layoutMutex);
+    return VulkanDeviceImpl::intern(m_impl->m_pipelineLayouts, std::move(layout), key);
+}
+
 VulkanSwapChain& VulkanDevice::swapChain() noexcept
 {
     return *m_impl->m_swapChain;
@@ -775,15 +876,12 @@ void VulkanDevice::computeAccelerationStructureSizes(const VulkanBottomLevelAcce
 
 void VulkanDevice::computeAccelerationStructureSizes(const VulkanTopLevelAccelerationStructure& tlas, UInt64& bufferSize, UInt64& scratchSize, bool forUpdate) const
 {
-    auto instances = tlas.buildInfo();
-    auto instanceCount = static_cast<UInt32>(instances.size());
+    // The instance data is ignored when querying the sizes, so there is no need to pack the instances here.
+    auto instanceCount = tlas.instanceCount();
 
     VkAccelerationStructureGeometryInstancesDataKHR instanceInfo = {
         .sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR,
-        .arrayOfPointers = false,
-        .data = {
-            .hostAddress = instances.data()
-        }
+        .arrayOfPointers = false
     };
 
     VkAccelerationStructureGeometryKHR geometryInfo = {
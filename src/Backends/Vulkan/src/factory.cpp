@@ -15,6 +15,7 @@ public:
 private:
 	const VulkanDevice& m_device;
 	VmaAllocator m_allocator{ nullptr };
+	MemoryTracker m_tracker;
 
 public:
 	VulkanGraphicsFactoryImpl(VulkanGraphicsFactory* parent, const VulkanDevice& device) :
@@ -28,6 +29,10 @@ public:
 		allocatorInfo.flags = VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
 		allocatorInfo.vulkanApiVersion = VK_API_VERSION_1_3;
 
+		// Without the memory budget extension, the allocator estimates the budget from the heap sizes.
+		if (std::ranges::any_of(device.enabledExtensions(), [](const String& extension) { return extension == VK_EXT_MEMORY_BUDGET_EXTENSION_NAME; }))
+			allocatorInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+
 		raiseIfFailed(::vmaCreateAllocator(&allocatorInfo, &m_allocator), "Unable to create Vulkan memory allocator.");
 	}
 
@@ -36,6 +41,59 @@ public:
 		if (m_allocator != nullptr)
 			::vmaDestroyAllocator(m_allocator);
 	}
+
+public:
+	template <typename TResource>
+	TResource allocate(ResourceHeap heap, Optional<BufferType> type, UInt64 size, VmaAllocationCreateInfo& allocationInfo, std::function<TResource()> allocate)
+	{
+		// The allocation record is stored in the user data of the allocation and released by the resource, when it gets destroyed.
+		auto allocation = m_tracker.track(heap, type, size);
+		allocationInfo.pUserData = allocation;
+		TResource resource;
+
+		try
+		{
+			resource = allocate();
+		}
+		catch (...)
+		{
+			MemoryTracker::release(allocation);
+			throw;
+		}
+
+		this->checkBudgets();
+		return resource;
+	}
+
+	Array<MemoryHeapBudget> budgets() const
+	{
+		const VkPhysicalDeviceMemoryProperties* memoryProperties;
+		::vmaGetMemoryProperties(m_allocator, &memoryProperties);
+
+		Array<VmaBudget> heapBudgets(memoryProperties->memoryHeapCount);
+		::vmaGetHeapBudgets(m_allocator, heapBudgets.data());
+
+		return std::views::iota(0u, memoryProperties->memoryHeapCount) | std::views::transform([&](UInt32 heap) {
+			return MemoryHeapBudget {
+				.Heap = heap,
+				.DeviceLocal = (memoryProperties->memoryHeaps[heap].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0,
+				.Usage = heapBudgets[heap].usage,
+				.Budget = heapBudgets[heap].budget
+			};
+		}) | std::ranges::to<Array<MemoryHeapBudget>>();
+	}
+
+	void checkBudgets()
+	{
+		// Only invoke the event, if there are subscribers to skip querying the budgets.
+		if (!m_parent->budgetExceeded)
+			return;
+
+		auto threshold = m_tracker.budgetThreshold();
+
+		for (const auto& budget : m_tracker.checkBudgets(this->budgets()))
+			m_parent->budgetExceeded.invoke(m_parent, { budget, threshold });
+	}
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -139,15 +197,27 @@ UniquePtr<IVulkanBuffer> VulkanGraphicsFactory::createBuffer(const String& name,
 	case ResourceHeap::Readback: allocInfo.usage = VMA_MEMORY_USAGE_GPU_TO_CPU; break;
 	}
 
-	// If the buffer is used as a static resource or staging buffer, it needs to be accessible concurrently by the graphics and transfer queues.
+	// Buffers that can be bound to descriptors or that are used as acceleration structure build inputs are accessed without the command buffers being able to track 
+	// them, so they are always shared concurrently. All other buffers are owned by one queue family at a time, unless concurrent access has been explicitly requested. 
+	// Ownership transfers between queue families are handled by the queues when submitting command buffers that use the buffers (see `VulkanQueue::submit`).
+	if ((type != BufferType::Vertex && type != BufferType::Index && type != BufferType::Other) || LITEFX_FLAG_IS_SET(usage, ResourceUsage::AccelerationStructureBuildInput))
+		usage |= ResourceUsage::Concurrent;
+
 	UniquePtr<IVulkanBuffer> buffer;
 	auto queueFamilies = m_impl->m_device.queueFamilyIndices() | std::ranges::to<std::vector>();
 
-	bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
-	bufferInfo.queueFamilyIndexCount = static_cast<UInt32>(queueFamilies.size());
-	bufferInfo.pQueueFamilyIndices = queueFamilies.data();
+	if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::Concurrent))
+	{
+		bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+		bufferInfo.queueFamilyIndexCount = static_cast<UInt32>(queueFamilies.size());
+		bufferInfo.pQueueFamilyIndices = queueFamilies.data();
+	}
+	else
+	{
+		bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	}
 
-	buffer = VulkanBuffer::allocate(name, type, elements, elementSize, alignment, usage, m_impl->m_device, m_impl->m_allocator, bufferInfo, allocInfo);
+	buffer = m_impl->allocate<UniquePtr<IVulkanBuffer>>(heap, type, bufferInfo.size, allocInfo, [&]() { return VulkanBuffer::allocate(name, type, elements, elementSize, alignment, usage, m_impl->m_device, m_impl->m_allocator, bufferInfo, allocInfo); });
 
 #ifndef NDEBUG
 	if (!name.empty())
@@ -199,15 +269,27 @@ UniquePtr<IVulkanVertexBuffer> VulkanGraphicsFactory::createVertexBuffer(const S
 	case ResourceHeap::Readback: allocInfo.usage = VMA_MEMORY_USAGE_GPU_TO_CPU; break;
 	}
 
-	// If the buffer is used as a static resource or staging buffer, it needs to be accessible concurrently by the graphics and transfer queues.
+	// Buffers used as acceleration structure build inputs are not tracked by the command buffers, so they are always shared concurrently. All other buffers are owned by 
+	// one queue family at a time, unless concurrent access has been explicitly requested. Ownership transfers between queue families are handled by the queues when 
+	// submitting command buffers that use the buffers (see `VulkanQueue::submit`).
+	if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::AccelerationStructureBuildInput))
+		usage |= ResourceUsage::Concurrent;
+
 	UniquePtr<IVulkanVertexBuffer> buffer;
 	auto queueFamilies = m_impl->m_device.queueFamilyIndices() | std::ranges::to<std::vector>();
 
-	bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
-	bufferInfo.queueFamilyIndexCount = static_cast<UInt32>(queueFamilies.size());
-	bufferInfo.pQueueFamilyIndices = queueFamilies.data();
+	if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::Concurrent))
+	{
+		bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+		bufferInfo.queueFamilyIndexCount = static_cast<UInt32>(queueFamilies.size());
+		bufferInfo.pQueueFamilyIndices = queueFamilies.data();
+	}
+	else
+	{
+		bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	}
 
-	buffer = VulkanVertexBuffer::allocate(name, layout, elements, usage, m_impl->m_device, m_impl->m_allocator, bufferInfo, allocInfo);
+	buffer = m_impl->allocate<UniquePtr<IVulkanVertexBuffer>>(heap, BufferType::Vertex, bufferInfo.size, allocInfo, [&]() { return VulkanVertexBuffer::allocate(name, layout, elements, usage, m_impl->m_device, m_impl->m_allocator, bufferInfo, allocInfo); });
 
 #ifndef NDEBUG
 	if (!name.empty())
@@ -259,18 +341,27 @@ UniquePtr<IVulkanIndexBuffer> VulkanGraphicsFactory::createIndexBuffer(const Str
 	case ResourceHeap::Readback: allocInfo.usage = VMA_MEMORY_USAGE_GPU_TO_CPU; break;
 	}
 
-	// NOTE: Resource sharing between queue families leaves room for optimization. Currently we simply allow concurrent access by all queue families, so that the driver
-	//       needs to ensure that resource state is valid. Ideally, we would set sharing mode to exclusive and detect queue family switches where we need to insert a 
-	//       barrier for queue family ownership transfer. This would allow to further optimize workloads between queues to minimize resource ownership transfers (i.e.,
-	//       prefer executing workloads that depend on one resource on the same queue, even if it could be run in parallel).
+	// Buffers used as acceleration structure build inputs are not tracked by the command buffers, so they are always shared concurrently. All other buffers are owned by 
+	// one queue family at a time, unless concurrent access has been explicitly requested. Ownership transfers between queue families are handled by the queues when 
+	// submitting command buffers that use the buffers (see `VulkanQueue::submit`).
+	if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::AccelerationStructureBuildInput))
+		usage |= ResourceUsage::Concurrent;
+
 	UniquePtr<IVulkanIndexBuffer> buffer;
 	auto queueFamilies = m_impl->m_device.queueFamilyIndices() | std::ranges::to<std::vector>();
 
-	bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
-	bufferInfo.queueFamilyIndexCount = static_cast<UInt32>(queueFamilies.size());
-	bufferInfo.pQueueFamilyIndices = queueFamilies.data();
+	if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::Concurrent))
+	{
+		bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+		bufferInfo.queueFamilyIndexCount = static_cast<UInt32>(queueFamilies.size());
+		bufferInfo.pQueueFamilyIndices = queueFamilies.data();
+	}
+	else
+	{
+		bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	}
 
-	buffer = VulkanIndexBuffer::allocate(name, layout, elements, usage, m_impl->m_device, m_impl->m_allocator, bufferInfo, allocInfo);
+	buffer = m_impl->allocate<UniquePtr<IVulkanIndexBuffer>>(heap, BufferType::Index, bufferInfo.size, allocInfo, [&]() { return VulkanIndexBuffer::allocate(name, layout, elements, usage, m_impl->m_device, m_impl->m_allocator, bufferInfo, allocInfo); });
 
 #ifndef NDEBUG
 	if (!name.empty())
@@ -336,7 +427,14 @@ UniquePtr<IVulkanImage> VulkanGraphicsFactory::createTexture(const String& name,
 	VmaAllocationCreateInfo allocInfo = {};
 	allocInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
 
-	auto image = VulkanImage::allocate(name, m_impl->m_device, { width, height, depth }, format, dimension, levels, layers, samples, usage, m_impl->m_allocator, imageInfo, allocInfo);
+	// Query the size of the image upfront, so that it can be tracked.
+	VkDeviceImageMemoryRequirements requirementsInfo = { .sType = VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS, .pCreateInfo = &imageInfo };
+	VkMemoryRequirements2 memoryRequirements = { .sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2 };
+	::vkGetDeviceImageMemoryRequirements(m_impl->m_device.handle(), &requirementsInfo, &memoryRequirements);
+
+	auto image = m_impl->allocate<UniquePtr<IVulkanImage>>(ResourceHeap::Resource, std::nullopt, memoryRequirements.memoryRequirements.size, allocInfo, [&]() -> UniquePtr<IVulkanImage> { 
+		return VulkanImage::allocate(name, m_impl->m_device, { width, height, depth }, format, dimension, levels, layers, samples, usage, m_impl->m_allocator, imageInfo, allocInfo); 
+	});
 
 #ifndef NDEBUG
 	if (!name.empty())
@@ -387,4 +485,30 @@ UniquePtr<VulkanBottomLevelAccelerationStructure> VulkanGraphicsFactory::createB
 UniquePtr<VulkanTopLevelAccelerationStructure> VulkanGraphicsFactory::createTopLevelAccelerationStructure(StringView name, AccelerationStructureFlags flags) const
 {
 	return makeUnique<VulkanTopLevelAccelerationStructure>(flags, name);
-}
\ No newline at end of file
+}
+
+GraphicsMemoryStatistics VulkanGraphicsFactory::memoryStatistics() const
+{
+	auto statistics = m_impl->m_tracker.statistics();
+	statistics.Budgets = m_impl->budgets();
+	return statistics;
+}
+
+String VulkanGraphicsFactory::dumpMemoryAllocations() const
+{
+	char* json { nullptr };
+	::vmaBuildStatsString(m_impl->m_allocator, &json, VK_TRUE);
+	String result(json);
+	::vmaFreeStatsString(m_impl->m_allocator, json);
+	return result;
+}
+
+Float VulkanGraphicsFactory::memoryBudgetThreshold() const noexcept
+{
+	return m_impl->m_tracker.budgetThreshold();
+}
+
+void VulkanGraphicsFactory::setMemoryBudgetThreshold(Float threshold)
+{
+	m_impl->m_tracker.setBudgetThreshold(threshold);
+}
@@ -2,6 +2,10 @@
 
 using namespace LiteFX::Rendering::Backends;
 
+static inline Size2d capacityFor(const Size2d& size, UInt32 granularity) noexcept {
+    return { (size.width() + granularity - 1) / granularity * granularity, (size.height() + granularity - 1) / granularity * granularity };
+}
+
 // ------------------------------------------------------------------------------------------------
 // Implementation.
 // ------------------------------------------------------------------------------------------------
@@ -11,20 +15,36 @@ public:
 	friend class VulkanFrameBuffer;
 
 private:
-    Array<UniquePtr<IVulkanImage>> m_images;
+    // Stores images and views that have been replaced by a re-allocation, until the graphics queue has passed the fence.
+    struct RetiredImages {
+        UInt64 Fence;
+        Array<SharedPtr<IVulkanImage>> Images;
+        Array<VkImageView> Views;
+    };
+
+    Array<SharedPtr<IVulkanImage>> m_images;
     Dictionary<const IVulkanImage*, VkImageView> m_renderTargetHandles;
     Dictionary<UInt64, IVulkanImage*> m_mappedRenderTargets;
-	Size2d m_size;
+    Dictionary<const IVulkanImage*, std::pair<UInt32, UInt32>> m_transientLifetimes;
+    UniquePtr<VulkanTransientAllocator> m_transientAllocator;
+    Array<RetiredImages> m_retiredImages;
+	Size2d m_size, m_capacity;
+    UInt32 m_granularity { 1 };
+    UInt64 m_generation { 0 };
     const VulkanDevice& m_device;
 
 public:
     VulkanFrameBufferImpl(VulkanFrameBuffer* parent, const VulkanDevice& device, const Size2d& renderArea) :
-        base(parent), m_device(device), m_size(renderArea)
+        base(parent), m_device(device), m_size(renderArea), m_capacity(renderArea)
 	{
 	}
 
     ~VulkanFrameBufferImpl()
     {
+        if (!m_retiredImages.empty())
+            m_device.defaultQueue(QueueType::Graphics).waitFor(m_retiredImages.back().Fence);
+
+        this->releaseRetiredImages();
         this->cleanup();
     }
 
@@ -37,10 +57,26 @@ public:
         m_renderTargetHandles.clear();
     }
 
+    void releaseRetiredImages()
+    {
+        UInt64 completedFence { 0 };
+        ::vkGetSemaphoreCounterValue(m_device.handle(), m_device.defaultQueue(QueueType::Graphics).timelineSemaphore(), &completedFence);
+
+        std::erase_if(m_retiredImages, [&](const RetiredImages& retired) {
+            if (retired.Fence > completedFence)
+                return false;
+
+            for (auto view : retired.Views)
+                ::vkDestroyImageView(m_device.handle(), view, nullptr);
+
+            return true;
+        });
+    }
+
 	void initialize()
 	{
         // Define a factory callback for an image view.
-        auto getImageView = [&](const UniquePtr<IVulkanImage>& image) -> std::pair<const IVulkanImage*, VkImageView> {
+        auto getImageView = [&](const SharedPtr<IVulkanImage>& image) -> std::pair<const IVulkanImage*, VkImageView> {
             VkImageViewCreateInfo createInfo = {
                 .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
                 .pNext = nullptr,
@@ -76,8 +112,20 @@ public:
             return { image.get(), imageView };
         };
 
-        // Destroy the previous image views.
-        this->cleanup();
+        // Release the resources of frames that have completed and retire the previous image views, since frames that are still in flight may use them.
+        this->releaseRetiredImages();
+
+        if (!m_renderTargetHandles.empty())
+        {
+            m_retiredImages.push_back({
+                .Fence = m_device.defaultQueue(QueueType::Graphics).currentFence(),
+                .Views = m_renderTargetHandles | std::views::values | std::ranges::to<Array<VkImageView>>()
+            });
+
+            m_renderTargetHandles.clear();
+        }
+
+        m_generation++;
 
         // Create the image views for each image.
         m_renderTargetHandles = m_images | std::views::transform(getImageView) | std::ranges::to<Dictionary<const IVulkanImage*, VkImageView>>();
@@ -92,44 +140,121 @@ public:
 
     void resize(const Size2d& renderArea)
     {
-        // Resize/Re-allocate all images.
+        this->releaseRetiredImages();
         m_size = renderArea;
 
+        // Keep the images, if the render area still fits into them and they are not more than twice as large as required. Otherwise re-allocate them at the next capacity bucket.
+        auto capacity = ::capacityFor(renderArea, m_granularity);
+        bool sameCapacity = capacity.width() == m_capacity.width() && capacity.height() == m_capacity.height();
+        bool fits = renderArea.width() <= m_capacity.width() && renderArea.height() <= m_capacity.height();
+        bool wasteful = capacity.width() * capacity.height() * 2 <= m_capacity.width() * m_capacity.height();
+
+        if (sameCapacity || (m_granularity > 1 && fits && !wasteful))
+            return;
+
+        m_capacity = capacity;
+
+        if (m_transientAllocator != nullptr)
+            m_transientAllocator->clear();
+
+        this->recreate(false);
+    }
+
+    void addTransientImage(const String& name, Format format, MultiSamplingLevel samples, ResourceUsage usage, UInt32 firstUse, UInt32 lastUse)
+    {
+        if (m_transientAllocator == nullptr)
+            m_transientAllocator = makeUnique<VulkanTransientAllocator>(m_device);
+
+        // All transient images share their memory, so the other ones need to be re-created alongside the new image.
+        m_transientAllocator->clear();
+        auto image = m_transientAllocator->createTexture(name, format, m_capacity, ImageDimensions::DIM_2, 1u, 1u, samples, usage, firstUse, lastUse);
+        m_transientLifetimes[image.get()] = { firstUse, lastUse };
+        m_images.push_back(image);
+
+        this->recreate(true, image.get());
+    }
+
+private:
+    // Re-creates the images (or only the transient ones) at the current capacity and transitions them into their expected states. The transient allocator must have been
+    // cleared before. The `created` image has already been created by the transient allocator and is only transitioned. The replaced images are retired, so that frames
+    // that are still in flight can finish using them.
+    void recreate(bool transientOnly, const IVulkanImage* created = nullptr)
+    {
         // Recreate all resources.
         Dictionary<const IVulkanImage*, IVulkanImage*> imageReplacements;
+        Dictionary<const IVulkanImage*, std::pair<UInt32, UInt32>> transientLifetimes;
         auto& queue = m_device.defaultQueue(QueueType::Graphics);
         auto commandBuffer = queue.createCommandBuffer(true);
-        auto barrier = commandBuffer->makeBarrier(PipelineStage::None, PipelineStage::None);
+
+        // NOTE: Blocking all subsequent commands on the queue until the layouts have been transitioned allows us to submit without waiting for the queue.
+        auto barrier = commandBuffer->makeBarrier(PipelineStage::None, PipelineStage::All);
 
         auto images = m_images |
-            std::views::transform([&](const UniquePtr<IVulkanImage>& image) { 
-                auto format = image->format();
-                auto newImage = m_device.factory().createTexture(image->name(), format, renderArea, image->dimensions(), image->levels(), image->layers(), image->samples(), image->usage()); 
-                imageReplacements[image.get()] = newImage.get();
+            std::views::transform([&](const SharedPtr<IVulkanImage>& image) -> SharedPtr<IVulkanImage> {
+                auto lifetime = m_transientLifetimes.find(image.get());
+
+                if (lifetime == m_transientLifetimes.end())
+                {
+                    if (transientOnly)
+                        return image;
 
-                if (::hasDepth(format) || ::hasStencil(format))
-                    barrier->transition(*newImage, ResourceAccess::None, ResourceAccess::None, ImageLayout::DepthRead);
+                    auto newImage = m_device.factory().createTexture(image->name(), image->format(), m_capacity, image->dimensions(), image->levels(), image->layers(), image->samples(), image->usage());
+                    imageReplacements[image.get()] = newImage.get();
+                    return std::move(newImage);
+                }
+                else if (image.get() == created)
+                {
+                    transientLifetimes[image.get()] = lifetime->second;
+                    imageReplacements[image.get()] = image.get();
+                    return image;
+                }
                 else
-                    barrier->transition(*newImage, ResourceAccess::None, ResourceAccess::None, ImageLayout::ShaderResource);
+                {
+                    auto [firstUse, lastUse] = lifetime->second;
+                    auto newImage = m_transientAllocator->createTexture(image->name(), image->format(), m_capacity, image->dimensions(), image->levels(), image->layers(), image->samples(), image->usage(), firstUse, lastUse);
+                    transientLifetimes[newImage.get()] = lifetime->second;
+                    imageReplacements[image.get()] = newImage.get();
+                    return newImage;
+                }
+            }) | std::ranges::to<Array<SharedPtr<IVulkanImage>>>();
 
-                return std::move(newImage);
-            }) | std::views::as_rvalue | std::ranges::to<Array<UniquePtr<IVulkanImage>>>();
+        // Bind the transient images to their memory, before they are used.
+        if (m_transientAllocator != nullptr)
+            m_transientAllocator->allocate();
 
         // Transition the image layouts into their expected states.
+        for (auto newImage : imageReplacements | std::views::values)
+        {
+            if (::hasDepth(newImage->format()) || ::hasStencil(newImage->format()))
+                barrier->transition(*newImage, ResourceAccess::None, ResourceAccess::None, ImageLayout::DepthRead);
+            else
+                barrier->transition(*newImage, ResourceAccess::None, ResourceAccess::None, ImageLayout::ShaderResource);
+        }
+
         commandBuffer->barrier(*barrier);
         auto fence = queue.submit(commandBuffer);
 
         // Update the mappings.
-        std::ranges::for_each(m_mappedRenderTargets | std::views::values, [&imageReplacements](auto& image) { image = imageReplacements[image]; });
+        std::ranges::for_each(m_mappedRenderTargets | std::views::values, [&imageReplacements](auto& image) { 
+            if (auto replacement = imageReplacements.find(image); replacement != imageReplacements.end())
+                image = replacement->second;
+        });
+
+        // Retire the replaced images and all current image views, since frames that are still in flight may use them.
+        m_retiredImages.push_back({
+            .Fence = fence,
+            .Images = m_images | std::views::filter([&](const auto& image) { return imageReplacements.contains(image.get()) && image.get() != created; }) | std::ranges::to<Array<SharedPtr<IVulkanImage>>>(),
+            .Views = m_renderTargetHandles | std::views::values | std::ranges::to<Array<VkImageView>>()
+        });
+
+        m_renderTargetHandles.clear();
 
         // Store the new images.
         m_images = std::move(images);
+        m_transientLifetimes = std::move(transientLifetimes);
 
         // Re-initialize to update heaps and descriptors.
         this->initialize();
-
-        // Wait for the fence to finish.
-        queue.waitFor(fence);
     }
 };
 
@@ -156,7 +281,7 @@ VkImageView VulkanFrameBuffer::imageView(StringView imageName) const
 {
     auto nameHash = hash(imageName);
 
-    if (auto match = std::ranges::find_if(m_impl->m_images, [nameHash](UniquePtr<IVulkanImage>& image) { return hash(image->name()) == nameHash; }); match != m_impl->m_images.end())
+    if (auto match = std::ranges::find_if(m_impl->m_images, [nameHash](const SharedPtr<IVulkanImage>& image) { return hash(image->name()) == nameHash; }); match != m_impl->m_images.end())
         return m_impl->m_renderTargetHandles.at(match->get());
     else
         throw InvalidArgumentException("imageName", "The frame buffer does not contain an image with the name \"{0}\".", imageName);
@@ -175,6 +300,33 @@ const Size2d& VulkanFrameBuffer::size() const noexcept
 	return m_impl->m_size;
 }
 
+const Size2d& VulkanFrameBuffer::capacity() const noexcept
+{
+    return m_impl->m_capacity;
+}
+
+UInt32 VulkanFrameBuffer::capacityGranularity() const noexcept
+{
+    return m_impl->m_granularity;
+}
+
+void VulkanFrameBuffer::setCapacityGranularity(UInt32 granularity)
+{
+    if (granularity == 0) [[unlikely]]
+        throw InvalidArgumentException("granularity", "The capacity granularity must be at least one pixel.");
+
+    m_impl->m_granularity = granularity;
+
+    // If there are no images yet, the capacity can be changed right away.
+    if (m_impl->m_images.empty())
+        m_impl->m_capacity = ::capacityFor(m_impl->m_size, granularity);
+}
+
+UInt64 VulkanFrameBuffer::generation() const noexcept
+{
+    return m_impl->m_generation;
+}
+
 size_t VulkanFrameBuffer::getWidth() const noexcept
 {
 	return m_impl->m_size.width();
@@ -194,13 +346,14 @@ void VulkanFrameBuffer::mapRenderTarget(const RenderTarget& renderTarget, UInt32
         LITEFX_WARNING(VULKAN_LOG, "The render target format {0} does not match the image format {1} for image {2}.", renderTarget.format(), m_impl->m_images[index]->format(), index);
 
     m_impl->m_mappedRenderTargets[renderTarget.identifier()] = m_impl->m_images[index].get();
+    m_impl->m_generation++;
 }
 
 void VulkanFrameBuffer::mapRenderTarget(const RenderTarget& renderTarget, StringView name)
 {
     auto nameHash = hash(name);
 
-    if (auto match = std::ranges::find_if(m_impl->m_images, [nameHash](UniquePtr<IVulkanImage>& image) { return hash(image->name()) == nameHash; }); match != m_impl->m_images.end())
+    if (auto match = std::ranges::find_if(m_impl->m_images, [nameHash](const SharedPtr<IVulkanImage>& image) { return hash(image->name()) == nameHash; }); match != m_impl->m_images.end())
         this->mapRenderTarget(renderTarget, std::ranges::distance(m_impl->m_images.begin(), match));
     else
         throw InvalidArgumentException("name", "The frame buffer does not contain an image with the name \"{0}\".", name);
@@ -208,7 +361,8 @@ void VulkanFrameBuffer::mapRenderTarget(const RenderTarget& renderTarget, String
 
 void VulkanFrameBuffer::unmapRenderTarget(const RenderTarget& renderTarget) noexcept
 {
-    m_impl->m_mappedRenderTargets.erase(renderTarget.identifier());
+    if (m_impl->m_mappedRenderTargets.erase(renderTarget.identifier()) > 0)
+        m_impl->m_generation++;
 }
 
 Enumerable<const IVulkanImage*> VulkanFrameBuffer::images() const noexcept
@@ -249,7 +403,7 @@ void VulkanFrameBuffer::addImage(const String& name, Format format, MultiSamplin
         throw InvalidArgumentException("name", "Another image with the name {0} does already exist within the frame buffer.", name);
 
     // Add a new image...
-    m_impl->m_images.push_back(std::move(m_impl->m_device.factory().createTexture(name, format, m_impl->m_size, ImageDimensions::DIM_2, 1u, 1u, samples, usage)));
+    m_impl->m_images.push_back(std::move(m_impl->m_device.factory().createTexture(name, format, m_impl->m_capacity, ImageDimensions::DIM_2, 1u, 1u, samples, usage)));
 
     // ... and make sure it is in the right layout.
     auto& queue = m_impl->m_device.defaultQueue(QueueType::Graphics);
@@ -280,7 +434,7 @@ void VulkanFrameBuffer::addImage(const String& name, const RenderTarget& renderT
     // Add a new image...
     auto index = m_impl->m_images.size();
     auto format = renderTarget.format();
-    m_impl->m_images.push_back(std::move(m_impl->m_device.factory().createTexture(name, format, m_impl->m_size, ImageDimensions::DIM_2, 1u, 1u, samples, usage)));
+    m_impl->m_images.push_back(std::move(m_impl->m_device.factory().createTexture(name, format, m_impl->m_capacity, ImageDimensions::DIM_2, 1u, 1u, samples, usage)));
 
     // ... and make sure it is in the right layout.
     auto& queue = m_impl->m_device.defaultQueue(QueueType::Graphics);
@@ -308,4 +462,41 @@ void VulkanFrameBuffer::resize(const Size2d& renderArea)
     // Reset the size and re-initialize the frame buffer.
     m_impl->resize(renderArea);
     this->resized(this, { renderArea });
-}
\ No newline at end of file
+}
+
+void VulkanFrameBuffer::addImage(const String& name, Format format, UInt32 firstUse, UInt32 lastUse, MultiSamplingLevel samples, ResourceUsage usage)
+{
+    // Check if there's already another image with the same name.
+    auto nameHash = hash(name);
+
+    if (auto match = std::ranges::find_if(m_impl->m_images, [nameHash](auto& image) { return hash(image->name()) == nameHash; }); match != m_impl->m_images.end()) [[unlikely]]
+        throw InvalidArgumentException("name", "Another image with the name {0} does already exist within the frame buffer.", name);
+
+    // Add the image and re-allocate all transient images.
+    m_impl->addTransientImage(name, format, samples, usage, firstUse, lastUse);
+}
+
+void VulkanFrameBuffer::addImage(const String& name, const RenderTarget& renderTarget, UInt32 firstUse, UInt32 lastUse, MultiSamplingLevel samples, ResourceUsage usage)
+{
+    // Check if there's already another image with the same name.
+    auto nameHash = hash(name);
+
+    if (auto match = std::ranges::find_if(m_impl->m_images, [nameHash](auto& image) { return hash(image->name()) == nameHash; }); match != m_impl->m_images.end()) [[unlikely]]
+        throw InvalidArgumentException("name", "Another image with the name {0} does already exist within the frame buffer.", name);
+
+    // Add the image, re-allocate all transient images and map the render target to the image.
+    auto index = m_impl->m_images.size();
+    m_impl->addTransientImage(name, renderTarget.format(), samples, usage, firstUse, lastUse);
+    this->mapRenderTarget(renderTarget, static_cast<UInt32>(index));
+}
+
+void VulkanFrameBuffer::transitionTransientImages(VulkanBarrier& barrier, UInt32 use) const
+{
+    if (m_impl->m_transientAllocator != nullptr)
+        m_impl->m_transientAllocator->transition(barrier, use);
+}
+
+TransientMemoryStatistics VulkanFrameBuffer::transientMemoryStatistics() const noexcept
+{
+    return m_impl->m_transientAllocator == nullptr ? TransientMemoryStatistics { } : m_impl->m_transientAllocator->statistics();
+}
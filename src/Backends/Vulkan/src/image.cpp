@@ -51,8 +51,17 @@ VulkanImage::VulkanImage(const VulkanDevice& device, VkImage image, const Size3d
 
 VulkanImage::~VulkanImage() noexcept 
 {
-	if (m_impl->m_allocator != nullptr && m_impl->m_allocationInfo != nullptr)
+	// NOTE: Images without an allocation are bound to memory that is owned by someone else (e.g., the transient allocator), but still need to be destroyed.
+	if (m_impl->m_allocator != nullptr)
 	{
+		// Release the memory tracking record, if the image has been allocated by a graphics factory.
+		if (m_impl->m_allocationInfo != nullptr)
+		{
+			VmaAllocationInfo allocationInfo;
+			::vmaGetAllocationInfo(m_impl->m_allocator, m_impl->m_allocationInfo, &allocationInfo);
+			MemoryTracker::release(static_cast<MemoryTracker::Allocation*>(allocationInfo.pUserData));
+		}
+
 		::vmaDestroyImage(m_impl->m_allocator, this->handle(), m_impl->m_allocationInfo);
 		LITEFX_TRACE(VULKAN_LOG, "Destroyed image {0}", reinterpret_cast<void*>(this->handle()));
 	}
@@ -274,6 +283,10 @@ UniquePtr<VulkanImage> VulkanImage::allocate(const String& name, const VulkanDev
 	VmaAllocation allocation;
 
 	raiseIfFailed(::vmaCreateImage(allocator, &createInfo, &allocationInfo, &image, &allocation, allocationResult), "Unable to allocate texture.");
+
+	if (!name.empty())
+		::vmaSetAllocationName(allocator, allocation, name.c_str());
+
 	LITEFX_DEBUG(VULKAN_LOG, "Allocated image {0} with {1} bytes {{ Extent: {2}x{3} Px, Format: {4}, Levels: {5}, Layers: {6}, Samples: {8}, Usage: {7} }}", name.empty() ? std::format("{0}", reinterpret_cast<void*>(image)) : name, ::getSize(format) * extent.width() * extent.height(), extent.width(), extent.height(), format, levels, layers, usage, samples);
 
 	return makeUnique<VulkanImage>(device, image, extent, format, dimensions, levels, layers, samples, usage, allocator, allocation, name);
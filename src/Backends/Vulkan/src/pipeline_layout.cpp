@@ -14,14 +14,14 @@ public:
 
 private:
     UniquePtr<VulkanPushConstantsLayout> m_pushConstantsLayout;
-    Array<UniquePtr<VulkanDescriptorSetLayout>> m_descriptorSetLayouts;
+    Array<SharedPtr<const VulkanDescriptorSetLayout>> m_descriptorSetLayouts;
     const VulkanDevice& m_device;
 
 public:
     VulkanPipelineLayoutImpl(VulkanPipelineLayout* parent, const VulkanDevice& device, Enumerable<UniquePtr<VulkanDescriptorSetLayout>>&& descriptorLayouts, UniquePtr<VulkanPushConstantsLayout>&& pushConstantsLayout) :
         base(parent), m_device(device), m_pushConstantsLayout(std::move(pushConstantsLayout))
     {
-        m_descriptorSetLayouts = descriptorLayouts | std::views::as_rvalue | std::ranges::to<std::vector>();
+        m_descriptorSetLayouts = descriptorLayouts | std::views::as_rvalue | std::ranges::to<Array<SharedPtr<const VulkanDescriptorSetLayout>>>();
     }
 
     VulkanPipelineLayoutImpl(VulkanPipelineLayout* parent, const VulkanDevice& device) :
@@ -33,7 +33,7 @@ public:
     VkPipelineLayout initialize()
     {
         // Since Vulkan does not know spaces, descriptor sets are mapped to their indices based on the order they are defined. Hence we need to sort the descriptor set layouts accordingly.
-        std::ranges::sort(m_descriptorSetLayouts, [](const UniquePtr<VulkanDescriptorSetLayout>& a, const UniquePtr<VulkanDescriptorSetLayout>& b) { return a->space() < b->space(); });
+        std::ranges::sort(m_descriptorSetLayouts, [](const SharedPtr<const VulkanDescriptorSetLayout>& a, const SharedPtr<const VulkanDescriptorSetLayout>& b) { return a->space() < b->space(); });
 
         // Find unused and duplicate descriptor sets. Initialize with all the set indices up until the first set index is reached.
         Array<UInt32> emptySets;
@@ -41,7 +41,7 @@ public:
         if (!m_descriptorSetLayouts.empty())
             emptySets.append_range(std::views::iota(0u, m_descriptorSetLayouts.front()->space()));
 
-        for (Tuple spaces : m_descriptorSetLayouts | std::views::transform([](const UniquePtr<VulkanDescriptorSetLayout>& layout) { return layout->space(); }) | std::views::adjacent_transform<2>([](UInt32 a, UInt32 b) { return std::make_tuple(a, b); }))
+        for (Tuple spaces : m_descriptorSetLayouts | std::views::transform([](const SharedPtr<const VulkanDescriptorSetLayout>& layout) { return layout->space(); }) | std::views::adjacent_transform<2>([](UInt32 a, UInt32 b) { return std::make_tuple(a, b); }))
         {
             auto [a, b] = spaces;
 
@@ -56,19 +56,22 @@ public:
         if (!emptySets.empty())
         {
             for (auto s : emptySets)
-                m_descriptorSetLayouts.push_back(UniquePtr<VulkanDescriptorSetLayout>{ new VulkanDescriptorSetLayout(m_device, { }, s, ShaderStage::Any) }); // No descriptor can ever be allocated from an empty descriptor set.
+                m_descriptorSetLayouts.push_back(SharedPtr<const VulkanDescriptorSetLayout>{ new VulkanDescriptorSetLayout(m_device, { }, s, ShaderStage::Any) }); // No descriptor can ever be allocated from an empty descriptor set.
 
             // Re-order them.
-            std::ranges::sort(m_descriptorSetLayouts, [](const UniquePtr<VulkanDescriptorSetLayout>& a, const UniquePtr<VulkanDescriptorSetLayout>& b) { return a->space() < b->space(); });
+            std::ranges::sort(m_descriptorSetLayouts, [](const SharedPtr<const VulkanDescriptorSetLayout>& a, const SharedPtr<const VulkanDescriptorSetLayout>& b) { return a->space() < b->space(); });
         }
 
+        // Share descriptor set layouts with other pipeline layouts that define identical descriptor sets. This allows them to use the same descriptor pools and descriptor sets.
+        std::ranges::for_each(m_descriptorSetLayouts, [this](SharedPtr<const VulkanDescriptorSetLayout>& layout) { layout = m_device.internDescriptorSetLayout(std::move(layout)); });
+
         // Store the pipeline layout on the push constants.
         if (m_pushConstantsLayout != nullptr)
             m_pushConstantsLayout->pipelineLayout(*this->m_parent);
 
         // Query for the descriptor set layout handles.
         auto descriptorSetLayouts = m_descriptorSetLayouts |
-            std::views::transform([](const UniquePtr<VulkanDescriptorSetLayout>& layout) { return std::as_const(*layout.get()).handle(); }) |
+            std::views::transform([](const SharedPtr<const VulkanDescriptorSetLayout>& layout) { return std::as_const(*layout.get()).handle(); }) |
             std::ranges::to<Array<VkDescriptorSetLayout>>();
 
         // Query for push constant ranges.
@@ -120,7 +123,7 @@ const VulkanDevice& VulkanPipelineLayout::device() const noexcept
 
 const VulkanDescriptorSetLayout& VulkanPipelineLayout::descriptorSet(UInt32 space) const
 {
-    if (auto match = std::ranges::find_if(m_impl->m_descriptorSetLayouts, [&space](const UniquePtr<VulkanDescriptorSetLayout>& layout) { return layout->space() == space; }); match != m_impl->m_descriptorSetLayouts.end())
+    if (auto match = std::ranges::find_if(m_impl->m_descriptorSetLayouts, [&space](const SharedPtr<const VulkanDescriptorSetLayout>& layout) { return layout->space() == space; }); match != m_impl->m_descriptorSetLayouts.end())
         return *match->get();
 
     throw InvalidArgumentException("space", "No descriptor set layout uses the provided space {0}.", space);
@@ -128,7 +131,7 @@ const VulkanDescriptorSetLayout& VulkanPipelineLayout::descriptorSet(UInt32 spac
 
 Enumerable<const VulkanDescriptorSetLayout*> VulkanPipelineLayout::descriptorSets() const noexcept
 {
-    return m_impl->m_descriptorSetLayouts | std::views::transform([](const UniquePtr<VulkanDescriptorSetLayout>& layout) { return layout.get(); });
+    return m_impl->m_descriptorSetLayouts | std::views::transform([](const SharedPtr<const VulkanDescriptorSetLayout>& layout) { return layout.get(); });
 }
 
 const VulkanPushConstantsLayout* VulkanPipelineLayout::pushConstants() const noexcept
@@ -170,7 +173,7 @@ VulkanPipelineLayoutBuilder::~VulkanPipelineLayoutBuilder() noexcept = default;
 void VulkanPipelineLayoutBuilder::build()
 {
     auto instance = this->instance();
-    instance->m_impl->m_descriptorSetLayouts = std::move(m_state.descriptorSetLayouts);
+    instance->m_impl->m_descriptorSetLayouts = m_state.descriptorSetLayouts | std::views::as_rvalue | std::ranges::to<Array<SharedPtr<const VulkanDescriptorSetLayout>>>();
     instance->m_impl->m_pushConstantsLayout = std::move(m_state.pushConstantsLayout);
     instance->handle() = instance->m_impl->initialize();
 }
@@ -1,4 +1,5 @@
 #include <litefx/backends/vulkan.hpp>
+#include "buffer.h"
 
 using namespace LiteFX::Rendering::Backends;
 
@@ -84,6 +85,116 @@ public:
 
 		this->m_submittedCommandBuffers.erase(from, to);
 	}
+
+	UInt64 submitBarrier(const VulkanBarrier& barrier, const VulkanQueue* waitQueue = nullptr, UInt64 waitFence = 0)
+	{
+		// NOTE: The caller must hold the queue mutex.
+		auto commandBuffer = m_parent->createCommandBuffer(true);
+		commandBuffer->barrier(barrier);
+		commandBuffer->end();
+
+		auto fence = ++m_fenceValue;
+
+		VkSemaphoreSubmitInfo waitSemaphoreInfo = {
+			.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+			.semaphore = waitQueue != nullptr ? waitQueue->timelineSemaphore() : VK_NULL_HANDLE,
+			.value = waitFence,
+			.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT
+		};
+
+		VkSemaphoreSubmitInfo signalSemaphoreInfo = {
+			.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+			.semaphore = m_timelineSemaphore,
+			.value = fence,
+			.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT
+		};
+
+		VkCommandBufferSubmitInfo commandBufferInfo = {
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
+			.commandBuffer = commandBuffer->handle()
+		};
+
+		VkSubmitInfo2 submitInfo = {
+			.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+			.waitSemaphoreInfoCount = waitQueue != nullptr ? 1u : 0u,
+			.pWaitSemaphoreInfos = &waitSemaphoreInfo,
+			.commandBufferInfoCount = 1,
+			.pCommandBufferInfos = &commandBufferInfo,
+			.signalSemaphoreInfoCount = 1,
+			.pSignalSemaphoreInfos = &signalSemaphoreInfo
+		};
+
+		raiseIfFailed(::vkQueueSubmit2(m_parent->handle(), 1, &submitInfo, VK_NULL_HANDLE), "Unable to submit queue family ownership transfer.");
+		m_submittedCommandBuffers.push_back({ fence, commandBuffer });
+
+		return fence;
+	}
+
+	void transferOwnership(const VulkanQueue& source, Span<const VulkanBuffer* const> buffers)
+	{
+		// NOTE: The caller must hold the queue mutexes of both queues.
+		if (buffers.empty())
+			return;
+
+		// Queues of the same family can access the buffers without an ownership transfer.
+		if (source.familyId() != m_familyId)
+		{
+			// Release the buffers on the source queue and acquire them on this queue, after the release has been executed.
+			VulkanBarrier release(PipelineStage::All, PipelineStage::None), acquire(PipelineStage::None, PipelineStage::All);
+
+			for (auto buffer : buffers)
+			{
+				release.transition(*buffer, ResourceAccess::Common, ResourceAccess::None, source.familyId(), m_familyId);
+				acquire.transition(*buffer, ResourceAccess::None, ResourceAccess::Common, source.familyId(), m_familyId);
+			}
+
+			auto fence = source.m_impl->submitBarrier(release);
+			this->submitBarrier(acquire, &source, fence);
+		}
+
+		// Update the owner of the buffers.
+		std::ranges::for_each(buffers, [this](auto buffer) { buffer->setOwner(m_parent); });
+	}
+
+	void acquireOwnership(Span<const IVulkanBuffer* const> exclusiveBuffers)
+	{
+		// Group the buffers by the queue that currently owns them.
+		Dictionary<const VulkanQueue*, Array<const VulkanBuffer*>> transfers;
+
+		for (auto exclusiveBuffer : exclusiveBuffers)
+		{
+			auto buffer = dynamic_cast<const VulkanBuffer*>(exclusiveBuffer);
+
+			if (buffer == nullptr)
+				continue;
+
+			auto owner = buffer->owner();
+
+			if (owner == m_parent)
+				continue;
+
+			auto& buffers = transfers[owner];
+
+			if (std::ranges::find(buffers, buffer) == buffers.end())
+				buffers.push_back(buffer);
+		}
+
+		for (auto& [owner, buffers] : transfers)
+		{
+			if (owner == nullptr)
+			{
+				// Buffers that have not been used by any queue before do not require an ownership transfer.
+				std::ranges::for_each(buffers, [this](auto buffer) { buffer->claim(m_parent); });
+			}
+			else
+			{
+				// NOTE: Both queues submit barriers for the transfer, so both of their mutexes must be locked together to prevent deadlocks.
+				std::scoped_lock lock(owner->m_impl->m_mutex, m_mutex);
+				std::erase_if(buffers, [owner](const VulkanBuffer* buffer) { return buffer->owner() != owner; });
+				this->transferOwnership(*owner, buffers);
+			}
+		}
+	}
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -170,6 +281,9 @@ UInt64 VulkanQueue::submit(SharedPtr<const VulkanCommandBuffer> commandBuffer) c
 	if (commandBuffer->isSecondary()) [[unlikely]]
 		throw InvalidArgumentException("commandBuffer", "The command buffer must be a primary command buffer.");
 
+	// Transfer the ownership of all exclusive buffers used by the command buffer to this queue.
+	m_impl->acquireOwnership(commandBuffer->exclusiveBuffers());
+
 	std::lock_guard<std::mutex> lock(m_impl->m_mutex);
 
 	// Begin event.
@@ -225,6 +339,9 @@ UInt64 VulkanQueue::submit(const Enumerable<SharedPtr<const VulkanCommandBuffer>
 	if (!std::ranges::all_of(commandBuffers, [](const auto& buffer) { return !buffer->isSecondary(); })) [[unlikely]]
 		throw InvalidArgumentException("commandBuffers", "At least one command buffer is a secondary command buffer, which is not allowed to be submitted to a command queue.");
 
+	// Transfer the ownership of all exclusive buffers used by the command buffers to this queue.
+	std::ranges::for_each(commandBuffers, [this](const auto& buffer) { m_impl->acquireOwnership(buffer->exclusiveBuffers()); });
+
 	std::lock_guard<std::mutex> lock(m_impl->m_mutex);
 
 	// Begin event.
@@ -320,4 +437,4 @@ void VulkanQueue::waitFor(const VulkanQueue& queue, UInt64 fence) const noexcept
 UInt64 VulkanQueue::currentFence() const noexcept
 {
 	return m_impl->m_fenceValue;
-}
\ No newline at end of file
+}
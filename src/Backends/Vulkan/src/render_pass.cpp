@@ -12,15 +12,35 @@ public:
     friend class VulkanRenderPassBuilder;
     friend class VulkanRenderPass;
 
+private:
+    /// <summary>
+    /// Stores the state that is required to begin the render pass on a frame buffer, which only changes if the images of the frame buffer or their mappings change.
+    /// </summary>
+    struct FrameBufferContext {
+        size_t resizeToken{ 0 };
+        bool valid{ false };
+        UInt64 generation{ 0 };
+        VkRect2D renderArea{ };
+        Array<VkRenderingAttachmentInfo> colorAttachments{ };
+        Optional<VkRenderingAttachmentInfo> depthAttachment{ };
+        Optional<VkRenderingAttachmentInfo> stencilAttachment{ };
+        Optional<size_t> resolveAttachment{ };
+        Array<VkFormat> colorFormats{ };
+        VkCommandBufferInheritanceRenderingInfo inheritanceInfo{ };
+        Array<VkCommandBuffer> secondaryHandles{ };
+    };
+
 private:
     Array<RenderTarget> m_renderTargets;
     Array<RenderPassDependency> m_inputAttachments;
     Dictionary<const IFrameBuffer*, size_t> m_frameBufferTokens;
+    Dictionary<const IFrameBuffer*, FrameBufferContext> m_frameBufferContexts;
     Array<size_t> m_swapChainTokens;
     Dictionary<const IFrameBuffer*, SharedPtr<VulkanCommandBuffer>> m_primaryCommandBuffers;
     Dictionary<const IFrameBuffer*, Array<SharedPtr<VulkanCommandBuffer>>> m_secondaryCommandBuffers;
     Dictionary<const IVulkanImage*, VkImageView> m_swapChainViews;
     UInt32 m_secondaryCommandBufferCount = 0;
+    RenderPassRecordingMode m_recordingMode = RenderPassRecordingMode::Secondary;
     const VulkanFrameBuffer* m_activeFrameBuffer = nullptr;
     const RenderTarget* m_presentTarget = nullptr;
     const RenderTarget* m_depthStencilTarget = nullptr;
@@ -51,6 +71,9 @@ public:
         for (auto [frameBuffer, token] : m_frameBufferTokens)
             frameBuffer->released -= token;
 
+        for (auto& [frameBuffer, context] : m_frameBufferContexts)
+            frameBuffer->resized -= context.resizeToken;
+
         // Stop listening to swap chain events.
         for (auto token : m_swapChainTokens)
             m_swapChain.reseted -= token;
@@ -91,6 +114,23 @@ public:
         m_inputAttachments.assign(std::begin(inputAttachments), std::end(inputAttachments));
     }
 
+    void setRecordingMode(RenderPassRecordingMode mode)
+    {
+        // Parallel recording only pays off, if there is more than one thread recording commands. Otherwise fall back to inline recording.
+        if (mode == RenderPassRecordingMode::Parallel)
+            mode = m_secondaryCommandBufferCount > 1 ? RenderPassRecordingMode::Secondary : RenderPassRecordingMode::Inline;
+
+        if (mode == RenderPassRecordingMode::Inline && m_secondaryCommandBufferCount > 1) [[unlikely]]
+            LITEFX_WARNING(VULKAN_LOG, "Render pass {0} requested {1} command buffers, but only records inline. Only one command buffer will be available.", m_parent->name(), m_secondaryCommandBufferCount);
+
+        m_recordingMode = mode;
+    }
+
+    inline bool recordsInline() const noexcept
+    {
+        return m_recordingMode == RenderPassRecordingMode::Inline;
+    }
+
     void registerFrameBuffer(const VulkanFrameBuffer& frameBuffer)
     {
         // If the frame buffer is not yet registered, do so by listening for its release.
@@ -99,6 +139,7 @@ public:
         if (!m_frameBufferTokens.contains(interfacePointer)) [[unlikely]]
         {
             m_frameBufferTokens[interfacePointer] = frameBuffer.released.add(std::bind(&VulkanRenderPassImpl::onFrameBufferRelease, this, std::placeholders::_1, std::placeholders::_2));
+            m_frameBufferContexts[interfacePointer].resizeToken = frameBuffer.resized.add(std::bind(&VulkanRenderPassImpl::onFrameBufferResize, this, std::placeholders::_1, std::placeholders::_2));
 
             // Create primary command buffers.
             {
@@ -110,8 +151,8 @@ public:
                 m_primaryCommandBuffers[interfacePointer] = commandBuffer;
             }
 
-            // Create secondary command buffers.
-            m_secondaryCommandBuffers[interfacePointer] = std::views::iota(0u, m_secondaryCommandBufferCount) |
+            // Create secondary command buffers. If commands are recorded inline, we do not need any.
+            m_secondaryCommandBuffers[interfacePointer] = std::views::iota(0u, this->recordsInline() ? 0u : m_secondaryCommandBufferCount) |
                 std::views::transform([this](UInt32 i) {
                     auto commandBuffer = m_queue->createCommandBuffer(false, true);
 #ifndef NDEBUG
@@ -120,6 +161,11 @@ public:
 #endif
                     return commandBuffer;
                 }) | std::ranges::to<Array<SharedPtr<VulkanCommandBuffer>>>();
+
+            // Secondary command buffer handles never change, so they can be stored alongside the context.
+            m_frameBufferContexts[interfacePointer].secondaryHandles = m_secondaryCommandBuffers[interfacePointer] |
+                std::views::transform([](const auto& commandBuffer) { return std::as_const(*commandBuffer).handle(); }) |
+                std::ranges::to<Array<VkCommandBuffer>>();
         }
 
         // Store the active frame buffer pointer.
@@ -137,10 +183,23 @@ public:
         m_primaryCommandBuffers.erase(interfacePointer);
         m_secondaryCommandBuffers.erase(interfacePointer);
 
-        // Release the token.
+        // Release the tokens.
+        if (auto context = m_frameBufferContexts.find(interfacePointer); context != m_frameBufferContexts.end())
+        {
+            interfacePointer->resized -= context->second.resizeToken;
+            m_frameBufferContexts.erase(context);
+        }
+
         m_frameBufferTokens.erase(interfacePointer);
     }
 
+    void onFrameBufferResize(const void* sender, IFrameBuffer::ResizeEventArgs args)
+    {
+        // Invalidate the context, so that it gets re-created the next time the render pass begins on the frame buffer.
+        if (auto context = m_frameBufferContexts.find(reinterpret_cast<const IFrameBuffer*>(sender)); context != m_frameBufferContexts.end())
+            context->second.valid = false;
+    }
+
     void onSwapChainReset(const void* sender, ISwapChain::ResetEventArgs args)
     {
         // Release swap chain image views if there are any, so that they need to be re-created with the next context.
@@ -150,90 +209,133 @@ public:
         m_swapChainViews.clear();
     }
 
-    Array<VkRenderingAttachmentInfo> colorTargetContext(const VulkanFrameBuffer& frameBuffer)
+    VkImageView swapChainView(const IVulkanImage& backBuffer)
     {
-        return m_renderTargets | std::views::filter([](const RenderTarget& renderTarget) { return renderTarget.type() != RenderTargetType::DepthStencil; }) |
-            std::views::transform([this, &frameBuffer](const RenderTarget& renderTarget) {
-                // Create an attachment info.
-                VkRenderingAttachmentInfo attachmentInfo = {
-                    .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
-                    .imageView = frameBuffer.imageView(renderTarget),
-                    .imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
-                    .loadOp = renderTarget.clearBuffer() ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
-                    .storeOp = renderTarget.isVolatile() ? VK_ATTACHMENT_STORE_OP_NONE : VK_ATTACHMENT_STORE_OP_STORE,
-                    .clearValue = { renderTarget.clearValues().x(), renderTarget.clearValues().y(), renderTarget.clearValues().z(), renderTarget.clearValues().w() }
-                };
-
-                // Get the image and check if we need to resolve it.
-                if (renderTarget.type() == RenderTargetType::Present && frameBuffer[renderTarget].samples() > MultiSamplingLevel::x1)
-                {
-                    auto getImageView = [&](const IVulkanImage& image) -> VkImageView {
-                        VkImageViewCreateInfo createInfo = {
-                            .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
-                            .image = std::as_const(image).handle(),
-                            .viewType = VK_IMAGE_VIEW_TYPE_2D,
-                            .format = Vk::getFormat(image.format()),
-                            .components = VkComponentMapping {
-                                .r = VK_COMPONENT_SWIZZLE_IDENTITY,
-                                .g = VK_COMPONENT_SWIZZLE_IDENTITY,
-                                .b = VK_COMPONENT_SWIZZLE_IDENTITY,
-                                .a = VK_COMPONENT_SWIZZLE_IDENTITY
-                            },
-                            .subresourceRange = VkImageSubresourceRange {
-                                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
-                                .levelCount = 1,
-                                .layerCount = 1
-                            }
-                        };
-
-                        VkImageView imageView;
-                        raiseIfFailed(::vkCreateImageView(m_device.handle(), &createInfo, nullptr, &imageView), "Unable to create image view for swap chain back buffer.");
-                        return imageView;
-                    };
-
-                    // Create an image view if we don't already have one for the swap chain image.
-                    auto& backBuffer = m_swapChain.image();
-
-                    if (!m_swapChainViews.contains(&backBuffer))
-                        m_swapChainViews[&backBuffer] = getImageView(backBuffer);
-
-                    attachmentInfo.resolveMode = VK_RESOLVE_MODE_AVERAGE_BIT;
-                    attachmentInfo.resolveImageView = m_swapChainViews.at(&backBuffer);
-                    attachmentInfo.resolveImageLayout = Vk::getImageLayout(ImageLayout::ResolveDestination);
-                }
-
-                return attachmentInfo;
-            }) | std::ranges::to<Array<VkRenderingAttachmentInfo>>();
+        // Create an image view if we don't already have one for the swap chain image.
+        if (auto match = m_swapChainViews.find(&backBuffer); match != m_swapChainViews.end()) [[likely]]
+            return match->second;
+
+        VkImageViewCreateInfo createInfo = {
+            .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+            .image = std::as_const(backBuffer).handle(),
+            .viewType = VK_IMAGE_VIEW_TYPE_2D,
+            .format = Vk::getFormat(backBuffer.format()),
+            .components = VkComponentMapping {
+                .r = VK_COMPONENT_SWIZZLE_IDENTITY,
+                .g = VK_COMPONENT_SWIZZLE_IDENTITY,
+                .b = VK_COMPONENT_SWIZZLE_IDENTITY,
+                .a = VK_COMPONENT_SWIZZLE_IDENTITY
+            },
+            .subresourceRange = VkImageSubresourceRange {
+                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                .levelCount = 1,
+                .layerCount = 1
+            }
+        };
+
+        VkImageView imageView;
+        raiseIfFailed(::vkCreateImageView(m_device.handle(), &createInfo, nullptr, &imageView), "Unable to create image view for swap chain back buffer.");
+        return m_swapChainViews[&backBuffer] = imageView;
     }
 
-    Optional<VkRenderingAttachmentInfo> depthTargetContext(const VulkanFrameBuffer& frameBuffer)
+    void initializeContext(FrameBufferContext& context, const VulkanFrameBuffer& frameBuffer)
     {
-        if (m_depthStencilTarget == nullptr || !::hasDepth(m_depthStencilTarget->format()))
-            return std::nullopt;
-
-        return VkRenderingAttachmentInfo {
-            .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
-            .imageView = frameBuffer.imageView(*m_depthStencilTarget),
-            .imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
-            .loadOp = m_depthStencilTarget->clearBuffer() ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
-            .storeOp = m_depthStencilTarget->isVolatile() ? VK_ATTACHMENT_STORE_OP_NONE : VK_ATTACHMENT_STORE_OP_STORE,
-            .clearValue = { m_depthStencilTarget->clearValues().x(), m_depthStencilTarget->clearValues().x(), m_depthStencilTarget->clearValues().x(), m_depthStencilTarget->clearValues().x() }
+        context.renderArea = { 0, 0, static_cast<UInt32>(frameBuffer.size().width()), static_cast<UInt32>(frameBuffer.size().height()) };
+        context.colorAttachments.clear();
+        context.colorFormats.clear();
+        context.resolveAttachment = std::nullopt;
+
+        // Setup the color attachments and check the multi-sampling levels.
+        Optional<MultiSamplingLevel> samples{ std::nullopt };
+
+        for (const auto& renderTarget : m_renderTargets)
+        {
+            auto& image = frameBuffer[renderTarget];
+
+            if (!samples.has_value())
+                samples = image.samples();
+            else if (samples.value() != image.samples()) [[unlikely]]
+                throw RuntimeException("All render targets of the current render pass must use the multi sampling level.");
+
+            if (renderTarget.type() == RenderTargetType::DepthStencil)
+                continue;
+
+            context.colorFormats.push_back(Vk::getFormat(renderTarget.format()));
+            context.colorAttachments.push_back(VkRenderingAttachmentInfo {
+                .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+                .imageView = frameBuffer.imageView(renderTarget),
+                .imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                .loadOp = renderTarget.clearBuffer() ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
+                .storeOp = renderTarget.isVolatile() ? VK_ATTACHMENT_STORE_OP_NONE : VK_ATTACHMENT_STORE_OP_STORE,
+                .clearValue = { renderTarget.clearValues().x(), renderTarget.clearValues().y(), renderTarget.clearValues().z(), renderTarget.clearValues().w() }
+            });
+
+            // If the present target is multi-sampled, it needs to be resolved into the current back buffer. The resolve view is set when beginning the render pass.
+            if (renderTarget.type() == RenderTargetType::Present && image.samples() > MultiSamplingLevel::x1)
+            {
+                auto& attachmentInfo = context.colorAttachments.back();
+                attachmentInfo.resolveMode = VK_RESOLVE_MODE_AVERAGE_BIT;
+                attachmentInfo.resolveImageLayout = Vk::getImageLayout(ImageLayout::ResolveDestination);
+                context.resolveAttachment = context.colorAttachments.size() - 1;
+            }
+        }
+
+        // Setup the depth and stencil attachments.
+        if (m_depthStencilTarget != nullptr && ::hasDepth(m_depthStencilTarget->format()))
+        {
+            context.depthAttachment = VkRenderingAttachmentInfo {
+                .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+                .imageView = frameBuffer.imageView(*m_depthStencilTarget),
+                .imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                .loadOp = m_depthStencilTarget->clearBuffer() ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
+                .storeOp = m_depthStencilTarget->isVolatile() ? VK_ATTACHMENT_STORE_OP_NONE : VK_ATTACHMENT_STORE_OP_STORE,
+                .clearValue = { m_depthStencilTarget->clearValues().x(), m_depthStencilTarget->clearValues().x(), m_depthStencilTarget->clearValues().x(), m_depthStencilTarget->clearValues().x() }
+            };
+        }
+        else
+        {
+            context.depthAttachment = std::nullopt;
+        }
+
+        if (m_depthStencilTarget != nullptr && ::hasStencil(m_depthStencilTarget->format()))
+        {
+            context.stencilAttachment = VkRenderingAttachmentInfo {
+                .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+                .imageView = frameBuffer.imageView(*m_depthStencilTarget),
+                .imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                .loadOp = m_depthStencilTarget->clearStencil() ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
+                .storeOp = m_depthStencilTarget->isVolatile() ? VK_ATTACHMENT_STORE_OP_NONE : VK_ATTACHMENT_STORE_OP_STORE,
+                .clearValue = { m_depthStencilTarget->clearValues().y(), m_depthStencilTarget->clearValues().y(), m_depthStencilTarget->clearValues().y(), m_depthStencilTarget->clearValues().y() }
+            };
+        }
+        else
+        {
+            context.stencilAttachment = std::nullopt;
+        }
+
+        // Setup the inheritance info for secondary command buffers.
+        context.inheritanceInfo = {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO,
+            .colorAttachmentCount = static_cast<UInt32>(context.colorFormats.size()),
+            .pColorAttachmentFormats = context.colorFormats.data(),
+            .depthAttachmentFormat = context.depthAttachment.has_value() ? Vk::getFormat(m_depthStencilTarget->format()) : VK_FORMAT_UNDEFINED,
+            .stencilAttachmentFormat = context.stencilAttachment.has_value() ? Vk::getFormat(m_depthStencilTarget->format()) : VK_FORMAT_UNDEFINED,
+            .rasterizationSamples = Vk::getSamples(samples.value_or(MultiSamplingLevel::x1))
         };
+
+        context.generation = frameBuffer.generation();
+        context.valid = true;
     }
 
-    Optional<VkRenderingAttachmentInfo> stencilTargetContext(const VulkanFrameBuffer& frameBuffer)
+    FrameBufferContext& getContext(const VulkanFrameBuffer& frameBuffer)
     {
-        if (m_depthStencilTarget == nullptr || !::hasStencil(m_depthStencilTarget->format()))
-            return std::nullopt;
-
-        return VkRenderingAttachmentInfo {
-            .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
-            .imageView = frameBuffer.imageView(*m_depthStencilTarget),
-            .imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
-            .loadOp = m_depthStencilTarget->clearStencil() ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
-            .storeOp = m_depthStencilTarget->isVolatile() ? VK_ATTACHMENT_STORE_OP_NONE : VK_ATTACHMENT_STORE_OP_STORE,
-            .clearValue = { m_depthStencilTarget->clearValues().y(), m_depthStencilTarget->clearValues().y(), m_depthStencilTarget->clearValues().y(), m_depthStencilTarget->clearValues().y() }
-        };
+        auto& context = m_frameBufferContexts.at(static_cast<const IFrameBuffer*>(&frameBuffer));
+
+        // Re-create the context, if the frame buffer has been resized or its image views have been re-created since the context has been initialized.
+        if (!context.valid || context.generation != frameBuffer.generation()) [[unlikely]]
+            this->initializeContext(context, frameBuffer);
+
+        return context;
     }
 
     inline SharedPtr<VulkanCommandBuffer> getPrimaryCommandBuffer(const VulkanFrameBuffer& frameBuffer)
@@ -305,8 +407,11 @@ SharedPtr<const VulkanCommandBuffer> VulkanRenderPass::commandBuffer(UInt32 inde
     if (m_impl->m_activeFrameBuffer == nullptr) [[unlikely]]
         throw RuntimeException("Unable to lookup command buffers on a render pass that has not been begun.");
 
-    if (index >= m_impl->m_secondaryCommandBufferCount) [[unlikely]]
-        throw ArgumentOutOfRangeException("index", 0u, m_impl->m_secondaryCommandBufferCount, index, "The render pass only contains {0} command buffers, but an index of {1} has been provided.", m_impl->m_secondaryCommandBufferCount, index);
+    if (index >= this->secondaryCommandBuffers()) [[unlikely]]
+        throw ArgumentOutOfRangeException("index", 0u, this->secondaryCommandBuffers(), index, "The render pass only contains {0} command buffers, but an index of {1} has been provided.", this->secondaryCommandBuffers(), index);
+
+    if (m_impl->recordsInline())
+        return m_impl->getPrimaryCommandBuffer(*m_impl->m_activeFrameBuffer);
 
     return m_impl->m_secondaryCommandBuffers[m_impl->m_activeFrameBuffer][index];
 }
@@ -316,12 +421,29 @@ Enumerable<SharedPtr<const VulkanCommandBuffer>> VulkanRenderPass::commandBuffer
     if (m_impl->m_secondaryCommandBufferCount == 0u || m_impl->m_activeFrameBuffer == nullptr)
         return { };
 
+    if (m_impl->recordsInline())
+        return { SharedPtr<const VulkanCommandBuffer>(m_impl->getPrimaryCommandBuffer(*m_impl->m_activeFrameBuffer)) };
+
     return m_impl->m_secondaryCommandBuffers[m_impl->m_activeFrameBuffer];
 }
 
 UInt32 VulkanRenderPass::secondaryCommandBuffers() const noexcept
 {
-    return m_impl->m_secondaryCommandBufferCount;
+    // When recording inline, the primary command buffer is the only command buffer that can be recorded to.
+    return m_impl->recordsInline() ? std::min(m_impl->m_secondaryCommandBufferCount, 1u) : m_impl->m_secondaryCommandBufferCount;
+}
+
+RenderPassRecordingMode VulkanRenderPass::recordingMode() const noexcept
+{
+    return m_impl->m_recordingMode;
+}
+
+const VkCommandBufferInheritanceRenderingInfo& VulkanRenderPass::inheritanceInfo() const
+{
+    if (m_impl->m_activeFrameBuffer == nullptr) [[unlikely]]
+        throw RuntimeException("Unable to obtain the inheritance info of a render pass that has not been begun.");
+
+    return m_impl->getContext(*m_impl->m_activeFrameBuffer).inheritanceInfo;
 }
 
 const Array<RenderTarget>& VulkanRenderPass::renderTargets() const noexcept
@@ -369,23 +491,24 @@ void VulkanRenderPass::begin(const VulkanFrameBuffer& frameBuffer) const
     // Register the frame buffer.
     m_impl->registerFrameBuffer(frameBuffer);
 
-    // Initialize the render pass context.
-    auto colorTargetInfos  = m_impl->colorTargetContext(frameBuffer);
-    auto depthTargetInfo   = m_impl->depthTargetContext(frameBuffer);
-    auto stencilTargetInfo = m_impl->stencilTargetContext(frameBuffer);
+    // Get the render pass context and point the resolve attachment to the current back buffer, if required.
+    auto& context = m_impl->getContext(frameBuffer);
+    const auto& backBufferImage = m_impl->m_swapChain.image();
+    bool requiresResolve = context.resolveAttachment.has_value();
 
-    // Build up the rendering info to begin the render pass.
-    VkRect2D renderArea = { 0, 0, static_cast<UInt32>(frameBuffer.size().width()), static_cast<UInt32>(frameBuffer.size().height()) };
+    if (requiresResolve)
+        context.colorAttachments[context.resolveAttachment.value()].resolveImageView = m_impl->swapChainView(backBufferImage);
 
+    // Build up the rendering info to begin the render pass.
     VkRenderingInfo renderingInfo = {
         .sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
-        .flags = VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT,
-        .renderArea = renderArea,
+        .flags = m_impl->recordsInline() ? 0u : static_cast<VkRenderingFlags>(VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT),
+        .renderArea = context.renderArea,
         .layerCount = 1,
-        .colorAttachmentCount = static_cast<UInt32>(colorTargetInfos.size()),
-        .pColorAttachments = colorTargetInfos.data(),
-        .pDepthAttachment = depthTargetInfo.has_value() ? &depthTargetInfo.value() : nullptr,
-        .pStencilAttachment = stencilTargetInfo.has_value() ? &stencilTargetInfo.value() : nullptr
+        .colorAttachmentCount = static_cast<UInt32>(context.colorAttachments.size()),
+        .pColorAttachments = context.colorAttachments.data(),
+        .pDepthAttachment = context.depthAttachment.has_value() ? &context.depthAttachment.value() : nullptr,
+        .pStencilAttachment = context.stencilAttachment.has_value() ? &context.stencilAttachment.value() : nullptr
     };
 
     // Begin the command recording on the frame buffers command buffer. Before we can do that, we need to make sure it has not being executed anymore.
@@ -405,9 +528,6 @@ void VulkanRenderPass::begin(const VulkanFrameBuffer& frameBuffer) const
     });
 
     // If the present target is multi-sampled, transition the back buffer image into resolve state.
-    const auto& backBufferImage = m_impl->m_swapChain.image();
-    bool requiresResolve = this->hasPresentTarget() && frameBuffer[*m_impl->m_presentTarget].samples() > MultiSamplingLevel::x1;
-
     if (requiresResolve)
     {
         VulkanBarrier resolveBarrier(PipelineStage::None, PipelineStage::Resolve);
@@ -444,15 +564,25 @@ UInt64 VulkanRenderPass::end() const
 
     // End secondary command buffers and end rendering.
     auto primaryCommandBuffer = m_impl->getPrimaryCommandBuffer(frameBuffer);
-    auto secondaryHandles = m_impl->getSecondaryCommandBuffers(frameBuffer) |
-        std::views::transform([](auto commandBuffer) { commandBuffer->end(); return std::as_const(*commandBuffer).handle(); }) |
-        std::ranges::to<Array<VkCommandBuffer>>();
-    ::vkCmdExecuteCommands(std::as_const(*primaryCommandBuffer).handle(), static_cast<UInt32>(secondaryHandles.size()), secondaryHandles.data());
+
+    auto& context = m_impl->getContext(frameBuffer);
+
+    if (!m_impl->recordsInline())
+    {
+        // NOTE: The primary command buffer needs to know the buffers used by the secondary ones, so that the queue can acquire their ownership on submit.
+        std::ranges::for_each(m_impl->getSecondaryCommandBuffers(frameBuffer), [&primaryCommandBuffer](auto& commandBuffer) { 
+            commandBuffer->end(); 
+            primaryCommandBuffer->inheritExclusiveBuffers(*commandBuffer);
+        });
+
+        ::vkCmdExecuteCommands(std::as_const(*primaryCommandBuffer).handle(), static_cast<UInt32>(context.secondaryHandles.size()), context.secondaryHandles.data());
+    }
+
     ::vkCmdEndRendering(std::as_const(*primaryCommandBuffer).handle());
 
     // If the present target is multi-sampled, we need to resolve it to the back buffer.
     const auto& backBufferImage = m_impl->m_swapChain.image();
-    bool requiresResolve = this->hasPresentTarget() && frameBuffer[*m_impl->m_presentTarget].samples() > MultiSamplingLevel::x1;
+    bool requiresResolve = context.resolveAttachment.has_value();
 
     // Transition the present and depth/stencil views.
     VulkanBarrier renderTargetBarrier(PipelineStage::RenderTarget, PipelineStage::None), depthStencilBarrier(PipelineStage::DepthStencil, PipelineStage::None),
@@ -497,8 +627,19 @@ UInt64 VulkanRenderPass::end() const
         beginPresentBarrier.transition(backBufferImage, ResourceAccess::None, ResourceAccess::TransferWrite, ImageLayout::Undefined, ImageLayout::CopyDestination);
         primaryCommandBuffer->barrier(beginPresentBarrier);
 
+        // NOTE: Frame buffer images may be allocated with a larger capacity than the back buffer, so only the rendered area is copied.
         auto& presentTarget = frameBuffer[*m_impl->m_presentTarget];
-        primaryCommandBuffer->transfer(presentTarget, backBufferImage);
+        VkImageCopy copyInfo = {
+            .srcSubresource = { .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .layerCount = 1 },
+            .dstSubresource = { .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT, .layerCount = 1 },
+            .extent = { 
+                static_cast<UInt32>(std::min({ frameBuffer.size().width(), presentTarget.extent().width(), backBufferImage.extent().width() })), 
+                static_cast<UInt32>(std::min({ frameBuffer.size().height(), presentTarget.extent().height(), backBufferImage.extent().height() })), 
+                1 
+            }
+        };
+
+        ::vkCmdCopyImage(std::as_const(*primaryCommandBuffer).handle(), std::as_const(presentTarget).handle(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, std::as_const(backBufferImage).handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copyInfo);
 
         VulkanBarrier endPresentBarrier(PipelineStage::Transfer, PipelineStage::None);
         endPresentBarrier.transition(presentTarget, ResourceAccess::TransferRead, ResourceAccess::None, ImageLayout::CopySource, ImageLayout::ShaderResource);
@@ -552,6 +693,7 @@ void VulkanRenderPassBuilder::build()
     instance->m_impl->mapInputAttachments(m_state.inputAttachments);
     instance->m_impl->m_inputAttachmentSamplerBinding = m_state.inputAttachmentSamplerBinding;
     instance->m_impl->m_secondaryCommandBufferCount = m_state.commandBufferCount;
+    instance->m_impl->setRecordingMode(m_state.recordingMode);
 }
 
 RenderPassDependency VulkanRenderPassBuilder::makeInputAttachment(DescriptorBindingPoint binding, const RenderTarget& renderTarget)
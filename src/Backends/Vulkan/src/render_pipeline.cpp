@@ -526,6 +526,11 @@ void VulkanRenderPipeline::bind(const VulkanCommandBuffer& commandBuffer, Span<c
 	}
 }
 
+void VulkanRenderPipeline::bind(const VulkanCommandBuffer& commandBuffer, const VulkanDescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets) const noexcept
+{
+	::vkCmdBindDescriptorSets(commandBuffer.handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, std::as_const(*m_impl->m_layout).handle(), descriptorSet.layout().space(), 1, &descriptorSet.handle(), static_cast<UInt32>(dynamicOffsets.size()), dynamicOffsets.data());
+}
+
 #if defined(LITEFX_BUILD_DEFINE_BUILDERS)
 // ------------------------------------------------------------------------------------------------
 // Builder interface.
@@ -1,5 +1,7 @@
 #include <litefx/backends/vulkan.hpp>
 #include <fstream>
+#include <cstring>
+#include <mutex>
 
 using namespace LiteFX::Rendering::Backends;
 
@@ -13,10 +15,19 @@ public:
 
 private:
 	ShaderStage m_type;
-	String m_fileName, m_entryPoint, m_bytecode;
+	String m_fileName, m_entryPoint;
 	const VulkanDevice& m_device;
 	Optional<DescriptorBindingPoint> m_shaderLocalDescriptor;
 
+	// NOTE: The bytecode either points into a mapped file, a shader archive or into an aligned buffer, if the module has been loaded from a stream.
+	SharedPtr<const MappedFile> m_file;
+	SharedPtr<const ShaderArchive> m_archive;
+	Array<UInt32> m_buffer;
+	StringView m_bytecode;
+	UInt64 m_hash { 0 }, m_size { 0 };
+	bool m_fromFile { false };
+	std::mutex m_bytecodeMutex;
+
 public:
 	VulkanShaderModuleImpl(VulkanShaderModule* parent, const VulkanDevice& device, ShaderStage type, const String& fileName, const String& entryPoint, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor) :
 		base(parent), m_device(device), m_fileName(fileName), m_entryPoint(entryPoint), m_type(type), m_shaderLocalDescriptor(shaderLocalDescriptor)
@@ -24,38 +35,76 @@ public:
 	}
 
 private:
-	String readFileContents(const String& fileName) 
+	void mapFile()
 	{
-		std::ifstream file(fileName, std::ios::in | std::ios::binary);
-		
-		if (!file.is_open())
-			throw std::runtime_error("Unable to open shader file.");
-
-		return this->readStreamContents(file);
+		m_file = makeShared<MappedFile>(m_fileName);
+		m_bytecode = StringView(reinterpret_cast<const char*>(m_file->data().data()), m_file->size());
 	}
 
-	String readStreamContents(std::istream& stream)
+	void readStreamContents(std::istream& stream)
 	{
-		return String(std::istreambuf_iterator<char>(stream), {});
+		// Read the whole stream at once into a buffer that is aligned to 4 bytes, as required for SPIR-V. If the stream is not seekable, fall back to streaming it.
+		auto start = stream.tellg();
+
+		if (start != std::istream::pos_type(-1) && stream.seekg(0, std::ios::end))
+		{
+			auto size = static_cast<size_t>(stream.tellg() - start);
+			stream.seekg(start);
+			m_buffer.resize((size + sizeof(UInt32) - 1) / sizeof(UInt32));
+
+			if (!stream.read(reinterpret_cast<char*>(m_buffer.data()), size)) [[unlikely]]
+				throw RuntimeException("Unable to read shader module {0} from stream.", m_fileName);
+
+			m_bytecode = StringView(reinterpret_cast<const char*>(m_buffer.data()), size);
+		}
+		else
+		{
+			stream.clear();
+			String contents(std::istreambuf_iterator<char>(stream), {});
+			m_buffer.resize((contents.size() + sizeof(UInt32) - 1) / sizeof(UInt32));
+			std::memcpy(m_buffer.data(), contents.data(), contents.size());
+			m_bytecode = StringView(reinterpret_cast<const char*>(m_buffer.data()), contents.size());
+		}
 	}
 
 public:
 	VkShaderModule initialize()
 	{
-		return this->initialize(this->readFileContents(m_fileName));
+		m_fromFile = true;
+		this->mapFile();
+		m_hash = LiteFX::hash(m_bytecode);
+		return this->createModule();
 	}
 
 	VkShaderModule initialize(std::istream& stream)
 	{
-		return this->initialize(this->readStreamContents(stream));
+		this->readStreamContents(stream);
+		m_hash = LiteFX::hash(m_bytecode);
+		return this->createModule();
 	}
 
-	VkShaderModule initialize(String fileContents)
+	VkShaderModule initialize(const SharedPtr<const ShaderArchive>& archive)
 	{
+		// The archive already stores the hash of the uncompressed bytecode, so it does not need to be computed again.
+		const auto& entry = archive->entry(m_fileName);
+		const auto bytecode = archive->bytecode(m_fileName);
+		m_archive = archive;
+		m_entryPoint = entry.EntryPoint;
+		m_bytecode = StringView(reinterpret_cast<const char*>(bytecode.data()), bytecode.size());
+		m_hash = entry.Hash;
+		return this->createModule();
+	}
+
+	VkShaderModule createModule()
+	{
+		if (m_bytecode.empty() || m_bytecode.size() % sizeof(UInt32) != 0) [[unlikely]]
+			throw RuntimeException("The shader module {0} does not contain valid SPIR-V bytecode.", m_fileName);
+
+		// The bytecode is passed to the driver without copying it, which is valid, since both, the mapped file and the stream buffer are aligned.
 		VkShaderModuleCreateInfo createInfo = {};
 		createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-		createInfo.codeSize = fileContents.size();
-		createInfo.pCode = reinterpret_cast<const uint32_t*>(fileContents.c_str());
+		createInfo.codeSize = m_bytecode.size();
+		createInfo.pCode = reinterpret_cast<const uint32_t*>(m_bytecode.data());
 
 		VkShaderModule module;
 
@@ -66,9 +115,41 @@ public:
 		m_device.setDebugName(*reinterpret_cast<const UInt64*>(&module), VK_DEBUG_REPORT_OBJECT_TYPE_SHADER_MODULE_EXT, std::format("{0}: {1}", m_fileName, m_entryPoint));
 #endif
 
-		m_bytecode = fileContents;
+		m_size = m_bytecode.size();
 		return module;
 	}
+
+	StringView bytecode()
+	{
+		std::lock_guard<std::mutex> lock(m_bytecodeMutex);
+
+		// Restore the bytecode, if it has been released before.
+		if (m_bytecode.empty() && m_fromFile)
+			this->mapFile();
+		else if (m_bytecode.empty() && m_archive != nullptr)
+		{
+			const auto bytecode = m_archive->bytecode(m_fileName);
+			m_bytecode = StringView(reinterpret_cast<const char*>(bytecode.data()), bytecode.size());
+		}
+
+		return m_bytecode;
+	}
+
+	void releaseBytecode() noexcept
+	{
+		std::lock_guard<std::mutex> lock(m_bytecodeMutex);
+
+		// Modules loaded from a stream can not restore their bytecode, so it is kept. The archive owns the bytecode of archived modules, so only the view is reset.
+		if (m_fromFile)
+		{
+			m_bytecode = { };
+			m_file = nullptr;
+		}
+		else if (m_archive != nullptr)
+		{
+			m_bytecode = { };
+		}
+	}
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -87,6 +168,15 @@ VulkanShaderModule::VulkanShaderModule(const VulkanDevice& device, ShaderStage t
 	this->handle() = m_impl->initialize(stream);
 }
 
+VulkanShaderModule::VulkanShaderModule(const VulkanDevice& device, ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor) :
+	Resource<VkShaderModule>(VK_NULL_HANDLE), m_impl(makePimpl<VulkanShaderModuleImpl>(this, device, type, name, "main", shaderLocalDescriptor))
+{
+	if (archive == nullptr) [[unlikely]]
+		throw ArgumentNotInitializedException("archive", "The shader archive must be initialized.");
+
+	this->handle() = m_impl->initialize(archive);
+}
+
 VulkanShaderModule::~VulkanShaderModule() noexcept
 {
 	::vkDestroyShaderModule(m_impl->m_device.handle(), this->handle(), nullptr);
@@ -107,9 +197,24 @@ const String& VulkanShaderModule::entryPoint() const noexcept
 	return m_impl->m_entryPoint;
 }
 
-const String& VulkanShaderModule::bytecode() const noexcept
+StringView VulkanShaderModule::bytecode() const
+{
+	return m_impl->bytecode();
+}
+
+UInt64 VulkanShaderModule::bytecodeHash() const noexcept
+{
+	return m_impl->m_hash;
+}
+
+UInt64 VulkanShaderModule::bytecodeSize() const noexcept
+{
+	return m_impl->m_size;
+}
+
+void VulkanShaderModule::releaseBytecode() const noexcept
 {
-	return m_impl->m_bytecode;
+	m_impl->releaseBytecode();
 }
 
 VkPipelineShaderStageCreateInfo VulkanShaderModule::shaderStageDefinition() const
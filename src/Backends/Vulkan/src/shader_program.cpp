@@ -3,6 +3,8 @@
 #include <spirv_reflect.h>
 #include <fstream>
 #include <numeric>
+#include <mutex>
+#include <spanstream>
 
 using namespace LiteFX::Rendering::Backends;
 
@@ -91,6 +93,33 @@ private:
         UInt32 size;
     };
 
+    struct ModuleDescriptorSetInfo {
+    public:
+        UInt32 space;
+        Array<DescriptorInfo> descriptors;
+    };
+
+    struct ModulePushConstantInfo {
+    public:
+        UInt32 offset;
+        UInt32 size;
+    };
+
+    struct ModuleReflectionInfo {
+    public:
+        UInt64 bytecodeSize;
+        Array<ModuleDescriptorSetInfo> descriptorSets;
+        Array<ModulePushConstantInfo> pushConstants;
+    };
+
+private:
+    // NOTE: Reflection results only depend on the shader bytecode, so they are shared between all devices and shader programs.
+    static inline Dictionary<UInt64, SharedPtr<const ModuleReflectionInfo>> s_reflectionCache;
+    static inline std::mutex s_reflectionCacheMutex;
+
+    static constexpr UInt32 REFLECTION_CACHE_MAGIC = 0x52584C4C; // "LLXR"
+    static constexpr UInt32 REFLECTION_CACHE_VERSION = 1;
+
 public:
     VulkanShaderProgramImpl(VulkanShaderProgram* parent, const VulkanDevice& device, Enumerable<UniquePtr<VulkanShaderModule>>&& modules) :
         base(parent), m_device(device)
@@ -194,120 +223,326 @@ public:
             throw InvalidArgumentException("modules", "A shader program that contains only a fragment/pixel shader is not valid.");
     }
 
-    SharedPtr<VulkanPipelineLayout> reflectPipelineLayout()
+    static SharedPtr<const ModuleReflectionInfo> cachedReflection(UInt64 key, UInt64 size)
     {
-        // First, filter the descriptor sets and push constant ranges.
-        Dictionary<UInt32, DescriptorSetInfo> descriptorSetLayouts;
-        Array<PushConstantRangeInfo> pushConstantRanges;
+        // The bytecode size is stored alongside the hash to sort out trivial collisions.
+        std::lock_guard<std::mutex> lock(s_reflectionCacheMutex);
 
-        // Extract reflection data from all shader modules.
-        std::ranges::for_each(m_modules, [this, &descriptorSetLayouts, &pushConstantRanges](UniquePtr<VulkanShaderModule>& shaderModule) {
-            // Read the file and initialize a reflection module.
-            auto bytecode = shaderModule->bytecode();
-            spv_reflect::ShaderModule reflection(bytecode.size(), bytecode.c_str());
-            auto result = reflection.GetResult();
+        if (auto match = s_reflectionCache.find(key); match != s_reflectionCache.end() && match->second->bytecodeSize == size)
+            return match->second;
 
-            if (result != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
-                throw RuntimeException("Unable to reflect shader module (Error {0:x}).", static_cast<UInt32>(reflection.GetResult()));
+        return nullptr;
+    }
 
-            // Get the number of descriptor sets and push constants.
-            UInt32 descriptorSetCount, pushConstantCount;
+    static SharedPtr<const ModuleReflectionInfo> reflect(const VulkanShaderModule& shaderModule)
+    {
+        // Check if the module has already been reflected before, in which case the bytecode does not need to be touched at all.
+        if (auto reflection = cachedReflection(shaderModule.bytecodeHash(), shaderModule.bytecodeSize()); reflection != nullptr)
+            return reflection;
 
-            if ((result = reflection.EnumerateDescriptorSets(&descriptorSetCount, nullptr)) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
-                throw RuntimeException("Unable to get descriptor set count (Error {0:x}).", static_cast<UInt32>(result));
+        auto bytecode = shaderModule.bytecode();
 
-            if ((result = reflection.EnumeratePushConstants(&pushConstantCount, nullptr)) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
-                throw RuntimeException("Unable to get push constants count (Error {0:x}).", static_cast<UInt32>(result));
+        if (bytecode.empty()) [[unlikely]]
+            throw RuntimeException("Unable to reflect shader module {0}: the bytecode has been released and no cached reflection result is available.", shaderModule.fileName());
 
-            // Acquire the descriptor sets and push constants.
-            Array<SpvReflectDescriptorSet*> descriptorSets(descriptorSetCount);
-            Array<SpvReflectBlockVariable*> pushConstants(pushConstantCount);
+        return reflect(bytecode, shaderModule.bytecodeHash());
+    }
 
-            if ((result = reflection.EnumerateDescriptorSets(&descriptorSetCount, descriptorSets.data())) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
-                throw RuntimeException("Unable to enumerate descriptor sets (Error {0:x}).", static_cast<UInt32>(result));
+    static SharedPtr<const ModuleReflectionInfo> reflect(StringView bytecode, UInt64 key)
+    {
+        if (auto reflection = cachedReflection(key, bytecode.size()); reflection != nullptr)
+            return reflection;
 
-            if ((result = reflection.EnumeratePushConstants(&pushConstantCount, pushConstants.data())) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
-                throw RuntimeException("Unable to enumerate push constants (Error {0:x}).", static_cast<UInt32>(result));
+        // Initialize a reflection module.
+        spv_reflect::ShaderModule reflection(bytecode.size(), bytecode.data());
+        auto result = reflection.GetResult();
 
-            // Parse the descriptor sets.
-            std::ranges::for_each(descriptorSets, [this, &shaderModule, &reflection, &descriptorSetLayouts](const SpvReflectDescriptorSet* descriptorSet) {
-                // Get all descriptor layouts.
-                Array<DescriptorInfo> descriptors(descriptorSet->binding_count);
+        if (result != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
+            throw RuntimeException("Unable to reflect shader module (Error {0:x}).", static_cast<UInt32>(reflection.GetResult()));
 
-                std::ranges::generate(descriptors, [&descriptorSet, i = 0]() mutable {
-                    auto descriptor = descriptorSet->bindings[i++];
+        // Get the number of descriptor sets and push constants.
+        UInt32 descriptorSetCount, pushConstantCount;
 
-                    // Filter the descriptor type.
-                    DescriptorType type;
-                    UInt32 inputAttachmentIndex = 0;
+        if ((result = reflection.EnumerateDescriptorSets(&descriptorSetCount, nullptr)) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
+            throw RuntimeException("Unable to get descriptor set count (Error {0:x}).", static_cast<UInt32>(result));
 
-                    switch (descriptor->descriptor_type)
-                    {
-                    default: throw RuntimeException("Unsupported descriptor type detected.");
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:     throw RuntimeException("The shader exposes a combined image samplers, which is currently not supported.");
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:     throw RuntimeException("The shader exposes a dynamic buffer, which is currently not supported.");
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:           type = DescriptorType::InputAttachment; inputAttachmentIndex = descriptor->input_attachment_index; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_SAMPLER:                    type = DescriptorType::Sampler; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_SAMPLED_IMAGE:              type = DescriptorType::Texture; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_IMAGE:              type = DescriptorType::RWTexture; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_UNIFORM_BUFFER:             type = DescriptorType::ConstantBuffer; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:       type = DescriptorType::Buffer; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:       type = DescriptorType::RWBuffer; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: type = DescriptorType::AccelerationStructure; break;
-                    case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_BUFFER:
-                    {
-                        // NOTE: Storage buffers need special care here. For more information see: 
-                        //       https://github.com/microsoft/DirectXShaderCompiler/blob/main/docs/SPIR-V.rst#constant-texture-structured-byte-buffers.
-                        //       Structured buffers and byte address buffers all translate into storage buffers, which in Vulkan terms only differ in how they are bound. We still try to approximate 
-                        //       which buffer type was used for compilation, but at least for how Vulkan is concerned it does not matter anyway.
-                        // TODO: There's also  `TextureBuffer`/`tbuffer`, that lands here. But how does it relate to texel buffers?
-                        
-                        // All buffers should have at least one member that stores the type info about the contained type. Descriptor arrays are of type `SpvOpTypeRuntimeArray`. To differentiate
-                        // between `ByteAddressBuffer` and `StructuredBuffer`, we check the type flags of the first member. If it identifies an array of DWORDs, we treat the descriptor as 
-                        // `ByteAddressBuffer`, though it could be a flavor of `StructuredBuffer<int>`. This is conceptually identical, so it ultimately makes no difference.
-                        if ((descriptor->type_description->members[0].type_flags & SPV_REFLECT_TYPE_FLAG_STRUCT) == SPV_REFLECT_TYPE_FLAG_STRUCT)
-                            type = (descriptor->resource_type & SPV_REFLECT_RESOURCE_FLAG_SRV) == SPV_REFLECT_RESOURCE_FLAG_SRV ? DescriptorType::StructuredBuffer : DescriptorType::RWStructuredBuffer;
-                        else
-                            type = (descriptor->resource_type & SPV_REFLECT_RESOURCE_FLAG_SRV) == SPV_REFLECT_RESOURCE_FLAG_SRV ? DescriptorType::ByteAddressBuffer : DescriptorType::RWByteAddressBuffer;
-
-                        break;
-                    }
-                    }
+        if ((result = reflection.EnumeratePushConstants(&pushConstantCount, nullptr)) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
+            throw RuntimeException("Unable to get push constants count (Error {0:x}).", static_cast<UInt32>(result));
+
+        // Acquire the descriptor sets and push constants.
+        Array<SpvReflectDescriptorSet*> descriptorSets(descriptorSetCount);
+        Array<SpvReflectBlockVariable*> pushConstants(pushConstantCount);
+
+        if ((result = reflection.EnumerateDescriptorSets(&descriptorSetCount, descriptorSets.data())) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
+            throw RuntimeException("Unable to enumerate descriptor sets (Error {0:x}).", static_cast<UInt32>(result));
+
+        if ((result = reflection.EnumeratePushConstants(&pushConstantCount, pushConstants.data())) != SPV_REFLECT_RESULT_SUCCESS) [[unlikely]]
+            throw RuntimeException("Unable to enumerate push constants (Error {0:x}).", static_cast<UInt32>(result));
+
+        auto info = makeShared<ModuleReflectionInfo>(ModuleReflectionInfo{ .bytecodeSize = bytecode.size() });
+
+        // Parse the descriptor sets.
+        std::ranges::for_each(descriptorSets, [&info](const SpvReflectDescriptorSet* descriptorSet) {
+            // Get all descriptor layouts.
+            Array<DescriptorInfo> descriptors(descriptorSet->binding_count);
+
+            std::ranges::generate(descriptors, [&descriptorSet, i = 0]() mutable {
+                auto descriptor = descriptorSet->bindings[i++];
+
+                // Filter the descriptor type.
+                DescriptorType type;
+                UInt32 inputAttachmentIndex = 0;
+
+                switch (descriptor->descriptor_type)
+                {
+                default: throw RuntimeException("Unsupported descriptor type detected.");
+                case SPV_REFLECT_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:     throw RuntimeException("The shader exposes a combined image samplers, which is currently not supported.");
+                case SPV_REFLECT_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:     type = DescriptorType::DynamicConstantBuffer; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:     type = (descriptor->resource_type & SPV_REFLECT_RESOURCE_FLAG_SRV) == SPV_REFLECT_RESOURCE_FLAG_SRV ? DescriptorType::DynamicStructuredBuffer : DescriptorType::RWDynamicStructuredBuffer; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:           type = DescriptorType::InputAttachment; inputAttachmentIndex = descriptor->input_attachment_index; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_SAMPLER:                    type = DescriptorType::Sampler; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_SAMPLED_IMAGE:              type = DescriptorType::Texture; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_IMAGE:              type = DescriptorType::RWTexture; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_UNIFORM_BUFFER:             type = DescriptorType::ConstantBuffer; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:       type = DescriptorType::Buffer; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:       type = DescriptorType::RWBuffer; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: type = DescriptorType::AccelerationStructure; break;
+                case SPV_REFLECT_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                {
+                    // NOTE: Storage buffers need special care here. For more information see: 
+                    //       https://github.com/microsoft/DirectXShaderCompiler/blob/main/docs/SPIR-V.rst#constant-texture-structured-byte-buffers.
+                    //       Structured buffers and byte address buffers all translate into storage buffers, which in Vulkan terms only differ in how they are bound. We still try to approximate 
+                    //       which buffer type was used for compilation, but at least for how Vulkan is concerned it does not matter anyway.
+                    // TODO: There's also  `TextureBuffer`/`tbuffer`, that lands here. But how does it relate to texel buffers?
+                    
+                    // All buffers should have at least one member that stores the type info about the contained type. Descriptor arrays are of type `SpvOpTypeRuntimeArray`. To differentiate
+                    // between `ByteAddressBuffer` and `StructuredBuffer`, we check the type flags of the first member. If it identifies an array of DWORDs, we treat the descriptor as 
+                    // `ByteAddressBuffer`, though it could be a flavor of `StructuredBuffer<int>`. This is conceptually identical, so it ultimately makes no difference.
+                    if ((descriptor->type_description->members[0].type_flags & SPV_REFLECT_TYPE_FLAG_STRUCT) == SPV_REFLECT_TYPE_FLAG_STRUCT)
+                        type = (descriptor->resource_type & SPV_REFLECT_RESOURCE_FLAG_SRV) == SPV_REFLECT_RESOURCE_FLAG_SRV ? DescriptorType::StructuredBuffer : DescriptorType::RWStructuredBuffer;
+                    else
+                        type = (descriptor->resource_type & SPV_REFLECT_RESOURCE_FLAG_SRV) == SPV_REFLECT_RESOURCE_FLAG_SRV ? DescriptorType::ByteAddressBuffer : DescriptorType::RWByteAddressBuffer;
+
+                    break;
+                }
+                }
+
+                // Count the array elements.
+                // NOTE: Actually there is a difference between declaring a descriptor an array (e.g. `StructuredBuffer<T> buffers[10]`) and declaring an array of descriptors 
+                //       (e.g. `StructuredBuffer<T> buffers[]`). The first variant only takes up a single descriptor, to which a buffer array can be bound. The second variant describes an 
+                //       variable-sized array of descriptors (aka runtime array). In the engine we treat both identically. A runtime array is defined as a descriptor with 0xFFFFFFFF elements.
+                //       Theoretically, we could bind a buffer array to an descriptor within a descriptor array, which is currently an unsupported use case. In the future, we might want to have
+                //       a separate descriptor flag for descriptor arrays and array descriptors and also provide methods to bind them both.
+                UInt32 descriptors = 1;
+
+                if (descriptor->type_description->op == SpvOp::SpvOpTypeRuntimeArray)
+                    descriptors = std::numeric_limits<UInt32>::max();   // Unbounded.
+                else
+                    for (int i(0); i < descriptor->array.dims_count; ++i)
+                        descriptors *= descriptor->array.dims[i];
+
+                // Create the descriptor layout.
+                return DescriptorInfo{ .location = descriptor->binding, .elementSize = descriptor->block.padded_size, .elements = descriptors, .inputAttachmentIndex = inputAttachmentIndex, .type = type };
+            });
+
+            info->descriptorSets.push_back(ModuleDescriptorSetInfo{ .space = descriptorSet->set, .descriptors = std::move(descriptors) });
+        });
+
+        // Parse push constants.
+        std::ranges::for_each(pushConstants, [&info](const SpvReflectBlockVariable* pushConstant) {
+            info->pushConstants.push_back(ModulePushConstantInfo{ .offset = pushConstant->absolute_offset, .size = pushConstant->padded_size });
+        });
+
+        // Store the reflection result.
+        std::lock_guard<std::mutex> lock(s_reflectionCacheMutex);
+        s_reflectionCache[key] = info;
+        return info;
+    }
+
+    static void saveReflectionCache(std::ostream& stream)
+    {
+        auto write = [&stream](auto value) { stream.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+
+        std::lock_guard<std::mutex> lock(s_reflectionCacheMutex);
+        write(REFLECTION_CACHE_MAGIC);
+        write(REFLECTION_CACHE_VERSION);
+        write(static_cast<UInt32>(s_reflectionCache.size()));
+
+        for (const auto& [key, info] : s_reflectionCache)
+        {
+            write(key);
+            write(info->bytecodeSize);
+            write(static_cast<UInt32>(info->descriptorSets.size()));
+
+            for (const auto& descriptorSet : info->descriptorSets)
+            {
+                write(descriptorSet.space);
+                write(static_cast<UInt32>(descriptorSet.descriptors.size()));
+
+                for (const auto& descriptor : descriptorSet.descriptors)
+                {
+                    write(descriptor.location);
+                    write(descriptor.elementSize);
+                    write(descriptor.elements);
+                    write(descriptor.inputAttachmentIndex);
+                    write(static_cast<UInt32>(descriptor.type));
+                }
+            }
+
+            write(static_cast<UInt32>(info->pushConstants.size()));
+
+            for (const auto& pushConstant : info->pushConstants)
+            {
+                write(pushConstant.offset);
+                write(pushConstant.size);
+            }
+        }
+
+        if (stream.fail()) [[unlikely]]
+            throw RuntimeException("Unable to write the shader reflection cache.");
+    }
+
+    static bool isValidDescriptorType(UInt32 type) noexcept
+    {
+        switch (static_cast<DescriptorType>(type))
+        {
+        case DescriptorType::ConstantBuffer:
+        case DescriptorType::StructuredBuffer:
+        case DescriptorType::RWStructuredBuffer:
+        case DescriptorType::Texture:
+        case DescriptorType::RWTexture:
+        case DescriptorType::Sampler:
+        case DescriptorType::InputAttachment:
+        case DescriptorType::Buffer:
+        case DescriptorType::RWBuffer:
+        case DescriptorType::ByteAddressBuffer:
+        case DescriptorType::RWByteAddressBuffer:
+        case DescriptorType::AccelerationStructure:
+        case DescriptorType::DynamicConstantBuffer:
+        case DescriptorType::DynamicStructuredBuffer:
+        case DescriptorType::RWDynamicStructuredBuffer:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    static void loadReflectionCache(std::istream& stream)
+    {
+        auto read = [&stream]<typename T>() -> T {
+            T value;
+
+            if (!stream.read(reinterpret_cast<char*>(&value), sizeof(T))) [[unlikely]]
+                throw RuntimeException("Unable to read the shader reflection cache: unexpected end of stream.");
+
+            return value;
+        };
+
+        // If the stream is seekable, element counts are checked against the remaining length, so that a corrupted count fails early. Otherwise the arrays are 
+        // only grown while elements are actually read, so that a corrupted count can never cause a large allocation.
+        Optional<std::streamoff> length { std::nullopt };
+
+        if (auto position = stream.tellg(); position != std::streampos(-1))
+        {
+            stream.seekg(0, std::ios::end);
+            length = stream.tellg() - std::streampos(0);
+            stream.seekg(position);
+        }
+
+        auto readCount = [&]<size_t ElementSize>(StringView element) -> UInt32 {
+            auto count = read.operator()<UInt32>();
+
+            if (length.has_value() && static_cast<UInt64>(count) * ElementSize > static_cast<UInt64>(length.value() - (stream.tellg() - std::streampos(0)))) [[unlikely]]
+                throw RuntimeException("Unable to read the shader reflection cache: the stream is too short to contain {0} {1}.", count, element);
+
+            return count;
+        };
 
-                    // Count the array elements.
-                    // NOTE: Actually there is a difference between declaring a descriptor an array (e.g. `StructuredBuffer<T> buffers[10]`) and declaring an array of descriptors 
-                    //       (e.g. `StructuredBuffer<T> buffers[]`). The first variant only takes up a single descriptor, to which a buffer array can be bound. The second variant describes an 
-                    //       variable-sized array of descriptors (aka runtime array). In the engine we treat both identically. A runtime array is defined as a descriptor with 0xFFFFFFFF elements.
-                    //       Theoretically, we could bind a buffer array to an descriptor within a descriptor array, which is currently an unsupported use case. In the future, we might want to have
-                    //       a separate descriptor flag for descriptor arrays and array descriptors and also provide methods to bind them both.
-                    UInt32 descriptors = 1;
+        if (read.operator()<UInt32>() != REFLECTION_CACHE_MAGIC) [[unlikely]]
+            throw RuntimeException("Unable to read the shader reflection cache: the stream does not contain a shader reflection cache.");
 
-                    if (descriptor->type_description->op == SpvOp::SpvOpTypeRuntimeArray)
-                        descriptors = std::numeric_limits<UInt32>::max();   // Unbounded.
+        if (auto version = read.operator()<UInt32>(); version != REFLECTION_CACHE_VERSION) [[unlikely]]
+            throw RuntimeException("Unable to read the shader reflection cache: unsupported version {0} (expected version {1}).", version, REFLECTION_CACHE_VERSION);
+
+        // The smallest possible sizes of the serialized elements.
+        constexpr size_t ENTRY_SIZE = sizeof(UInt64) * 2 + sizeof(UInt32) * 2;
+        constexpr size_t DESCRIPTOR_SET_SIZE = sizeof(UInt32) * 2;
+        constexpr size_t DESCRIPTOR_SIZE = sizeof(UInt32) * 5;
+        constexpr size_t PUSH_CONSTANT_SIZE = sizeof(UInt32) * 2;
+
+        // Read all entries before publishing them, so that a corrupted stream does not leave the cache in a partial state.
+        Dictionary<UInt64, SharedPtr<const ModuleReflectionInfo>> entries;
+        auto count = readCount.operator()<ENTRY_SIZE>("entries");
+
+        for (UInt32 i { 0 }; i < count; ++i)
+        {
+            auto key = read.operator()<UInt64>();
+            auto info = makeShared<ModuleReflectionInfo>(ModuleReflectionInfo{ .bytecodeSize = read.operator()<UInt64>() });
+            auto descriptorSets = readCount.operator()<DESCRIPTOR_SET_SIZE>("descriptor sets");
+
+            for (UInt32 set { 0 }; set < descriptorSets; ++set)
+            {
+                auto& descriptorSet = info->descriptorSets.emplace_back(ModuleDescriptorSetInfo{ .space = read.operator()<UInt32>() });
+                auto descriptors = readCount.operator()<DESCRIPTOR_SIZE>("descriptors");
+
+                for (UInt32 d { 0 }; d < descriptors; ++d)
+                {
+                    auto& descriptor = descriptorSet.descriptors.emplace_back();
+                    descriptor.location = read.operator()<UInt32>();
+                    descriptor.elementSize = read.operator()<UInt32>();
+                    descriptor.elements = read.operator()<UInt32>();
+                    descriptor.inputAttachmentIndex = read.operator()<UInt32>();
+
+                    if (auto type = read.operator()<UInt32>(); isValidDescriptorType(type)) [[likely]]
+                        descriptor.type = static_cast<DescriptorType>(type);
                     else
-                        for (int i(0); i < descriptor->array.dims_count; ++i)
-                            descriptors *= descriptor->array.dims[i];
+                        throw RuntimeException("Unable to read the shader reflection cache: invalid descriptor type 0x{0:08X}.", type);
+                }
+            }
+
+            auto pushConstants = readCount.operator()<PUSH_CONSTANT_SIZE>("push constant ranges");
+
+            for (UInt32 p { 0 }; p < pushConstants; ++p)
+            {
+                auto& pushConstant = info->pushConstants.emplace_back();
+                pushConstant.offset = read.operator()<UInt32>();
+                pushConstant.size = read.operator()<UInt32>();
+            }
 
-                    // Create the descriptor layout.
-                    return DescriptorInfo{ .location = descriptor->binding, .elementSize = descriptor->block.padded_size, .elements = descriptors, .inputAttachmentIndex = inputAttachmentIndex, .type = type };
-                });
+            entries[key] = info;
+        }
+
+        std::lock_guard<std::mutex> lock(s_reflectionCacheMutex);
+        s_reflectionCache.merge(entries);
+    }
 
-                if (!descriptorSetLayouts.contains(descriptorSet->set))
-                    descriptorSetLayouts.insert(std::make_pair(descriptorSet->set, DescriptorSetInfo{ .space = descriptorSet->set, .stage = shaderModule->type(), .descriptors = descriptors }));
+    SharedPtr<VulkanPipelineLayout> reflectPipelineLayout()
+    {
+        // First, filter the descriptor sets and push constant ranges.
+        Dictionary<UInt32, DescriptorSetInfo> descriptorSetLayouts;
+        Array<PushConstantRangeInfo> pushConstantRanges;
+
+        // Extract reflection data from all shader modules.
+        std::ranges::for_each(m_modules, [&descriptorSetLayouts, &pushConstantRanges](UniquePtr<VulkanShaderModule>& shaderModule) {
+            auto reflection = VulkanShaderProgramImpl::reflect(*shaderModule);
+
+            // Merge the descriptor sets.
+            std::ranges::for_each(reflection->descriptorSets, [&shaderModule, &descriptorSetLayouts](const ModuleDescriptorSetInfo& descriptorSet) {
+                if (!descriptorSetLayouts.contains(descriptorSet.space))
+                    descriptorSetLayouts.insert(std::make_pair(descriptorSet.space, DescriptorSetInfo{ .space = descriptorSet.space, .stage = shaderModule->type(), .descriptors = descriptorSet.descriptors }));
                 else
                 {
                     // If the set already exists in another stage, merge it.
-                    auto& layout = descriptorSetLayouts[descriptorSet->set];
+                    auto& layout = descriptorSetLayouts[descriptorSet.space];
 
-                    for (auto& descriptor : descriptors)
+                    for (auto& descriptor : descriptorSet.descriptors)
                     {
                         // Add the descriptor, if no other descriptor has been bound to the location. Otherwise, check if the descriptors are equal and drop it, if they aren't.
                         if (auto match = std::ranges::find_if(layout.descriptors, [&descriptor](const DescriptorInfo& element) { return element.location == descriptor.location; }); match == layout.descriptors.end())
                             layout.descriptors.push_back(descriptor);
                         else if (!descriptor.equals(*match))
                             LITEFX_WARNING(VULKAN_LOG, "Mismatching descriptors detected: the descriptor at location {0} ({3} elements with size of {4} bytes) of the descriptor set {1} in shader stage {2} conflicts with a descriptor from at least one other shader stage and will be dropped (conflicts with descriptor of type {8} in stage/s {5} with {6} elements of {7} bytes).",
-                                descriptor.location, descriptorSet->set, shaderModule->type(), descriptor.elements, descriptor.elementSize, layout.stage, match->elements, match->elementSize, match->type);
+                                descriptor.location, descriptorSet.space, shaderModule->type(), descriptor.elements, descriptor.elementSize, layout.stage, match->elements, match->elementSize, match->type);
                     }
 
                     // Store the stage.
@@ -315,17 +550,20 @@ public:
                 }
             });
 
-            // Parse push constants.
+            // Merge push constants.
             // NOTE: Block variables are not exposing the shader stage, they are used from. If there are two shader modules created from the same source, but with different 
             //       entry points, each using their own push constants, it would be valid, but we are not able to tell which push constant range belongs to which stage.
-            if (pushConstantCount > 1)
+            if (reflection->pushConstants.size() > 1)
                 LITEFX_WARNING(VULKAN_LOG, "More than one push constant range detected for shader stage {0}. If you have multiple entry points, you may be able to split them up into different shader files.", shaderModule->type());
 
-            std::ranges::for_each(pushConstants, [this, &shaderModule, &reflection, &pushConstantRanges](const SpvReflectBlockVariable* pushConstant) {
-                pushConstantRanges.push_back(PushConstantRangeInfo{ .stage = shaderModule->type(), .offset = pushConstant->absolute_offset, .size = pushConstant->padded_size });
+            std::ranges::for_each(reflection->pushConstants, [&shaderModule, &pushConstantRanges](const ModulePushConstantInfo& pushConstant) {
+                pushConstantRanges.push_back(PushConstantRangeInfo{ .stage = shaderModule->type(), .offset = pushConstant.offset, .size = pushConstant.size });
             });
         });
 
+        // The reflection results are cached now, so the bytecode is no longer required. Modules only release bytecode they are able to restore, in case the cache gets cleared.
+        std::ranges::for_each(m_modules, [](const UniquePtr<VulkanShaderModule>& shaderModule) { shaderModule->releaseBytecode(); });
+
         // Create the descriptor set layouts.
         auto descriptorSets = [this, &descriptorSetLayouts]() -> std::generator<UniquePtr<VulkanDescriptorSetLayout>> {
             for (auto it = descriptorSetLayouts.begin(); it != descriptorSetLayouts.end(); ++it)
@@ -353,8 +591,8 @@ public:
         auto overallSize = std::accumulate(pushConstantRanges.begin(), pushConstantRanges.end(), 0, [](UInt32 currentSize, const auto& range) { return currentSize + range.size; });
         auto pushConstantsLayout = makeUnique<VulkanPushConstantsLayout>(std::move(pushConstants), overallSize);
 
-        // Return the pipeline layout.
-        return makeShared<VulkanPipelineLayout>(m_device, std::move(descriptorSets), std::move(pushConstantsLayout));
+        // Return the pipeline layout, or an equal one that is already used by another pipeline.
+        return m_device.internPipelineLayout(makeShared<VulkanPipelineLayout>(m_device, std::move(descriptorSets), std::move(pushConstantsLayout)));
     }
 };
 
@@ -390,6 +628,38 @@ SharedPtr<VulkanPipelineLayout> VulkanShaderProgram::reflectPipelineLayout() con
     return m_impl->reflectPipelineLayout();
 }
 
+void VulkanShaderProgram::cacheReflection(StringView bytecode)
+{
+    VulkanShaderProgramImpl::reflect(bytecode, LiteFX::hash(bytecode));
+}
+
+void VulkanShaderProgram::loadReflectionCache(std::istream& stream)
+{
+    VulkanShaderProgramImpl::loadReflectionCache(stream);
+}
+
+void VulkanShaderProgram::loadReflectionCache(const ShaderArchive& archive)
+{
+    auto data = archive.reflectionData();
+
+    if (data.empty())
+        return;
+
+    std::ispanstream stream(Span<const char>(reinterpret_cast<const char*>(data.data()), data.size()));
+    VulkanShaderProgramImpl::loadReflectionCache(stream);
+}
+
+void VulkanShaderProgram::saveReflectionCache(std::ostream& stream)
+{
+    VulkanShaderProgramImpl::saveReflectionCache(stream);
+}
+
+void VulkanShaderProgram::clearReflectionCache() noexcept
+{
+    std::lock_guard<std::mutex> lock(VulkanShaderProgramImpl::s_reflectionCacheMutex);
+    VulkanShaderProgramImpl::s_reflectionCache.clear();
+}
+
 #if defined(LITEFX_BUILD_DEFINE_BUILDERS)
 // ------------------------------------------------------------------------------------------------
 // Shader program builder implementation.
@@ -435,4 +705,9 @@ UniquePtr<VulkanShaderModule> VulkanShaderProgramBuilder::makeShaderModule(Shade
 {
     return makeUnique<VulkanShaderModule>(m_impl->m_device, type, stream, name, entryPoint, shaderLocalDescriptor);
 }
+
+UniquePtr<VulkanShaderModule> VulkanShaderProgramBuilder::makeShaderModule(ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor)
+{
+    return makeUnique<VulkanShaderModule>(m_impl->m_device, type, archive, name, shaderLocalDescriptor);
+}
 #endif // defined(LITEFX_BUILD_DEFINE_BUILDERS)
\ No newline at end of file
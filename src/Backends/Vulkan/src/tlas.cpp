@@ -18,6 +18,8 @@ public:
 private:
     Array<Instance> m_instances { };
     AccelerationStructureFlags m_flags;
+    SharedPtr<const IVulkanBuffer> m_instanceBuffer;
+    UInt32 m_firstInstance { }, m_instanceCount { }, m_builtInstances { };
     SharedPtr<const IVulkanBuffer> m_buffer;
     UInt64 m_offset { }, m_size { };
     const VulkanDevice* m_device { nullptr };
@@ -32,6 +34,11 @@ public:
     }
 
 public:
+    inline UInt32 instanceCount() const noexcept
+    {
+        return m_instanceBuffer != nullptr ? m_instanceCount : static_cast<UInt32>(m_instances.size());
+    }
+
     Array<VkAccelerationStructureInstanceKHR> buildInfo() const
     {
         return m_instances | std::views::transform([](const Instance& instance) { 
@@ -51,6 +58,8 @@ public:
     }
 };
 
+static_assert(sizeof(VkAccelerationStructureInstanceKHR) == sizeof(ITopLevelAccelerationStructure::PackedInstance), "The packed instance layout does not match the Vulkan instance layout.");
+
 // ------------------------------------------------------------------------------------------------
 // Shared interface.
 // ------------------------------------------------------------------------------------------------
@@ -139,6 +148,7 @@ void VulkanTopLevelAccelerationStructure::build(const VulkanCommandBuffer& comma
     m_impl->m_offset = offset;
     m_impl->m_buffer = buffer;
     m_impl->m_size = requiredMemory;
+    m_impl->m_builtInstances = m_impl->instanceCount();
 
     // Write out the acceleration structure properties to make the compacted size available.
     if (LITEFX_FLAG_IS_SET(m_impl->m_flags, AccelerationStructureFlags::AllowCompaction))
@@ -159,6 +169,9 @@ void VulkanTopLevelAccelerationStructure::update(const VulkanCommandBuffer& comm
     if (!LITEFX_FLAG_IS_SET(m_impl->m_flags, AccelerationStructureFlags::AllowUpdate)) [[unlikely]]
         throw RuntimeException("The acceleration structure does not allow updates. Specify `AccelerationStructureFlags::AllowUpdate` during creation.");
 
+    if (m_impl->instanceCount() != m_impl->m_builtInstances) [[unlikely]]
+        throw RuntimeException("The number of instances changed from {0} to {1} since the acceleration structure has been built. Rebuild the acceleration structure instead of updating it.", m_impl->m_builtInstances, m_impl->instanceCount());
+
     // Validate the arguments and create the buffers if required.
     UInt64 requiredMemory, requiredScratchMemory;
     auto& device = static_cast<const VulkanQueue&>(commandBuffer.queue()).device();
@@ -247,7 +260,7 @@ void VulkanTopLevelAccelerationStructure::copy(const VulkanCommandBuffer& comman
     VkAccelerationStructureCreateInfoKHR info = {
         .sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR,
         .buffer = buffer->handle(),
-        .offset = offset,
+        .offset = buffer->offset() + offset,
         .size = requiredMemory[0],
         .type = VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR
     };
@@ -259,6 +272,7 @@ void VulkanTopLevelAccelerationStructure::copy(const VulkanCommandBuffer& comman
     destination.m_impl->m_buffer = buffer;
     destination.m_impl->m_size = requiredMemory[0];
     destination.m_impl->m_device = m_impl->m_device;
+    destination.m_impl->m_builtInstances = m_impl->m_builtInstances;
 
     // Perform the update.
     commandBuffer.copyAccelerationStructure(*this, destination, compress);
@@ -274,7 +288,12 @@ void VulkanTopLevelAccelerationStructure::copy(const VulkanCommandBuffer& comman
 
     // Copy build data, if requested.
     if (copyBuildInfo)
+    {
         destination.m_impl->m_instances = m_impl->m_instances;
+        destination.m_impl->m_instanceBuffer = m_impl->m_instanceBuffer;
+        destination.m_impl->m_firstInstance = m_impl->m_firstInstance;
+        destination.m_impl->m_instanceCount = m_impl->m_instanceCount;
+    }
 }
 
 const Array<Instance>& VulkanTopLevelAccelerationStructure::instances() const noexcept
@@ -287,12 +306,17 @@ void VulkanTopLevelAccelerationStructure::addInstance(const Instance& instance)
     if (m_impl->m_buffer != nullptr) [[unlikely]]
         throw RuntimeException("An acceleration structure cannot be modified after buffers for it have been created.");
 
+    if (m_impl->m_instanceBuffer != nullptr) [[unlikely]]
+        throw RuntimeException("Instances cannot be added to an acceleration structure that reads its instances from an instance buffer.");
+
     m_impl->m_instances.push_back(instance);
 }
 
 void VulkanTopLevelAccelerationStructure::clear() noexcept
 {
     m_impl->m_instances.clear();
+    m_impl->m_instanceBuffer = nullptr;
+    m_impl->m_firstInstance = m_impl->m_instanceCount = 0;
 }
 
 bool VulkanTopLevelAccelerationStructure::remove(const Instance& instance) noexcept
@@ -306,6 +330,44 @@ bool VulkanTopLevelAccelerationStructure::remove(const Instance& instance) noexc
     return false;
 }
 
+void VulkanTopLevelAccelerationStructure::useInstanceBuffer(SharedPtr<const IVulkanBuffer> buffer, UInt32 instances, UInt32 firstInstance)
+{
+    if (buffer == nullptr)
+    {
+        m_impl->m_instanceBuffer = nullptr;
+        m_impl->m_firstInstance = m_impl->m_instanceCount = 0;
+        return;
+    }
+
+    if (!m_impl->m_instances.empty()) [[unlikely]]
+        throw RuntimeException("An instance buffer cannot be used for an acceleration structure that already contains instances.");
+
+    if (buffer->alignedElementSize() != sizeof(VkAccelerationStructureInstanceKHR)) [[unlikely]]
+        throw InvalidArgumentException("buffer", "The elements of the instance buffer must be tightly packed instances of {0} bytes, but the aligned element size was {1} bytes.", sizeof(VkAccelerationStructureInstanceKHR), buffer->alignedElementSize());
+
+    if (static_cast<UInt64>(firstInstance) + instances > buffer->elements()) [[unlikely]]
+        throw ArgumentOutOfRangeException("instances", 0ull, static_cast<UInt64>(buffer->elements()), static_cast<UInt64>(firstInstance) + instances, "The instance buffer does not contain enough elements to read {0} instances, starting at instance {1}.", instances, firstInstance);
+
+    m_impl->m_instanceBuffer = buffer;
+    m_impl->m_firstInstance = firstInstance;
+    m_impl->m_instanceCount = instances;
+}
+
+SharedPtr<const IVulkanBuffer> VulkanTopLevelAccelerationStructure::instanceBuffer() const noexcept
+{
+    return m_impl->m_instanceBuffer;
+}
+
+UInt32 VulkanTopLevelAccelerationStructure::firstInstance() const noexcept
+{
+    return m_impl->m_firstInstance;
+}
+
+UInt32 VulkanTopLevelAccelerationStructure::instanceCount() const noexcept
+{
+    return m_impl->instanceCount();
+}
+
 Array<VkAccelerationStructureInstanceKHR> VulkanTopLevelAccelerationStructure::buildInfo() const noexcept
 {
     return m_impl->buildInfo();
@@ -338,4 +400,19 @@ void VulkanTopLevelAccelerationStructure::doUpdate(const ICommandBuffer& command
 void VulkanTopLevelAccelerationStructure::doCopy(const ICommandBuffer& commandBuffer, ITopLevelAccelerationStructure& destination, bool compress, SharedPtr<const IBuffer> buffer, UInt64 offset, bool copyBuildInfo) const
 {
     this->copy(dynamic_cast<const VulkanCommandBuffer&>(commandBuffer), dynamic_cast<VulkanTopLevelAccelerationStructure&>(destination), compress, std::dynamic_pointer_cast<const IVulkanBuffer>(buffer), offset, copyBuildInfo);
+}
+
+void VulkanTopLevelAccelerationStructure::doUseInstanceBuffer(SharedPtr<const IBuffer> buffer, UInt32 instances, UInt32 firstInstance)
+{
+    if (buffer == nullptr)
+        this->useInstanceBuffer(nullptr, instances, firstInstance);
+    else if (auto instanceBuffer = std::dynamic_pointer_cast<const IVulkanBuffer>(buffer); instanceBuffer == nullptr) [[unlikely]]
+        throw InvalidArgumentException("buffer", "The instance buffer must be a Vulkan buffer.");
+    else
+        this->useInstanceBuffer(instanceBuffer, instances, firstInstance);
+}
+
+SharedPtr<const IBuffer> VulkanTopLevelAccelerationStructure::getInstanceBuffer() const noexcept
+{
+    return std::static_pointer_cast<const IBuffer>(m_impl->m_instanceBuffer);
 }
\ No newline at end of file
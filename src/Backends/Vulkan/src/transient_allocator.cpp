@@ -0,0 +1,376 @@
+#include <litefx/backends/vulkan.hpp>
+#include "buffer.h"
+#include "image.h"
+
+using namespace LiteFX::Rendering::Backends;
+
+// ------------------------------------------------------------------------------------------------
+// Shared memory.
+// ------------------------------------------------------------------------------------------------
+
+// Owns the memory allocator of a transient allocator.
+struct VulkanTransientMemoryAllocator {
+    VmaAllocator Handle { nullptr };
+
+    ~VulkanTransientMemoryAllocator() noexcept
+    {
+        if (Handle != nullptr)
+            ::vmaDestroyAllocator(Handle);
+    }
+};
+
+// Owns the memory blocks of one allocation. Each transient resource keeps a reference to the blocks, so that they are not released while the resource is still alive.
+struct VulkanTransientMemoryBlocks {
+    SharedPtr<VulkanTransientMemoryAllocator> Allocator;
+    Array<VmaAllocation> Blocks;
+
+    ~VulkanTransientMemoryBlocks() noexcept
+    {
+        for (auto block : Blocks)
+            ::vmaFreeMemory(Allocator->Handle, block);
+    }
+};
+
+// NOTE: The memory reference is inherited before the resource, so that it gets released after the resource has been destroyed.
+struct VulkanTransientMemoryReference {
+    SharedPtr<VulkanTransientMemoryBlocks> Memory;
+};
+
+class VulkanTransientImage final : private VulkanTransientMemoryReference, public VulkanImage {
+public:
+    VulkanTransientImage(SharedPtr<VulkanTransientMemoryBlocks> memory, const VulkanDevice& device, VkImage image, const Size3d& extent, Format format, ImageDimensions dimensions, UInt32 levels, UInt32 layers, MultiSamplingLevel samples, ResourceUsage usage, const String& name) :
+        VulkanTransientMemoryReference(std::move(memory)), VulkanImage(device, image, extent, format, dimensions, levels, layers, samples, usage, this->Memory->Allocator->Handle, nullptr, name)
+    {
+    }
+};
+
+class VulkanTransientBuffer final : private VulkanTransientMemoryReference, public VulkanBuffer {
+public:
+    VulkanTransientBuffer(SharedPtr<VulkanTransientMemoryBlocks> memory, VkBuffer buffer, BufferType type, UInt32 elements, size_t elementSize, size_t alignment, ResourceUsage usage, const VulkanDevice& device, const String& name) :
+        VulkanTransientMemoryReference(std::move(memory)), VulkanBuffer(buffer, type, elements, elementSize, alignment, usage, device, this->Memory->Allocator->Handle, nullptr, name)
+    {
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class VulkanTransientAllocator::VulkanTransientAllocatorImpl : public Implement<VulkanTransientAllocator> {
+public:
+    friend class VulkanTransientAllocator;
+
+private:
+    struct TransientResource {
+        SharedPtr<IVulkanImage> Image;
+        SharedPtr<IVulkanBuffer> Buffer;
+        bool Aliased { false };
+    };
+
+    const VulkanDevice& m_device;
+    SharedPtr<VulkanTransientMemoryAllocator> m_allocator;
+    SharedPtr<VulkanTransientMemoryBlocks> m_memory;
+    Array<TransientResource> m_resources;
+    TransientMemoryPlanner m_planner;
+    bool m_allocated { false };
+
+public:
+    VulkanTransientAllocatorImpl(VulkanTransientAllocator* parent, const VulkanDevice& device) :
+        base(parent), m_device(device), m_allocator(makeShared<VulkanTransientMemoryAllocator>())
+    {
+        // NOTE: Transient memory is allocated from a separate allocator, so that it can be released independently from the resources created by the factory.
+        VmaAllocatorCreateInfo allocatorInfo = {};
+        allocatorInfo.physicalDevice = device.adapter().handle();
+        allocatorInfo.instance = device.surface().instance();
+        allocatorInfo.device = device.handle();
+        allocatorInfo.flags = VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+        allocatorInfo.vulkanApiVersion = VK_API_VERSION_1_3;
+
+        raiseIfFailed(::vmaCreateAllocator(&allocatorInfo, &m_allocator->Handle), "Unable to create Vulkan memory allocator.");
+    }
+
+public:
+    const SharedPtr<VulkanTransientMemoryBlocks>& memory()
+    {
+        if (m_allocated) [[unlikely]]
+            throw RuntimeException("Transient resources cannot be created after the allocator has been allocated. Clear the allocator first.");
+
+        if (m_memory == nullptr)
+        {
+            m_memory = makeShared<VulkanTransientMemoryBlocks>();
+            m_memory->Allocator = m_allocator;
+        }
+
+        return m_memory;
+    }
+
+    void add(const VkMemoryRequirements& requirements, UInt32 firstUse, UInt32 lastUse)
+    {
+        // NOTE: Buffers and optimal images can share a block, so we always respect the buffer-image granularity to prevent them from sharing a page.
+        auto alignment = std::max<UInt64>(requirements.alignment, m_device.adapter().limits().bufferImageGranularity);
+
+        m_planner.add({ .Size = requirements.size, .Alignment = alignment, .MemoryTypes = requirements.memoryTypeBits, .FirstUse = firstUse, .LastUse = lastUse });
+    }
+
+    void allocate()
+    {
+        if (m_allocated) [[unlikely]]
+            throw RuntimeException("The transient resources have already been allocated.");
+
+        m_planner.plan();
+
+        // Allocate the memory blocks.
+        auto& memory = this->memory();
+        VmaAllocationCreateInfo allocationInfo = {};
+        allocationInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+
+        for (const auto& block : m_planner.blocks())
+        {
+            VkMemoryRequirements requirements = { .size = block.Size, .alignment = block.Alignment, .memoryTypeBits = block.MemoryTypes };
+            VmaAllocation allocation;
+            raiseIfFailed(::vmaAllocateMemory(m_allocator->Handle, &requirements, &allocationInfo, &allocation, nullptr), "Unable to allocate transient memory block.");
+            memory->Blocks.push_back(allocation);
+        }
+
+        // Bind the resources and find out which of them share memory with other ones. Those resources need to be transitioned from an undefined state at the first use in
+        // each frame, since the memory can be overwritten by a resource that has been used before (within the frame) or after (within the previous frame).
+        const auto& placements = m_planner.placements();
+
+        for (UInt32 i { 0 }; i < static_cast<UInt32>(m_resources.size()); ++i)
+        {
+            const auto& placement = placements[i];
+            auto allocation = memory->Blocks[placement.Block];
+
+            if (m_resources[i].Image != nullptr)
+                raiseIfFailed(::vmaBindImageMemory2(m_allocator->Handle, allocation, placement.Offset, std::as_const(*m_resources[i].Image).handle(), nullptr), "Unable to bind transient image memory.");
+            else
+                raiseIfFailed(::vmaBindBufferMemory2(m_allocator->Handle, allocation, placement.Offset, std::as_const(*m_resources[i].Buffer).handle(), nullptr), "Unable to bind transient buffer memory.");
+
+            if (!placement.Aliases.empty())
+            {
+                m_resources[i].Aliased = true;
+                std::ranges::for_each(placement.Aliases, [this](UInt32 alias) { m_resources[alias].Aliased = true; });
+            }
+        }
+
+        m_allocated = true;
+
+        const auto& statistics = m_planner.statistics();
+        LITEFX_DEBUG(VULKAN_LOG, "Allocated {0} transient resources in {1} memory blocks {{ Aliased: {2} bytes, Unaliased: {3} bytes }}", statistics.Resources, statistics.Blocks, statistics.AliasedMemory, statistics.UnaliasedMemory);
+    }
+
+    void clear() noexcept
+    {
+        m_resources.clear();
+        m_planner.clear();
+        m_memory = nullptr;
+        m_allocated = false;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+VulkanTransientAllocator::VulkanTransientAllocator(const VulkanDevice& device) :
+    m_impl(makePimpl<VulkanTransientAllocatorImpl>(this, device))
+{
+}
+
+VulkanTransientAllocator::~VulkanTransientAllocator() noexcept = default;
+
+SharedPtr<IVulkanImage> VulkanTransientAllocator::createTexture(const String& name, Format format, const Size3d& size, ImageDimensions dimension, UInt32 levels, UInt32 layers, MultiSamplingLevel samples, ResourceUsage usage, UInt32 firstUse, UInt32 lastUse)
+{
+    if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::AccelerationStructureBuildInput)) [[unlikely]]
+        throw InvalidArgumentException("usage", "Invalid resource usage has been specified: image resources cannot be used as build inputs for other acceleration structures.");
+
+    if (dimension == ImageDimensions::CUBE && layers != 6) [[unlikely]]
+        throw ArgumentOutOfRangeException("layers", 6u, 6u, layers, "A cube map must be defined with 6 layers, but {0} are provided.", layers);
+
+    if (dimension == ImageDimensions::DIM_3 && layers != 1) [[unlikely]]
+        throw ArgumentOutOfRangeException("layers", 1u, 1u, layers, "A 3D texture can only have one layer, but {0} are provided.", layers);
+
+    auto& memory = m_impl->memory();
+    auto width = std::max<UInt32>(1, size.width());
+    auto height = std::max<UInt32>(1, size.height());
+    auto depth = std::max<UInt32>(1, size.depth());
+
+    VkImageCreateInfo imageInfo = {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+        .imageType = Vk::getImageType(dimension),
+        .format = Vk::getFormat(format),
+        .extent = VkExtent3D { .width = width, .height = height, .depth = depth },
+        .mipLevels = levels,
+        .arrayLayers = layers,
+        .samples = Vk::getSamples(samples),
+        .tiling = VK_IMAGE_TILING_OPTIMAL,
+        .usage = VK_IMAGE_USAGE_SAMPLED_BIT,
+        .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED
+    };
+
+    if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::AllowWrite))
+        imageInfo.usage |= VK_IMAGE_USAGE_STORAGE_BIT;
+    if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::TransferSource))
+        imageInfo.usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::TransferDestination))
+        imageInfo.usage |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::RenderTarget))
+    {
+        if (::hasDepth(format) || ::hasStencil(format))
+            imageInfo.usage |= VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+        else
+            imageInfo.usage |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    }
+
+    auto queueFamilies = m_impl->m_device.queueFamilyIndices() | std::ranges::to<std::vector>();
+    imageInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+    imageInfo.queueFamilyIndexCount = static_cast<UInt32>(queueFamilies.size());
+    imageInfo.pQueueFamilyIndices = queueFamilies.data();
+
+    VkImage handle;
+    VkMemoryRequirements requirements;
+    raiseIfFailed(::vkCreateImage(m_impl->m_device.handle(), &imageInfo, nullptr, &handle), "Unable to create transient image.");
+    ::vkGetImageMemoryRequirements(m_impl->m_device.handle(), handle, &requirements);
+
+    SharedPtr<IVulkanImage> image = makeShared<VulkanTransientImage>(memory, m_impl->m_device, handle, Size3d { width, height, depth }, format, dimension, levels, layers, samples, usage, name);
+    m_impl->add(requirements, firstUse, lastUse);
+    m_impl->m_resources.push_back({ .Image = image });
+
+#ifndef NDEBUG
+    if (!name.empty())
+        m_impl->m_device.setDebugName(*reinterpret_cast<const UInt64*>(&handle), VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, name);
+#endif
+
+    return image;
+}
+
+SharedPtr<IVulkanBuffer> VulkanTransientAllocator::createBuffer(const String& name, BufferType type, size_t elementSize, UInt32 elements, ResourceUsage usage, UInt32 firstUse, UInt32 lastUse)
+{
+    if ((type == BufferType::Vertex || type == BufferType::Index || type == BufferType::Uniform) && LITEFX_FLAG_IS_SET(usage, ResourceUsage::AllowWrite)) [[unlikely]]
+        throw InvalidArgumentException("usage", "Invalid resource usage has been specified: vertex, index and uniform/constant buffers cannot be written to.");
+
+    if (type == BufferType::AccelerationStructure && LITEFX_FLAG_IS_SET(usage, ResourceUsage::AccelerationStructureBuildInput)) [[unlikely]]
+        throw InvalidArgumentException("usage", "Invalid resource usage has been specified: acceleration structures cannot be used as build inputs for other acceleration structures.");
+
+    auto& memory = m_impl->memory();
+    const auto limits = m_impl->m_device.adapter().limits();
+    VkBufferUsageFlags usageFlags = { VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT };
+    size_t alignment = 0;
+
+    switch (type)
+    {
+    case BufferType::Vertex:
+        usageFlags |= VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+        break;
+    case BufferType::Index:
+        usageFlags |= VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+        break;
+    case BufferType::Uniform:
+        usageFlags |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+        alignment = limits.minUniformBufferOffsetAlignment;
+        break;
+    case BufferType::Storage:
+        usageFlags |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        alignment = limits.minStorageBufferOffsetAlignment;
+        break;
+    case BufferType::Texel:
+        if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::AllowWrite))
+            usageFlags |= VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT;
+        else
+            usageFlags |= VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
+
+        alignment = limits.minTexelBufferOffsetAlignment;
+        break;
+    case BufferType::AccelerationStructure:
+        usageFlags |= VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR;
+        alignment = limits.minUniformBufferOffsetAlignment;
+        break;
+    case BufferType::ShaderBindingTable:
+        usageFlags |= VK_BUFFER_USAGE_SHADER_BINDING_TABLE_BIT_KHR;
+        alignment = limits.minStorageBufferOffsetAlignment;
+        break;
+    case BufferType::Indirect:
+        usageFlags |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+        alignment = limits.minStorageBufferOffsetAlignment;
+        break;
+    }
+
+    if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::TransferSource))
+        usageFlags |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::TransferDestination))
+        usageFlags |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    if (LITEFX_FLAG_IS_SET(usage, ResourceUsage::AccelerationStructureBuildInput))
+        usageFlags |= VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR;
+
+    size_t alignedSize = alignment > 0 ? (elementSize + alignment - 1) & ~(alignment - 1) : elementSize;
+
+    // NOTE: Transient buffers alias memory with other resources and are always shared concurrently, so they never take part in queue family ownership transfers.
+    auto queueFamilies = m_impl->m_device.queueFamilyIndices() | std::ranges::to<std::vector>();
+    VkBufferCreateInfo bufferInfo = {
+        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .size = alignedSize * static_cast<size_t>(elements),
+        .usage = usageFlags,
+        .sharingMode = VK_SHARING_MODE_CONCURRENT,
+        .queueFamilyIndexCount = static_cast<UInt32>(queueFamilies.size()),
+        .pQueueFamilyIndices = queueFamilies.data()
+    };
+
+    VkBuffer handle;
+    VkMemoryRequirements requirements;
+    raiseIfFailed(::vkCreateBuffer(m_impl->m_device.handle(), &bufferInfo, nullptr, &handle), "Unable to create transient buffer.");
+    ::vkGetBufferMemoryRequirements(m_impl->m_device.handle(), handle, &requirements);
+
+    SharedPtr<IVulkanBuffer> buffer = makeShared<VulkanTransientBuffer>(memory, handle, type, elements, elementSize, alignment, usage | ResourceUsage::Concurrent, m_impl->m_device, name);
+    m_impl->add(requirements, firstUse, lastUse);
+    m_impl->m_resources.push_back({ .Buffer = buffer });
+
+#ifndef NDEBUG
+    if (!name.empty())
+        m_impl->m_device.setDebugName(*reinterpret_cast<const UInt64*>(&handle), VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, name);
+#endif
+
+    return buffer;
+}
+
+void VulkanTransientAllocator::allocate()
+{
+    m_impl->allocate();
+}
+
+bool VulkanTransientAllocator::allocated() const noexcept
+{
+    return m_impl->m_allocated;
+}
+
+void VulkanTransientAllocator::clear() noexcept
+{
+    m_impl->clear();
+}
+
+void VulkanTransientAllocator::transition(VulkanBarrier& barrier, UInt32 use) const
+{
+    if (!m_impl->m_allocated) [[unlikely]]
+        throw RuntimeException("The transient resources must be allocated before they can be transitioned.");
+
+    const auto& resources = m_impl->m_planner.resources();
+
+    for (UInt32 i { 0 }; i < static_cast<UInt32>(m_impl->m_resources.size()); ++i)
+    {
+        const auto& resource = m_impl->m_resources[i];
+
+        if (!resource.Aliased || resources[i].FirstUse != use)
+            continue;
+
+        if (resource.Image == nullptr)
+            barrier.transition(*resource.Buffer, ResourceAccess::None, ResourceAccess::None);
+        else if (::hasDepth(resource.Image->format()) || ::hasStencil(resource.Image->format()))
+            barrier.transition(*resource.Image, ResourceAccess::None, ResourceAccess::None, ImageLayout::Undefined, ImageLayout::DepthRead);
+        else
+            barrier.transition(*resource.Image, ResourceAccess::None, ResourceAccess::None, ImageLayout::Undefined, ImageLayout::ShaderResource);
+    }
+}
+
+const TransientMemoryStatistics& VulkanTransientAllocator::statistics() const noexcept
+{
+    return m_impl->m_planner.statistics();
+}
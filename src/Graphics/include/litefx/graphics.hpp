@@ -16,4 +16,496 @@ namespace LiteFX::Graphics {
         Vector2f TextureCoordinate0;
     };
 
+    /// <summary>
+    /// Describes an indexed triangle list that is processed by the mesh tools.
+    /// </summary>
+    /// <remarks>
+    /// The mesh does not own its data. Vertex positions are read from <see cref="IndexedMesh::Positions" />, where each position consists of three 
+    /// consecutive floats and subsequent positions are <see cref="IndexedMesh::Stride" /> bytes apart. This allows to pass arrays of <see cref="Vertex" />,
+    /// as well as arrays of positions or any other interleaved vertex layout.
+    /// </remarks>
+    struct LITEFX_GRAPHICS_API IndexedMesh {
+    public:
+        /// <summary>
+        /// A pointer to the position of the first vertex.
+        /// </summary>
+        const Byte* Positions{ nullptr };
+
+        /// <summary>
+        /// The distance between two subsequent positions in bytes.
+        /// </summary>
+        size_t Stride{ 0 };
+
+        /// <summary>
+        /// The number of vertices of the mesh.
+        /// </summary>
+        size_t VertexCount{ 0 };
+
+        /// <summary>
+        /// The indices of the triangle list. Must contain three indices per triangle.
+        /// </summary>
+        std::span<const UInt32> Indices;
+
+    public:
+        IndexedMesh() noexcept = default;
+
+        /// <summary>
+        /// Initializes a mesh from a set of vertices.
+        /// </summary>
+        /// <param name="vertices">The vertices of the mesh.</param>
+        /// <param name="indices">The indices of the triangle list.</param>
+        IndexedMesh(std::span<const Vertex> vertices, std::span<const UInt32> indices) noexcept;
+
+        /// <summary>
+        /// Initializes a mesh from a set of positions.
+        /// </summary>
+        /// <param name="positions">The vertex positions of the mesh.</param>
+        /// <param name="indices">The indices of the triangle list.</param>
+        IndexedMesh(std::span<const Vector3f> positions, std::span<const UInt32> indices) noexcept;
+
+        /// <summary>
+        /// Initializes a mesh from an interleaved vertex buffer.
+        /// </summary>
+        /// <param name="positions">A pointer to the position of the first vertex.</param>
+        /// <param name="stride">The distance between two subsequent positions in bytes.</param>
+        /// <param name="vertexCount">The number of vertices of the mesh.</param>
+        /// <param name="indices">The indices of the triangle list.</param>
+        IndexedMesh(const Byte* positions, size_t stride, size_t vertexCount, std::span<const UInt32> indices) noexcept;
+
+    public:
+        /// <summary>
+        /// Returns the number of triangles of the mesh.
+        /// </summary>
+        /// <returns>The number of triangles of the mesh.</returns>
+        size_t triangles() const noexcept;
+
+        /// <summary>
+        /// Returns the position of a vertex.
+        /// </summary>
+        /// <param name="vertex">The index of the vertex.</param>
+        /// <returns>The position of the vertex.</returns>
+        Vector3f position(size_t vertex) const noexcept;
+    };
+
+    /// <summary>
+    /// Describes a meshlet, i.e., a small cluster of triangles that is processed by a single mesh shader thread group.
+    /// </summary>
+    /// <remarks>
+    /// The layout of this structure matches the one expected by a mesh shader, so that an array of meshlets can be copied into a buffer as-is.
+    /// </remarks>
+    /// <seealso cref="MeshletBuilder" />
+    struct LITEFX_GRAPHICS_API Meshlet {
+    public:
+        /// <summary>
+        /// The index of the first vertex index of the meshlet in <see cref="MeshletData::Vertices" />.
+        /// </summary>
+        UInt32 VertexOffset;
+
+        /// <summary>
+        /// The number of unique vertices referenced by the meshlet.
+        /// </summary>
+        UInt32 VertexCount;
+
+        /// <summary>
+        /// The index of the first primitive of the meshlet in <see cref="MeshletData::Primitives" />.
+        /// </summary>
+        UInt32 PrimitiveOffset;
+
+        /// <summary>
+        /// The number of primitives (triangles) of the meshlet.
+        /// </summary>
+        UInt32 PrimitiveCount;
+    };
+
+    /// <summary>
+    /// Stores the bounding sphere and normal cone of a meshlet, which are used to cull meshlets in a task or amplification shader.
+    /// </summary>
+    /// <remarks>
+    /// A meshlet is outside the view, if its bounding sphere does not intersect the view frustum. Assuming counter-clockwise front faces, a meshlet is 
+    /// back-facing, if <c>dot(normalize(ConeApex - cameraPosition), ConeAxis) >= ConeCutoff</c>. If the triangles of a meshlet face into too different 
+    /// directions, the cone cutoff is set to <c>1</c>, so that the meshlet is never culled by the test.
+    /// </remarks>
+    /// <seealso cref="MeshletBuilder" />
+    struct LITEFX_GRAPHICS_API MeshletBounds {
+    public:
+        /// <summary>
+        /// The center of the bounding sphere.
+        /// </summary>
+        Vector3f Center;
+
+        /// <summary>
+        /// The radius of the bounding sphere.
+        /// </summary>
+        Float Radius;
+
+        /// <summary>
+        /// The (normalized) axis of the normal cone.
+        /// </summary>
+        Vector3f ConeAxis;
+
+        /// <summary>
+        /// The cosine of the angle between the cone axis and the cone surface.
+        /// </summary>
+        Float ConeCutoff;
+
+        /// <summary>
+        /// The apex of the normal cone.
+        /// </summary>
+        Vector3f ConeApex;
+
+        /// <summary>
+        /// Unused padding, which aligns the structure to 16 bytes.
+        /// </summary>
+        Float Padding;
+    };
+
+    /// <summary>
+    /// Stores the meshlets of a mesh, along with the buffers required to draw them.
+    /// </summary>
+    /// <remarks>
+    /// All arrays can be uploaded into GPU buffers directly. Each primitive is packed into a single 32 bit integer, where the bits 0 to 7, 8 to 15 and 16 to
+    /// 23 contain the indices of the triangle vertices within the meshlet. Adding the index to <see cref="Meshlet::VertexOffset" /> yields the index into
+    /// <see cref="MeshletData::Vertices" />, which in turn contains the index into the vertex buffer of the mesh.
+    /// </remarks>
+    /// <seealso cref="MeshletBuilder" />
+    struct LITEFX_GRAPHICS_API MeshletData {
+    public:
+        /// <summary>
+        /// The meshlets of the mesh.
+        /// </summary>
+        Array<Meshlet> Meshlets;
+
+        /// <summary>
+        /// The culling information for each meshlet.
+        /// </summary>
+        Array<MeshletBounds> Bounds;
+
+        /// <summary>
+        /// The indices into the vertex buffer of the mesh, referenced by the meshlets.
+        /// </summary>
+        Array<UInt32> Vertices;
+
+        /// <summary>
+        /// The packed primitives of the meshlets.
+        /// </summary>
+        Array<UInt32> Primitives;
+    };
+
+    /// <summary>
+    /// Partitions indexed triangle meshes into meshlets.
+    /// </summary>
+    /// <remarks>
+    /// Meshlets are built greedily: starting from a seed triangle, the builder adds the neighboring triangle that introduces the fewest new vertices and is 
+    /// closest to the center of the meshlet, until either limit is reached or there are no more neighboring triangles. This produces compact meshlets with
+    /// tight bounds, which improves the efficiency of meshlet culling. Increasing the cone weight favors triangles that face into the same direction as the
+    /// meshlet, which produces tighter normal cones at the cost of slightly larger meshlets.
+    /// 
+    /// Building meshlets for a single mesh is single-threaded. Multiple meshes can be processed in parallel using <see cref="MeshletBuilder::build" />. The 
+    /// builder itself is immutable and can be shared between threads.
+    /// </remarks>
+    /// <seealso cref="MeshletData" />
+    class LITEFX_GRAPHICS_API MeshletBuilder {
+    public:
+        /// <summary>
+        /// The maximum number of vertices and primitives of a meshlet, as supported by the packed primitive representation.
+        /// </summary>
+        static constexpr UInt32 MAX_LIMIT = 256;
+
+    private:
+        UInt32 m_maxVertices, m_maxPrimitives;
+        Float m_coneWeight;
+
+    public:
+        /// <summary>
+        /// Initializes a new meshlet builder.
+        /// </summary>
+        /// <remarks>
+        /// The default limits of 64 vertices and 124 primitives are a good fit for most hardware.
+        /// </remarks>
+        /// <param name="maxVertices">The maximum number of vertices of a meshlet. Must be between 3 and <see cref="MAX_LIMIT" />.</param>
+        /// <param name="maxPrimitives">The maximum number of primitives of a meshlet. Must be between 1 and <see cref="MAX_LIMIT" />.</param>
+        /// <param name="coneWeight">The weight of the normal cone when selecting triangles. Must be between 0 and 1.</param>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if any of the limits is out of range.</exception>
+        explicit MeshletBuilder(UInt32 maxVertices = 64, UInt32 maxPrimitives = 124, Float coneWeight = 0.f);
+        MeshletBuilder(const MeshletBuilder&) = default;
+        MeshletBuilder(MeshletBuilder&&) noexcept = default;
+        virtual ~MeshletBuilder() noexcept = default;
+
+    public:
+        /// <summary>
+        /// Returns the maximum number of vertices of a meshlet.
+        /// </summary>
+        /// <returns>The maximum number of vertices of a meshlet.</returns>
+        UInt32 maxVertices() const noexcept;
+
+        /// <summary>
+        /// Returns the maximum number of primitives of a meshlet.
+        /// </summary>
+        /// <returns>The maximum number of primitives of a meshlet.</returns>
+        UInt32 maxPrimitives() const noexcept;
+
+        /// <summary>
+        /// Returns the weight of the normal cone when selecting triangles.
+        /// </summary>
+        /// <returns>The weight of the normal cone when selecting triangles.</returns>
+        Float coneWeight() const noexcept;
+
+        /// <summary>
+        /// Partitions a mesh into meshlets.
+        /// </summary>
+        /// <param name="mesh">The mesh to build meshlets for.</param>
+        /// <returns>The meshlets of the mesh.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if the number of indices is not a multiple of three.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if an index references a vertex that does not exist.</exception>
+        MeshletData build(const IndexedMesh& mesh) const;
+
+        /// <summary>
+        /// Partitions multiple meshes into meshlets in parallel.
+        /// </summary>
+        /// <param name="meshes">The meshes to build meshlets for.</param>
+        /// <param name="threads">The number of worker threads. If set to <c>0</c>, the number of hardware threads is used.</param>
+        /// <returns>The meshlets for each mesh, in the order of <paramref name="meshes" />.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if the number of indices of a mesh is not a multiple of three.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if an index of a mesh references a vertex that does not exist.</exception>
+        Array<MeshletData> build(std::span<const IndexedMesh> meshes, UInt32 threads = 0) const;
+    };
+
+    /// <summary>
+    /// Stores statistics about the efficiency of the post-transform vertex cache for an index buffer.
+    /// </summary>
+    /// <seealso cref="MeshOptimizer::analyzeVertexCache" />
+    struct LITEFX_GRAPHICS_API VertexCacheStatistics {
+    public:
+        /// <summary>
+        /// The number of vertices that need to be transformed, i.e., the number of cache misses.
+        /// </summary>
+        UInt32 VerticesTransformed;
+
+        /// <summary>
+        /// The average cache miss ratio, i.e., the number of transformed vertices per triangle. The optimum is around 0.5 for regular meshes and the worst
+        /// case is 3.
+        /// </summary>
+        Float ACMR;
+
+        /// <summary>
+        /// The average transform to vertex ratio, i.e., the number of transformed vertices per referenced vertex. The optimum is 1.
+        /// </summary>
+        Float ATVR;
+    };
+
+    /// <summary>
+    /// Re-orders index and vertex buffers to make better use of the GPU caches.
+    /// </summary>
+    /// <remarks>
+    /// The optimizer provides three passes, which are typically applied in the following order:
+    /// 
+    /// <list type="number">
+    ///     <item><description><see cref="MeshOptimizer::optimizeVertexCache" /> re-orders the triangles to increase the hit rate of the post-transform vertex
+    ///         cache, using the Tipsify algorithm (see Sander et al., "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw").</description></item>
+    ///     <item><description><see cref="MeshOptimizer::optimizeOverdraw" /> splits the optimized triangles into clusters and sorts them, so that triangles that 
+    ///         are likely to occlude others are drawn first, while maintaining most of the cache efficiency.</description></item>
+    ///     <item><description><see cref="MeshOptimizer::optimizeVertexFetch" /> re-orders the vertices in the order they are referenced by the index buffer,
+    ///         which improves the locality of vertex fetches. The returned remap table can be used to re-order the vertex buffer with
+    ///         <see cref="MeshOptimizer::remapVertices" />.</description></item>
+    /// </list>
+    /// 
+    /// All passes preserve the winding order of each triangle. The resulting buffers can be passed to <c>IGraphicsFactory::createIndexBuffer</c> and 
+    /// <c>IGraphicsFactory::createVertexBuffer</c> as usual. Use <see cref="MeshOptimizer::analyzeVertexCache" /> to compare the efficiency of an index
+    /// buffer before and after optimization.
+    /// </remarks>
+    class LITEFX_GRAPHICS_API MeshOptimizer {
+    public:
+        /// <summary>
+        /// The default size of the simulated post-transform vertex cache.
+        /// </summary>
+        static constexpr UInt32 DEFAULT_CACHE_SIZE = 16;
+
+        /// <summary>
+        /// The index written into a remap table for vertices that are not referenced by the index buffer.
+        /// </summary>
+        static constexpr UInt32 UNUSED_VERTEX = std::numeric_limits<UInt32>::max();
+
+    public:
+        MeshOptimizer() = delete;
+
+    public:
+        /// <summary>
+        /// Re-orders the triangles of an index buffer to improve the post-transform vertex cache hit rate.
+        /// </summary>
+        /// <param name="indices">The indices of the triangle list.</param>
+        /// <param name="vertexCount">The number of vertices referenced by <paramref name="indices" />.</param>
+        /// <param name="cacheSize">The number of vertices in the simulated vertex cache.</param>
+        /// <returns>The re-ordered indices.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if the number of indices is not a multiple of three.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if an index references a vertex that does not exist, or if the cache size is smaller than 3.</exception>
+        static Array<UInt32> optimizeVertexCache(std::span<const UInt32> indices, size_t vertexCount, UInt32 cacheSize = DEFAULT_CACHE_SIZE);
+
+        /// <summary>
+        /// Re-orders clusters of triangles to reduce overdraw.
+        /// </summary>
+        /// <remarks>
+        /// The indices of <paramref name="mesh" /> should already be optimized for the vertex cache. They are split into clusters wherever the cache is 
+        /// flushed, and further split as long as the cache miss ratio of each cluster does not exceed the one of the input by more than 
+        /// <paramref name="threshold" />. The clusters are then sorted by how much they face away from the center of the mesh, which draws the outer 
+        /// surfaces first.
+        /// </remarks>
+        /// <param name="mesh">The mesh, whose indices are re-ordered.</param>
+        /// <param name="threshold">The factor by which the cache miss ratio is allowed to degrade. Must be at least 1.</param>
+        /// <param name="cacheSize">The number of vertices in the simulated vertex cache.</param>
+        /// <returns>The re-ordered indices.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if the number of indices is not a multiple of three.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if an index references a vertex that does not exist, or if any of the parameters is out of range.</exception>
+        static Array<UInt32> optimizeOverdraw(const IndexedMesh& mesh, Float threshold = 1.05f, UInt32 cacheSize = DEFAULT_CACHE_SIZE);
+
+        /// <summary>
+        /// Re-orders the vertices in the order they are first referenced by the index buffer and updates the indices accordingly.
+        /// </summary>
+        /// <param name="indices">The indices of the triangle list, which are updated in place.</param>
+        /// <param name="vertexCount">The number of vertices referenced by <paramref name="indices" />.</param>
+        /// <returns>
+        /// The remap table, which contains the new index of each vertex, or <see cref="UNUSED_VERTEX" />, if the vertex is not referenced.
+        /// </returns>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if an index references a vertex that does not exist.</exception>
+        static Array<UInt32> optimizeVertexFetch(std::span<UInt32> indices, size_t vertexCount);
+
+        /// <summary>
+        /// Copies vertices into a new vertex buffer according to a remap table.
+        /// </summary>
+        /// <param name="source">A pointer to the first source vertex.</param>
+        /// <param name="destination">A pointer to the destination buffer. Must be able to hold all referenced vertices.</param>
+        /// <param name="stride">The size of a single vertex in bytes.</param>
+        /// <param name="remap">The remap table, as returned by <see cref="optimizeVertexFetch" />.</param>
+        /// <returns>The number of vertices that have been written to <paramref name="destination" />.</returns>
+        /// <exception cref="ArgumentNotInitializedException">Thrown, if <paramref name="source" /> or <paramref name="destination" /> are not initialized.</exception>
+        static size_t remapVertices(const Byte* source, Byte* destination, size_t stride, std::span<const UInt32> remap);
+
+        /// <summary>
+        /// Returns a new vertex buffer, which contains the vertices in the order defined by a remap table.
+        /// </summary>
+        /// <typeparam name="TVertex">The type of the vertices.</typeparam>
+        /// <param name="vertices">The vertices to re-order.</param>
+        /// <param name="remap">The remap table, as returned by <see cref="optimizeVertexFetch" />.</param>
+        /// <returns>The re-ordered vertices, excluding vertices that are not referenced.</returns>
+        template <typename TVertex>
+        static Array<TVertex> remapVertices(std::span<const TVertex> vertices, std::span<const UInt32> remap) {
+            if (remap.size() != vertices.size()) [[unlikely]]
+                throw InvalidArgumentException("remap", "The remap table must contain an entry for each of the {0} vertices, but contains {1}.", vertices.size(), remap.size());
+
+            Array<TVertex> result(std::ranges::count_if(remap, [](UInt32 index) { return index != UNUSED_VERTEX; }));
+
+            if (!result.empty())
+                remapVertices(reinterpret_cast<const Byte*>(vertices.data()), reinterpret_cast<Byte*>(result.data()), sizeof(TVertex), remap);
+
+            return result;
+        }
+
+        /// <summary>
+        /// Simulates a FIFO post-transform vertex cache to measure the efficiency of an index buffer.
+        /// </summary>
+        /// <param name="indices">The indices of the triangle list.</param>
+        /// <param name="vertexCount">The number of vertices referenced by <paramref name="indices" />.</param>
+        /// <param name="cacheSize">The number of vertices in the simulated vertex cache.</param>
+        /// <returns>The vertex cache statistics for the index buffer.</returns>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if an index references a vertex that does not exist.</exception>
+        static VertexCacheStatistics analyzeVertexCache(std::span<const UInt32> indices, size_t vertexCount, UInt32 cacheSize = DEFAULT_CACHE_SIZE);
+    };
+
+    /// <summary>
+    /// Describes a single level of detail within a <see cref="LevelOfDetailChain" />.
+    /// </summary>
+    /// <remarks>
+    /// The members map directly onto the parameters of an indexed draw call. A level can be drawn by calling <c>drawIndexed(IndexCount, instances, FirstIndex)</c>,
+    /// or by setting <c>IndexCount</c> and <c>FirstIndex</c> of an <c>IndirectIndexedBatch</c> accordingly.
+    /// </remarks>
+    struct LITEFX_GRAPHICS_API LevelOfDetail {
+    public:
+        /// <summary>
+        /// The index of the first index of the level within <see cref="LevelOfDetailChain::Indices" />.
+        /// </summary>
+        UInt32 FirstIndex;
+
+        /// <summary>
+        /// The number of indices of the level.
+        /// </summary>
+        UInt32 IndexCount;
+
+        /// <summary>
+        /// The geometric error of the level, relative to the size of the mesh.
+        /// </summary>
+        /// <remarks>
+        /// The error can be multiplied with the size of the mesh and projected onto the screen in order to select a level of detail.
+        /// </remarks>
+        Float Error;
+    };
+
+    /// <summary>
+    /// Stores a chain of levels of detail, which share a single vertex buffer.
+    /// </summary>
+    /// <seealso cref="MeshSimplifier::buildLevelsOfDetail" />
+    struct LITEFX_GRAPHICS_API LevelOfDetailChain {
+    public:
+        /// <summary>
+        /// The indices of all levels, which can be uploaded into a single index buffer.
+        /// </summary>
+        Array<UInt32> Indices;
+
+        /// <summary>
+        /// The levels of detail, starting with the most detailed one.
+        /// </summary>
+        Array<LevelOfDetail> Levels;
+    };
+
+    /// <summary>
+    /// Reduces the number of triangles of a mesh, using quadric error metrics.
+    /// </summary>
+    /// <remarks>
+    /// The simplifier collapses edges in order of the smallest quadric error (see Garland and Heckbert, "Surface Simplification Using Quadric Error Metrics").
+    /// Edge collapses never introduce new vertices, so the simplified indices reference the original vertex buffer.
+    /// 
+    /// Attribute seams are preserved: vertices that share a position but have different attributes (for example, at texture coordinate or normal 
+    /// discontinuities) are only collapsed along the seam, where both sides of the seam are collapsed together. Vertices on open borders are only collapsed 
+    /// along the border and vertices where multiple seams or a seam and a border meet are never collapsed. Collapses that would flip a triangle are rejected.
+    /// 
+    /// Errors are measured relative to the size of the mesh, i.e., an error of <c>0.01</c> corresponds to a deviation of 1% of the largest extent of its 
+    /// bounding box. The error of a collapse is the root mean square distance between the new vertex position and the planes of the original triangles around 
+    /// the collapsed vertices, weighted by their area. The largest distance between the simplified surface and individual original vertices can therefore be 
+    /// a few times larger than the error.
+    /// </remarks>
+    /// <seealso cref="LevelOfDetailChain" />
+    class LITEFX_GRAPHICS_API MeshSimplifier {
+    public:
+        MeshSimplifier() = delete;
+
+    public:
+        /// <summary>
+        /// Simplifies a mesh until it contains <paramref name="targetIndexCount" /> indices or no edge can be collapsed without exceeding 
+        /// <paramref name="targetError" />.
+        /// </summary>
+        /// <param name="mesh">The mesh to simplify.</param>
+        /// <param name="targetIndexCount">The desired number of indices.</param>
+        /// <param name="targetError">The maximum error, relative to the size of the mesh.</param>
+        /// <param name="error">If provided, receives the error of the simplified mesh, relative to the size of the mesh.</param>
+        /// <returns>The indices of the simplified mesh, which reference the vertices of <paramref name="mesh" />.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if the number of indices is not a multiple of three.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if an index references a vertex that does not exist, or if <paramref name="targetError" /> is negative.</exception>
+        static Array<UInt32> simplify(const IndexedMesh& mesh, size_t targetIndexCount, Float targetError = 0.01f, Float* error = nullptr);
+
+        /// <summary>
+        /// Builds a chain of levels of detail for a mesh.
+        /// </summary>
+        /// <remarks>
+        /// The first level contains the original indices. Each subsequent level is simplified from the previous one, where the number of triangles is reduced 
+        /// by <paramref name="reduction" />. The chain ends early, if a level can not be simplified further without exceeding <paramref name="targetError" />.
+        /// The indices of each simplified level are optimized for the vertex cache.
+        /// </remarks>
+        /// <param name="mesh">The mesh to build the levels of detail for.</param>
+        /// <param name="levels">The maximum number of levels, including the original mesh.</param>
+        /// <param name="reduction">The ratio between the triangle counts of two subsequent levels. Must be between 0 and 1.</param>
+        /// <param name="targetError">The maximum error of each simplification step, relative to the size of the mesh.</param>
+        /// <returns>The chain of levels of detail.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if the number of indices is not a multiple of three.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if an index references a vertex that does not exist, or if any of the parameters is out of range.</exception>
+        static LevelOfDetailChain buildLevelsOfDetail(const IndexedMesh& mesh, UInt32 levels, Float reduction = 0.5f, Float targetError = 0.05f);
+    };
+
 }
\ No newline at end of file
@@ -0,0 +1,34 @@
+#include <litefx/graphics.hpp>
+
+using namespace LiteFX::Graphics;
+
+// ------------------------------------------------------------------------------------------------
+// Indexed mesh.
+// ------------------------------------------------------------------------------------------------
+
+IndexedMesh::IndexedMesh(std::span<const Vertex> vertices, std::span<const UInt32> indices) noexcept :
+    Positions(reinterpret_cast<const Byte*>(vertices.data()) + offsetof(Vertex, Position)), Stride(sizeof(Vertex)), VertexCount(vertices.size()), Indices(indices)
+{
+}
+
+IndexedMesh::IndexedMesh(std::span<const Vector3f> positions, std::span<const UInt32> indices) noexcept :
+    Positions(reinterpret_cast<const Byte*>(positions.data())), Stride(sizeof(Vector3f)), VertexCount(positions.size()), Indices(indices)
+{
+}
+
+IndexedMesh::IndexedMesh(const Byte* positions, size_t stride, size_t vertexCount, std::span<const UInt32> indices) noexcept :
+    Positions(positions), Stride(stride), VertexCount(vertexCount), Indices(indices)
+{
+}
+
+size_t IndexedMesh::triangles() const noexcept
+{
+    return this->Indices.size() / 3;
+}
+
+Vector3f IndexedMesh::position(size_t vertex) const noexcept
+{
+    std::array<Float, 3> position;
+    std::memcpy(position.data(), this->Positions + vertex * this->Stride, sizeof(position));
+    return Vector3f(position[0], position[1], position[2]);
+}
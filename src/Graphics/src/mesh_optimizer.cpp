@@ -0,0 +1,359 @@
+#include <litefx/graphics.hpp>
+#include <numeric>
+
+using namespace LiteFX::Graphics;
+
+// ------------------------------------------------------------------------------------------------
+// Helpers.
+// ------------------------------------------------------------------------------------------------
+
+namespace {
+
+    constexpr UInt32 INVALID = std::numeric_limits<UInt32>::max();
+
+    void validate(std::span<const UInt32> indices, size_t vertexCount, bool triangles = true)
+    {
+        if (triangles && indices.size() % 3 != 0) [[unlikely]]
+            throw InvalidArgumentException("indices", "The number of indices must be a multiple of three, but was {0}.", indices.size());
+
+        if (auto invalid = std::ranges::find_if(indices, [&](UInt32 index) { return index >= vertexCount; }); invalid != indices.end()) [[unlikely]]
+            throw ArgumentOutOfRangeException("indices", 0ull, static_cast<unsigned long long>(vertexCount), static_cast<unsigned long long>(*invalid),
+                "The index at position {0} references a vertex that does not exist.", std::distance(indices.begin(), invalid));
+    }
+
+    /// <summary>
+    /// Simulates a FIFO post-transform vertex cache by storing the time at which each vertex has entered the cache.
+    /// </summary>
+    class VertexCache {
+    private:
+        Array<UInt32> m_times;
+        UInt32 m_time, m_size;
+
+    public:
+        VertexCache(size_t vertexCount, UInt32 size) :
+            m_times(vertexCount, 0), m_time(size + 1), m_size(size)
+        {
+        }
+
+        /// <summary>
+        /// Returns the number of time steps since the vertex has entered the cache. If this is larger than the cache size, the vertex has been evicted.
+        /// </summary>
+        UInt32 age(UInt32 vertex) const noexcept
+        {
+            return m_time - m_times[vertex];
+        }
+
+        /// <summary>
+        /// Accesses a vertex and returns <c>true</c>, if it was not in the cache.
+        /// </summary>
+        bool miss(UInt32 vertex) noexcept
+        {
+            if (m_time - m_times[vertex] <= m_size)
+                return false;
+
+            m_times[vertex] = m_time++;
+            return true;
+        }
+
+        /// <summary>
+        /// Accesses all vertices of a triangle and returns the number of cache misses.
+        /// </summary>
+        UInt32 misses(std::span<const UInt32> indices, size_t triangle) noexcept
+        {
+            return static_cast<UInt32>(this->miss(indices[triangle * 3])) + static_cast<UInt32>(this->miss(indices[triangle * 3 + 1])) +
+                static_cast<UInt32>(this->miss(indices[triangle * 3 + 2]));
+        }
+
+        /// <summary>
+        /// Evicts all vertices from the cache.
+        /// </summary>
+        void flush() noexcept
+        {
+            m_time += m_size + 1;
+        }
+    };
+
+    /// <summary>
+    /// Stores the triangles that reference each vertex in a compressed sparse row layout.
+    /// </summary>
+    struct Adjacency {
+        Array<UInt32> Offsets;
+        Array<UInt32> Triangles;
+
+        Adjacency(std::span<const UInt32> indices, size_t vertexCount) :
+            Offsets(vertexCount + 1, 0), Triangles(indices.size())
+        {
+            for (auto index : indices)
+                ++Offsets[index + 1];
+
+            std::inclusive_scan(Offsets.begin(), Offsets.end(), Offsets.begin());
+            Array<UInt32> fill(Offsets.begin(), Offsets.end() - 1);
+
+            for (size_t i{ 0 }; i < indices.size(); ++i)
+                Triangles[fill[indices[i]]++] = static_cast<UInt32>(i / 3);
+        }
+
+        std::span<const UInt32> adjacent(UInt32 vertex) const noexcept
+        {
+            return std::span(Triangles).subspan(Offsets[vertex], Offsets[vertex + 1] - Offsets[vertex]);
+        }
+    };
+
+}
+
+// ------------------------------------------------------------------------------------------------
+// Mesh optimizer.
+// ------------------------------------------------------------------------------------------------
+
+Array<UInt32> MeshOptimizer::optimizeVertexCache(std::span<const UInt32> indices, size_t vertexCount, UInt32 cacheSize)
+{
+    validate(indices, vertexCount);
+
+    if (cacheSize < 3) [[unlikely]]
+        throw ArgumentOutOfRangeException("cacheSize", "The cache must be able to hold at least one triangle, but its size was {0}.", cacheSize);
+
+    Array<UInt32> result;
+    result.reserve(indices.size());
+
+    if (indices.empty())
+        return result;
+
+    Adjacency adjacency(indices, vertexCount);
+    VertexCache cache(vertexCount, cacheSize);
+    Array<UInt32> liveTriangles(vertexCount), deadEnds, candidates;
+    Array<Byte> emitted(indices.size() / 3, 0);
+    UInt32 cursor{ 0 };
+
+    for (UInt32 v{ 0 }; v < vertexCount; ++v)
+        liveTriangles[v] = static_cast<UInt32>(adjacency.adjacent(v).size());
+
+    // Returns the next vertex in index order that still has triangles left, or INVALID if all triangles have been emitted.
+    auto nextLiveVertex = [&]() {
+        while (cursor < vertexCount && liveTriangles[cursor] == 0)
+            ++cursor;
+
+        return cursor < vertexCount ? cursor : INVALID;
+    };
+
+    // Emit all triangles around the fanning vertex, then continue with the vertex that is most likely to remain in the cache while its triangles are
+    // emitted. If no such vertex exists, continue with the most recently referenced vertex that still has triangles (see Sander et al., "Fast Triangle
+    // Reordering for Vertex Locality and Reduced Overdraw").
+    for (auto fan = nextLiveVertex(); fan != INVALID; )
+    {
+        candidates.clear();
+
+        for (auto triangle : adjacency.adjacent(fan))
+        {
+            if (emitted[triangle])
+                continue;
+
+            for (size_t i{ 0 }; i < 3; ++i)
+            {
+                auto vertex = indices[triangle * 3 + i];
+                result.push_back(vertex);
+                deadEnds.push_back(vertex);
+                candidates.push_back(vertex);
+                --liveTriangles[vertex];
+                cache.miss(vertex);
+            }
+
+            emitted[triangle] = 1;
+        }
+
+        fan = INVALID;
+        Int64 bestPriority{ -1 };
+
+        for (auto vertex : candidates)
+        {
+            if (liveTriangles[vertex] == 0)
+                continue;
+
+            // Prefer the oldest vertex that stays in the cache while all of its remaining triangles are emitted.
+            Int64 priority{ 0 };
+
+            if (cache.age(vertex) + 2 * liveTriangles[vertex] <= cacheSize)
+                priority = cache.age(vertex);
+
+            if (priority > bestPriority)
+                fan = vertex, bestPriority = priority;
+        }
+
+        while (fan == INVALID && !deadEnds.empty())
+        {
+            if (liveTriangles[deadEnds.back()] > 0)
+                fan = deadEnds.back();
+
+            deadEnds.pop_back();
+        }
+
+        if (fan == INVALID)
+            fan = nextLiveVertex();
+    }
+
+    return result;
+}
+
+Array<UInt32> MeshOptimizer::optimizeOverdraw(const IndexedMesh& mesh, Float threshold, UInt32 cacheSize)
+{
+    validate(mesh.Indices, mesh.VertexCount);
+
+    if (!(threshold >= 1.f)) [[unlikely]]
+        throw ArgumentOutOfRangeException("threshold", "The threshold must be at least 1, but was {0}.", threshold);
+
+    if (cacheSize < 3) [[unlikely]]
+        throw ArgumentOutOfRangeException("cacheSize", "The cache must be able to hold at least one triangle, but its size was {0}.", cacheSize);
+
+    auto indices = mesh.Indices;
+    auto triangleCount = indices.size() / 3;
+
+    if (triangleCount == 0)
+        return {};
+
+    // Split the triangles into clusters wherever the cache is effectively flushed, i.e., none of the vertices of a triangle are in the cache.
+    VertexCache cache(mesh.VertexCount, cacheSize);
+    Array<size_t> hardBoundaries, clusters;
+
+    for (size_t t{ 0 }; t < triangleCount; ++t)
+        if (cache.misses(indices, t) == 3)
+            hardBoundaries.push_back(t);
+
+    hardBoundaries.push_back(triangleCount);
+
+    // Further split each cluster, as soon as the cache miss ratio of the new cluster is within the threshold of the one of the original cluster.
+    for (size_t c{ 0 }; c + 1 < hardBoundaries.size(); ++c)
+    {
+        auto start = hardBoundaries[c], end = hardBoundaries[c + 1];
+        UInt32 clusterMisses{ 0 };
+        cache.flush();
+
+        for (auto t = start; t < end; ++t)
+            clusterMisses += cache.misses(indices, t);
+
+        auto clusterThreshold = threshold * static_cast<Float>(clusterMisses) / static_cast<Float>(end - start);
+        UInt32 runningMisses{ 0 }, runningTriangles{ 0 };
+        clusters.push_back(start);
+        cache.flush();
+
+        for (auto t = start; t < end; ++t)
+        {
+            runningMisses += cache.misses(indices, t);
+            ++runningTriangles;
+
+            if (t + 1 < end && static_cast<Float>(runningMisses) / static_cast<Float>(runningTriangles) <= clusterThreshold)
+            {
+                clusters.push_back(t + 1);
+                runningMisses = runningTriangles = 0;
+                cache.flush();
+            }
+        }
+    }
+
+    clusters.push_back(triangleCount);
+
+    // Sort the clusters by how much they face away from the mesh center, so that outer surfaces that occlude the inner ones are drawn first.
+    Vector3f meshCentroid{ };
+
+    for (auto index : indices)
+        meshCentroid += mesh.position(index);
+
+    meshCentroid /= static_cast<Float>(indices.size());
+
+    Array<Float> keys(clusters.size() - 1);
+
+    for (size_t c{ 0 }; c < keys.size(); ++c)
+    {
+        Vector3f centroid{ }, normal{ };
+        Float area{ 0.f };
+
+        for (auto t = clusters[c]; t < clusters[c + 1]; ++t)
+        {
+            auto p0 = mesh.position(indices[t * 3]), p1 = mesh.position(indices[t * 3 + 1]), p2 = mesh.position(indices[t * 3 + 2]);
+            Vector3f triangleNormal = cross(p1 - p0, p2 - p0);
+            auto triangleArea = length(triangleNormal);
+
+            centroid += (p0 + p1 + p2) * (triangleArea / 3.f);
+            normal += triangleNormal;
+            area += triangleArea;
+        }
+
+        auto normalLength = length(normal);
+        keys[c] = area > 0.f && normalLength > 0.f ? dot(centroid / area - meshCentroid, normal / normalLength) : 0.f;
+    }
+
+    Array<size_t> order(keys.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::stable_sort(order, std::greater<>{ }, [&](size_t c) { return keys[c]; });
+
+    Array<UInt32> result;
+    result.reserve(indices.size());
+
+    for (auto c : order)
+        result.insert(result.end(), indices.begin() + clusters[c] * 3, indices.begin() + clusters[c + 1] * 3);
+
+    return result;
+}
+
+Array<UInt32> MeshOptimizer::optimizeVertexFetch(std::span<UInt32> indices, size_t vertexCount)
+{
+    validate(indices, vertexCount, false);
+
+    Array<UInt32> remap(vertexCount, UNUSED_VERTEX);
+    UInt32 next{ 0 };
+
+    for (auto& index : indices)
+    {
+        if (remap[index] == UNUSED_VERTEX)
+            remap[index] = next++;
+
+        index = remap[index];
+    }
+
+    return remap;
+}
+
+size_t MeshOptimizer::remapVertices(const Byte* source, Byte* destination, size_t stride, std::span<const UInt32> remap)
+{
+    if (source == nullptr) [[unlikely]]
+        throw ArgumentNotInitializedException("source", "The source vertices must be initialized.");
+
+    if (destination == nullptr) [[unlikely]]
+        throw ArgumentNotInitializedException("destination", "The destination must be initialized.");
+
+    size_t written{ 0 };
+
+    for (size_t v{ 0 }; v < remap.size(); ++v)
+    {
+        if (remap[v] == UNUSED_VERTEX)
+            continue;
+
+        std::memcpy(destination + static_cast<size_t>(remap[v]) * stride, source + v * stride, stride);
+        ++written;
+    }
+
+    return written;
+}
+
+VertexCacheStatistics MeshOptimizer::analyzeVertexCache(std::span<const UInt32> indices, size_t vertexCount, UInt32 cacheSize)
+{
+    validate(indices, vertexCount, false);
+
+    VertexCache cache(vertexCount, cacheSize);
+    Array<Byte> referenced(vertexCount, 0);
+    UInt32 misses{ 0 }, uniqueVertices{ 0 };
+
+    for (auto index : indices)
+    {
+        misses += static_cast<UInt32>(cache.miss(index));
+
+        if (!referenced[index])
+            referenced[index] = 1, ++uniqueVertices;
+    }
+
+    auto triangles = indices.size() / 3;
+
+    return {
+        .VerticesTransformed = misses,
+        .ACMR = triangles > 0 ? static_cast<Float>(misses) / static_cast<Float>(triangles) : 0.f,
+        .ATVR = uniqueVertices > 0 ? static_cast<Float>(misses) / static_cast<Float>(uniqueVertices) : 0.f
+    };
+}
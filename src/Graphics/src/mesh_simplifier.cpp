@@ -0,0 +1,601 @@
+#include <litefx/graphics.hpp>
+#include <numeric>
+#include <unordered_map>
+
+using namespace LiteFX::Graphics;
+
+// ------------------------------------------------------------------------------------------------
+// Helpers.
+// ------------------------------------------------------------------------------------------------
+
+namespace {
+
+    constexpr UInt32 INVALID = std::numeric_limits<UInt32>::max();
+
+    /// <summary>
+    /// Describes which collapses a vertex can participate in.
+    /// </summary>
+    enum class VertexKind {
+        /// <summary>
+        /// The vertex is surrounded by triangles and has no attribute discontinuities. It can be collapsed onto any neighbor.
+        /// </summary>
+        Manifold,
+
+        /// <summary>
+        /// The vertex is on an open border. It can only be collapsed along the border.
+        /// </summary>
+        Border,
+
+        /// <summary>
+        /// The vertex is on an attribute seam, i.e., it shares its position with exactly one other vertex. It can only be collapsed along the seam, together
+        /// with the other vertex.
+        /// </summary>
+        Seam,
+
+        /// <summary>
+        /// The vertex can not be collapsed.
+        /// </summary>
+        Locked
+    };
+
+    /// <summary>
+    /// Stores a quadric, i.e., a symmetric 4x4 matrix that measures the squared distance of a point to a set of planes, together with the accumulated weight
+    /// of the planes.
+    /// </summary>
+    struct Quadric {
+        Float A00{ 0.f }, A11{ 0.f }, A22{ 0.f }, A01{ 0.f }, A02{ 0.f }, A12{ 0.f };
+        Float B0{ 0.f }, B1{ 0.f }, B2{ 0.f }, C{ 0.f }, W{ 0.f };
+
+        static Quadric fromPlane(const Vector3f& normal, Float distance, Float weight) noexcept
+        {
+            Quadric q;
+            q.A00 = weight * normal.x() * normal.x();
+            q.A11 = weight * normal.y() * normal.y();
+            q.A22 = weight * normal.z() * normal.z();
+            q.A01 = weight * normal.x() * normal.y();
+            q.A02 = weight * normal.x() * normal.z();
+            q.A12 = weight * normal.y() * normal.z();
+            q.B0 = weight * normal.x() * distance;
+            q.B1 = weight * normal.y() * distance;
+            q.B2 = weight * normal.z() * distance;
+            q.C = weight * distance * distance;
+            q.W = weight;
+            return q;
+        }
+
+        Quadric& operator+=(const Quadric& other) noexcept
+        {
+            A00 += other.A00; A11 += other.A11; A22 += other.A22;
+            A01 += other.A01; A02 += other.A02; A12 += other.A12;
+            B0 += other.B0; B1 += other.B1; B2 += other.B2;
+            C += other.C;
+            W += other.W;
+            return *this;
+        }
+
+        /// <summary>
+        /// Returns the weighted mean of the squared distances between <paramref name="p" /> and the planes of the quadric.
+        /// </summary>
+        Float error(const Vector3f& p) const noexcept
+        {
+            auto rx = A00 * p.x() + A01 * p.y() + A02 * p.z() + 2.f * B0;
+            auto ry = A01 * p.x() + A11 * p.y() + A12 * p.z() + 2.f * B1;
+            auto rz = A02 * p.x() + A12 * p.y() + A22 * p.z() + 2.f * B2;
+            auto error = std::abs(rx * p.x() + ry * p.y() + rz * p.z() + C);
+
+            // Normalize by the weight, so that the error is a squared distance that does not depend on the area of the triangles around the vertex.
+            return W > 0.f ? error / W : error;
+        }
+    };
+
+    struct Collapse {
+        UInt32 From, To;
+        Float Error;
+    };
+
+    /// <summary>
+    /// Stores the state of a mesh during simplification.
+    /// </summary>
+    class Simplifier {
+    private:
+        Array<UInt32> m_indices;
+        Array<Vector3f> m_positions;
+        Array<UInt32> m_classes;
+        Array<UInt32> m_siblings;
+        Array<VertexKind> m_kinds;
+        Array<Quadric> m_quadrics;
+        Array<UInt32> m_offsets, m_triangles;
+
+    public:
+        Simplifier(const IndexedMesh& mesh) :
+            m_indices(mesh.Indices.begin(), mesh.Indices.end()), m_positions(mesh.VertexCount), m_classes(mesh.VertexCount), m_siblings(mesh.VertexCount),
+            m_kinds(mesh.VertexCount, VertexKind::Manifold), m_quadrics(mesh.VertexCount)
+        {
+            this->normalizePositions(mesh);
+            this->buildClasses();
+            this->buildAdjacency();
+            this->classifyVertices();
+            this->buildQuadrics();
+        }
+
+    public:
+        Array<UInt32>& indices() noexcept
+        {
+            return m_indices;
+        }
+
+        /// <summary>
+        /// Collapses edges until the target triangle count is reached, or no edge can be collapsed without exceeding the target error. Returns the error of
+        /// the most expensive collapse.
+        /// </summary>
+        Float simplify(size_t targetIndexCount, Float targetError)
+        {
+            Array<Collapse> candidates;
+            Array<UInt32> remap(m_positions.size());
+            Array<Byte> locked(m_positions.size());
+            Float maxError{ 0.f };
+            auto errorLimit = targetError * targetError;
+
+            while (m_indices.size() > targetIndexCount)
+            {
+                this->collectCandidates(candidates, errorLimit);
+                std::ranges::sort(candidates, {}, &Collapse::Error);
+
+                std::iota(remap.begin(), remap.end(), 0);
+                std::ranges::fill(locked, 0);
+                size_t removedTriangles{ 0 }, triangleGoal = (m_indices.size() - targetIndexCount) / 3;
+
+                // Each vertex can only participate in one collapse per pass and a collapse is skipped, if any of the triangles around the collapsed vertex 
+                // has already been changed during this pass, so that the error estimates and flip tests remain valid.
+                for (auto& candidate : candidates)
+                {
+                    if (removedTriangles >= triangleGoal)
+                        break;
+
+                    auto from = candidate.From, to = candidate.To;
+
+                    if (locked[m_classes[from]] || locked[m_classes[to]] || this->changed(from, remap) || this->flips(from, to))
+                        continue;
+
+                    auto fromSibling = m_kinds[from] == VertexKind::Seam ? m_siblings[from] : INVALID;
+                    auto toSibling = m_kinds[from] == VertexKind::Seam ? this->seamSibling(fromSibling, to) : INVALID;
+
+                    if (fromSibling != INVALID && (toSibling == INVALID || this->changed(fromSibling, remap) || this->flips(fromSibling, toSibling)))
+                        continue;
+
+                    locked[m_classes[from]] = locked[m_classes[to]] = 1;
+                    removedTriangles += this->collapse(from, to, remap);
+
+                    if (fromSibling != INVALID)
+                        removedTriangles += this->collapse(fromSibling, toSibling, remap);
+
+                    m_quadrics[m_classes[to]] += m_quadrics[m_classes[from]];
+                    maxError = std::max(maxError, candidate.Error);
+                }
+
+                if (removedTriangles == 0)
+                    break;
+
+                this->applyRemap(remap);
+                this->buildAdjacency();
+            }
+
+            return std::sqrt(maxError);
+        }
+
+    private:
+        void normalizePositions(const IndexedMesh& mesh)
+        {
+            // Scale the mesh into the unit cube, so that errors are relative to the size of the mesh. Only referenced vertices contribute to the bounds, since 
+            // the mesh may only cover a small part of a large vertex buffer.
+            for (size_t v{ 0 }; v < m_positions.size(); ++v)
+                m_positions[v] = mesh.position(v);
+
+            if (m_indices.empty())
+                return;
+
+            Vector3f minimum = m_positions[m_indices.front()], maximum = minimum;
+
+            for (auto index : m_indices)
+            {
+                auto& position = m_positions[index];
+                minimum = Vector3f(std::min(minimum.x(), position.x()), std::min(minimum.y(), position.y()), std::min(minimum.z(), position.z()));
+                maximum = Vector3f(std::max(maximum.x(), position.x()), std::max(maximum.y(), position.y()), std::max(maximum.z(), position.z()));
+            }
+
+            auto extent = maximum - minimum;
+            auto size = std::max({ extent.x(), extent.y(), extent.z() });
+            auto scale = size > 0.f ? 1.f / size : 1.f;
+
+            for (auto& position : m_positions)
+                position = Vector3f((position - minimum) * scale);
+        }
+
+        void buildClasses()
+        {
+            // Group vertices with identical positions into classes, where each vertex points to the first vertex of its class. The siblings form a circular
+            // list of all vertices within a class.
+            struct PositionHash {
+                size_t operator()(const std::array<UInt32, 3>& key) const noexcept
+                {
+                    return (key[0] * 73856093u) ^ (key[1] * 19349663u) ^ (key[2] * 83492791u);
+                }
+            };
+
+            // Vertices that are not referenced by any triangle are skipped, which is important when simplifying a small part of a large vertex buffer, 
+            // for example when building levels of detail.
+            Array<Byte> used(m_positions.size());
+
+            for (auto index : m_indices)
+                used[index] = 1;
+
+            std::iota(m_classes.begin(), m_classes.end(), 0);
+            std::iota(m_siblings.begin(), m_siblings.end(), 0);
+            std::unordered_map<std::array<UInt32, 3>, UInt32, PositionHash> classes;
+            classes.reserve(std::min(m_indices.size(), m_positions.size()));
+
+            for (UInt32 v{ 0 }; v < static_cast<UInt32>(m_positions.size()); ++v)
+            {
+                if (!used[v])
+                    continue;
+
+                // Adding zero turns negative zero into positive zero.
+                std::array<Float, 3> position = { m_positions[v].x() + 0.f, m_positions[v].y() + 0.f, m_positions[v].z() + 0.f };
+                std::array<UInt32, 3> key;
+                std::memcpy(key.data(), position.data(), sizeof(key));
+
+                auto [it, inserted] = classes.try_emplace(key, v);
+
+                if (!inserted)
+                {
+                    m_classes[v] = it->second;
+                    m_siblings[v] = m_siblings[it->second];
+                    m_siblings[it->second] = v;
+                }
+            }
+        }
+
+        void buildAdjacency()
+        {
+            m_offsets.assign(m_positions.size() + 1, 0);
+            m_triangles.resize(m_indices.size());
+
+            for (auto index : m_indices)
+                ++m_offsets[index + 1];
+
+            std::inclusive_scan(m_offsets.begin(), m_offsets.end(), m_offsets.begin());
+            Array<UInt32> fill(m_offsets.begin(), m_offsets.end() - 1);
+
+            for (size_t i{ 0 }; i < m_indices.size(); ++i)
+                m_triangles[fill[m_indices[i]]++] = static_cast<UInt32>(i / 3);
+        }
+
+        std::span<const UInt32> adjacent(UInt32 vertex) const noexcept
+        {
+            return std::span(m_triangles).subspan(m_offsets[vertex], m_offsets[vertex + 1] - m_offsets[vertex]);
+        }
+
+        std::span<const UInt32> triangle(UInt32 t) const noexcept
+        {
+            return std::span(m_indices).subspan(t * 3, 3);
+        }
+
+        /// <summary>
+        /// Returns <c>true</c>, if a triangle contains the half-edge from <paramref name="a" /> to <paramref name="b" />.
+        /// </summary>
+        bool hasEdge(UInt32 a, UInt32 b) const noexcept
+        {
+            return std::ranges::any_of(this->adjacent(a), [&](UInt32 t) {
+                auto indices = this->triangle(t);
+                return (indices[0] == a && indices[1] == b) || (indices[1] == a && indices[2] == b) || (indices[2] == a && indices[0] == b);
+            });
+        }
+
+        /// <summary>
+        /// Returns <c>true</c>, if a triangle contains a half-edge from the position of <paramref name="a" /> to the position of <paramref name="b" />.
+        /// </summary>
+        bool hasPositionEdge(UInt32 a, UInt32 b) const noexcept
+        {
+            auto target = m_classes[b];
+
+            for (auto wedge = a; ; )
+            {
+                for (auto t : this->adjacent(wedge))
+                {
+                    auto indices = this->triangle(t);
+
+                    for (size_t i{ 0 }; i < 3; ++i)
+                        if (indices[i] == wedge && m_classes[indices[(i + 1) % 3]] == target)
+                            return true;
+                }
+
+                if ((wedge = m_siblings[wedge]) == a)
+                    return false;
+            }
+        }
+
+        /// <summary>
+        /// Returns the vertex at the position of <paramref name="to" /> that forms an edge with <paramref name="fromSibling" />, or INVALID, if there is none.
+        /// </summary>
+        UInt32 seamSibling(UInt32 fromSibling, UInt32 to) const noexcept
+        {
+            for (auto wedge = m_siblings[to]; wedge != to; wedge = m_siblings[wedge])
+                if (this->hasEdge(fromSibling, wedge) || this->hasEdge(wedge, fromSibling))
+                    return wedge;
+
+            return INVALID;
+        }
+
+        UInt32 classSize(UInt32 vertex) const noexcept
+        {
+            UInt32 size{ 1 };
+
+            for (auto wedge = m_siblings[vertex]; wedge != vertex; wedge = m_siblings[wedge])
+                ++size;
+
+            return size;
+        }
+
+        void classifyVertices()
+        {
+            // Edges on open borders in position space have no opposite half-edge.
+            Array<Byte> border(m_positions.size());
+
+            for (UInt32 t{ 0 }; t < static_cast<UInt32>(m_indices.size() / 3); ++t)
+            {
+                auto indices = this->triangle(t);
+
+                for (size_t i{ 0 }; i < 3; ++i)
+                {
+                    auto from = indices[i], to = indices[(i + 1) % 3];
+
+                    if (m_classes[from] != m_classes[to] && !this->hasPositionEdge(to, from))
+                        border[m_classes[from]] = border[m_classes[to]] = 1;
+                }
+            }
+
+            for (UInt32 v{ 0 }; v < static_cast<UInt32>(m_positions.size()); ++v)
+            {
+                switch (this->classSize(v))
+                {
+                case 1: m_kinds[v] = border[m_classes[v]] ? VertexKind::Border : VertexKind::Manifold; break;
+                case 2: m_kinds[v] = border[m_classes[v]] ? VertexKind::Locked : VertexKind::Seam; break;
+                default: m_kinds[v] = VertexKind::Locked; break;
+                }
+            }
+        }
+
+        void buildQuadrics()
+        {
+            for (UInt32 t{ 0 }; t < static_cast<UInt32>(m_indices.size() / 3); ++t)
+            {
+                auto indices = this->triangle(t);
+                auto& a = m_positions[indices[0]];
+                auto& b = m_positions[indices[1]];
+                auto& c = m_positions[indices[2]];
+                Vector3f normal = cross(b - a, c - a);
+                auto area = length(normal);
+
+                if (area <= 0.f)
+                    continue;
+
+                normal /= area;
+                auto quadric = Quadric::fromPlane(normal, -dot(normal, a), area);
+
+                for (auto index : indices)
+                    m_quadrics[m_classes[index]] += quadric;
+
+                // Add planes perpendicular to border and seam edges, which keeps them from moving during simplification.
+                for (size_t i{ 0 }; i < 3; ++i)
+                {
+                    auto from = indices[i], to = indices[(i + 1) % 3];
+
+                    if (this->hasEdge(to, from))
+                        continue;
+
+                    Vector3f edge = m_positions[to] - m_positions[from];
+                    auto edgeLength = length(edge);
+
+                    if (edgeLength <= 0.f)
+                        continue;
+
+                    Vector3f perpendicular = normalize(cross(edge, normal));
+                    auto edgeQuadric = Quadric::fromPlane(perpendicular, -dot(perpendicular, m_positions[from]), edgeLength * edgeLength * 10.f);
+                    m_quadrics[m_classes[from]] += edgeQuadric;
+                    m_quadrics[m_classes[to]] += edgeQuadric;
+                }
+            }
+        }
+
+        bool canCollapse(UInt32 from, UInt32 to) const noexcept
+        {
+            if (m_classes[from] == m_classes[to])
+                return false;
+
+            switch (m_kinds[from])
+            {
+            case VertexKind::Manifold:
+                return true;
+            case VertexKind::Border:
+                // Only collapse along border edges.
+                return m_kinds[to] != VertexKind::Manifold && this->hasPositionEdge(from, to) != this->hasPositionEdge(to, from);
+            case VertexKind::Seam:
+                // Only collapse along seam edges, i.e., edges that are open in index space, but closed in position space.
+                return m_kinds[to] == VertexKind::Seam && this->hasEdge(from, to) != this->hasEdge(to, from);
+            default:
+                return false;
+            }
+        }
+
+        void collectCandidates(Array<Collapse>& candidates, Float errorLimit) const
+        {
+            candidates.clear();
+
+            for (size_t t{ 0 }; t < m_indices.size() / 3; ++t)
+            {
+                auto indices = this->triangle(static_cast<UInt32>(t));
+
+                for (size_t i{ 0 }; i < 3; ++i)
+                {
+                    auto a = indices[i], b = indices[(i + 1) % 3];
+
+                    // Evaluate both directions, but only for one of the two half-edges of interior edges.
+                    if (a > b && this->hasEdge(b, a))
+                        continue;
+
+                    for (auto [from, to] : { std::pair{ a, b }, std::pair{ b, a } })
+                    {
+                        if (!this->canCollapse(from, to))
+                            continue;
+
+                        auto quadric = m_quadrics[m_classes[from]];
+                        quadric += m_quadrics[m_classes[to]];
+                        auto error = quadric.error(m_positions[to]);
+
+                        if (error <= errorLimit)
+                            candidates.push_back({ from, to, error });
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Returns <c>true</c>, if moving <paramref name="from" /> onto <paramref name="to" /> flips any of the remaining triangles.
+        /// </summary>
+        bool flips(UInt32 from, UInt32 to) const noexcept
+        {
+            auto& target = m_positions[to];
+
+            return std::ranges::any_of(this->adjacent(from), [&](UInt32 t) {
+                auto indices = this->triangle(t);
+
+                if (std::ranges::any_of(indices, [&](UInt32 index) { return m_classes[index] == m_classes[to]; }))
+                    return false;
+
+                std::array<Vector3f, 3> before = { m_positions[indices[0]], m_positions[indices[1]], m_positions[indices[2]] };
+                auto after = before;
+
+                for (size_t i{ 0 }; i < 3; ++i)
+                    if (indices[i] == from)
+                        after[i] = target;
+
+                return dot(cross(before[1] - before[0], before[2] - before[0]), cross(after[1] - after[0], after[2] - after[0])) <= 0.f;
+            });
+        }
+
+        /// <summary>
+        /// Returns <c>true</c>, if any vertex of the triangles around <paramref name="vertex" /> has already been collapsed.
+        /// </summary>
+        bool changed(UInt32 vertex, std::span<const UInt32> remap) const noexcept
+        {
+            return std::ranges::any_of(this->adjacent(vertex), [&](UInt32 t) {
+                return std::ranges::any_of(this->triangle(t), [&](UInt32 index) { return remap[index] != index; });
+            });
+        }
+
+        /// <summary>
+        /// Collapses <paramref name="from" /> onto <paramref name="to" /> and returns the number of triangles that are removed by the collapse.
+        /// </summary>
+        size_t collapse(UInt32 from, UInt32 to, std::span<UInt32> remap) const noexcept
+        {
+            remap[from] = to;
+
+            return static_cast<size_t>(std::ranges::count_if(this->adjacent(from), [&](UInt32 t) { 
+                return std::ranges::find(this->triangle(t), to) != this->triangle(t).end(); 
+            }));
+        }
+
+        void applyRemap(std::span<const UInt32> remap)
+        {
+            size_t written{ 0 };
+
+            for (size_t t{ 0 }; t < m_indices.size(); t += 3)
+            {
+                auto a = remap[m_indices[t]], b = remap[m_indices[t + 1]], c = remap[m_indices[t + 2]];
+
+                if (a == b || b == c || c == a)
+                    continue;
+
+                m_indices[written++] = a;
+                m_indices[written++] = b;
+                m_indices[written++] = c;
+            }
+
+            m_indices.resize(written);
+        }
+    };
+
+    void validate(const IndexedMesh& mesh)
+    {
+        if (mesh.Indices.size() % 3 != 0) [[unlikely]]
+            throw InvalidArgumentException("mesh", "The number of indices must be a multiple of three, but was {0}.", mesh.Indices.size());
+
+        if (auto invalid = std::ranges::find_if(mesh.Indices, [&](UInt32 index) { return index >= mesh.VertexCount; }); invalid != mesh.Indices.end()) [[unlikely]]
+            throw ArgumentOutOfRangeException("mesh", 0ull, static_cast<unsigned long long>(mesh.VertexCount), static_cast<unsigned long long>(*invalid),
+                "The index at position {0} references a vertex that does not exist.", std::distance(mesh.Indices.begin(), invalid));
+    }
+
+}
+
+// ------------------------------------------------------------------------------------------------
+// Mesh simplifier.
+// ------------------------------------------------------------------------------------------------
+
+Array<UInt32> MeshSimplifier::simplify(const IndexedMesh& mesh, size_t targetIndexCount, Float targetError, Float* error)
+{
+    validate(mesh);
+
+    if (!(targetError >= 0.f)) [[unlikely]]
+        throw ArgumentOutOfRangeException("targetError", "The target error must not be negative, but was {0}.", targetError);
+
+    if (error != nullptr)
+        *error = 0.f;
+
+    if (mesh.Indices.size() <= targetIndexCount)
+        return Array<UInt32>(mesh.Indices.begin(), mesh.Indices.end());
+
+    Simplifier simplifier(mesh);
+    auto result = simplifier.simplify(targetIndexCount, targetError);
+
+    if (error != nullptr)
+        *error = result;
+
+    return std::move(simplifier.indices());
+}
+
+LevelOfDetailChain MeshSimplifier::buildLevelsOfDetail(const IndexedMesh& mesh, UInt32 levels, Float reduction, Float targetError)
+{
+    validate(mesh);
+
+    if (levels == 0) [[unlikely]]
+        throw ArgumentOutOfRangeException("levels", "The chain must contain at least one level.");
+
+    if (!(reduction > 0.f && reduction < 1.f)) [[unlikely]]
+        throw ArgumentOutOfRangeException("reduction", "The reduction must be between 0 and 1, but was {0}.", reduction);
+
+    LevelOfDetailChain chain;
+    chain.Indices.assign(mesh.Indices.begin(), mesh.Indices.end());
+    chain.Levels.push_back({ 0, static_cast<UInt32>(mesh.Indices.size()), 0.f });
+
+    Array<UInt32> current(mesh.Indices.begin(), mesh.Indices.end());
+    Float error{ 0.f };
+
+    for (UInt32 level{ 1 }; level < levels; ++level)
+    {
+        auto targetIndexCount = static_cast<size_t>(static_cast<Float>(current.size() / 3) * reduction) * 3;
+        Float levelError{ 0.f };
+        auto simplified = simplify(IndexedMesh(mesh.Positions, mesh.Stride, mesh.VertexCount, current), targetIndexCount, targetError, &levelError);
+
+        // Stop, if the level does not remove a significant number of triangles.
+        if (simplified.empty() || static_cast<Float>(simplified.size()) > static_cast<Float>(current.size()) * 0.95f)
+            break;
+
+        // The errors of subsequent simplifications accumulate, so their sum is an upper bound for the error of the level.
+        error += levelError;
+        current = MeshOptimizer::optimizeVertexCache(simplified, mesh.VertexCount);
+        chain.Levels.push_back({ static_cast<UInt32>(chain.Indices.size()), static_cast<UInt32>(current.size()), error });
+        chain.Indices.insert(chain.Indices.end(), current.begin(), current.end());
+    }
+
+    return chain;
+}
@@ -0,0 +1,368 @@
+#include <litefx/graphics.hpp>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+using namespace LiteFX::Graphics;
+
+// ------------------------------------------------------------------------------------------------
+// Helpers.
+// ------------------------------------------------------------------------------------------------
+
+namespace {
+
+    constexpr UInt32 INVALID = std::numeric_limits<UInt32>::max();
+
+    /// <summary>
+    /// Stores the triangles that reference each vertex in a compressed sparse row layout, along with per-triangle data that is used to select triangles.
+    /// </summary>
+    struct MeshTopology {
+        Array<Vector3f> Positions;
+        Array<Vector3f> Centroids;
+        Array<Vector3f> Normals;
+        Array<UInt32> Offsets;
+        Array<UInt32> Triangles;
+
+        MeshTopology(const IndexedMesh& mesh) :
+            Positions(mesh.VertexCount), Centroids(mesh.triangles()), Normals(mesh.triangles()), Offsets(mesh.VertexCount + 1, 0), Triangles(mesh.Indices.size())
+        {
+            for (size_t v{ 0 }; v < mesh.VertexCount; ++v)
+                Positions[v] = mesh.position(v);
+
+            for (auto index : mesh.Indices)
+                ++Offsets[index + 1];
+
+            std::inclusive_scan(Offsets.begin(), Offsets.end(), Offsets.begin());
+            Array<UInt32> fill(Offsets.begin(), Offsets.end() - 1);
+
+            for (UInt32 t{ 0 }; t < static_cast<UInt32>(Centroids.size()); ++t)
+            {
+                const auto& a = Positions[mesh.Indices[t * 3]];
+                const auto& b = Positions[mesh.Indices[t * 3 + 1]];
+                const auto& c = Positions[mesh.Indices[t * 3 + 2]];
+                Centroids[t] = (a + b + c) / 3.f;
+
+                // Degenerate triangles have no normal and do not contribute to the normal cone.
+                Vector3f normal = cross(b - a, c - a);
+                auto area = length(normal);
+                Normals[t] = area > 0.f ? Vector3f(normal / area) : Vector3f{ };
+
+                for (size_t i{ 0 }; i < 3; ++i)
+                    Triangles[fill[mesh.Indices[t * 3 + i]]++] = t;
+            }
+        }
+
+        std::span<const UInt32> adjacent(UInt32 vertex) const noexcept
+        {
+            return std::span(Triangles).subspan(Offsets[vertex], Offsets[vertex + 1] - Offsets[vertex]);
+        }
+    };
+
+    /// <summary>
+    /// Computes the bounding sphere and normal cone of a meshlet from its vertices and triangles.
+    /// </summary>
+    MeshletBounds computeBounds(const MeshTopology& topology, std::span<const UInt32> indices, std::span<const UInt32> vertices, std::span<const UInt32> triangles) noexcept
+    {
+        MeshletBounds bounds{ };
+
+        // Compute an approximate bounding sphere (see Ritter, "An Efficient Bounding Sphere").
+        auto farthest = [&](const Vector3f& from) {
+            return *std::ranges::max_element(vertices, {}, [&](UInt32 v) { auto d = topology.Positions[v] - from; return dot(d, d); });
+        };
+
+        const auto& a = topology.Positions[farthest(topology.Positions[vertices.front()])];
+        const auto& b = topology.Positions[farthest(a)];
+        Vector3f center = (a + b) * 0.5f;
+        Float radius = length(b - a) * 0.5f;
+
+        for (auto v : vertices)
+        {
+            auto distance = length(topology.Positions[v] - center);
+
+            if (distance > radius)
+            {
+                auto grow = (distance - radius) * 0.5f;
+                center = center + (topology.Positions[v] - center) * (grow / distance);
+                radius += grow;
+            }
+        }
+
+        bounds.Center = center;
+        bounds.Radius = radius;
+        bounds.ConeApex = center;
+        bounds.ConeCutoff = 1.f;
+
+        // Compute the normal cone (see Barczak, "Triangle-Cluster Culling").
+        Vector3f axis{ };
+
+        for (auto t : triangles)
+            axis += topology.Normals[t];
+
+        auto axisLength = length(axis);
+
+        if (axisLength <= 0.f)
+            return bounds;
+
+        axis /= axisLength;
+        bounds.ConeAxis = axis;
+        Float minimumDot = 1.f;
+
+        for (auto t : triangles)
+            if (auto& normal = topology.Normals[t]; dot(normal, normal) > 0.f)
+                minimumDot = std::min(minimumDot, dot(normal, axis));
+
+        // If the cone is too wide, the meshlet can never be culled, so the cutoff remains 1.
+        if (minimumDot <= 0.1f)
+            return bounds;
+
+        // Move the apex back along the axis, until all triangle planes are in front of it.
+        Float offset{ 0.f };
+
+        for (auto t : triangles)
+        {
+            auto& normal = topology.Normals[t];
+
+            if (dot(normal, normal) > 0.f)
+                offset = std::max(offset, dot(center - topology.Positions[indices[t * 3]], normal) / dot(axis, normal));
+        }
+
+        bounds.ConeApex = center - axis * offset;
+        bounds.ConeCutoff = std::sqrt(1.f - minimumDot * minimumDot);
+
+        return bounds;
+    }
+
+}
+
+// ------------------------------------------------------------------------------------------------
+// Meshlet builder.
+// ------------------------------------------------------------------------------------------------
+
+MeshletBuilder::MeshletBuilder(UInt32 maxVertices, UInt32 maxPrimitives, Float coneWeight) :
+    m_maxVertices(maxVertices), m_maxPrimitives(maxPrimitives), m_coneWeight(coneWeight)
+{
+    if (maxVertices < 3 || maxVertices > MAX_LIMIT) [[unlikely]]
+        throw ArgumentOutOfRangeException("maxVertices", 3u, MAX_LIMIT + 1, maxVertices, "The maximum number of vertices must be between 3 and {0}.", MAX_LIMIT);
+
+    if (maxPrimitives < 1 || maxPrimitives > MAX_LIMIT) [[unlikely]]
+        throw ArgumentOutOfRangeException("maxPrimitives", 1u, MAX_LIMIT + 1, maxPrimitives, "The maximum number of primitives must be between 1 and {0}.", MAX_LIMIT);
+
+    if (!(coneWeight >= 0.f && coneWeight <= 1.f)) [[unlikely]]
+        throw ArgumentOutOfRangeException("coneWeight", "The cone weight must be between 0 and 1, but was {0}.", coneWeight);
+}
+
+UInt32 MeshletBuilder::maxVertices() const noexcept
+{
+    return m_maxVertices;
+}
+
+UInt32 MeshletBuilder::maxPrimitives() const noexcept
+{
+    return m_maxPrimitives;
+}
+
+Float MeshletBuilder::coneWeight() const noexcept
+{
+    return m_coneWeight;
+}
+
+MeshletData MeshletBuilder::build(const IndexedMesh& mesh) const
+{
+    if (mesh.Indices.size() % 3 != 0) [[unlikely]]
+        throw InvalidArgumentException("mesh", "The number of indices must be a multiple of three, but was {0}.", mesh.Indices.size());
+
+    if (auto invalid = std::ranges::find_if(mesh.Indices, [&](UInt32 index) { return index >= mesh.VertexCount; }); invalid != mesh.Indices.end()) [[unlikely]]
+        throw ArgumentOutOfRangeException("mesh", 0ull, static_cast<unsigned long long>(mesh.VertexCount), static_cast<unsigned long long>(*invalid),
+            "The index at position {0} references a vertex that does not exist.", std::distance(mesh.Indices.begin(), invalid));
+
+    MeshletData data;
+    auto triangleCount = static_cast<UInt32>(mesh.triangles());
+
+    if (triangleCount == 0)
+        return data;
+
+    MeshTopology topology(mesh);
+    Array<UInt32> liveTriangles(mesh.VertexCount), localIndices(mesh.VertexCount, INVALID), candidateStamps(triangleCount, 0), candidates, triangles;
+    Array<Byte> emitted(triangleCount, 0);
+    UInt32 emittedCount{ 0 }, nextUnemitted{ 0 }, stamp{ 0 };
+
+    for (UInt32 v{ 0 }; v < mesh.VertexCount; ++v)
+        liveTriangles[v] = static_cast<UInt32>(topology.adjacent(v).size());
+
+    data.Vertices.reserve(mesh.Indices.size());
+    data.Primitives.reserve(triangleCount);
+    triangles.reserve(m_maxPrimitives);
+
+    while (emittedCount < triangleCount)
+    {
+        // Seed the next meshlet with a triangle adjacent to the previous one, preferring triangles on the border of the remaining mesh, which prevents
+        // leaving isolated triangles behind. Otherwise continue with the next triangle in index order.
+        UInt32 seed{ INVALID }, seedScore{ INVALID };
+
+        for (auto t : candidates)
+        {
+            if (emitted[t])
+                continue;
+
+            auto score = liveTriangles[mesh.Indices[t * 3]] + liveTriangles[mesh.Indices[t * 3 + 1]] + liveTriangles[mesh.Indices[t * 3 + 2]];
+
+            if (score < seedScore)
+                seed = t, seedScore = score;
+        }
+
+        if (seed == INVALID)
+        {
+            while (emitted[nextUnemitted])
+                ++nextUnemitted;
+
+            seed = nextUnemitted;
+        }
+
+        Meshlet meshlet{ static_cast<UInt32>(data.Vertices.size()), 0, static_cast<UInt32>(data.Primitives.size()), 0 };
+        Vector3f centroid{ }, normal{ };
+        candidates.clear();
+        triangles.clear();
+        ++stamp;
+
+        auto append = [&](UInt32 triangle) {
+            std::array<UInt32, 3> local;
+
+            for (size_t i{ 0 }; i < 3; ++i)
+            {
+                auto vertex = mesh.Indices[triangle * 3 + i];
+
+                if (localIndices[vertex] == INVALID)
+                {
+                    localIndices[vertex] = meshlet.VertexCount++;
+                    data.Vertices.push_back(vertex);
+                }
+
+                local[i] = localIndices[vertex];
+                --liveTriangles[vertex];
+
+                for (auto neighbor : topology.adjacent(vertex))
+                {
+                    if (!emitted[neighbor] && candidateStamps[neighbor] != stamp)
+                    {
+                        candidateStamps[neighbor] = stamp;
+                        candidates.push_back(neighbor);
+                    }
+                }
+            }
+
+            data.Primitives.push_back(local[0] | (local[1] << 8) | (local[2] << 16));
+            emitted[triangle] = 1;
+            ++emittedCount;
+            ++meshlet.PrimitiveCount;
+            triangles.push_back(triangle);
+            centroid += (topology.Centroids[triangle] - centroid) / static_cast<Float>(meshlet.PrimitiveCount);
+            normal += topology.Normals[triangle];
+        };
+
+        append(seed);
+
+        while (meshlet.PrimitiveCount < m_maxPrimitives)
+        {
+            // Select the neighbor that adds the fewest vertices and is closest to the meshlet. The cone weight penalizes triangles that face away from the
+            // average meshlet normal.
+            UInt32 best{ INVALID }, bestVertices{ 5 };
+            Float bestScore = std::numeric_limits<Float>::max();
+            auto normalLength = length(normal);
+            auto axis = normalLength > 0.f ? Vector3f(normal / normalLength) : Vector3f{ };
+            size_t remaining{ 0 };
+
+            for (auto t : candidates)
+            {
+                if (emitted[t])
+                    continue;
+
+                candidates[remaining++] = t;
+                auto a = mesh.Indices[t * 3], b = mesh.Indices[t * 3 + 1], c = mesh.Indices[t * 3 + 2];
+                auto newVertices = static_cast<UInt32>(localIndices[a] == INVALID) + static_cast<UInt32>(localIndices[b] == INVALID) + static_cast<UInt32>(localIndices[c] == INVALID);
+
+                if (meshlet.VertexCount + newVertices > m_maxVertices)
+                    continue;
+
+                // Triangles that do not add vertices are preferred. Next are triangles that would otherwise be left dangling, i.e., that are the last 
+                // triangle of one of their vertices, since they would end up in small meshlets otherwise.
+                UInt32 vertices = newVertices == 0 ? 0 : (liveTriangles[a] == 1 || liveTriangles[b] == 1 || liveTriangles[c] == 1 ? 1 : newVertices + 1);
+
+                if (vertices > bestVertices)
+                    continue;
+
+                auto distance = topology.Centroids[t] - centroid;
+                auto score = dot(distance, distance) * (1.f + m_coneWeight * (1.f - dot(topology.Normals[t], axis)));
+
+                if (vertices < bestVertices || score < bestScore)
+                    best = t, bestVertices = vertices, bestScore = score;
+            }
+
+            candidates.resize(remaining);
+
+            if (best == INVALID)
+                break;
+
+            append(best);
+        }
+
+        // Reset the local indices of the meshlet vertices for the next meshlet.
+        for (auto vertex : std::span(data.Vertices).subspan(meshlet.VertexOffset))
+            localIndices[vertex] = INVALID;
+
+        data.Meshlets.push_back(meshlet);
+        data.Bounds.push_back(computeBounds(topology, mesh.Indices, std::span(data.Vertices).subspan(meshlet.VertexOffset), triangles));
+    }
+
+    return data;
+}
+
+Array<MeshletData> MeshletBuilder::build(std::span<const IndexedMesh> meshes, UInt32 threads) const
+{
+    Array<MeshletData> results(meshes.size());
+    std::atomic_size_t next{ 0 };
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto worker = [&]() {
+        for (size_t mesh = next++; mesh < meshes.size(); mesh = next++)
+        {
+            try
+            {
+                results[mesh] = this->build(meshes[mesh]);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(errorMutex);
+
+                if (!error)
+                    error = std::current_exception();
+
+                next = meshes.size();
+            }
+        }
+    };
+
+    if (threads == 0)
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    threads = static_cast<UInt32>(std::min<size_t>(threads, meshes.size()));
+
+    if (threads <= 1)
+        worker();
+    else
+    {
+        Array<std::jthread> workers;
+        workers.reserve(threads - 1);
+
+        for (UInt32 i{ 1 }; i < threads; ++i)
+            workers.emplace_back(worker);
+
+        worker();
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+
+    return results;
+}
@@ -17,6 +17,7 @@
 #endif
 
 #include <litefx/core.h>
+#include <chrono>
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/sink.h>
 
@@ -53,6 +54,7 @@ namespace LiteFX::Logging {
 
     protected:
         friend class Logger;
+        friend class AsyncSink;
         virtual spdlog::sink_ptr get() const = 0;
     };
 
@@ -108,6 +110,41 @@ namespace LiteFX::Logging {
         spdlog::sink_ptr get() const override;
     };
 
+    /// <summary>
+    /// A sink that forwards messages to another sink on a background thread.
+    /// </summary>
+    /// <remarks>
+    /// Messages are pushed into a lock-free multi-producer, single-consumer queue, that is drained by a worker thread that writes them into the wrapped sink. This
+    /// prevents threads that emit messages from blocking on expensive sink operations, such as file I/O. Messages that are still queued when the sink is destroyed
+    /// are written before the worker thread exits.
+    /// </remarks>
+    class LITEFX_LOGGING_API AsyncSink : public ISink {
+        LITEFX_IMPLEMENTATION(AsyncSinkImpl);
+
+    public:
+        /// <summary>
+        /// Creates a new asynchronous sink that forwards messages to <paramref name="sink" />.
+        /// </summary>
+        /// <param name="sink">The sink to forward the messages to.</param>
+        AsyncSink(const ISink& sink);
+        AsyncSink(const AsyncSink&) = delete;
+        AsyncSink(AsyncSink&&) = delete;
+        virtual ~AsyncSink() noexcept;
+
+    public:
+        /// <inheritdoc />
+        LogLevel getLevel() const override;
+
+        /// <inheritdoc />
+        String getName() const override;
+
+        /// <inheritdoc />
+        String getPattern() const override;
+
+    protected:
+        spdlog::sink_ptr get() const override;
+    };
+
     class LITEFX_LOGGING_API Log {
         LITEFX_IMPLEMENTATION(LogImpl);
 
@@ -123,13 +160,28 @@ namespace LiteFX::Logging {
         /// </summary>
         virtual const String& getName() const noexcept;
 
+        /// <summary>
+        /// Returns `true`, if a message with the provided <paramref name="level" /> would be written to any sink.
+        /// </summary>
+        /// <param name="level">The level of the message.</param>
+        /// <returns>`true`, if a message with the provided <paramref name="level" /> would be written to any sink, otherwise `false`.</returns>
+        virtual bool shouldLog(LogLevel level) const noexcept;
+
     protected:
         virtual void log(LogLevel level, StringView message);
 
     public:
         template<typename ...TArgs>
         inline void log(LogLevel level, std::format_string<TArgs...> format, TArgs&&... args) {
-            this->log(level, std::format(format, std::forward<TArgs>(args)...));
+            // Skip formatting, if the message gets discarded anyway.
+            if (!this->shouldLog(level))
+                return;
+
+            // Format into a thread-local buffer, so that the message does not need to be allocated each time.
+            thread_local String buffer;
+            buffer.clear();
+            std::format_to(std::back_inserter(buffer), format, std::forward<TArgs>(args)...);
+            this->log(level, StringView(buffer));
         }
 
         template<typename ...TArgs>
@@ -180,11 +232,155 @@ namespace LiteFX::Logging {
         Logger() noexcept;
 
     public:
-        // TODO: Cache logs by name and return them, instead of re-creating them with each call.
-        static Log get(StringView name);
+        /// <summary>
+        /// Returns the log with the provided <paramref name="name" />.
+        /// </summary>
+        /// <remarks>
+        /// Logs are created the first time they are requested and cached afterwards, so that subsequent calls return the same instance. Logs created this way
+        /// write to all sinks that have been registered using <see cref="sinkTo" /> before the log has been created.
+        /// </remarks>
+        /// <param name="name">The name of the log.</param>
+        /// <returns>A reference of the log with the provided name.</returns>
+        static Log& get(StringView name);
         static void sinkTo(const ISink* sink);
     };
 
+    /// <summary>
+    /// Describes how a trace event is interpreted when converting a trace file.
+    /// </summary>
+    /// <seealso cref="TraceSink" />
+    enum class LITEFX_LOGGING_API TraceEventType : std::uint8_t {
+        /// <summary>
+        /// The event marks a single point in time.
+        /// </summary>
+        Instant = 0x00,
+
+        /// <summary>
+        /// The event marks the beginning of a duration on the emitting thread.
+        /// </summary>
+        Begin = 0x01,
+
+        /// <summary>
+        /// The event marks the end of the last duration that has begun on the emitting thread.
+        /// </summary>
+        End = 0x02,
+
+        /// <summary>
+        /// The event records the value of a counter, which is stored in the first payload element.
+        /// </summary>
+        Counter = 0x03
+    };
+
+    /// <summary>
+    /// Stores a single record of a binary trace file.
+    /// </summary>
+    /// <seealso cref="TraceSink" />
+    struct LITEFX_LOGGING_API TraceRecord {
+        /// <summary>
+        /// The time stamp of the event in ticks of the steady clock.
+        /// </summary>
+        std::uint64_t timestamp;
+
+        /// <summary>
+        /// The index of the thread that emitted the event.
+        /// </summary>
+        std::uint32_t threadId;
+
+        /// <summary>
+        /// The identifier of the event.
+        /// </summary>
+        std::uint16_t eventId;
+
+        /// <summary>
+        /// The type of the event.
+        /// </summary>
+        TraceEventType type;
+
+        /// <summary>
+        /// Reserved for future use.
+        /// </summary>
+        std::uint8_t reserved;
+
+        /// <summary>
+        /// The user-defined payload of the event.
+        /// </summary>
+        std::uint64_t payload[2];
+    };
+
+    static_assert(sizeof(TraceRecord) == 32, "Trace records must be 32 bytes in size.");
+
+    /// <summary>
+    /// Writes fixed-size binary trace records into a memory-mapped file.
+    /// </summary>
+    /// <remarks>
+    /// Unlike <see cref="ISink" /> implementations, the trace sink does not format any messages. Each thread that emits events writes them into its own lock-free
+    /// ring buffer, which is drained into a memory-mapped file by a background thread. If a ring buffer is full, the record is dropped and counted. This makes 
+    /// it cheap enough to trace high-frequency events, such as resource creation or queue submissions, every frame.
+    /// 
+    /// Trace files can be converted into the Chrome trace event format, which can be loaded into Perfetto or `chrome://tracing`, using <see cref="convert" />.
+    /// </remarks>
+    /// <seealso cref="TraceRecord" />
+    class LITEFX_LOGGING_API TraceSink {
+        LITEFX_IMPLEMENTATION(TraceSinkImpl);
+
+    public:
+        /// <summary>
+        /// Creates a new trace sink that writes into <paramref name="fileName" />.
+        /// </summary>
+        /// <param name="fileName">The name of the trace file. If the file exists, it will be overwritten.</param>
+        /// <param name="bufferSize">The number of records that can be stored in the ring buffer of each thread.</param>
+        /// <param name="flushInterval">The interval in which the background thread drains the ring buffers.</param>
+        TraceSink(const String& fileName, std::uint32_t bufferSize = 4096, std::chrono::milliseconds flushInterval = std::chrono::milliseconds(10));
+        TraceSink(const TraceSink&) = delete;
+        TraceSink(TraceSink&&) = delete;
+        virtual ~TraceSink() noexcept;
+
+    public:
+        /// <summary>
+        /// Gets the name of the trace file.
+        /// </summary>
+        virtual const String& getFileName() const noexcept;
+
+        /// <summary>
+        /// Returns the number of records that have been dropped, because the ring buffer of the emitting thread was full.
+        /// </summary>
+        virtual std::uint64_t dropped() const noexcept;
+
+        /// <summary>
+        /// Assigns a name to an event identifier, which is used when converting the trace file.
+        /// </summary>
+        /// <param name="eventId">The identifier of the event.</param>
+        /// <param name="name">The name of the event.</param>
+        virtual void registerEvent(std::uint16_t eventId, StringView name);
+
+        /// <summary>
+        /// Writes a trace record for the current thread.
+        /// </summary>
+        /// <remarks>
+        /// The ring buffer of a thread is allocated when the thread writes its first record into the sink. All subsequent writes from the same thread do not allocate.
+        /// </remarks>
+        /// <param name="eventId">The identifier of the event.</param>
+        /// <param name="type">The type of the event.</param>
+        /// <param name="payload0">The first element of the event payload.</param>
+        /// <param name="payload1">The second element of the event payload.</param>
+        /// <exception cref="std::bad_alloc">Thrown, if the ring buffer for the current thread could not be allocated.</exception>
+        virtual void write(std::uint16_t eventId, TraceEventType type = TraceEventType::Instant, std::uint64_t payload0 = 0, std::uint64_t payload1 = 0) const;
+
+        /// <summary>
+        /// Drains all ring buffers into the trace file.
+        /// </summary>
+        virtual void flush() const;
+
+    public:
+        /// <summary>
+        /// Converts a binary trace file into a JSON file in the Chrome trace event format.
+        /// </summary>
+        /// <param name="traceFile">The name of the binary trace file.</param>
+        /// <param name="jsonFile">The name of the JSON file to write.</param>
+        /// <exception cref="RuntimeException">Thrown, if the trace file could not be read or is not a valid trace file.</exception>
+        static void convert(const String& traceFile, const String& jsonFile);
+    };
+
 }
 
 #ifndef NDEBUG
@@ -0,0 +1,219 @@
+#include <litefx/logging.hpp>
+#include <spdlog/details/log_msg_buffer.h>
+#include <atomic>
+#include <thread>
+
+using namespace LiteFX::Logging;
+
+// ------------------------------------------------------------------------------------------------
+// Message queue sink.
+// ------------------------------------------------------------------------------------------------
+
+/// <summary>
+/// Implements a spdlog sink that pushes messages into an intrusive lock-free multi-producer, single-consumer queue.
+/// </summary>
+/// <remarks>
+/// The queue is based on the algorithm described by Dmitry Vyukov. Producers only perform a single atomic exchange to enqueue a message, whilst the worker thread
+/// is the only consumer that ever reads from the queue. The worker thread waits for new messages on an atomic counter, which is only notified if the worker is
+/// actually waiting.
+/// </remarks>
+class AsyncQueueSink final : public spdlog::sinks::sink {
+private:
+    struct Node {
+        std::atomic<Node*> next{ nullptr };
+        spdlog::details::log_msg_buffer message{ };
+
+        Node() = default;
+        Node(const spdlog::details::log_msg& message) : message(message) { }
+    };
+
+private:
+    spdlog::sink_ptr m_sink;
+    Node m_stub{ };
+    std::atomic<Node*> m_head{ &m_stub };
+    Node* m_tail{ &m_stub };
+    std::atomic<UInt64> m_sequence{ 0 };
+    std::atomic_bool m_waiting{ false }, m_stop{ false };
+    std::thread m_worker;
+
+public:
+    AsyncQueueSink(spdlog::sink_ptr sink) :
+        m_sink(sink)
+    {
+        this->set_level(sink->level());
+        m_worker = std::thread(&AsyncQueueSink::run, this);
+    }
+
+    ~AsyncQueueSink() noexcept
+    {
+        m_stop.store(true);
+        m_sequence.fetch_add(1);
+        m_sequence.notify_one();
+        m_worker.join();
+    }
+
+private:
+    void push(Node* node) noexcept
+    {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        auto previous = m_head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    Node* pop() noexcept
+    {
+        auto tail = m_tail;
+        auto next = tail->next.load(std::memory_order_acquire);
+
+        // Skip the stub node.
+        if (tail == &m_stub)
+        {
+            if (next == nullptr)
+                return nullptr;
+
+            m_tail = tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next != nullptr)
+        {
+            m_tail = next;
+            return tail;
+        }
+
+        // If the tail is not the head, a producer is currently enqueueing a node and we need to try again later.
+        if (tail != m_head.load(std::memory_order_acquire))
+            return nullptr;
+
+        // Re-insert the stub node, so that the last node can be dequeued.
+        this->push(&m_stub);
+        next = tail->next.load(std::memory_order_acquire);
+
+        if (next != nullptr)
+        {
+            m_tail = next;
+            return tail;
+        }
+
+        return nullptr;
+    }
+
+    void run()
+    {
+        while (true)
+        {
+            auto sequence = m_sequence.load();
+
+            // Drain the queue.
+            while (auto node = this->pop())
+            {
+                try
+                {
+                    m_sink->log(node->message);
+                }
+                catch (...)
+                {
+                    // Swallow exceptions to keep the worker alive. There is nowhere left to report them to.
+                }
+
+                delete node;
+            }
+
+            if (m_stop.load())
+            {
+                // A producer might still be in the middle of enqueueing a node. Make sure it gets written before exiting.
+                if (m_head.load() != m_tail || m_tail != &m_stub)
+                    continue;
+
+                break;
+            }
+
+            // Wait for new messages.
+            m_waiting.store(true);
+
+            if (m_sequence.load() == sequence)
+                m_sequence.wait(sequence);
+
+            m_waiting.store(false);
+        }
+
+        m_sink->flush();
+    }
+
+public:
+    void log(const spdlog::details::log_msg& message) override
+    {
+        this->push(new Node(message));
+        m_sequence.fetch_add(1);
+
+        // Only wake up the worker, if it is actually waiting.
+        if (m_waiting.load())
+            m_sequence.notify_one();
+    }
+
+    void flush() override
+    {
+        m_sink->flush();
+    }
+
+    void set_pattern(const std::string& pattern) override
+    {
+        m_sink->set_pattern(pattern);
+    }
+
+    void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override
+    {
+        m_sink->set_formatter(std::move(formatter));
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class AsyncSink::AsyncSinkImpl : public Implement<AsyncSink> {
+public:
+    friend class AsyncSink;
+
+private:
+    String m_pattern;
+    LogLevel m_level;
+    SharedPtr<AsyncQueueSink> m_sink;
+
+public:
+    AsyncSinkImpl(AsyncSink* parent, const ISink& sink, spdlog::sink_ptr target) :
+        base(parent), m_pattern(sink.getPattern()), m_level(sink.getLevel()), m_sink(makeShared<AsyncQueueSink>(target))
+    {
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+AsyncSink::AsyncSink(const ISink& sink) :
+    m_impl(makePimpl<AsyncSinkImpl>(this, sink, sink.get()))
+{
+}
+
+AsyncSink::~AsyncSink() noexcept = default;
+
+String AsyncSink::getName() const
+{
+    return "LiteFX::Logging::AsyncSink";
+}
+
+LogLevel AsyncSink::getLevel() const
+{
+    return m_impl->m_level;
+}
+
+String AsyncSink::getPattern() const
+{
+    return m_impl->m_pattern;
+}
+
+spdlog::sink_ptr AsyncSink::get() const
+{
+    return m_impl->m_sink;
+}
@@ -13,10 +13,21 @@ public:
 
 private:
     String m_name;
+    SharedPtr<spdlog::logger> m_logger;
 
 public:
     LogImpl(Log* parent, const String& name) : 
-        base(parent), m_name(name) { }
+        base(parent), m_name(name), m_logger(spdlog::get(name)) { }
+
+public:
+    inline spdlog::logger* logger()
+    {
+        // The logger might not have been registered when the log has been created, in which case we need to look it up again.
+        if (m_logger == nullptr) [[unlikely]]
+            m_logger = spdlog::get(m_name);
+
+        return m_logger.get();
+    }
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -35,9 +46,18 @@ const String& Log::getName() const noexcept
     return m_impl->m_name;
 }
 
+bool Log::shouldLog(LogLevel level) const noexcept
+{
+    if (level == LogLevel::Off || level == LogLevel::Invalid) [[unlikely]]
+        return false;
+
+    auto logger = m_impl->logger();
+    return logger != nullptr && logger->should_log(static_cast<spdlog::level::level_enum>(level));
+}
+
 void Log::log(LogLevel level, StringView message)
 {
-    auto logger = spdlog::get(this->getName());
+    auto logger = m_impl->logger();
     assert(logger != nullptr);
 
     switch (level)
@@ -1,32 +1,63 @@
 #include <litefx/logging.hpp>
 #include <spdlog/spdlog.h>
+#include <shared_mutex>
 
 using namespace LiteFX::Logging;
 
-static Array<spdlog::sink_ptr> m_sinks;
+struct LogNameHash {
+    using is_transparent = void;
 
-Log Logger::get(StringView name)
-{
-    auto nameCopy = String(name);
+    inline size_t operator()(StringView name) const noexcept {
+        return std::hash<StringView>{ }(name);
+    }
+};
 
-    // Get the log.
-    auto log = spdlog::get(nameCopy);
-    
-    // If it does not exist, create it from the current sinks.
-    if (log == nullptr)
-    {
-        auto logger = makeShared<spdlog::logger>(nameCopy, std::begin(m_sinks), std::end(m_sinks));
+static Array<spdlog::sink_ptr> m_sinks;
+static std::unordered_map<String, UniquePtr<Log>, LogNameHash, std::equal_to<>> m_logs;
+static std::shared_mutex m_mutex;
 
+static spdlog::level::level_enum getLogLevel()
+{
 #ifndef NDEBUG
-        logger->set_level(spdlog::level::trace);
+    auto level = spdlog::level::trace;
 #else
-        logger->set_level(spdlog::level::info);
+    auto level = spdlog::level::info;
 #endif
 
+    // There is no need to accept messages, that are discarded by all sinks anyway.
+    if (!m_sinks.empty())
+        level = std::max(level, std::ranges::min(m_sinks | std::views::transform([](const auto& sink) { return sink->level(); })));
+
+    return level;
+}
+
+Log& Logger::get(StringView name)
+{
+    // Return the cached log, if it exists.
+    {
+        std::shared_lock lock(m_mutex);
+
+        if (auto match = m_logs.find(name); match != m_logs.end()) [[likely]]
+            return *match->second;
+    }
+
+    // Check again, since another thread might have created the log in the meantime.
+    std::unique_lock lock(m_mutex);
+
+    if (auto match = m_logs.find(name); match != m_logs.end())
+        return *match->second;
+
+    auto nameCopy = String(name);
+
+    // If the logger does not exist, create it from the current sinks.
+    if (spdlog::get(nameCopy) == nullptr)
+    {
+        auto logger = makeShared<spdlog::logger>(nameCopy, std::begin(m_sinks), std::end(m_sinks));
+        logger->set_level(::getLogLevel());
         spdlog::register_logger(logger);
     }
 
-    return Log(nameCopy);
+    return *m_logs.emplace(nameCopy, makeUnique<Log>(nameCopy)).first->second;
 }
 
 void Logger::sinkTo(const ISink* sink)
@@ -34,5 +65,6 @@ void Logger::sinkTo(const ISink* sink)
     if (sink == nullptr)
         throw std::invalid_argument("The provided sink is not initialized.");
 
+    std::unique_lock lock(m_mutex);
     m_sinks.push_back(sink->get());
-}
\ No newline at end of file
+}
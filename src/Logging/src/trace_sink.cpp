@@ -0,0 +1,470 @@
+#include <litefx/logging.hpp>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+#if !(defined _WIN32 || defined WINCE)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+using namespace LiteFX::Logging;
+
+// ------------------------------------------------------------------------------------------------
+// Trace file layout.
+// ------------------------------------------------------------------------------------------------
+
+/// <summary>
+/// The header of a binary trace file.
+/// </summary>
+/// <remarks>
+/// The header is followed by <see cref="records" /> instances of <see cref="TraceRecord" />. The event name table starts at <see cref="namesOffset" /> and
+/// contains <see cref="names" /> entries, each of which consists of a 16 bit event id, a 16 bit name length and the name characters (without a null-terminator).
+/// </remarks>
+struct TraceFileHeader {
+    char magic[4] = { 'L', 'F', 'X', 'T' };
+    std::uint32_t version = 1;
+    std::uint32_t recordSize = sizeof(TraceRecord);
+    std::uint32_t reserved = 0;
+    std::uint64_t ticksPerSecond = std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num;
+    std::uint64_t records = 0;
+    std::uint64_t namesOffset = 0;
+    std::uint64_t names = 0;
+    std::uint64_t padding[2] = { 0, 0 };
+};
+
+static_assert(sizeof(TraceFileHeader) == 64, "The trace file header must be 64 bytes in size.");
+
+// ------------------------------------------------------------------------------------------------
+// Memory mapped file.
+// ------------------------------------------------------------------------------------------------
+
+/// <summary>
+/// A file that is written through a memory mapping that grows on demand.
+/// </summary>
+class MappedFile {
+private:
+    String m_fileName;
+    std::byte* m_data{ nullptr };
+    size_t m_capacity{ 0 };
+
+#if (defined _WIN32 || defined WINCE)
+    HANDLE m_file{ INVALID_HANDLE_VALUE };
+    HANDLE m_mapping{ nullptr };
+#else
+    int m_file{ -1 };
+#endif
+
+public:
+    MappedFile(const String& fileName, size_t capacity) :
+        m_fileName(fileName)
+    {
+#if (defined _WIN32 || defined WINCE)
+        m_file = ::CreateFileW(Widen(fileName).c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (m_file == INVALID_HANDLE_VALUE) [[unlikely]]
+            throw RuntimeException("Unable to create trace file {0}.", fileName);
+#else
+        m_file = ::open(fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+        if (m_file < 0) [[unlikely]]
+            throw RuntimeException("Unable to create trace file {0}.", fileName);
+#endif
+
+        this->map(capacity);
+    }
+
+    ~MappedFile() noexcept
+    {
+        this->unmap();
+
+#if (defined _WIN32 || defined WINCE)
+        ::CloseHandle(m_file);
+#else
+        ::close(m_file);
+#endif
+    }
+
+private:
+    void map(size_t capacity)
+    {
+#if (defined _WIN32 || defined WINCE)
+        m_mapping = ::CreateFileMappingW(m_file, nullptr, PAGE_READWRITE, static_cast<DWORD>(capacity >> 32), static_cast<DWORD>(capacity & 0xFFFFFFFF), nullptr);
+
+        if (m_mapping == nullptr) [[unlikely]]
+            throw RuntimeException("Unable to map trace file {0}.", m_fileName);
+
+        m_data = static_cast<std::byte*>(::MapViewOfFile(m_mapping, FILE_MAP_WRITE, 0, 0, capacity));
+#else
+        if (::ftruncate(m_file, static_cast<off_t>(capacity)) != 0) [[unlikely]]
+            throw RuntimeException("Unable to resize trace file {0}.", m_fileName);
+
+        auto data = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0);
+        m_data = data == MAP_FAILED ? nullptr : static_cast<std::byte*>(data);
+#endif
+
+        if (m_data == nullptr) [[unlikely]]
+            throw RuntimeException("Unable to map trace file {0}.", m_fileName);
+
+        m_capacity = capacity;
+    }
+
+    void unmap() noexcept
+    {
+        if (m_data == nullptr)
+            return;
+
+#if (defined _WIN32 || defined WINCE)
+        ::UnmapViewOfFile(m_data);
+        ::CloseHandle(m_mapping);
+        m_mapping = nullptr;
+#else
+        ::munmap(m_data, m_capacity);
+#endif
+
+        m_data = nullptr;
+    }
+
+public:
+    inline std::byte* data() const noexcept
+    {
+        return m_data;
+    }
+
+    void reserve(size_t size)
+    {
+        if (size <= m_capacity) [[likely]]
+            return;
+
+        // Grow the file in large steps, so that re-mapping it stays rare.
+        auto capacity = std::max(size, m_capacity * 2);
+        this->unmap();
+        this->map(capacity);
+    }
+
+    void close(size_t size) noexcept
+    {
+        // Release the mapping and shrink the file to the actually written size.
+        this->unmap();
+
+#if (defined _WIN32 || defined WINCE)
+        LARGE_INTEGER position{ .QuadPart = static_cast<LONGLONG>(size) };
+        ::SetFilePointerEx(m_file, position, nullptr, FILE_BEGIN);
+        ::SetEndOfFile(m_file);
+#else
+        [[maybe_unused]] auto result = ::ftruncate(m_file, static_cast<off_t>(size));
+#endif
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class TraceSink::TraceSinkImpl : public Implement<TraceSink> {
+public:
+    friend class TraceSink;
+
+private:
+    /// <summary>
+    /// A single-producer, single-consumer ring buffer that stores the records of one thread.
+    /// </summary>
+    struct ThreadBuffer {
+        Array<TraceRecord> records;
+        alignas(64) std::atomic<std::uint64_t> head{ 0 };
+        alignas(64) std::atomic<std::uint64_t> tail{ 0 };
+
+        ThreadBuffer(size_t capacity) : records(capacity) { }
+    };
+
+    static inline std::atomic<std::uint64_t> s_nextId{ 1 };
+
+private:
+    std::uint64_t m_id{ s_nextId.fetch_add(1) };
+    String m_fileName;
+    size_t m_capacity;
+    std::chrono::milliseconds m_flushInterval;
+    Array<UniquePtr<ThreadBuffer>> m_buffers;
+    Dictionary<std::uint16_t, String> m_eventNames;
+    MappedFile m_file;
+    size_t m_records{ 0 };
+    std::atomic<std::uint64_t> m_dropped{ 0 };
+    std::mutex m_bufferMutex, m_fileMutex;
+    std::condition_variable m_signal;
+    bool m_stop{ false };
+    std::thread m_worker;
+
+public:
+    TraceSinkImpl(TraceSink* parent, const String& fileName, std::uint32_t bufferSize, std::chrono::milliseconds flushInterval) :
+        base(parent), m_fileName(fileName), m_capacity(std::bit_ceil(std::max(bufferSize, 2u))), m_flushInterval(flushInterval),
+        m_file(fileName, sizeof(TraceFileHeader) + sizeof(TraceRecord) * m_capacity * 16)
+    {
+        std::construct_at(reinterpret_cast<TraceFileHeader*>(m_file.data()));
+        m_worker = std::thread(&TraceSinkImpl::run, this);
+    }
+
+    ~TraceSinkImpl() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_bufferMutex);
+            m_stop = true;
+        }
+
+        m_signal.notify_one();
+        m_worker.join();
+
+        // Drain the remaining records and finalize the file.
+        this->drain();
+        this->finalize();
+    }
+
+public:
+    ThreadBuffer* threadBuffer()
+    {
+        // Each thread caches the buffers it owns for each sink, so that looking them up does not require any locking.
+        thread_local Dictionary<std::uint64_t, ThreadBuffer*> buffers;
+        thread_local std::pair<std::uint64_t, ThreadBuffer*> lastBuffer{ 0, nullptr };
+
+        if (lastBuffer.first == m_id) [[likely]]
+            return lastBuffer.second;
+
+        if (auto match = buffers.find(m_id); match != buffers.end())
+            lastBuffer = *match;
+        else
+        {
+            std::lock_guard<std::mutex> lock(m_bufferMutex);
+            auto buffer = m_buffers.emplace_back(makeUnique<ThreadBuffer>(m_capacity)).get();
+            lastBuffer = *buffers.emplace(m_id, buffer).first;
+        }
+
+        return lastBuffer.second;
+    }
+
+    void drain()
+    {
+        std::lock_guard<std::mutex> fileLock(m_fileMutex);
+        std::lock_guard<std::mutex> bufferLock(m_bufferMutex);
+
+        for (std::uint32_t threadId = 0; threadId < static_cast<std::uint32_t>(m_buffers.size()); ++threadId)
+        {
+            auto& buffer = *m_buffers[threadId];
+            auto tail = buffer.tail.load(std::memory_order_relaxed);
+            auto head = buffer.head.load(std::memory_order_acquire);
+
+            if (head == tail)
+                continue;
+
+            auto count = static_cast<size_t>(head - tail);
+            m_file.reserve(sizeof(TraceFileHeader) + sizeof(TraceRecord) * (m_records + count));
+            auto records = reinterpret_cast<TraceRecord*>(m_file.data() + sizeof(TraceFileHeader)) + m_records;
+
+            // Copy the records in at most two contiguous chunks and stamp the thread index.
+            auto mask = m_capacity - 1;
+            auto first = std::min(count, m_capacity - static_cast<size_t>(tail & mask));
+            std::memcpy(records, buffer.records.data() + (tail & mask), sizeof(TraceRecord) * first);
+            std::memcpy(records + first, buffer.records.data(), sizeof(TraceRecord) * (count - first));
+            std::for_each(records, records + count, [threadId](TraceRecord& record) { record.threadId = threadId; });
+
+            m_records += count;
+            buffer.tail.store(head, std::memory_order_release);
+        }
+
+        reinterpret_cast<TraceFileHeader*>(m_file.data())->records = m_records;
+    }
+
+    void finalize()
+    {
+        // Write the event name table behind the records.
+        auto namesOffset = sizeof(TraceFileHeader) + sizeof(TraceRecord) * m_records;
+        auto size = namesOffset;
+
+        for (const auto& name : m_eventNames | std::views::values)
+            size += sizeof(std::uint16_t) * 2 + name.size();
+
+        m_file.reserve(size);
+        auto data = m_file.data() + namesOffset;
+
+        for (const auto& [id, name] : m_eventNames)
+        {
+            auto length = static_cast<std::uint16_t>(name.size());
+            std::memcpy(data, &id, sizeof(std::uint16_t));
+            std::memcpy(data + sizeof(std::uint16_t), &length, sizeof(std::uint16_t));
+            std::memcpy(data + sizeof(std::uint16_t) * 2, name.data(), length);
+            data += sizeof(std::uint16_t) * 2 + length;
+        }
+
+        auto header = reinterpret_cast<TraceFileHeader*>(m_file.data());
+        header->records = m_records;
+        header->namesOffset = namesOffset;
+        header->names = m_eventNames.size();
+
+        m_file.close(size);
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(m_bufferMutex);
+
+        while (!m_stop)
+        {
+            m_signal.wait_for(lock, m_flushInterval, [this]() { return m_stop; });
+
+            lock.unlock();
+            this->drain();
+            lock.lock();
+        }
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+TraceSink::TraceSink(const String& fileName, std::uint32_t bufferSize, std::chrono::milliseconds flushInterval) :
+    m_impl(makePimpl<TraceSinkImpl>(this, fileName, bufferSize, flushInterval))
+{
+}
+
+TraceSink::~TraceSink() noexcept = default;
+
+const String& TraceSink::getFileName() const noexcept
+{
+    return m_impl->m_fileName;
+}
+
+std::uint64_t TraceSink::dropped() const noexcept
+{
+    return m_impl->m_dropped.load(std::memory_order_relaxed);
+}
+
+void TraceSink::registerEvent(std::uint16_t eventId, StringView name)
+{
+    std::lock_guard<std::mutex> lock(m_impl->m_fileMutex);
+    m_impl->m_eventNames[eventId] = String(name.substr(0, std::numeric_limits<std::uint16_t>::max()));
+}
+
+void TraceSink::write(std::uint16_t eventId, TraceEventType type, std::uint64_t payload0, std::uint64_t payload1) const
+{
+    auto& buffer = *m_impl->threadBuffer();
+    auto head = buffer.head.load(std::memory_order_relaxed);
+
+    // Drop the record, if the ring buffer is full.
+    if (head - buffer.tail.load(std::memory_order_acquire) >= m_impl->m_capacity) [[unlikely]]
+    {
+        m_impl->m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer.records[head & (m_impl->m_capacity - 1)] = TraceRecord {
+        .timestamp = static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()),
+        .eventId = eventId,
+        .type = type,
+        .payload = { payload0, payload1 }
+    };
+
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void TraceSink::flush() const
+{
+    m_impl->drain();
+}
+
+void TraceSink::convert(const String& traceFile, const String& jsonFile)
+{
+    std::ifstream input(traceFile, std::ios::binary);
+
+    if (!input.is_open()) [[unlikely]]
+        throw RuntimeException("Unable to open trace file {0}.", traceFile);
+
+    TraceFileHeader header;
+    input.read(reinterpret_cast<char*>(&header), sizeof(TraceFileHeader));
+
+    if (!input || std::memcmp(header.magic, TraceFileHeader{ }.magic, sizeof(header.magic)) != 0 || header.recordSize != sizeof(TraceRecord)) [[unlikely]]
+        throw RuntimeException("The file {0} is not a valid trace file.", traceFile);
+
+    // Read the event names.
+    Dictionary<std::uint16_t, String> eventNames;
+
+    if (header.namesOffset != 0)
+    {
+        input.seekg(static_cast<std::streamoff>(header.namesOffset));
+
+        for (std::uint64_t i = 0; i < header.names && input; ++i)
+        {
+            std::uint16_t id, length;
+            input.read(reinterpret_cast<char*>(&id), sizeof(std::uint16_t));
+            input.read(reinterpret_cast<char*>(&length), sizeof(std::uint16_t));
+
+            String name(length, '\0');
+            input.read(name.data(), length);
+
+            // Escape the name, so that it can be written into a JSON string.
+            String escaped;
+            
+            for (auto c : name)
+            {
+                if (c == '"' || c == '\\')
+                    escaped.push_back('\\');
+
+                if (static_cast<unsigned char>(c) >= 0x20)
+                    escaped.push_back(c);
+            }
+
+            eventNames[id] = std::move(escaped);
+        }
+    }
+
+    // Write the records as Chrome trace events. Time stamps are expected to be in microseconds.
+    std::ofstream output(jsonFile, std::ios::trunc);
+
+    if (!output.is_open()) [[unlikely]]
+        throw RuntimeException("Unable to create output file {0}.", jsonFile);
+
+    output << "{\"traceEvents\":[";
+    input.clear();
+    input.seekg(sizeof(TraceFileHeader));
+
+    // Records are drained per thread, so they are not stored in chronological order. Read all of them first, so that they can be sorted and the time origin 
+    // can be computed from the earliest record over all threads.
+    Array<TraceRecord> records;
+    TraceRecord current;
+
+    for (std::uint64_t i = 0; i < header.records && input.read(reinterpret_cast<char*>(&current), sizeof(TraceRecord)); ++i)
+        records.push_back(current);
+
+    std::ranges::stable_sort(records, std::less<>{ }, &TraceRecord::timestamp);
+
+    auto ticksPerMicrosecond = static_cast<double>(header.ticksPerSecond) / 1000000.0;
+    auto start = records.empty() ? 0 : records.front().timestamp;
+
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const auto& record = records[i];
+        auto timestamp = static_cast<double>(record.timestamp - start) / ticksPerMicrosecond;
+        auto name = eventNames.contains(record.eventId) ? eventNames[record.eventId] : std::format("Event {0}", record.eventId);
+        StringView phase;
+
+        switch (record.type)
+        {
+        case TraceEventType::Begin: phase = "B"; break;
+        case TraceEventType::End: phase = "E"; break;
+        case TraceEventType::Counter: phase = "C"; break;
+        default: phase = "i"; break;
+        }
+
+        if (i > 0)
+            output << ",";
+
+        if (record.type == TraceEventType::Counter)
+            output << std::format("\n{{\"name\":\"{0}\",\"ph\":\"C\",\"ts\":{1:.3f},\"pid\":0,\"tid\":{2},\"args\":{{\"value\":{3}}}}}", name, timestamp, record.threadId, record.payload[0]);
+        else
+            output << std::format("\n{{\"name\":\"{0}\",\"ph\":\"{1}\",\"ts\":{2:.3f},\"pid\":0,\"tid\":{3},\"s\":\"t\",\"args\":{{\"payload0\":{4},\"payload1\":{5}}}}}", name, phase, timestamp, record.threadId, record.payload[0], record.payload[1]);
+    }
+
+    output << "\n]}\n";
+}
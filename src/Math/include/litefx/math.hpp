@@ -169,6 +169,9 @@ namespace LiteFX::Math {
 	}
 
 #pragma region Vector
+	// NOTE: Conversions are defined inline, so that they can be optimized away in hot loops. The DirectXMath storage types (e.g., `XMFLOAT3`) share the 
+	//       layout of the element array, which allows to load and store `XMVECTOR` instances in place.
+
 	/// <summary>
 	/// A vector that contains a single float.
 	/// </summary>
@@ -176,24 +179,32 @@ namespace LiteFX::Math {
 	public:
 		using Vector::Vector;
 
+		/// <summary>
+		/// Initializes the vector from a generic vector, for example the result of an arithmetic operation.
+		/// </summary>
+		/// <param name="v">The vector to copy the elements from.</param>
+		constexpr Vector1f(const Vector<Float, 1>& v) noexcept : Vector(v) { }
+
 #if defined(LITEFX_BUILD_WITH_GLM)
 	public:
 		/// <summary>
 		/// Converts a vector of type `glm::f32vec1`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector1f(const glm::f32vec1& v) noexcept;
+		constexpr Vector1f(const glm::f32vec1& v) noexcept : Vector(v.x) { }
 
 		/// <summary>
 		/// Converts a vector of type `glm::f32vec1`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector1f(glm::f32vec1&& v) noexcept;
+		constexpr Vector1f(glm::f32vec1&& v) noexcept : Vector(v.x) { }
 
 		/// <summary>
 		/// Converts the vector into the type `glm::f32vec1`.
 		/// </summary>
-		operator glm::f32vec1() const noexcept;
+		constexpr operator glm::f32vec1() const noexcept {
+			return glm::f32vec1(m_elements[0]);
+		}
 #endif
 
 #if defined(LITEFX_BUILD_WITH_DIRECTX_MATH)
@@ -202,18 +213,22 @@ namespace LiteFX::Math {
 		/// Converts a vector of type `DirectX::XMVECTOR`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector1f(const DirectX::XMVECTOR& v) noexcept;
+		Vector1f(const DirectX::XMVECTOR& v) noexcept {
+			DirectX::XMStoreFloat(m_elements.data(), v);
+		}
 
 		/// <summary>
 		/// Converts a vector of type `DirectX::XMVECTOR`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector1f(DirectX::XMVECTOR&& v) noexcept;
+		Vector1f(DirectX::XMVECTOR&& v) noexcept : Vector1f(v) { }
 
 		/// <summary>
 		/// Converts the vector into the type `DirectX::XMVECTOR`.
 		/// </summary>
-		operator DirectX::XMVECTOR() const noexcept;
+		operator DirectX::XMVECTOR() const noexcept {
+			return DirectX::XMLoadFloat(m_elements.data());
+		}
 #endif
 	};
 
@@ -226,24 +241,32 @@ namespace LiteFX::Math {
 	public:
 		using Vector::Vector;
 
+		/// <summary>
+		/// Initializes the vector from a generic vector, for example the result of an arithmetic operation.
+		/// </summary>
+		/// <param name="v">The vector to copy the elements from.</param>
+		constexpr Vector1u(const Vector<UInt32, 1>& v) noexcept : Vector(v) { }
+
 #if defined(LITEFX_BUILD_WITH_GLM)
 	public:
 		/// <summary>
 		/// Converts a vector of type `glm::u32vec1`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector1u(const glm::u32vec1& v) noexcept;
+		constexpr Vector1u(const glm::u32vec1& v) noexcept : Vector(v.x) { }
 
 		/// <summary>
 		/// Converts a vector of type `glm::u32vec1`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector1u(glm::u32vec1&& v) noexcept;
+		constexpr Vector1u(glm::u32vec1&& v) noexcept : Vector(v.x) { }
 
 		/// <summary>
 		/// Converts the vector into the type `glm::u32vec1`.
 		/// </summary>
-		operator glm::u32vec1() const noexcept;
+		constexpr operator glm::u32vec1() const noexcept {
+			return glm::u32vec1(m_elements[0]);
+		}
 #endif
 
 #if defined(LITEFX_BUILD_WITH_DIRECTX_MATH)
@@ -252,18 +275,22 @@ namespace LiteFX::Math {
 		/// Converts a vector of type `DirectX::XMVECTOR`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector1u(const DirectX::XMVECTOR& v) noexcept;
+		Vector1u(const DirectX::XMVECTOR& v) noexcept {
+			DirectX::XMStoreInt(m_elements.data(), v);
+		}
 
 		/// <summary>
 		/// Converts a vector of type `DirectX::XMVECTOR`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector1u(DirectX::XMVECTOR&& v) noexcept;
+		Vector1u(DirectX::XMVECTOR&& v) noexcept : Vector1u(v) { }
 
 		/// <summary>
 		/// Converts the vector into the type `DirectX::XMVECTOR`.
 		/// </summary>
-		operator DirectX::XMVECTOR() const noexcept;
+		operator DirectX::XMVECTOR() const noexcept {
+			return DirectX::XMLoadInt(m_elements.data());
+		}
 #endif
 	};
 
@@ -274,24 +301,32 @@ namespace LiteFX::Math {
 	public:
 		using Vector::Vector;
 
+		/// <summary>
+		/// Initializes the vector from a generic vector, for example the result of an arithmetic operation.
+		/// </summary>
+		/// <param name="v">The vector to copy the elements from.</param>
+		constexpr Vector2f(const Vector<Float, 2>& v) noexcept : Vector(v) { }
+
 #if defined(LITEFX_BUILD_WITH_GLM)
 	public:
 		/// <summary>
 		/// Converts a vector of type `glm::f32vec2`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2f(const glm::f32vec2& v) noexcept;
+		constexpr Vector2f(const glm::f32vec2& v) noexcept : Vector(v.x, v.y) { }
 
 		/// <summary>
 		/// Converts a vector of type `glm::f32vec2`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2f(glm::f32vec2&& v) noexcept;
+		constexpr Vector2f(glm::f32vec2&& v) noexcept : Vector(v.x, v.y) { }
 
 		/// <summary>
 		/// Converts the vector into the type `glm::f32vec2`.
 		/// </summary>
-		operator glm::f32vec2() const noexcept;
+		constexpr operator glm::f32vec2() const noexcept {
+			return glm::f32vec2(m_elements[0], m_elements[1]);
+		}
 #endif
 
 #if defined(LITEFX_BUILD_WITH_DIRECTX_MATH)
@@ -300,35 +335,41 @@ namespace LiteFX::Math {
 		/// Converts a vector of type `DirectX::XMVECTOR`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2f(const DirectX::XMVECTOR& v) noexcept;
+		Vector2f(const DirectX::XMVECTOR& v) noexcept {
+			DirectX::XMStoreFloat2(reinterpret_cast<DirectX::XMFLOAT2*>(m_elements.data()), v);
+		}
 
 		/// <summary>
 		/// Converts a vector of type `DirectX::XMVECTOR`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2f(DirectX::XMVECTOR&& v) noexcept;
+		Vector2f(DirectX::XMVECTOR&& v) noexcept : Vector2f(v) { }
 
 		/// <summary>
 		/// Converts a vector of type `DirectX::XMFLOAT2`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2f(const DirectX::XMFLOAT2& v) noexcept;
+		constexpr Vector2f(const DirectX::XMFLOAT2& v) noexcept : Vector(v.x, v.y) { }
 
 		/// <summary>
 		/// Converts a vector of type `DirectX::XMFLOAT2`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2f(DirectX::XMFLOAT2&& v) noexcept;
+		constexpr Vector2f(DirectX::XMFLOAT2&& v) noexcept : Vector(v.x, v.y) { }
 
 		/// <summary>
 		/// Converts the vector into the type `DirectX::XMVECTOR`.
 		/// </summary>
-		operator DirectX::XMVECTOR() const noexcept;
+		operator DirectX::XMVECTOR() const noexcept {
+			return DirectX::XMLoadFloat2(reinterpret_cast<const DirectX::XMFLOAT2*>(m_elements.data()));
+		}
 
 		/// <summary>
 		/// Converts the vector into the type `DirectX::XMFLOAT2`.
 		/// </summary>
-		operator DirectX::XMFLOAT2() const noexcept;
+		constexpr operator DirectX::XMFLOAT2() const noexcept {
+			return DirectX::XMFLOAT2(m_elements[0], m_elements[1]);
+		}
 #endif
 	};
 
@@ -339,24 +380,32 @@ namespace LiteFX::Math {
 	public:
 		using Vector::Vector;
 
+		/// <summary>
+		/// Initializes the vector from a generic vector, for example the result of an arithmetic operation.
+		/// </summary>
+		/// <param name="v">The vector to copy the elements from.</param>
+		constexpr Vector2u(const Vector<UInt32, 2>& v) noexcept : Vector(v) { }
+
 #if defined(LITEFX_BUILD_WITH_GLM)
 	public:
 		/// <summary>
 		/// Converts a vector of type `glm::u32vec2`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2u(const glm::u32vec2& v) noexcept;
+		constexpr Vector2u(const glm::u32vec2& v) noexcept : Vector(v.x, v.y) { }
 
 		/// <summary>
 		/// Converts a vector of type `glm::u32vec2`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2u(glm::u32vec2&& v) noexcept;
+		constexpr Vector2u(glm::u32vec2&& v) noexcept : Vector(v.x, v.y) { }
 
 		/// <summary>
 		/// Converts the vector into the type `glm::u32vec2`.
 		/// </summary>
-		operator glm::u32vec2() const noexcept;
+		constexpr operator glm::u32vec2() const noexcept {
+			return glm::u32vec2(m_elements[0], m_elements[1]);
+		}
 #endif
 
 #if defined(LITEFX_BUILD_WITH_DIRECTX_MATH)
@@ -365,35 +414,41 @@ namespace LiteFX::Math {
 		/// Converts a vector of type `DirectX::XMVECTOR`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2u(const DirectX::XMVECTOR& v) noexcept;
+		Vector2u(const DirectX::XMVECTOR& v) noexcept {
+			DirectX::XMStoreUInt2(reinterpret_cast<DirectX::XMUINT2*>(m_elements.data()), v);
+		}
 
 		/// <summary>
 		/// Converts a vector of type `DirectX::XMVECTOR`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2u(DirectX::XMVECTOR&& v) noexcept;
+		Vector2u(DirectX::XMVECTOR&& v) noexcept : Vector2u(v) { }
 
 		/// <summary>
 		/// Converts a vector of type `DirectX::XMUINT2`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2u(const DirectX::XMUINT2& v) noexcept;
+		constexpr Vector2u(const DirectX::XMUINT2& v) noexcept : Vector(v.x, v.y) { }
 
 		/// <summary>
 		/// Converts a vector of type `DirectX::XMUINT2`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2u(DirectX::XMUINT2&& v) noexcept;
+		constexpr Vector2u(DirectX::XMUINT2&& v) noexcept : Vector(v.x, v.y) { }
 
 		/// <summary>
 		/// Converts the vector into the type `DirectX::XMVECTOR`.
 		/// </summary>
-		operator DirectX::XMVECTOR() const noexcept;
+		operator DirectX::XMVECTOR() const noexcept {
+			return DirectX::XMLoadUInt2(reinterpret_cast<const DirectX::XMUINT2*>(m_elements.data()));
+		}
 
 		/// <summary>
 		/// Converts the vector into the type `DirectX::XMUINT2`.
 		/// </summary>
-		operator DirectX::XMUINT2() const noexcept;
+		constexpr operator DirectX::XMUINT2() const noexcept {
+			return DirectX::XMUINT2(m_elements[0], m_elements[1]);
+		}
 #endif
 	};
 
@@ -404,24 +459,32 @@ namespace LiteFX::Math {
 	public:
 		using Vector::Vector;
 
+		/// <summary>
+		/// Initializes the vector from a generic vector, for example the result of an arithmetic operation.
+		/// </summary>
+		/// <param name="v">The vector to copy the elements from.</param>
+		constexpr Vector2i(const Vector<Int32, 2>& v) noexcept : Vector(v) { }
+
 #if defined(LITEFX_BUILD_WITH_GLM)
 	public:
 		/// <summary>
 		/// Converts a vector of type `glm::i32vec2`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2i(const glm::i32vec2& v) noexcept;
+		constexpr Vector2i(const glm::i32vec2& v) noexcept : Vector(v.x, v.y) { }
 
 		/// <summary>
 		/// Converts a vector of type `glm::i32vec2`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2i(glm::i32vec2&& v) noexcept;
+		constexpr Vector2i(glm::i32vec2&& v) noexcept : Vector(v.x, v.y) { }
 
 		/// <summary>
 		/// Converts the vector into the type `glm::i32vec2`.
 		/// </summary>
-		operator glm::i32vec2() const noexcept;
+		constexpr operator glm::i32vec2() const noexcept {
+			return glm::i32vec2(m_elements[0], m_elements[1]);
+		}
 #endif
 
 #if defined(LITEFX_BUILD_WITH_DIRECTX_MATH)
@@ -430,35 +493,41 @@ namespace LiteFX::Math {
 		/// Converts a vector of type `DirectX::XMVECTOR`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2i(const DirectX::XMVECTOR& v) noexcept;
+		Vector2i(const DirectX::XMVECTOR& v) noexcept {
+			DirectX::XMStoreSInt2(reinterpret_cast<DirectX::XMINT2*>(m_elements.data()), v);
+		}
 
 		/// <summary>
 		/// Converts a vector of type `DirectX::XMVECTOR`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2i(DirectX::XMVECTOR&& v) noexcept;
+		Vector2i(DirectX::XMVECTOR&& v) noexcept : Vector2i(v) { }
 
 		/// <summary>
 		/// Converts a vector of type `DirectX::XMINT2`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2i(const DirectX::XMINT2& v) noexcept;
+		constexpr Vector2i(const DirectX::XMINT2& v) noexcept : Vector(v.x, v.y) { }
 
 		/// <summary>
 		/// Converts a vector of type `DirectX::XMINT2`.
 		/// </summary>
 		/// <param name="v">The vector to convert.</param>
-		Vector2i(DirectX::XMINT2&& v) noexcept;
+		constexpr Vector2i(DirectX::XMINT2&& v) noexcept : Vector(v.x, v.y) { }
 
 		/// <summary>
 		/// Converts the vector into the type `DirectX::XMVECTOR`.
 		/// </summary>
-		operator DirectX::XMVECTOR() const noexcept;
+		operator DirectX::XMVECTOR() const noexcept {
+			return DirectX::XMLoadSInt2(reinterpret_cast<const DirectX::XMINT2*>(m_elements.data()));
+		}
 
 		/// <summary>
 		/// Converts the vector into the type `DirectX::XMINT2`.
 		/// </summary>
-		operator DirectX::XMINT2() const noexcept;
+		constexpr operator DirectX::XMINT2() const noexcept {
+			return DirectX::XMINT2(m_elements[0], m_elements[1]);
+		}
 #endif
 	};
 
@@ -469,21 +538,42 @@ namespace LiteFX::Math {
 	public:
 		using Vector::Vector;
 
+		/// <summary>
+		/// Initializes the vector from a generic vector, for example the result of an arithmetic operation.
+		/// </summary>
+		/// <param name="v">The vector to copy the elements from.</param>
+		constexpr Vector3f(const Vector<Float, 3>& v) noexcept : Vector(v) { }
+
 #if defined(LITEFX_BUILD_WITH_GLM)
 	public:
-		Vector3f(const glm::f32vec3& v) noexcept;
-		Vector3f(glm::f32vec3&& v) noexcept;
-		operator glm::f32vec3() const noexcept;
+		constexpr Vector3f(const glm::f32vec3& v) noexcept : Vector(v.x, v.y, v.z) { }
+
+		constexpr Vector3f(glm::f32vec3&& v) noexcept : Vector(v.x, v.y, v.z) { }
+
+		constexpr operator glm::f32vec3() const noexcept {
+			return glm::f32vec3(m_elements[0], m_elements[1], m_elements[2]);
+		}
 #endif
 
 #if defined(LITEFX_BUILD_WITH_DIRECTX_MATH)
 	public:
-		Vector3f(const DirectX::XMVECTOR& v) noexcept;
-		Vector3f(DirectX::XMVECTOR&& v) noexcept;
-		Vector3f(const DirectX::XMFLOAT3& v) noexcept;
-		Vector3f(DirectX::XMFLOAT3&& v) noexcept;
-		operator DirectX::XMVECTOR() const noexcept;
-		operator DirectX::XMFLOAT3() const noexcept;
+		Vector3f(const DirectX::XMVECTOR& v) noexcept {
+			DirectX::XMStoreFloat3(reinterpret_cast<DirectX::XMFLOAT3*>(m_elements.data()), v);
+		}
+
+		Vector3f(DirectX::XMVECTOR&& v) noexcept : Vector3f(v) { }
+
+		constexpr Vector3f(const DirectX::XMFLOAT3& v) noexcept : Vector(v.x, v.y, v.z) { }
+
+		constexpr Vector3f(DirectX::XMFLOAT3&& v) noexcept : Vector(v.x, v.y, v.z) { }
+
+		operator DirectX::XMVECTOR() const noexcept {
+			return DirectX::XMLoadFloat3(reinterpret_cast<const DirectX::XMFLOAT3*>(m_elements.data()));
+		}
+
+		constexpr operator DirectX::XMFLOAT3() const noexcept {
+			return DirectX::XMFLOAT3(m_elements[0], m_elements[1], m_elements[2]);
+		}
 #endif
 	};
 
@@ -491,21 +581,42 @@ namespace LiteFX::Math {
 	public:
 		using Vector::Vector;
 
+		/// <summary>
+		/// Initializes the vector from a generic vector, for example the result of an arithmetic operation.
+		/// </summary>
+		/// <param name="v">The vector to copy the elements from.</param>
+		constexpr Vector3u(const Vector<UInt32, 3>& v) noexcept : Vector(v) { }
+
 #if defined(LITEFX_BUILD_WITH_GLM)
 	public:
-		Vector3u(const glm::u32vec3& v) noexcept;
-		Vector3u(glm::u32vec3&& v) noexcept;
-		operator glm::u32vec3() const noexcept;
+		constexpr Vector3u(const glm::u32vec3& v) noexcept : Vector(v.x, v.y, v.z) { }
+
+		constexpr Vector3u(glm::u32vec3&& v) noexcept : Vector(v.x, v.y, v.z) { }
+
+		constexpr operator glm::u32vec3() const noexcept {
+			return glm::u32vec3(m_elements[0], m_elements[1], m_elements[2]);
+		}
 #endif
 
 #if defined(LITEFX_BUILD_WITH_DIRECTX_MATH)
 	public:
-		Vector3u(const DirectX::XMVECTOR& v) noexcept;
-		Vector3u(DirectX::XMVECTOR&& v) noexcept;
-		Vector3u(const DirectX::XMUINT3& v) noexcept;
-		Vector3u(DirectX::XMUINT3&& v) noexcept;
-		operator DirectX::XMVECTOR() const noexcept;
-		operator DirectX::XMUINT3() const noexcept;
+		Vector3u(const DirectX::XMVECTOR& v) noexcept {
+			DirectX::XMStoreUInt3(reinterpret_cast<DirectX::XMUINT3*>(m_elements.data()), v);
+		}
+
+		Vector3u(DirectX::XMVECTOR&& v) noexcept : Vector3u(v) { }
+
+		constexpr Vector3u(const DirectX::XMUINT3& v) noexcept : Vector(v.x, v.y, v.z) { }
+
+		constexpr Vector3u(DirectX::XMUINT3&& v) noexcept : Vector(v.x, v.y, v.z) { }
+
+		operator DirectX::XMVECTOR() const noexcept {
+			return DirectX::XMLoadUInt3(reinterpret_cast<const DirectX::XMUINT3*>(m_elements.data()));
+		}
+
+		constexpr operator DirectX::XMUINT3() const noexcept {
+			return DirectX::XMUINT3(m_elements[0], m_elements[1], m_elements[2]);
+		}
 #endif
 	};
 
@@ -513,21 +624,42 @@ namespace LiteFX::Math {
 	public:
 		using Vector::Vector;
 
+		/// <summary>
+		/// Initializes the vector from a generic vector, for example the result of an arithmetic operation.
+		/// </summary>
+		/// <param name="v">The vector to copy the elements from.</param>
+		constexpr Vector3i(const Vector<Int32, 3>& v) noexcept : Vector(v) { }
+
 #if defined(LITEFX_BUILD_WITH_GLM)
 	public:
-		Vector3i(const glm::i32vec3& v) noexcept;
-		Vector3i(glm::i32vec3&& v) noexcept;
-		operator glm::i32vec3() const noexcept;
+		constexpr Vector3i(const glm::i32vec3& v) noexcept : Vector(v.x, v.y, v.z) { }
+
+		constexpr Vector3i(glm::i32vec3&& v) noexcept : Vector(v.x, v.y, v.z) { }
+
+		constexpr operator glm::i32vec3() const noexcept {
+			return glm::i32vec3(m_elements[0], m_elements[1], m_elements[2]);
+		}
 #endif
 
 #if defined(LITEFX_BUILD_WITH_DIRECTX_MATH)
 	public:
-		Vector3i(const DirectX::XMVECTOR& v) noexcept;
-		Vector3i(DirectX::XMVECTOR&& v) noexcept;
-		Vector3i(const DirectX::XMINT3& v) noexcept;
-		Vector3i(DirectX::XMINT3&& v) noexcept;
-		operator DirectX::XMVECTOR() const noexcept;
-		operator DirectX::XMINT3() const noexcept;
+		Vector3i(const DirectX::XMVECTOR& v) noexcept {
+			DirectX::XMStoreSInt3(reinterpret_cast<DirectX::XMINT3*>(m_elements.data()), v);
+		}
+
+		Vector3i(DirectX::XMVECTOR&& v) noexcept : Vector3i(v) { }
+
+		constexpr Vector3i(const DirectX::XMINT3& v) noexcept : Vector(v.x, v.y, v.z) { }
+
+		constexpr Vector3i(DirectX::XMINT3&& v) noexcept : Vector(v.x, v.y, v.z) { }
+
+		operator DirectX::XMVECTOR() const noexcept {
+			return DirectX::XMLoadSInt3(reinterpret_cast<const DirectX::XMINT3*>(m_elements.data()));
+		}
+
+		constexpr operator DirectX::XMINT3() const noexcept {
+			return DirectX::XMINT3(m_elements[0], m_elements[1], m_elements[2]);
+		}
 #endif
 	};
 
@@ -535,21 +667,42 @@ namespace LiteFX::Math {
 	public:
 		using Vector::Vector;
 
+		/// <summary>
+		/// Initializes the vector from a generic vector, for example the result of an arithmetic operation.
+		/// </summary>
+		/// <param name="v">The vector to copy the elements from.</param>
+		constexpr Vector4f(const Vector<Float, 4>& v) noexcept : Vector(v) { }
+
 #if defined(LITEFX_BUILD_WITH_GLM)
 	public:
-		Vector4f(const glm::f32vec4& v) noexcept;
-		Vector4f(glm::f32vec4&& v) noexcept;
-		operator glm::f32vec4() const noexcept;
+		constexpr Vector4f(const glm::f32vec4& v) noexcept : Vector(v.x, v.y, v.z, v.w) { }
+
+		constexpr Vector4f(glm::f32vec4&& v) noexcept : Vector(v.x, v.y, v.z, v.w) { }
+
+		constexpr operator glm::f32vec4() const noexcept {
+			return glm::f32vec4(m_elements[0], m_elements[1], m_elements[2], m_elements[3]);
+		}
 #endif
 
 #if defined(LITEFX_BUILD_WITH_DIRECTX_MATH)
 	public:
-		Vector4f(const DirectX::XMVECTOR& v) noexcept;
-		Vector4f(DirectX::XMVECTOR&& v) noexcept;
-		Vector4f(const DirectX::XMFLOAT4& v) noexcept;
-		Vector4f(DirectX::XMFLOAT4&& v) noexcept;
-		operator DirectX::XMVECTOR() const noexcept;
-		operator DirectX::XMFLOAT4() const noexcept;
+		Vector4f(const DirectX::XMVECTOR& v) noexcept {
+			DirectX::XMStoreFloat4(reinterpret_cast<DirectX::XMFLOAT4*>(m_elements.data()), v);
+		}
+
+		Vector4f(DirectX::XMVECTOR&& v) noexcept : Vector4f(v) { }
+
+		constexpr Vector4f(const DirectX::XMFLOAT4& v) noexcept : Vector(v.x, v.y, v.z, v.w) { }
+
+		constexpr Vector4f(DirectX::XMFLOAT4&& v) noexcept : Vector(v.x, v.y, v.z, v.w) { }
+
+		operator DirectX::XMVECTOR() const noexcept {
+			return DirectX::XMLoadFloat4(reinterpret_cast<const DirectX::XMFLOAT4*>(m_elements.data()));
+		}
+
+		constexpr operator DirectX::XMFLOAT4() const noexcept {
+			return DirectX::XMFLOAT4(m_elements[0], m_elements[1], m_elements[2], m_elements[3]);
+		}
 #endif
 	};
 
@@ -557,21 +710,42 @@ namespace LiteFX::Math {
 	public:
 		using Vector::Vector;
 
+		/// <summary>
+		/// Initializes the vector from a generic vector, for example the result of an arithmetic operation.
+		/// </summary>
+		/// <param name="v">The vector to copy the elements from.</param>
+		constexpr Vector4u(const Vector<UInt32, 4>& v) noexcept : Vector(v) { }
+
 #if defined(LITEFX_BUILD_WITH_GLM)
 	public:
-		Vector4u(const glm::u32vec4& v) noexcept;
-		Vector4u(glm::u32vec4&& v) noexcept;
-		operator glm::u32vec4() const noexcept;
+		constexpr Vector4u(const glm::u32vec4& v) noexcept : Vector(v.x, v.y, v.z, v.w) { }
+
+		constexpr Vector4u(glm::u32vec4&& v) noexcept : Vector(v.x, v.y, v.z, v.w) { }
+
+		constexpr operator glm::u32vec4() const noexcept {
+			return glm::u32vec4(m_elements[0], m_elements[1], m_elements[2], m_elements[3]);
+		}
 #endif
 
 #if defined(LITEFX_BUILD_WITH_DIRECTX_MATH)
 	public:
-		Vector4u(const DirectX::XMVECTOR& v) noexcept;
-		Vector4u(DirectX::XMVECTOR&& v) noexcept;
-		Vector4u(const DirectX::XMUINT4& v) noexcept;
-		Vector4u(DirectX::XMUINT4&& v) noexcept;
-		operator DirectX::XMVECTOR() const noexcept;
-		operator DirectX::XMUINT4() const noexcept;
+		Vector4u(const DirectX::XMVECTOR& v) noexcept {
+			DirectX::XMStoreUInt4(reinterpret_cast<DirectX::XMUINT4*>(m_elements.data()), v);
+		}
+
+		Vector4u(DirectX::XMVECTOR&& v) noexcept : Vector4u(v) { }
+
+		constexpr Vector4u(const DirectX::XMUINT4& v) noexcept : Vector(v.x, v.y, v.z, v.w) { }
+
+		constexpr Vector4u(DirectX::XMUINT4&& v) noexcept : Vector(v.x, v.y, v.z, v.w) { }
+
+		operator DirectX::XMVECTOR() const noexcept {
+			return DirectX::XMLoadUInt4(reinterpret_cast<const DirectX::XMUINT4*>(m_elements.data()));
+		}
+
+		constexpr operator DirectX::XMUINT4() const noexcept {
+			return DirectX::XMUINT4(m_elements[0], m_elements[1], m_elements[2], m_elements[3]);
+		}
 #endif
 	};
 
@@ -579,21 +753,42 @@ namespace LiteFX::Math {
 	public:
 		using Vector::Vector;
 
+		/// <summary>
+		/// Initializes the vector from a generic vector, for example the result of an arithmetic operation.
+		/// </summary>
+		/// <param name="v">The vector to copy the elements from.</param>
+		constexpr Vector4i(const Vector<Int32, 4>& v) noexcept : Vector(v) { }
+
 #if defined(LITEFX_BUILD_WITH_GLM)
 	public:
-		Vector4i(const glm::i32vec4& v) noexcept;
-		Vector4i(glm::i32vec4&& v) noexcept;
-		operator glm::i32vec4() const noexcept;
+		constexpr Vector4i(const glm::i32vec4& v) noexcept : Vector(v.x, v.y, v.z, v.w) { }
+
+		constexpr Vector4i(glm::i32vec4&& v) noexcept : Vector(v.x, v.y, v.z, v.w) { }
+
+		constexpr operator glm::i32vec4() const noexcept {
+			return glm::i32vec4(m_elements[0], m_elements[1], m_elements[2], m_elements[3]);
+		}
 #endif
 
 #if defined(LITEFX_BUILD_WITH_DIRECTX_MATH)
 	public:
-		Vector4i(const DirectX::XMVECTOR& v) noexcept;
-		Vector4i(DirectX::XMVECTOR&& v) noexcept;
-		Vector4i(const DirectX::XMINT4& v) noexcept;
-		Vector4i(DirectX::XMINT4&& v) noexcept;
-		operator DirectX::XMVECTOR() const noexcept;
-		operator DirectX::XMINT4() const noexcept;
+		Vector4i(const DirectX::XMVECTOR& v) noexcept {
+			DirectX::XMStoreSInt4(reinterpret_cast<DirectX::XMINT4*>(m_elements.data()), v);
+		}
+
+		Vector4i(DirectX::XMVECTOR&& v) noexcept : Vector4i(v) { }
+
+		constexpr Vector4i(const DirectX::XMINT4& v) noexcept : Vector(v.x, v.y, v.z, v.w) { }
+
+		constexpr Vector4i(DirectX::XMINT4&& v) noexcept : Vector(v.x, v.y, v.z, v.w) { }
+
+		operator DirectX::XMVECTOR() const noexcept {
+			return DirectX::XMLoadSInt4(reinterpret_cast<const DirectX::XMINT4*>(m_elements.data()));
+		}
+
+		constexpr operator DirectX::XMINT4() const noexcept {
+			return DirectX::XMINT4(m_elements[0], m_elements[1], m_elements[2], m_elements[3]);
+		}
 #endif
 	};
 
@@ -945,4 +1140,624 @@ namespace LiteFX::Math {
 		Float& height() noexcept;
 	};
 #pragma endregion
+
+#pragma region Packing
+	/// <summary>
+	/// Converts floating point values into compact representations and back.
+	/// </summary>
+	/// <remarks>
+	/// The bulk conversions are implemented using F16C for half precision values and SSE4.1 for normalized integers, if available. Otherwise they fall back
+	/// to scalar code. Normalized integers are rounded to the nearest representable value and values outside of the representable range are clamped.
+	/// 
+	/// All bulk conversions convert <c>source.size()</c> values and throw an <see cref="ArgumentOutOfRangeException" />, if the destination is too small to 
+	/// hold them.
+	/// </remarks>
+	class LITEFX_MATH_API Packing {
+	public:
+		Packing() = delete;
+
+	public:
+		/// <summary>
+		/// Converts a single precision floating point value into a half precision floating point value.
+		/// </summary>
+		/// <param name="value">The value to convert.</param>
+		/// <returns>The bit pattern of the half precision value.</returns>
+		static UInt16 toHalf(Float value) noexcept;
+
+		/// <summary>
+		/// Converts a half precision floating point value into a single precision floating point value.
+		/// </summary>
+		/// <param name="value">The bit pattern of the half precision value.</param>
+		/// <returns>The single precision value.</returns>
+		static Float fromHalf(UInt16 value) noexcept;
+
+		/// <summary>
+		/// Converts single precision floating point values into half precision floating point values.
+		/// </summary>
+		/// <param name="source">The values to convert.</param>
+		/// <param name="destination">The destination for the bit patterns of the half precision values.</param>
+		static void toHalf(std::span<const Float> source, std::span<UInt16> destination);
+
+		/// <summary>
+		/// Converts half precision floating point values into single precision floating point values.
+		/// </summary>
+		/// <param name="source">The bit patterns of the half precision values to convert.</param>
+		/// <param name="destination">The destination for the single precision values.</param>
+		static void fromHalf(std::span<const UInt16> source, std::span<Float> destination);
+
+		/// <summary>
+		/// Converts values in the range <c>[0, 1]</c> into unsigned normalized 8 bit integers.
+		/// </summary>
+		/// <param name="source">The values to convert.</param>
+		/// <param name="destination">The destination for the normalized integers.</param>
+		static void toUnorm8(std::span<const Float> source, std::span<Byte> destination);
+
+		/// <summary>
+		/// Converts unsigned normalized 8 bit integers into values in the range <c>[0, 1]</c>.
+		/// </summary>
+		/// <param name="source">The normalized integers to convert.</param>
+		/// <param name="destination">The destination for the floating point values.</param>
+		static void fromUnorm8(std::span<const Byte> source, std::span<Float> destination);
+
+		/// <summary>
+		/// Converts values in the range <c>[0, 1]</c> into unsigned normalized 16 bit integers.
+		/// </summary>
+		/// <param name="source">The values to convert.</param>
+		/// <param name="destination">The destination for the normalized integers.</param>
+		static void toUnorm16(std::span<const Float> source, std::span<UInt16> destination);
+
+		/// <summary>
+		/// Converts unsigned normalized 16 bit integers into values in the range <c>[0, 1]</c>.
+		/// </summary>
+		/// <param name="source">The normalized integers to convert.</param>
+		/// <param name="destination">The destination for the floating point values.</param>
+		static void fromUnorm16(std::span<const UInt16> source, std::span<Float> destination);
+
+		/// <summary>
+		/// Converts values in the range <c>[-1, 1]</c> into signed normalized 16 bit integers.
+		/// </summary>
+		/// <param name="source">The values to convert.</param>
+		/// <param name="destination">The destination for the normalized integers.</param>
+		static void toSnorm16(std::span<const Float> source, std::span<Int16> destination);
+
+		/// <summary>
+		/// Converts signed normalized 16 bit integers into values in the range <c>[-1, 1]</c>.
+		/// </summary>
+		/// <param name="source">The normalized integers to convert.</param>
+		/// <param name="destination">The destination for the floating point values.</param>
+		static void fromSnorm16(std::span<const Int16> source, std::span<Float> destination);
+
+		/// <summary>
+		/// Encodes unit vectors using an octahedral mapping into two signed normalized 16 bit integers each.
+		/// </summary>
+		/// <remarks>
+		/// The octahedral mapping projects the unit sphere onto an octahedron, which is then unfolded into a square. Compared to storing three components, this
+		/// reduces the memory footprint by one third, whilst distributing the precision more evenly over the sphere. The vectors do not need to be normalized, 
+		/// but must not be zero.
+		/// </remarks>
+		/// <param name="normals">The vectors to encode.</param>
+		/// <param name="destination">The destination for the encoded vectors. Must be able to hold two values for each vector.</param>
+		static void encodeOctahedral(std::span<const Vector3f> normals, std::span<Int16> destination);
+
+		/// <summary>
+		/// Decodes unit vectors that have been encoded using <see cref="encodeOctahedral" />.
+		/// </summary>
+		/// <param name="source">The encoded vectors, with two values per vector.</param>
+		/// <param name="normals">The destination for the decoded unit vectors. Must be able to hold half as many vectors as there are values in <paramref name="source" />.</param>
+		static void decodeOctahedral(std::span<const Int16> source, std::span<Vector3f> normals);
+	};
+#pragma endregion
+
+#pragma region Bounding Volumes
+	/// <summary>
+	/// An axis-aligned bounding box.
+	/// </summary>
+	/// <seealso cref="BoundingSphere" />
+	/// <seealso cref="Frustum" />
+	class LITEFX_MATH_API BoundingBox {
+	private:
+		Vector3f m_minimum, m_maximum;
+
+	public:
+		/// <summary>
+		/// Initializes an empty bounding box at the origin.
+		/// </summary>
+		BoundingBox() noexcept = default;
+
+		/// <summary>
+		/// Initializes a bounding box from its corners.
+		/// </summary>
+		/// <param name="minimum">The corner with the smallest coordinates.</param>
+		/// <param name="maximum">The corner with the largest coordinates.</param>
+		BoundingBox(const Vector3f& minimum, const Vector3f& maximum) noexcept;
+
+		BoundingBox(const BoundingBox&) noexcept = default;
+		BoundingBox(BoundingBox&&) noexcept = default;
+		BoundingBox& operator=(const BoundingBox&) noexcept = default;
+		BoundingBox& operator=(BoundingBox&&) noexcept = default;
+		~BoundingBox() noexcept = default;
+
+	public:
+		/// <summary>
+		/// Returns the corner with the smallest coordinates.
+		/// </summary>
+		/// <returns>The corner with the smallest coordinates.</returns>
+		const Vector3f& minimum() const noexcept;
+
+		/// <summary>
+		/// Returns the corner with the largest coordinates.
+		/// </summary>
+		/// <returns>The corner with the largest coordinates.</returns>
+		const Vector3f& maximum() const noexcept;
+
+		/// <summary>
+		/// Returns the center of the bounding box.
+		/// </summary>
+		/// <returns>The center of the bounding box.</returns>
+		Vector3f center() const noexcept;
+
+		/// <summary>
+		/// Returns the half-size of the bounding box along each axis.
+		/// </summary>
+		/// <returns>The distance between the center and the faces of the bounding box.</returns>
+		Vector3f extent() const noexcept;
+
+		/// <summary>
+		/// Returns <c>true</c>, if the bounding box contains <paramref name="point" />.
+		/// </summary>
+		/// <param name="point">The point to test.</param>
+		/// <returns><c>true</c>, if the bounding box contains the point.</returns>
+		bool contains(const Vector3f& point) const noexcept;
+
+		/// <summary>
+		/// Extends the bounding box, so that it also contains <paramref name="point" />.
+		/// </summary>
+		/// <param name="point">The point to include.</param>
+		void extend(const Vector3f& point) noexcept;
+
+		/// <summary>
+		/// Extends the bounding box, so that it also contains <paramref name="other" />.
+		/// </summary>
+		/// <param name="other">The bounding box to include.</param>
+		void extend(const BoundingBox& other) noexcept;
+
+	public:
+		/// <summary>
+		/// Computes the smallest bounding box that contains all <paramref name="points" />.
+		/// </summary>
+		/// <param name="points">The points to compute the bounding box for.</param>
+		/// <returns>The bounding box that contains all points.</returns>
+		static BoundingBox fromPoints(std::span<const Vector3f> points) noexcept;
+	};
+
+	/// <summary>
+	/// A bounding sphere.
+	/// </summary>
+	/// <seealso cref="BoundingBox" />
+	/// <seealso cref="Frustum" />
+	class LITEFX_MATH_API BoundingSphere {
+	private:
+		Vector3f m_center;
+		Float m_radius{ 0.f };
+
+	public:
+		/// <summary>
+		/// Initializes an empty bounding sphere at the origin.
+		/// </summary>
+		BoundingSphere() noexcept = default;
+
+		/// <summary>
+		/// Initializes a bounding sphere.
+		/// </summary>
+		/// <param name="center">The center of the sphere.</param>
+		/// <param name="radius">The radius of the sphere.</param>
+		BoundingSphere(const Vector3f& center, Float radius) noexcept;
+
+		/// <summary>
+		/// Initializes a bounding sphere that encloses a bounding box.
+		/// </summary>
+		/// <param name="box">The bounding box to enclose.</param>
+		explicit BoundingSphere(const BoundingBox& box) noexcept;
+
+		BoundingSphere(const BoundingSphere&) noexcept = default;
+		BoundingSphere(BoundingSphere&&) noexcept = default;
+		BoundingSphere& operator=(const BoundingSphere&) noexcept = default;
+		BoundingSphere& operator=(BoundingSphere&&) noexcept = default;
+		~BoundingSphere() noexcept = default;
+
+	public:
+		/// <summary>
+		/// Returns the center of the sphere.
+		/// </summary>
+		/// <returns>The center of the sphere.</returns>
+		const Vector3f& center() const noexcept;
+
+		/// <summary>
+		/// Returns the radius of the sphere.
+		/// </summary>
+		/// <returns>The radius of the sphere.</returns>
+		Float radius() const noexcept;
+
+		/// <summary>
+		/// Returns <c>true</c>, if the sphere contains <paramref name="point" />.
+		/// </summary>
+		/// <param name="point">The point to test.</param>
+		/// <returns><c>true</c>, if the sphere contains the point.</returns>
+		bool contains(const Vector3f& point) const noexcept;
+	};
+
+	/// <summary>
+	/// A view frustum, described by six planes that point towards its inside.
+	/// </summary>
+	/// <remarks>
+	/// Each plane is stored as a vector <c>(a, b, c, d)</c>, where <c>(a, b, c)</c> is the normalized plane normal and <c>d</c> is the distance to the origin. A 
+	/// point <c>p</c> is in front of a plane, if <c>dot(p, (a, b, c)) + d</c> is not negative. The planes are stored in the order left, right, bottom, top, near
+	/// and far.
+	/// </remarks>
+	/// <seealso cref="FrustumCulling" />
+	class LITEFX_MATH_API Frustum {
+	public:
+		using planes_type = std::array<Vector4f, 6>;
+
+	private:
+		planes_type m_planes;
+
+	public:
+		/// <summary>
+		/// Initializes a frustum from its planes.
+		/// </summary>
+		/// <param name="planes">The planes of the frustum. Plane normals are expected to be normalized and pointing towards the inside.</param>
+		explicit Frustum(const planes_type& planes) noexcept;
+
+		Frustum(const Frustum&) noexcept = default;
+		Frustum(Frustum&&) noexcept = default;
+		Frustum& operator=(const Frustum&) noexcept = default;
+		Frustum& operator=(Frustum&&) noexcept = default;
+		~Frustum() noexcept = default;
+
+	public:
+		/// <summary>
+		/// Returns the planes of the frustum.
+		/// </summary>
+		/// <returns>The planes of the frustum.</returns>
+		const planes_type& planes() const noexcept;
+
+		/// <summary>
+		/// Returns <c>true</c>, if the bounding box is at least partially inside the frustum.
+		/// </summary>
+		/// <remarks>
+		/// The test is conservative, i.e., boxes close to the edges of the frustum may be reported as intersecting, even if they are outside.
+		/// </remarks>
+		/// <param name="box">The bounding box to test.</param>
+		/// <returns><c>true</c>, if the bounding box is at least partially inside the frustum.</returns>
+		bool intersects(const BoundingBox& box) const noexcept;
+
+		/// <summary>
+		/// Returns <c>true</c>, if the bounding sphere is at least partially inside the frustum.
+		/// </summary>
+		/// <remarks>
+		/// The test is conservative, i.e., spheres close to the edges of the frustum may be reported as intersecting, even if they are outside.
+		/// </remarks>
+		/// <param name="sphere">The bounding sphere to test.</param>
+		/// <returns><c>true</c>, if the bounding sphere is at least partially inside the frustum.</returns>
+		bool intersects(const BoundingSphere& sphere) const noexcept;
+
+	public:
+		/// <summary>
+		/// Extracts the frustum planes from a view-projection matrix.
+		/// </summary>
+		/// <remarks>
+		/// The matrix is expected to transform column vectors (i.e., <c>clip = viewProjection * position</c>) into a clip space with a depth range of 
+		/// <c>[0, 1]</c>, as used by Vulkan and DirectX 12. The planes are expressed in the space that the matrix transforms from, so passing a 
+		/// model-view-projection matrix yields planes in object space.
+		/// </remarks>
+		/// <param name="viewProjection">The view-projection matrix.</param>
+		/// <returns>The frustum of the view-projection matrix.</returns>
+		static Frustum fromMatrix(const TMatrix4<Float>& viewProjection) noexcept;
+	};
+
+	/// <summary>
+	/// Stores a set of bounding spheres in structure-of-arrays layout.
+	/// </summary>
+	/// <seealso cref="FrustumCulling" />
+	struct LITEFX_MATH_API BoundingSphereComponents {
+	public:
+		/// <summary>
+		/// The x-coordinates of the sphere centers.
+		/// </summary>
+		std::span<const Float> CenterX;
+
+		/// <summary>
+		/// The y-coordinates of the sphere centers.
+		/// </summary>
+		std::span<const Float> CenterY;
+
+		/// <summary>
+		/// The z-coordinates of the sphere centers.
+		/// </summary>
+		std::span<const Float> CenterZ;
+
+		/// <summary>
+		/// The radii of the spheres.
+		/// </summary>
+		std::span<const Float> Radius;
+
+	public:
+		/// <summary>
+		/// Returns the number of bounding spheres, i.e., the number of elements of the smallest component span.
+		/// </summary>
+		/// <returns>The number of bounding spheres.</returns>
+		size_t size() const noexcept;
+	};
+
+	/// <summary>
+	/// Stores a set of axis-aligned bounding boxes in structure-of-arrays layout.
+	/// </summary>
+	/// <remarks>
+	/// The boxes are described by their center and their half-size along each axis (see <see cref="BoundingBox::center" /> and 
+	/// <see cref="BoundingBox::extent" />), which is the representation that is cheapest to test against a plane.
+	/// </remarks>
+	/// <seealso cref="FrustumCulling" />
+	struct LITEFX_MATH_API BoundingBoxComponents {
+	public:
+		/// <summary>
+		/// The x-coordinates of the box centers.
+		/// </summary>
+		std::span<const Float> CenterX;
+
+		/// <summary>
+		/// The y-coordinates of the box centers.
+		/// </summary>
+		std::span<const Float> CenterY;
+
+		/// <summary>
+		/// The z-coordinates of the box centers.
+		/// </summary>
+		std::span<const Float> CenterZ;
+
+		/// <summary>
+		/// The half-sizes of the boxes along the x-axis.
+		/// </summary>
+		std::span<const Float> ExtentX;
+
+		/// <summary>
+		/// The half-sizes of the boxes along the y-axis.
+		/// </summary>
+		std::span<const Float> ExtentY;
+
+		/// <summary>
+		/// The half-sizes of the boxes along the z-axis.
+		/// </summary>
+		std::span<const Float> ExtentZ;
+
+	public:
+		/// <summary>
+		/// Returns the number of bounding boxes, i.e., the number of elements of the smallest component span.
+		/// </summary>
+		/// <returns>The number of bounding boxes.</returns>
+		size_t size() const noexcept;
+	};
+
+	/// <summary>
+	/// Tests batches of bounding volumes against a frustum.
+	/// </summary>
+	/// <remarks>
+	/// The bounding volumes are tested for multiple objects at once, where the number of objects depends on the available instruction set: 16 with AVX-512, 8 
+	/// with AVX2 and 4 with SSE4.1 or NEON. The result is either a compacted list of visible object indices, or a compacted copy of per-object records (for 
+	/// example indirect draw commands) that can be written directly into a mapped buffer.
+	/// 
+	/// All methods accept an <c>offset</c> and a <c>count</c>, which allows to split large batches into chunks that are processed in parallel. The indices
+	/// that are written are always relative to the start of the bounding volume components, not to <c>offset</c>.
+	/// </remarks>
+	/// <seealso cref="Frustum" />
+	class LITEFX_MATH_API FrustumCulling {
+	public:
+		FrustumCulling() = delete;
+
+	public:
+		/// <summary>
+		/// Writes the indices of all bounding spheres that intersect the frustum into <paramref name="visible" />.
+		/// </summary>
+		/// <param name="frustum">The frustum to test the spheres against.</param>
+		/// <param name="spheres">The bounding spheres to test.</param>
+		/// <param name="visible">The destination for the indices of the visible spheres. Must be able to hold <paramref name="count" /> indices.</param>
+		/// <param name="offset">The index of the first sphere to test.</param>
+		/// <param name="count">The number of spheres to test.</param>
+		/// <returns>The number of visible spheres, i.e., the number of indices that have been written.</returns>
+		/// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="spheres" /> does not contain enough elements or <paramref name="visible" /> is too small.</exception>
+		static size_t cull(const Frustum& frustum, const BoundingSphereComponents& spheres, std::span<UInt32> visible, size_t offset, size_t count);
+
+		/// <summary>
+		/// Writes the indices of all bounding spheres that intersect the frustum into <paramref name="visible" />.
+		/// </summary>
+		/// <param name="frustum">The frustum to test the spheres against.</param>
+		/// <param name="spheres">The bounding spheres to test.</param>
+		/// <param name="visible">The destination for the indices of the visible spheres. Must be able to hold an index for each sphere.</param>
+		/// <returns>The number of visible spheres, i.e., the number of indices that have been written.</returns>
+		/// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="visible" /> is too small.</exception>
+		static size_t cull(const Frustum& frustum, const BoundingSphereComponents& spheres, std::span<UInt32> visible);
+
+		/// <summary>
+		/// Writes the indices of all bounding boxes that intersect the frustum into <paramref name="visible" />.
+		/// </summary>
+		/// <param name="frustum">The frustum to test the boxes against.</param>
+		/// <param name="boxes">The bounding boxes to test.</param>
+		/// <param name="visible">The destination for the indices of the visible boxes. Must be able to hold <paramref name="count" /> indices.</param>
+		/// <param name="offset">The index of the first box to test.</param>
+		/// <param name="count">The number of boxes to test.</param>
+		/// <returns>The number of visible boxes, i.e., the number of indices that have been written.</returns>
+		/// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="boxes" /> does not contain enough elements or <paramref name="visible" /> is too small.</exception>
+		static size_t cull(const Frustum& frustum, const BoundingBoxComponents& boxes, std::span<UInt32> visible, size_t offset, size_t count);
+
+		/// <summary>
+		/// Writes the indices of all bounding boxes that intersect the frustum into <paramref name="visible" />.
+		/// </summary>
+		/// <param name="frustum">The frustum to test the boxes against.</param>
+		/// <param name="boxes">The bounding boxes to test.</param>
+		/// <param name="visible">The destination for the indices of the visible boxes. Must be able to hold an index for each box.</param>
+		/// <returns>The number of visible boxes, i.e., the number of indices that have been written.</returns>
+		/// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="visible" /> is too small.</exception>
+		static size_t cull(const Frustum& frustum, const BoundingBoxComponents& boxes, std::span<UInt32> visible);
+
+		/// <summary>
+		/// Copies the records of all objects whose bounding spheres intersect the frustum into <paramref name="destination" />.
+		/// </summary>
+		/// <remarks>
+		/// Use this overload to write a compacted list of per-object records, such as indirect draw commands, directly into a mapped buffer. The record at 
+		/// <c>source + i * stride</c> belongs to the sphere at index <c>offset + i</c>. Visible records are written to <paramref name="destination" /> without 
+		/// gaps, preserving their order.
+		/// </remarks>
+		/// <param name="frustum">The frustum to test the spheres against.</param>
+		/// <param name="spheres">The bounding spheres to test.</param>
+		/// <param name="source">A pointer to the record of the first sphere.</param>
+		/// <param name="destination">A pointer to the destination for the visible records. Must be able to hold <paramref name="count" /> records.</param>
+		/// <param name="stride">The size of a single record in bytes.</param>
+		/// <param name="count">The number of spheres to test.</param>
+		/// <param name="offset">The index of the first sphere to test.</param>
+		/// <returns>The number of records that have been written.</returns>
+		/// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="spheres" /> does not contain enough elements.</exception>
+		static size_t compact(const Frustum& frustum, const BoundingSphereComponents& spheres, const Byte* source, Byte* destination, size_t stride, size_t count, size_t offset = 0);
+
+		/// <summary>
+		/// Copies the records of all objects whose bounding boxes intersect the frustum into <paramref name="destination" />.
+		/// </summary>
+		/// <remarks>
+		/// Use this overload to write a compacted list of per-object records, such as indirect draw commands, directly into a mapped buffer. The record at 
+		/// <c>source + i * stride</c> belongs to the box at index <c>offset + i</c>. Visible records are written to <paramref name="destination" /> without 
+		/// gaps, preserving their order.
+		/// </remarks>
+		/// <param name="frustum">The frustum to test the boxes against.</param>
+		/// <param name="boxes">The bounding boxes to test.</param>
+		/// <param name="source">A pointer to the record of the first box.</param>
+		/// <param name="destination">A pointer to the destination for the visible records. Must be able to hold <paramref name="count" /> records.</param>
+		/// <param name="stride">The size of a single record in bytes.</param>
+		/// <param name="count">The number of boxes to test.</param>
+		/// <param name="offset">The index of the first box to test.</param>
+		/// <returns>The number of records that have been written.</returns>
+		/// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="boxes" /> does not contain enough elements.</exception>
+		static size_t compact(const Frustum& frustum, const BoundingBoxComponents& boxes, const Byte* source, Byte* destination, size_t stride, size_t count, size_t offset = 0);
+	};
+#pragma endregion
+
+#pragma region Transforms
+	/// <summary>
+	/// Stores the components of a set of transforms in structure-of-arrays layout.
+	/// </summary>
+	/// <remarks>
+	/// Each transform is composed from a translation, a rotation and a scaling factor. The rotation is stored as a quaternion, which is expected to be 
+	/// normalized. Each component is stored in a separate span, so that the components of subsequent transforms can be loaded into a single register.
+	/// </remarks>
+	/// <seealso cref="TransformBatch" />
+	struct LITEFX_MATH_API TransformComponents {
+	public:
+		/// <summary>
+		/// The x-components of the translations.
+		/// </summary>
+		std::span<const Float> TranslationX;
+
+		/// <summary>
+		/// The y-components of the translations.
+		/// </summary>
+		std::span<const Float> TranslationY;
+
+		/// <summary>
+		/// The z-components of the translations.
+		/// </summary>
+		std::span<const Float> TranslationZ;
+
+		/// <summary>
+		/// The x-components of the rotation quaternions.
+		/// </summary>
+		std::span<const Float> RotationX;
+
+		/// <summary>
+		/// The y-components of the rotation quaternions.
+		/// </summary>
+		std::span<const Float> RotationY;
+
+		/// <summary>
+		/// The z-components of the rotation quaternions.
+		/// </summary>
+		std::span<const Float> RotationZ;
+
+		/// <summary>
+		/// The w-components of the rotation quaternions.
+		/// </summary>
+		std::span<const Float> RotationW;
+
+		/// <summary>
+		/// The scaling factors along the x-axis.
+		/// </summary>
+		std::span<const Float> ScaleX;
+
+		/// <summary>
+		/// The scaling factors along the y-axis.
+		/// </summary>
+		std::span<const Float> ScaleY;
+
+		/// <summary>
+		/// The scaling factors along the z-axis.
+		/// </summary>
+		std::span<const Float> ScaleZ;
+
+	public:
+		/// <summary>
+		/// Returns the number of transforms, i.e., the number of elements of the smallest component span.
+		/// </summary>
+		/// <returns>The number of transforms.</returns>
+		size_t size() const noexcept;
+	};
+
+	/// <summary>
+	/// Composes batches of transform matrices from their components.
+	/// </summary>
+	/// <remarks>
+	/// Each transform matrix is computed as <c>T * R * S</c>, i.e., the scaling is applied first, followed by the rotation and the translation. The matrices are
+	/// computed for multiple transforms at once, where the number of transforms depends on the available instruction set: 16 with AVX-512, 8 with AVX2 and 4
+	/// with SSE4.1 or NEON. The results are written directly into the destination, which can be a mapped buffer.
+	/// 
+	/// All methods accept an <c>offset</c> into the components, which allows to split large batches into chunks that are processed in parallel. Each chunk 
+	/// should contain a multiple of 16 transforms, except for the last one.
+	/// </remarks>
+	/// <seealso cref="TransformComponents" />
+	class LITEFX_MATH_API TransformBatch {
+	public:
+		TransformBatch() = delete;
+
+	public:
+		/// <summary>
+		/// Composes affine transform matrices and writes them into <paramref name="transforms" />.
+		/// </summary>
+		/// <param name="components">The components of the transforms.</param>
+		/// <param name="transforms">The destination for the transform matrices. One matrix is computed for each element.</param>
+		/// <param name="offset">The index of the first transform in <paramref name="components" />.</param>
+		/// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="components" /> does not contain enough transforms.</exception>
+		static void compose(const TransformComponents& components, std::span<TMatrix3x4<Float>> transforms, size_t offset = 0);
+
+		/// <summary>
+		/// Composes transform matrices and writes them into <paramref name="transforms" />.
+		/// </summary>
+		/// <param name="components">The components of the transforms.</param>
+		/// <param name="transforms">The destination for the transform matrices. One matrix is computed for each element.</param>
+		/// <param name="offset">The index of the first transform in <paramref name="components" />.</param>
+		/// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="components" /> does not contain enough transforms.</exception>
+		static void compose(const TransformComponents& components, std::span<TMatrix4<Float>> transforms, size_t offset = 0);
+
+		/// <summary>
+		/// Composes affine transform matrices and writes them into a strided destination.
+		/// </summary>
+		/// <remarks>
+		/// Use this overload to write the transforms into structures that contain other members besides the transform, for example instance buffers of top-level
+		/// acceleration structures. Each transform is stored as 12 consecutive floats in row-major order, starting at <c>destination + i * stride</c>.
+		/// </remarks>
+		/// <param name="components">The components of the transforms.</param>
+		/// <param name="destination">A pointer to the first transform in the destination.</param>
+		/// <param name="stride">The distance between two transforms in the destination in bytes. Must be a multiple of 4 and at least 48.</param>
+		/// <param name="count">The number of transforms to compose.</param>
+		/// <param name="offset">The index of the first transform in <paramref name="components" />.</param>
+		/// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="components" /> does not contain enough transforms or the stride is invalid.</exception>
+		static void compose(const TransformComponents& components, Byte* destination, size_t stride, size_t count, size_t offset = 0);
+	};
+#pragma endregion
+
 }
\ No newline at end of file
@@ -8,6 +8,9 @@
 #include <vector>
 #include <ranges>
 #include <initializer_list>
+#include <type_traits>
+#include <litefx/vector.hpp>
+#include <litefx/simd.hpp>
 
 #ifdef __cpp_lib_mdspan
 #include <mdspan>
@@ -375,6 +378,13 @@ namespace LiteFX::Math {
 		constexpr generic_mat_type<mat_cols, mat_rows> transpose() const noexcept {
 			std::array<scalar_type, mat_cols * mat_rows> data { };
 
+			if !consteval {
+				if constexpr (SIMD::enabled && std::same_as<scalar_type, float> && mat_rows == 4 && mat_cols == 4) {
+					SIMD::transpose4x4(m_elements.data(), data.data());
+					return generic_mat_type<mat_cols, mat_rows>(std::move(data));
+				}
+			}
+
 			for (int r{ 0 }; r < mat_rows; ++r)
 			{
 				auto row = this->row(r);
@@ -636,4 +646,285 @@ namespace LiteFX::Math {
 	/// <typeparam name="T">The type of the matrix elements.</typeparam>
 	template<typename T> using TMatrix3x4 = Matrix<T, 3, 4>;
 
+#pragma region Arithmetic
+	/// <summary>
+	/// Returns the component-wise sum of two matrices.
+	/// </summary>
+	/// <param name="lhs">The left operand.</param>
+	/// <param name="rhs">The right operand.</param>
+	/// <returns>The component-wise sum of <paramref name="lhs" /> and <paramref name="rhs" />.</returns>
+	template <typename T, unsigned ROWS, unsigned COLS>
+	constexpr Matrix<T, ROWS, COLS> operator+(const Matrix<T, ROWS, COLS>& lhs, const Matrix<T, ROWS, COLS>& rhs) noexcept {
+		Matrix<T, ROWS, COLS> result;
+		std::ranges::transform(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(), result.begin(), std::plus<>{ });
+		return result;
+	}
+
+	/// <summary>
+	/// Returns the component-wise difference of two matrices.
+	/// </summary>
+	/// <param name="lhs">The left operand.</param>
+	/// <param name="rhs">The right operand.</param>
+	/// <returns>The component-wise difference of <paramref name="lhs" /> and <paramref name="rhs" />.</returns>
+	template <typename T, unsigned ROWS, unsigned COLS>
+	constexpr Matrix<T, ROWS, COLS> operator-(const Matrix<T, ROWS, COLS>& lhs, const Matrix<T, ROWS, COLS>& rhs) noexcept {
+		Matrix<T, ROWS, COLS> result;
+		std::ranges::transform(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(), result.begin(), std::minus<>{ });
+		return result;
+	}
+
+	/// <summary>
+	/// Scales all elements of a matrix by a scalar value.
+	/// </summary>
+	/// <param name="lhs">The matrix to scale.</param>
+	/// <param name="rhs">The scaling factor.</param>
+	/// <returns>The scaled matrix.</returns>
+	template <typename T, unsigned ROWS, unsigned COLS>
+	constexpr Matrix<T, ROWS, COLS> operator*(const Matrix<T, ROWS, COLS>& lhs, std::type_identity_t<T> rhs) noexcept {
+		Matrix<T, ROWS, COLS> result;
+		std::ranges::transform(lhs.cbegin(), lhs.cend(), result.begin(), [rhs](T e) { return e * rhs; });
+		return result;
+	}
+
+	/// <summary>
+	/// Computes the product of two matrices.
+	/// </summary>
+	/// <remarks>
+	/// For single precision 4x4 matrices, the product is computed using the SIMD primitives, if they are available and the product is not evaluated at
+	/// compile time.
+	/// </remarks>
+	/// <param name="lhs">The left operand.</param>
+	/// <param name="rhs">The right operand.</param>
+	/// <returns>The product of <paramref name="lhs" /> and <paramref name="rhs" />.</returns>
+	template <typename T, unsigned ROWS, unsigned INNER, unsigned COLS>
+	constexpr Matrix<T, ROWS, COLS> operator*(const Matrix<T, ROWS, INNER>& lhs, const Matrix<T, INNER, COLS>& rhs) noexcept {
+		Matrix<T, ROWS, COLS> result;
+
+		if !consteval {
+			if constexpr (SIMD::enabled && std::same_as<T, float> && ROWS == 4 && INNER == 4 && COLS == 4) {
+				SIMD::multiply4x4(lhs.elements(), rhs.elements(), result.elements());
+				return result;
+			}
+		}
+
+		for (unsigned r{ 0 }; r < ROWS; ++r)
+			for (unsigned c{ 0 }; c < COLS; ++c)
+			{
+				T value{ 0 };
+
+				for (unsigned i{ 0 }; i < INNER; ++i)
+					value += lhs.at(r, i) * rhs.at(i, c);
+
+				result.at(r, c) = value;
+			}
+
+		return result;
+	}
+
+	/// <summary>
+	/// Concatenates two affine transforms.
+	/// </summary>
+	/// <remarks>
+	/// Both matrices are treated as 4x4 matrices with an implicit fourth row of <c>{ 0, 0, 0, 1 }</c>. Transforming a point with the result is equal to 
+	/// transforming it with <paramref name="rhs" /> first and then with <paramref name="lhs" />.
+	/// </remarks>
+	/// <param name="lhs">The left operand.</param>
+	/// <param name="rhs">The right operand.</param>
+	/// <returns>The concatenated transform.</returns>
+	template <typename T>
+	constexpr TMatrix3x4<T> operator*(const TMatrix3x4<T>& lhs, const TMatrix3x4<T>& rhs) noexcept {
+		TMatrix3x4<T> result;
+
+		if !consteval {
+			if constexpr (SIMD::enabled && std::same_as<T, float>) {
+				SIMD::multiply3x4(lhs.elements(), rhs.elements(), result.elements());
+				return result;
+			}
+		}
+
+		for (unsigned r{ 0 }; r < 3; ++r)
+			for (unsigned c{ 0 }; c < 4; ++c)
+				result.at(r, c) = lhs.at(r, 0) * rhs.at(0, c) + lhs.at(r, 1) * rhs.at(1, c) + lhs.at(r, 2) * rhs.at(2, c) + (c == 3 ? lhs.at(r, 3) : T{ 0 });
+
+		return result;
+	}
+
+	/// <summary>
+	/// Transforms a column vector by a matrix.
+	/// </summary>
+	/// <param name="lhs">The matrix to transform the vector with.</param>
+	/// <param name="rhs">The vector to transform.</param>
+	/// <returns>The transformed vector.</returns>
+	template <typename T, unsigned ROWS, unsigned COLS>
+	constexpr Vector<T, ROWS> operator*(const Matrix<T, ROWS, COLS>& lhs, const Vector<T, COLS>& rhs) noexcept {
+		Vector<T, ROWS> result;
+
+		if !consteval {
+			if constexpr (SIMD::enabled && std::same_as<T, float> && (ROWS == 3 || ROWS == 4) && COLS == 4) {
+				auto v = SIMD::load(rhs.elements());
+				auto r0 = SIMD::load(lhs.elements()), r1 = SIMD::load(lhs.elements() + 4), r2 = SIMD::load(lhs.elements() + 8);
+
+				if constexpr (ROWS == 4)
+					SIMD::store(result.elements(), SIMD::transform(r0, r1, r2, SIMD::load(lhs.elements() + 12), v));
+				else
+					SIMD::store3(result.elements(), SIMD::transform(r0, r1, r2, SIMD::splat(0.f), v));
+
+				return result;
+			}
+		}
+
+		for (unsigned r{ 0 }; r < ROWS; ++r)
+		{
+			T value{ 0 };
+
+			for (unsigned c{ 0 }; c < COLS; ++c)
+				value += lhs.at(r, c) * rhs[c];
+
+			result[r] = value;
+		}
+
+		return result;
+	}
+
+	/// <summary>
+	/// Computes the determinant of a square matrix.
+	/// </summary>
+	/// <param name="m">The matrix to compute the determinant of.</param>
+	/// <returns>The determinant of the matrix.</returns>
+	template <typename T, unsigned DIM> requires (DIM <= 4)
+	constexpr T determinant(const Matrix<T, DIM, DIM>& m) noexcept {
+		if constexpr (DIM == 2)
+			return m.at(0, 0) * m.at(1, 1) - m.at(0, 1) * m.at(1, 0);
+		else if constexpr (DIM == 3)
+			return m.at(0, 0) * (m.at(1, 1) * m.at(2, 2) - m.at(1, 2) * m.at(2, 1))
+				- m.at(0, 1) * (m.at(1, 0) * m.at(2, 2) - m.at(1, 2) * m.at(2, 0))
+				+ m.at(0, 2) * (m.at(1, 0) * m.at(2, 1) - m.at(1, 1) * m.at(2, 0));
+		else
+		{
+			auto s0 = m.at(0, 0) * m.at(1, 1) - m.at(1, 0) * m.at(0, 1);
+			auto s1 = m.at(0, 0) * m.at(1, 2) - m.at(1, 0) * m.at(0, 2);
+			auto s2 = m.at(0, 0) * m.at(1, 3) - m.at(1, 0) * m.at(0, 3);
+			auto s3 = m.at(0, 1) * m.at(1, 2) - m.at(1, 1) * m.at(0, 2);
+			auto s4 = m.at(0, 1) * m.at(1, 3) - m.at(1, 1) * m.at(0, 3);
+			auto s5 = m.at(0, 2) * m.at(1, 3) - m.at(1, 2) * m.at(0, 3);
+			auto c5 = m.at(2, 2) * m.at(3, 3) - m.at(3, 2) * m.at(2, 3);
+			auto c4 = m.at(2, 1) * m.at(3, 3) - m.at(3, 1) * m.at(2, 3);
+			auto c3 = m.at(2, 1) * m.at(3, 2) - m.at(3, 1) * m.at(2, 2);
+			auto c2 = m.at(2, 0) * m.at(3, 3) - m.at(3, 0) * m.at(2, 3);
+			auto c1 = m.at(2, 0) * m.at(3, 2) - m.at(3, 0) * m.at(2, 2);
+			auto c0 = m.at(2, 0) * m.at(3, 1) - m.at(3, 0) * m.at(2, 1);
+
+			return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+		}
+	}
+
+	/// <summary>
+	/// Computes the inverse of a square matrix.
+	/// </summary>
+	/// <remarks>
+	/// If the matrix is singular, the result is undefined. For single precision 4x4 matrices, the inverse is computed using the SIMD primitives, if they are 
+	/// available and the inverse is not evaluated at compile time.
+	/// </remarks>
+	/// <param name="m">The matrix to invert.</param>
+	/// <returns>The inverse of the matrix.</returns>
+	template <typename T, unsigned DIM> requires (DIM <= 4 && std::floating_point<T>)
+	constexpr Matrix<T, DIM, DIM> inverse(const Matrix<T, DIM, DIM>& m) noexcept {
+		Matrix<T, DIM, DIM> result;
+
+		if constexpr (DIM == 2)
+		{
+			auto factor = T{ 1 } / determinant(m);
+			result.at(0, 0) =  m.at(1, 1) * factor;
+			result.at(0, 1) = -m.at(0, 1) * factor;
+			result.at(1, 0) = -m.at(1, 0) * factor;
+			result.at(1, 1) =  m.at(0, 0) * factor;
+		}
+		else if constexpr (DIM == 3)
+		{
+			auto factor = T{ 1 } / determinant(m);
+			result.at(0, 0) = (m.at(1, 1) * m.at(2, 2) - m.at(1, 2) * m.at(2, 1)) * factor;
+			result.at(0, 1) = (m.at(0, 2) * m.at(2, 1) - m.at(0, 1) * m.at(2, 2)) * factor;
+			result.at(0, 2) = (m.at(0, 1) * m.at(1, 2) - m.at(0, 2) * m.at(1, 1)) * factor;
+			result.at(1, 0) = (m.at(1, 2) * m.at(2, 0) - m.at(1, 0) * m.at(2, 2)) * factor;
+			result.at(1, 1) = (m.at(0, 0) * m.at(2, 2) - m.at(0, 2) * m.at(2, 0)) * factor;
+			result.at(1, 2) = (m.at(0, 2) * m.at(1, 0) - m.at(0, 0) * m.at(1, 2)) * factor;
+			result.at(2, 0) = (m.at(1, 0) * m.at(2, 1) - m.at(1, 1) * m.at(2, 0)) * factor;
+			result.at(2, 1) = (m.at(0, 1) * m.at(2, 0) - m.at(0, 0) * m.at(2, 1)) * factor;
+			result.at(2, 2) = (m.at(0, 0) * m.at(1, 1) - m.at(0, 1) * m.at(1, 0)) * factor;
+		}
+		else
+		{
+			if !consteval {
+				if constexpr (SIMD::enabled && std::same_as<T, float>) {
+					SIMD::inverse4x4(m.elements(), result.elements());
+					return result;
+				}
+			}
+
+			auto s0 = m.at(0, 0) * m.at(1, 1) - m.at(1, 0) * m.at(0, 1);
+			auto s1 = m.at(0, 0) * m.at(1, 2) - m.at(1, 0) * m.at(0, 2);
+			auto s2 = m.at(0, 0) * m.at(1, 3) - m.at(1, 0) * m.at(0, 3);
+			auto s3 = m.at(0, 1) * m.at(1, 2) - m.at(1, 1) * m.at(0, 2);
+			auto s4 = m.at(0, 1) * m.at(1, 3) - m.at(1, 1) * m.at(0, 3);
+			auto s5 = m.at(0, 2) * m.at(1, 3) - m.at(1, 2) * m.at(0, 3);
+			auto c5 = m.at(2, 2) * m.at(3, 3) - m.at(3, 2) * m.at(2, 3);
+			auto c4 = m.at(2, 1) * m.at(3, 3) - m.at(3, 1) * m.at(2, 3);
+			auto c3 = m.at(2, 1) * m.at(3, 2) - m.at(3, 1) * m.at(2, 2);
+			auto c2 = m.at(2, 0) * m.at(3, 3) - m.at(3, 0) * m.at(2, 3);
+			auto c1 = m.at(2, 0) * m.at(3, 2) - m.at(3, 0) * m.at(2, 2);
+			auto c0 = m.at(2, 0) * m.at(3, 1) - m.at(3, 0) * m.at(2, 1);
+			auto factor = T{ 1 } / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+			result.at(0, 0) = ( m.at(1, 1) * c5 - m.at(1, 2) * c4 + m.at(1, 3) * c3) * factor;
+			result.at(0, 1) = (-m.at(0, 1) * c5 + m.at(0, 2) * c4 - m.at(0, 3) * c3) * factor;
+			result.at(0, 2) = ( m.at(3, 1) * s5 - m.at(3, 2) * s4 + m.at(3, 3) * s3) * factor;
+			result.at(0, 3) = (-m.at(2, 1) * s5 + m.at(2, 2) * s4 - m.at(2, 3) * s3) * factor;
+			result.at(1, 0) = (-m.at(1, 0) * c5 + m.at(1, 2) * c2 - m.at(1, 3) * c1) * factor;
+			result.at(1, 1) = ( m.at(0, 0) * c5 - m.at(0, 2) * c2 + m.at(0, 3) * c1) * factor;
+			result.at(1, 2) = (-m.at(3, 0) * s5 + m.at(3, 2) * s2 - m.at(3, 3) * s1) * factor;
+			result.at(1, 3) = ( m.at(2, 0) * s5 - m.at(2, 2) * s2 + m.at(2, 3) * s1) * factor;
+			result.at(2, 0) = ( m.at(1, 0) * c4 - m.at(1, 1) * c2 + m.at(1, 3) * c0) * factor;
+			result.at(2, 1) = (-m.at(0, 0) * c4 + m.at(0, 1) * c2 - m.at(0, 3) * c0) * factor;
+			result.at(2, 2) = ( m.at(3, 0) * s4 - m.at(3, 1) * s2 + m.at(3, 3) * s0) * factor;
+			result.at(2, 3) = (-m.at(2, 0) * s4 + m.at(2, 1) * s2 - m.at(2, 3) * s0) * factor;
+			result.at(3, 0) = (-m.at(1, 0) * c3 + m.at(1, 1) * c1 - m.at(1, 2) * c0) * factor;
+			result.at(3, 1) = ( m.at(0, 0) * c3 - m.at(0, 1) * c1 + m.at(0, 2) * c0) * factor;
+			result.at(3, 2) = (-m.at(3, 0) * s3 + m.at(3, 1) * s1 - m.at(3, 2) * s0) * factor;
+			result.at(3, 3) = ( m.at(2, 0) * s3 - m.at(2, 1) * s1 + m.at(2, 2) * s0) * factor;
+		}
+
+		return result;
+	}
+
+	/// <summary>
+	/// Computes the inverse of an affine transform.
+	/// </summary>
+	/// <remarks>
+	/// The matrix is treated as 4x4 matrix with an implicit fourth row of <c>{ 0, 0, 0, 1 }</c>. If the linear part of the transform is singular, the result
+	/// is undefined.
+	/// </remarks>
+	/// <param name="m">The transform to invert.</param>
+	/// <returns>The inverse transform.</returns>
+	template <std::floating_point T>
+	constexpr TMatrix3x4<T> inverse(const TMatrix3x4<T>& m) noexcept {
+		auto linear = inverse(TMatrix3<T>{ 
+			m.at(0, 0), m.at(0, 1), m.at(0, 2), 
+			m.at(1, 0), m.at(1, 1), m.at(1, 2), 
+			m.at(2, 0), m.at(2, 1), m.at(2, 2) 
+		});
+
+		TMatrix3x4<T> result;
+
+		for (unsigned r{ 0 }; r < 3; ++r)
+		{
+			for (unsigned c{ 0 }; c < 3; ++c)
+				result.at(r, c) = linear.at(r, c);
+
+			result.at(r, 3) = -(linear.at(r, 0) * m.at(0, 3) + linear.at(r, 1) * m.at(1, 3) + linear.at(r, 2) * m.at(2, 3));
+		}
+
+		return result;
+	}
+#pragma endregion
+
 }
\ No newline at end of file
@@ -0,0 +1,511 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <utility>
+
+// Select the instruction set that is used to implement the SIMD primitives. This is done at compile time, based on the target architecture and the instruction set
+// extensions that are enabled for the compiler. If SIMD support is disabled or no supported instruction set is available, a scalar implementation is used instead.
+// Note that MSVC does not signal SSE4.1 support (the x64 baseline only guarantees SSE2), so it needs to be requested explicitly by defining `LITEFX_BUILD_SIMD_SSE4`,
+// or implicitly by enabling AVX.
+#if defined(LITEFX_BUILD_WITH_SIMD)
+#  if (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+#    define LITEFX_MATH_SIMD_NEON
+#  elif defined(__AVX2__)
+#    define LITEFX_MATH_SIMD_AVX2
+#    define LITEFX_MATH_SIMD_SSE4
+#  elif defined(__SSE4_1__) || defined(__AVX__) || defined(LITEFX_BUILD_SIMD_SSE4)
+#    define LITEFX_MATH_SIMD_SSE4
+#  endif
+#endif
+
+// Half precision conversions are available on all AVX2 capable CPUs, but need to be enabled separately for GCC and Clang.
+#if defined(LITEFX_MATH_SIMD_AVX2) && (defined(__F16C__) || defined(_MSC_VER))
+#  define LITEFX_MATH_SIMD_F16C
+#endif
+
+#if defined(LITEFX_MATH_SIMD_AVX2)
+#include <immintrin.h>
+#elif defined(LITEFX_MATH_SIMD_SSE4)
+#include <smmintrin.h>
+#elif defined(LITEFX_MATH_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+/// <summary>
+/// Contains primitives and kernels that are used to implement vector and matrix arithmetic on 4-wide single precision floating point registers.
+/// </summary>
+/// <remarks>
+/// The primitives are implemented using SSE4.1 (optionally with AVX2 and FMA), NEON or scalar code, depending on the target architecture. Note that all loads
+/// and stores are unaligned, since the vector and matrix types do not impose any alignment requirements on their storage.
+/// </remarks>
+namespace LiteFX::Math::SIMD {
+
+#if defined(LITEFX_MATH_SIMD_SSE4)
+	/// <summary>
+	/// A register that stores four single precision floating point values.
+	/// </summary>
+	using float4 = __m128;
+
+	/// <summary>
+	/// Is <c>true</c>, if the primitives are implemented using SIMD instructions.
+	/// </summary>
+	constexpr bool enabled = true;
+#elif defined(LITEFX_MATH_SIMD_NEON)
+	/// <summary>
+	/// A register that stores four single precision floating point values.
+	/// </summary>
+	using float4 = float32x4_t;
+
+	/// <summary>
+	/// Is <c>true</c>, if the primitives are implemented using SIMD instructions.
+	/// </summary>
+	constexpr bool enabled = true;
+#else
+	/// <summary>
+	/// A register that stores four single precision floating point values.
+	/// </summary>
+	struct float4 {
+		std::array<float, 4> v;
+	};
+
+	/// <summary>
+	/// Is <c>true</c>, if the primitives are implemented using SIMD instructions.
+	/// </summary>
+	constexpr bool enabled = false;
+#endif
+
+#pragma region Primitives
+	/// <summary>
+	/// Loads four values from <paramref name="p" />.
+	/// </summary>
+	inline float4 load(const float* p) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_loadu_ps(p);
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		return vld1q_f32(p);
+#else
+		return { p[0], p[1], p[2], p[3] };
+#endif
+	}
+
+	/// <summary>
+	/// Loads three values from <paramref name="p" /> and sets the fourth value to zero.
+	/// </summary>
+	inline float4 load3(const float* p) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_movelh_ps(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))), _mm_load_ss(p + 2));
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		return vcombine_f32(vld1_f32(p), vset_lane_f32(p[2], vdup_n_f32(0.f), 0));
+#else
+		return { p[0], p[1], p[2], 0.f };
+#endif
+	}
+
+	/// <summary>
+	/// Stores all four values of <paramref name="v" /> to <paramref name="p" />.
+	/// </summary>
+	inline void store(float* p, float4 v) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		_mm_storeu_ps(p, v);
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		vst1q_f32(p, v);
+#else
+		std::ranges::copy(v.v, p);
+#endif
+	}
+
+	/// <summary>
+	/// Stores the first three values of <paramref name="v" /> to <paramref name="p" />.
+	/// </summary>
+	inline void store3(float* p, float4 v) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(v));
+		_mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		vst1_f32(p, vget_low_f32(v));
+		vst1q_lane_f32(p + 2, v, 2);
+#else
+		std::ranges::copy_n(v.v.begin(), 3, p);
+#endif
+	}
+
+	/// <summary>
+	/// Creates a register from four values.
+	/// </summary>
+	inline float4 set(float x, float y, float z, float w) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_setr_ps(x, y, z, w);
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		const float values[4] = { x, y, z, w };
+		return vld1q_f32(values);
+#else
+		return { x, y, z, w };
+#endif
+	}
+
+	/// <summary>
+	/// Creates a register that stores <paramref name="value" /> in all four elements.
+	/// </summary>
+	inline float4 splat(float value) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_set1_ps(value);
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		return vdupq_n_f32(value);
+#else
+		return { value, value, value, value };
+#endif
+	}
+
+	/// <summary>
+	/// Returns the element at index <typeparamref name="I" />.
+	/// </summary>
+	template <unsigned I> requires (I < 4)
+	inline float get(float4 v) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		if constexpr (I == 0)
+			return _mm_cvtss_f32(v);
+		else
+			return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(I, I, I, I)));
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		return vgetq_lane_f32(v, I);
+#else
+		return v.v[I];
+#endif
+	}
+
+	/// <summary>
+	/// Returns a register that stores the element at index <typeparamref name="I" /> in all four elements.
+	/// </summary>
+	template <unsigned I> requires (I < 4)
+	inline float4 broadcast(float4 v) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_shuffle_ps(v, v, _MM_SHUFFLE(I, I, I, I));
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		return vdupq_laneq_f32(v, I);
+#else
+		return { v.v[I], v.v[I], v.v[I], v.v[I] };
+#endif
+	}
+
+	/// <summary>
+	/// Returns a register that contains the elements <c>{ a[X], a[Y], b[Z], b[W] }</c>.
+	/// </summary>
+	template <unsigned X, unsigned Y, unsigned Z, unsigned W> requires (X < 4 && Y < 4 && Z < 4 && W < 4)
+	inline float4 shuffle(float4 a, float4 b) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		const float values[4] = { vgetq_lane_f32(a, X), vgetq_lane_f32(a, Y), vgetq_lane_f32(b, Z), vgetq_lane_f32(b, W) };
+		return vld1q_f32(values);
+#else
+		return { a.v[X], a.v[Y], b.v[Z], b.v[W] };
+#endif
+	}
+
+	/// <summary>
+	/// Returns the component-wise sum <c>a + b</c>.
+	/// </summary>
+	inline float4 add(float4 a, float4 b) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_add_ps(a, b);
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		return vaddq_f32(a, b);
+#else
+		return { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] };
+#endif
+	}
+
+	/// <summary>
+	/// Returns the component-wise difference <c>a - b</c>.
+	/// </summary>
+	inline float4 sub(float4 a, float4 b) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_sub_ps(a, b);
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		return vsubq_f32(a, b);
+#else
+		return { a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3] };
+#endif
+	}
+
+	/// <summary>
+	/// Returns the component-wise product <c>a * b</c>.
+	/// </summary>
+	inline float4 mul(float4 a, float4 b) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_mul_ps(a, b);
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		return vmulq_f32(a, b);
+#else
+		return { a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] };
+#endif
+	}
+
+	/// <summary>
+	/// Returns the component-wise quotient <c>a / b</c>.
+	/// </summary>
+	inline float4 div(float4 a, float4 b) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_div_ps(a, b);
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		return vdivq_f32(a, b);
+#else
+		return { a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3] };
+#endif
+	}
+
+	/// <summary>
+	/// Returns <c>a * b + c</c>, using a fused multiply-add instruction, if available.
+	/// </summary>
+	inline float4 madd(float4 a, float4 b, float4 c) noexcept {
+#if defined(LITEFX_MATH_SIMD_AVX2)
+		return _mm_fmadd_ps(a, b, c);
+#elif defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		return vfmaq_f32(c, a, b);
+#else
+		return add(mul(a, b), c);
+#endif
+	}
+
+	/// <summary>
+	/// Returns <c>c - a * b</c>, using a fused multiply-add instruction, if available.
+	/// </summary>
+	inline float4 nmadd(float4 a, float4 b, float4 c) noexcept {
+#if defined(LITEFX_MATH_SIMD_AVX2)
+		return _mm_fnmadd_ps(a, b, c);
+#elif defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_sub_ps(c, _mm_mul_ps(a, b));
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		return vfmsq_f32(c, a, b);
+#else
+		return sub(c, mul(a, b));
+#endif
+	}
+
+	/// <summary>
+	/// Returns the component-wise minimum of <paramref name="a" /> and <paramref name="b" />.
+	/// </summary>
+	inline float4 min(float4 a, float4 b) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_min_ps(a, b);
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		return vminq_f32(a, b);
+#else
+		return { std::min(a.v[0], b.v[0]), std::min(a.v[1], b.v[1]), std::min(a.v[2], b.v[2]), std::min(a.v[3], b.v[3]) };
+#endif
+	}
+
+	/// <summary>
+	/// Returns the component-wise maximum of <paramref name="a" /> and <paramref name="b" />.
+	/// </summary>
+	inline float4 max(float4 a, float4 b) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_max_ps(a, b);
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		return vmaxq_f32(a, b);
+#else
+		return { std::max(a.v[0], b.v[0]), std::max(a.v[1], b.v[1]), std::max(a.v[2], b.v[2]), std::max(a.v[3], b.v[3]) };
+#endif
+	}
+
+	/// <summary>
+	/// Returns the sum of all four elements of <paramref name="v" />.
+	/// </summary>
+	inline float sum(float4 v) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		auto t = _mm_hadd_ps(v, v);
+		return _mm_cvtss_f32(_mm_hadd_ps(t, t));
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		return vaddvq_f32(v);
+#else
+		return (v.v[0] + v.v[1]) + (v.v[2] + v.v[3]);
+#endif
+	}
+
+	/// <summary>
+	/// Returns the dot product of <paramref name="a" /> and <paramref name="b" />.
+	/// </summary>
+	inline float dot(float4 a, float4 b) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_cvtss_f32(_mm_dp_ps(a, b, 0xF1));
+#else
+		return sum(mul(a, b));
+#endif
+	}
+
+	/// <summary>
+	/// Returns a register that contains the dot products of <paramref name="v" /> with each of the four registers <paramref name="a" /> to <paramref name="d" />.
+	/// </summary>
+	inline float4 dot(float4 a, float4 b, float4 c, float4 d, float4 v) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		return _mm_hadd_ps(_mm_hadd_ps(_mm_mul_ps(a, v), _mm_mul_ps(b, v)), _mm_hadd_ps(_mm_mul_ps(c, v), _mm_mul_ps(d, v)));
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		return vpaddq_f32(vpaddq_f32(vmulq_f32(a, v), vmulq_f32(b, v)), vpaddq_f32(vmulq_f32(c, v), vmulq_f32(d, v)));
+#else
+		return { dot(a, v), dot(b, v), dot(c, v), dot(d, v) };
+#endif
+	}
+
+	/// <summary>
+	/// Transposes the 4x4 matrix stored in the rows <paramref name="r0" /> to <paramref name="r3" /> in place.
+	/// </summary>
+	inline void transpose(float4& r0, float4& r1, float4& r2, float4& r3) noexcept {
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+#elif defined(LITEFX_MATH_SIMD_NEON)
+		auto t0 = vzip1q_f32(r0, r2), t1 = vzip2q_f32(r0, r2);
+		auto t2 = vzip1q_f32(r1, r3), t3 = vzip2q_f32(r1, r3);
+		r0 = vzip1q_f32(t0, t2);
+		r1 = vzip2q_f32(t0, t2);
+		r2 = vzip1q_f32(t1, t3);
+		r3 = vzip2q_f32(t1, t3);
+#else
+		std::swap(r0.v[1], r1.v[0]);
+		std::swap(r0.v[2], r2.v[0]);
+		std::swap(r0.v[3], r3.v[0]);
+		std::swap(r1.v[2], r2.v[1]);
+		std::swap(r1.v[3], r3.v[1]);
+		std::swap(r2.v[3], r3.v[2]);
+#endif
+	}
+#pragma endregion
+
+#pragma region Kernels
+	/// <summary>
+	/// Computes the cross product of two 3D vectors stored in the first three elements of <paramref name="a" /> and <paramref name="b" />.
+	/// </summary>
+	inline float4 cross(float4 a, float4 b) noexcept {
+		// (a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x)
+		auto a_yzx = shuffle<1, 2, 0, 3>(a, a);
+		auto b_yzx = shuffle<1, 2, 0, 3>(b, b);
+		auto c = nmadd(a_yzx, b, mul(a, b_yzx));
+		return shuffle<1, 2, 0, 3>(c, c);
+	}
+
+	/// <summary>
+	/// Computes the product of two row-major 4x4 matrices <paramref name="a" /> and <paramref name="b" /> and stores the result in <paramref name="result" />.
+	/// </summary>
+	/// <remarks>
+	/// Each row of the result is the linear combination of the rows of <paramref name="b" />, weighted by the elements of the corresponding row of
+	/// <paramref name="a" />. With AVX2, two rows of the result are computed at once.
+	/// </remarks>
+	inline void multiply4x4(const float* a, const float* b, float* result) noexcept {
+#if defined(LITEFX_MATH_SIMD_AVX2)
+		constexpr auto broadcast = [](const float* row) { auto r = _mm_loadu_ps(row); return _mm256_set_m128(r, r); };
+		auto b0 = broadcast(b + 0), b1 = broadcast(b + 4), b2 = broadcast(b + 8), b3 = broadcast(b + 12);
+
+		for (int r{ 0 }; r < 16; r += 8)
+		{
+			auto rows = _mm256_loadu_ps(a + r);
+			auto row = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+			row = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(1, 1, 1, 1)), b1, row);
+			row = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(2, 2, 2, 2)), b2, row);
+			row = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(3, 3, 3, 3)), b3, row);
+			_mm256_storeu_ps(result + r, row);
+		}
+#else
+		auto b0 = load(b + 0), b1 = load(b + 4), b2 = load(b + 8), b3 = load(b + 12);
+
+		for (int r{ 0 }; r < 16; r += 4)
+		{
+			auto row = load(a + r);
+			auto out = mul(broadcast<0>(row), b0);
+			out = madd(broadcast<1>(row), b1, out);
+			out = madd(broadcast<2>(row), b2, out);
+			out = madd(broadcast<3>(row), b3, out);
+			store(result + r, out);
+		}
+#endif
+	}
+
+	/// <summary>
+	/// Computes the product of two affine transforms stored as row-major 3x4 matrices with an implicit fourth row of <c>{ 0, 0, 0, 1 }</c>.
+	/// </summary>
+	inline void multiply3x4(const float* a, const float* b, float* result) noexcept {
+		auto b0 = load(b + 0), b1 = load(b + 4), b2 = load(b + 8);
+		auto b3 = set(0.f, 0.f, 0.f, 1.f);
+
+		for (int r{ 0 }; r < 12; r += 4)
+		{
+			auto row = load(a + r);
+			auto out = mul(broadcast<0>(row), b0);
+			out = madd(broadcast<1>(row), b1, out);
+			out = madd(broadcast<2>(row), b2, out);
+			out = madd(broadcast<3>(row), b3, out);
+			store(result + r, out);
+		}
+	}
+
+	/// <summary>
+	/// Transforms the vector <paramref name="v" /> by the row-major matrix stored in the rows <paramref name="r0" /> to <paramref name="r3" />.
+	/// </summary>
+	inline float4 transform(float4 r0, float4 r1, float4 r2, float4 r3, float4 v) noexcept {
+		return dot(r0, r1, r2, r3, v);
+	}
+
+	/// <summary>
+	/// Computes the inverse of a row-major 4x4 matrix and stores it in <paramref name="result" />. If the matrix is singular, the result is undefined.
+	/// </summary>
+	/// <remarks>
+	/// The matrix is partitioned into four 2x2 blocks, which are stored in a single register each. The inverse is then computed from the blocks, their
+	/// adjugates and determinants using block-wise inversion.
+	/// </remarks>
+	inline void inverse4x4(const float* m, float* result) noexcept {
+		// 2x2 matrix helpers, where each matrix is stored as { m00, m01, m10, m11 }.
+		constexpr auto mat2Mul = [](float4 a, float4 b) { return madd(a, shuffle<0, 3, 0, 3>(b, b), mul(shuffle<1, 0, 3, 2>(a, a), shuffle<2, 1, 2, 1>(b, b))); };
+		constexpr auto mat2AdjMul = [](float4 a, float4 b) { return nmadd(shuffle<1, 1, 2, 2>(a, a), shuffle<2, 3, 0, 1>(b, b), mul(shuffle<3, 3, 0, 0>(a, a), b)); };
+		constexpr auto mat2MulAdj = [](float4 a, float4 b) { return nmadd(shuffle<1, 0, 3, 2>(a, a), shuffle<2, 1, 2, 1>(b, b), mul(a, shuffle<3, 0, 3, 0>(b, b))); };
+
+		auto r0 = load(m + 0), r1 = load(m + 4), r2 = load(m + 8), r3 = load(m + 12);
+
+		// Partition into blocks.
+		auto a = shuffle<0, 1, 0, 1>(r0, r1);
+		auto b = shuffle<2, 3, 2, 3>(r0, r1);
+		auto c = shuffle<0, 1, 0, 1>(r2, r3);
+		auto d = shuffle<2, 3, 2, 3>(r2, r3);
+
+		// Compute the determinants of all blocks at once: { det(a), det(b), det(c), det(d) }.
+		auto determinants = nmadd(shuffle<1, 3, 1, 3>(r0, r2), shuffle<0, 2, 0, 2>(r1, r3), mul(shuffle<0, 2, 0, 2>(r0, r2), shuffle<1, 3, 1, 3>(r1, r3)));
+		auto detA = broadcast<0>(determinants), detB = broadcast<1>(determinants), detC = broadcast<2>(determinants), detD = broadcast<3>(determinants);
+
+		auto dc = mat2AdjMul(d, c);
+		auto ab = mat2AdjMul(a, b);
+
+		auto x = sub(mul(detD, a), mat2Mul(b, dc));
+		auto w = sub(mul(detA, d), mat2Mul(c, ab));
+		auto y = sub(mul(detB, c), mat2MulAdj(d, ab));
+		auto z = sub(mul(detC, b), mat2MulAdj(a, dc));
+
+		auto determinant = madd(detB, detC, mul(detA, detD));
+		determinant = sub(determinant, splat(sum(mul(ab, shuffle<0, 2, 1, 3>(dc, dc)))));
+		auto factor = div(set(1.f, -1.f, -1.f, 1.f), determinant);
+
+		x = mul(x, factor);
+		y = mul(y, factor);
+		z = mul(z, factor);
+		w = mul(w, factor);
+
+		store(result + 0, shuffle<3, 1, 3, 1>(x, y));
+		store(result + 4, shuffle<2, 0, 2, 0>(x, y));
+		store(result + 8, shuffle<3, 1, 3, 1>(z, w));
+		store(result + 12, shuffle<2, 0, 2, 0>(z, w));
+	}
+
+	/// <summary>
+	/// Transposes a row-major 4x4 matrix and stores the result in <paramref name="result" />.
+	/// </summary>
+	inline void transpose4x4(const float* m, float* result) noexcept {
+		auto r0 = load(m + 0), r1 = load(m + 4), r2 = load(m + 8), r3 = load(m + 12);
+		transpose(r0, r1, r2, r3);
+		store(result + 0, r0);
+		store(result + 4, r1);
+		store(result + 8, r2);
+		store(result + 12, r3);
+	}
+#pragma endregion
+
+}
@@ -5,6 +5,10 @@
 #include <array>
 #include <vector>
 #include <ranges>
+#include <cmath>
+#include <concepts>
+#include <functional>
+#include <litefx/simd.hpp>
 
 namespace LiteFX::Math {
 
@@ -215,6 +219,14 @@ namespace LiteFX::Math {
             return m_elements.data();
         }
 
+        /// <summary>
+        /// Returns a pointer to the elements of the vector.
+        /// </summary>
+        /// <returns>A pointer to the elements of the vector.</returns>
+        constexpr scalar_type* elements() noexcept {
+            return m_elements.data();
+        }
+
         /// <summary>
         /// Converts the vector to an instance of `std::array`.
         /// </summary>
@@ -326,4 +338,277 @@ namespace LiteFX::Math {
     /// <typeparam name="T">The type of the vector components.</typeparam>
 	template<typename T> using TVector4 = Vector<T, 4>;
 
+#pragma region Arithmetic
+    /// <summary>
+    /// Concept that is satisfied by vector types with arithmetic scalar elements, including types that derive from <see cref="Vector" />.
+    /// </summary>
+    /// <typeparam name="TVector">The type to check.</typeparam>
+    template <typename TVector>
+    concept arithmetic_vector = std::derived_from<TVector, typename TVector::vec_type> && std::is_arithmetic_v<typename TVector::scalar_type>;
+
+    namespace details {
+        /// <summary>
+        /// Is <c>true</c>, if operations on vectors of type <typeparamref name="TVector" /> are executed using the SIMD primitives.
+        /// </summary>
+        /// <remarks>
+        /// Two-component vectors are always computed using scalar code, since loading them into a register costs more than computing the result directly.
+        /// </remarks>
+        template <typename TVector>
+        constexpr bool simd_vector = SIMD::enabled && std::same_as<typename TVector::scalar_type, float> && (TVector::vec_size == 3 || TVector::vec_size == 4);
+
+        template <typename TVector>
+        inline SIMD::float4 load(const TVector& v) noexcept {
+            if constexpr (TVector::vec_size == 4)
+                return SIMD::load(v.elements());
+            else
+                return SIMD::load3(v.elements());
+        }
+
+        template <typename TVector>
+        inline void store(TVector& v, SIMD::float4 value) noexcept {
+            if constexpr (TVector::vec_size == 4)
+                SIMD::store(v.elements(), value);
+            else
+                SIMD::store3(v.elements(), value);
+        }
+
+        template <typename TVector, typename TScalarOperation, typename TSimdOperation>
+        constexpr TVector componentWise(const TVector& lhs, const TVector& rhs, TScalarOperation scalarOperation, TSimdOperation simdOperation) noexcept {
+            TVector result;
+
+            if !consteval {
+                if constexpr (simd_vector<TVector>) {
+                    store(result, simdOperation(load(lhs), load(rhs)));
+                    return result;
+                }
+            }
+
+            for (unsigned i{ 0 }; i < TVector::vec_size; ++i)
+                result[i] = scalarOperation(lhs[i], rhs[i]);
+
+            return result;
+        }
+
+        template <typename TVector, typename TScalarOperation, typename TSimdOperation>
+        constexpr TVector componentWise(const TVector& lhs, typename TVector::scalar_type rhs, TScalarOperation scalarOperation, TSimdOperation simdOperation) noexcept {
+            TVector result;
+
+            if !consteval {
+                if constexpr (simd_vector<TVector>) {
+                    store(result, simdOperation(load(lhs), SIMD::splat(rhs)));
+                    return result;
+                }
+            }
+
+            for (unsigned i{ 0 }; i < TVector::vec_size; ++i)
+                result[i] = scalarOperation(lhs[i], rhs);
+
+            return result;
+        }
+    }
+
+    /// <summary>
+    /// Returns the component-wise sum of two vectors.
+    /// </summary>
+    /// <param name="lhs">The left operand.</param>
+    /// <param name="rhs">The right operand.</param>
+    /// <returns>The component-wise sum of <paramref name="lhs" /> and <paramref name="rhs" />.</returns>
+    template <arithmetic_vector TVector>
+    constexpr TVector operator+(const TVector& lhs, const TVector& rhs) noexcept {
+        return details::componentWise(lhs, rhs, std::plus<>{ }, [](auto a, auto b) { return SIMD::add(a, b); });
+    }
+
+    /// <summary>
+    /// Returns the component-wise difference of two vectors.
+    /// </summary>
+    /// <param name="lhs">The left operand.</param>
+    /// <param name="rhs">The right operand.</param>
+    /// <returns>The component-wise difference of <paramref name="lhs" /> and <paramref name="rhs" />.</returns>
+    template <arithmetic_vector TVector>
+    constexpr TVector operator-(const TVector& lhs, const TVector& rhs) noexcept {
+        return details::componentWise(lhs, rhs, std::minus<>{ }, [](auto a, auto b) { return SIMD::sub(a, b); });
+    }
+
+    /// <summary>
+    /// Returns the component-wise product of two vectors.
+    /// </summary>
+    /// <param name="lhs">The left operand.</param>
+    /// <param name="rhs">The right operand.</param>
+    /// <returns>The component-wise product of <paramref name="lhs" /> and <paramref name="rhs" />.</returns>
+    template <arithmetic_vector TVector>
+    constexpr TVector operator*(const TVector& lhs, const TVector& rhs) noexcept {
+        return details::componentWise(lhs, rhs, std::multiplies<>{ }, [](auto a, auto b) { return SIMD::mul(a, b); });
+    }
+
+    /// <summary>
+    /// Returns the component-wise quotient of two vectors.
+    /// </summary>
+    /// <param name="lhs">The left operand.</param>
+    /// <param name="rhs">The right operand.</param>
+    /// <returns>The component-wise quotient of <paramref name="lhs" /> and <paramref name="rhs" />.</returns>
+    template <arithmetic_vector TVector>
+    constexpr TVector operator/(const TVector& lhs, const TVector& rhs) noexcept {
+        return details::componentWise(lhs, rhs, std::divides<>{ }, [](auto a, auto b) { return SIMD::div(a, b); });
+    }
+
+    /// <summary>
+    /// Scales a vector by a scalar value.
+    /// </summary>
+    /// <param name="lhs">The vector to scale.</param>
+    /// <param name="rhs">The scaling factor.</param>
+    /// <returns>The scaled vector.</returns>
+    template <arithmetic_vector TVector>
+    constexpr TVector operator*(const TVector& lhs, typename TVector::scalar_type rhs) noexcept {
+        return details::componentWise(lhs, rhs, std::multiplies<>{ }, [](auto a, auto b) { return SIMD::mul(a, b); });
+    }
+
+    /// <summary>
+    /// Scales a vector by a scalar value.
+    /// </summary>
+    /// <param name="lhs">The scaling factor.</param>
+    /// <param name="rhs">The vector to scale.</param>
+    /// <returns>The scaled vector.</returns>
+    template <arithmetic_vector TVector>
+    constexpr TVector operator*(typename TVector::scalar_type lhs, const TVector& rhs) noexcept {
+        return rhs * lhs;
+    }
+
+    /// <summary>
+    /// Divides each component of a vector by a scalar value.
+    /// </summary>
+    /// <param name="lhs">The vector to divide.</param>
+    /// <param name="rhs">The divisor.</param>
+    /// <returns>The divided vector.</returns>
+    template <arithmetic_vector TVector>
+    constexpr TVector operator/(const TVector& lhs, typename TVector::scalar_type rhs) noexcept {
+        return details::componentWise(lhs, rhs, std::divides<>{ }, [](auto a, auto b) { return SIMD::div(a, b); });
+    }
+
+    /// <summary>
+    /// Negates each component of a vector.
+    /// </summary>
+    /// <param name="v">The vector to negate.</param>
+    /// <returns>The negated vector.</returns>
+    template <arithmetic_vector TVector> requires std::is_signed_v<typename TVector::scalar_type>
+    constexpr TVector operator-(const TVector& v) noexcept {
+        return details::componentWise(v, typename TVector::scalar_type{ -1 }, std::multiplies<>{ }, [](auto a, auto b) { return SIMD::mul(a, b); });
+    }
+
+    /// <summary>
+    /// Adds <paramref name="rhs" /> to <paramref name="lhs" />.
+    /// </summary>
+    template <arithmetic_vector TVector>
+    constexpr TVector& operator+=(TVector& lhs, const TVector& rhs) noexcept {
+        return lhs = lhs + rhs;
+    }
+
+    /// <summary>
+    /// Subtracts <paramref name="rhs" /> from <paramref name="lhs" />.
+    /// </summary>
+    template <arithmetic_vector TVector>
+    constexpr TVector& operator-=(TVector& lhs, const TVector& rhs) noexcept {
+        return lhs = lhs - rhs;
+    }
+
+    /// <summary>
+    /// Multiplies <paramref name="lhs" /> component-wise with <paramref name="rhs" />.
+    /// </summary>
+    template <arithmetic_vector TVector>
+    constexpr TVector& operator*=(TVector& lhs, const TVector& rhs) noexcept {
+        return lhs = lhs * rhs;
+    }
+
+    /// <summary>
+    /// Divides <paramref name="lhs" /> component-wise by <paramref name="rhs" />.
+    /// </summary>
+    template <arithmetic_vector TVector>
+    constexpr TVector& operator/=(TVector& lhs, const TVector& rhs) noexcept {
+        return lhs = lhs / rhs;
+    }
+
+    /// <summary>
+    /// Scales <paramref name="lhs" /> by <paramref name="rhs" />.
+    /// </summary>
+    template <arithmetic_vector TVector>
+    constexpr TVector& operator*=(TVector& lhs, typename TVector::scalar_type rhs) noexcept {
+        return lhs = lhs * rhs;
+    }
+
+    /// <summary>
+    /// Divides each component of <paramref name="lhs" /> by <paramref name="rhs" />.
+    /// </summary>
+    template <arithmetic_vector TVector>
+    constexpr TVector& operator/=(TVector& lhs, typename TVector::scalar_type rhs) noexcept {
+        return lhs = lhs / rhs;
+    }
+
+    /// <summary>
+    /// Computes the dot product of two vectors.
+    /// </summary>
+    /// <param name="lhs">The left operand.</param>
+    /// <param name="rhs">The right operand.</param>
+    /// <returns>The dot product of <paramref name="lhs" /> and <paramref name="rhs" />.</returns>
+    template <arithmetic_vector TVector>
+    constexpr typename TVector::scalar_type dot(const TVector& lhs, const TVector& rhs) noexcept {
+        if !consteval {
+            if constexpr (details::simd_vector<TVector>)
+                return SIMD::dot(details::load(lhs), details::load(rhs));
+        }
+
+        typename TVector::scalar_type result{ 0 };
+
+        for (unsigned i{ 0 }; i < TVector::vec_size; ++i)
+            result += lhs[i] * rhs[i];
+
+        return result;
+    }
+
+    /// <summary>
+    /// Computes the cross product of two three-dimensional vectors.
+    /// </summary>
+    /// <param name="lhs">The left operand.</param>
+    /// <param name="rhs">The right operand.</param>
+    /// <returns>The cross product of <paramref name="lhs" /> and <paramref name="rhs" />.</returns>
+    template <arithmetic_vector TVector> requires (TVector::vec_size == 3)
+    constexpr TVector cross(const TVector& lhs, const TVector& rhs) noexcept {
+        TVector result;
+
+        if !consteval {
+            if constexpr (details::simd_vector<TVector>) {
+                details::store(result, SIMD::cross(details::load(lhs), details::load(rhs)));
+                return result;
+            }
+        }
+
+        result[0] = lhs[1] * rhs[2] - lhs[2] * rhs[1];
+        result[1] = lhs[2] * rhs[0] - lhs[0] * rhs[2];
+        result[2] = lhs[0] * rhs[1] - lhs[1] * rhs[0];
+
+        return result;
+    }
+
+    /// <summary>
+    /// Returns the euclidean length of a vector.
+    /// </summary>
+    /// <param name="v">The vector to compute the length of.</param>
+    /// <returns>The length of the vector.</returns>
+    template <arithmetic_vector TVector> requires std::floating_point<typename TVector::scalar_type>
+    inline typename TVector::scalar_type length(const TVector& v) noexcept {
+        return std::sqrt(dot(v, v));
+    }
+
+    /// <summary>
+    /// Returns a vector that points into the same direction as <paramref name="v" />, but has a length of one.
+    /// </summary>
+    /// <remarks>
+    /// If the vector has a length of zero, the result is undefined.
+    /// </remarks>
+    /// <param name="v">The vector to normalize.</param>
+    /// <returns>The normalized vector.</returns>
+    template <arithmetic_vector TVector> requires std::floating_point<typename TVector::scalar_type>
+    inline TVector normalize(const TVector& v) noexcept {
+        return v / length(v);
+    }
+#pragma endregion
+
 }
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include <litefx/math.hpp>
+
+using namespace LiteFX::Math;
+
+// ------------------------------------------------------------------------------------------------
+// Bounding box.
+// ------------------------------------------------------------------------------------------------
+
+BoundingBox::BoundingBox(const Vector3f& minimum, const Vector3f& maximum) noexcept :
+	m_minimum(minimum), m_maximum(maximum)
+{
+}
+
+const Vector3f& BoundingBox::minimum() const noexcept
+{
+	return m_minimum;
+}
+
+const Vector3f& BoundingBox::maximum() const noexcept
+{
+	return m_maximum;
+}
+
+Vector3f BoundingBox::center() const noexcept
+{
+	return (m_minimum + m_maximum) * 0.5f;
+}
+
+Vector3f BoundingBox::extent() const noexcept
+{
+	return (m_maximum - m_minimum) * 0.5f;
+}
+
+bool BoundingBox::contains(const Vector3f& point) const noexcept
+{
+	return point.x() >= m_minimum.x() && point.y() >= m_minimum.y() && point.z() >= m_minimum.z() &&
+		point.x() <= m_maximum.x() && point.y() <= m_maximum.y() && point.z() <= m_maximum.z();
+}
+
+void BoundingBox::extend(const Vector3f& point) noexcept
+{
+	for (unsigned i{ 0 }; i < 3; ++i)
+	{
+		m_minimum[i] = std::min(m_minimum[i], point[i]);
+		m_maximum[i] = std::max(m_maximum[i], point[i]);
+	}
+}
+
+void BoundingBox::extend(const BoundingBox& other) noexcept
+{
+	this->extend(other.minimum());
+	this->extend(other.maximum());
+}
+
+BoundingBox BoundingBox::fromPoints(std::span<const Vector3f> points) noexcept
+{
+	if (points.empty())
+		return BoundingBox{ };
+
+	BoundingBox box(points.front(), points.front());
+
+	for (auto& point : points | std::views::drop(1))
+		box.extend(point);
+
+	return box;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Bounding sphere.
+// ------------------------------------------------------------------------------------------------
+
+BoundingSphere::BoundingSphere(const Vector3f& center, Float radius) noexcept :
+	m_center(center), m_radius(radius)
+{
+}
+
+BoundingSphere::BoundingSphere(const BoundingBox& box) noexcept :
+	m_center(box.center()), m_radius(length(box.extent()))
+{
+}
+
+const Vector3f& BoundingSphere::center() const noexcept
+{
+	return m_center;
+}
+
+Float BoundingSphere::radius() const noexcept
+{
+	return m_radius;
+}
+
+bool BoundingSphere::contains(const Vector3f& point) const noexcept
+{
+	auto distance = point - m_center;
+	return dot(distance, distance) <= m_radius * m_radius;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Frustum.
+// ------------------------------------------------------------------------------------------------
+
+Frustum::Frustum(const planes_type& planes) noexcept :
+	m_planes(planes)
+{
+}
+
+const Frustum::planes_type& Frustum::planes() const noexcept
+{
+	return m_planes;
+}
+
+bool Frustum::intersects(const BoundingBox& box) const noexcept
+{
+	auto center = box.center();
+	auto extent = box.extent();
+
+	return std::ranges::all_of(m_planes, [&](const Vector4f& plane) {
+		auto distance = plane.x() * center.x() + plane.y() * center.y() + plane.z() * center.z() + plane.w();
+		auto radius = std::abs(plane.x()) * extent.x() + std::abs(plane.y()) * extent.y() + std::abs(plane.z()) * extent.z();
+		return distance + radius >= 0.f;
+	});
+}
+
+bool Frustum::intersects(const BoundingSphere& sphere) const noexcept
+{
+	auto& center = sphere.center();
+
+	return std::ranges::all_of(m_planes, [&](const Vector4f& plane) {
+		return plane.x() * center.x() + plane.y() * center.y() + plane.z() * center.z() + plane.w() + sphere.radius() >= 0.f;
+	});
+}
+
+Frustum Frustum::fromMatrix(const TMatrix4<Float>& m) noexcept
+{
+	// Extract the planes from the rows of the matrix (see Gribb & Hartmann, "Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix").
+	auto row = [&m](unsigned r) { return Vector4f(m.at(r, 0), m.at(r, 1), m.at(r, 2), m.at(r, 3)); };
+	auto plane = [](const Vector4f& p) { return Vector4f(p / std::sqrt(p.x() * p.x() + p.y() * p.y() + p.z() * p.z())); };
+
+	return Frustum({
+		plane(row(3) + row(0)),		// Left
+		plane(row(3) - row(0)),		// Right
+		plane(row(3) + row(1)),		// Bottom
+		plane(row(3) - row(1)),		// Top
+		plane(row(2)),				// Near
+		plane(row(3) - row(2))		// Far
+	});
+}
@@ -0,0 +1,262 @@
+#include <litefx/math.hpp>
+#include <litefx/simd.hpp>
+#include <bit>
+#include <cstring>
+
+#if defined(LITEFX_MATH_SIMD_AVX2) && defined(__AVX512F__)
+#define LITEFX_MATH_SIMD_AVX512
+#endif
+
+using namespace LiteFX::Math;
+
+// ------------------------------------------------------------------------------------------------
+// Kernels.
+// ------------------------------------------------------------------------------------------------
+
+namespace {
+
+	/// <summary>
+	/// Implements the kernel for a single object, which is used for the objects that do not fill an entire pack.
+	/// </summary>
+	struct Pack1 {
+		using type = Float;
+		static constexpr size_t width = 1;
+
+		static type load(const Float* p) noexcept { return *p; }
+		static type splat(Float value) noexcept { return value; }
+		static type add(type a, type b) noexcept { return a + b; }
+		static type madd(type a, type b, type c) noexcept { return a * b + c; }
+		static type min(type a, type b) noexcept { return std::min(a, b); }
+		static UInt32 visible(type v) noexcept { return v >= 0.f ? 1 : 0; }
+	};
+
+	/// <summary>
+	/// Implements the kernel using 4-wide registers.
+	/// </summary>
+	struct Pack4 {
+		using type = SIMD::float4;
+		static constexpr size_t width = 4;
+
+		static type load(const Float* p) noexcept { return SIMD::load(p); }
+		static type splat(Float value) noexcept { return SIMD::splat(value); }
+		static type add(type a, type b) noexcept { return SIMD::add(a, b); }
+		static type madd(type a, type b, type c) noexcept { return SIMD::madd(a, b, c); }
+		static type min(type a, type b) noexcept { return SIMD::min(a, b); }
+
+		static UInt32 visible(type v) noexcept
+		{
+#if defined(LITEFX_MATH_SIMD_SSE4)
+			return static_cast<UInt32>(_mm_movemask_ps(_mm_cmpge_ps(v, _mm_setzero_ps())));
+#elif defined(LITEFX_MATH_SIMD_NEON)
+			const uint32x4_t bits = { 1, 2, 4, 8 };
+			return vaddvq_u32(vandq_u32(vcgeq_f32(v, vdupq_n_f32(0.f)), bits));
+#else
+			return (v.v[0] >= 0.f ? 1 : 0) | (v.v[1] >= 0.f ? 2 : 0) | (v.v[2] >= 0.f ? 4 : 0) | (v.v[3] >= 0.f ? 8 : 0);
+#endif
+		}
+	};
+
+#if defined(LITEFX_MATH_SIMD_AVX2)
+	/// <summary>
+	/// Implements the kernel using 8-wide AVX2 registers.
+	/// </summary>
+	struct Pack8 {
+		using type = __m256;
+		static constexpr size_t width = 8;
+
+		static type load(const Float* p) noexcept { return _mm256_loadu_ps(p); }
+		static type splat(Float value) noexcept { return _mm256_set1_ps(value); }
+		static type add(type a, type b) noexcept { return _mm256_add_ps(a, b); }
+		static type madd(type a, type b, type c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+		static type min(type a, type b) noexcept { return _mm256_min_ps(a, b); }
+		static UInt32 visible(type v) noexcept { return static_cast<UInt32>(_mm256_movemask_ps(_mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_GE_OQ))); }
+	};
+#endif
+
+#if defined(LITEFX_MATH_SIMD_AVX512)
+	/// <summary>
+	/// Implements the kernel using 16-wide AVX-512 registers.
+	/// </summary>
+	struct Pack16 {
+		using type = __m512;
+		static constexpr size_t width = 16;
+
+		static type load(const Float* p) noexcept { return _mm512_loadu_ps(p); }
+		static type splat(Float value) noexcept { return _mm512_set1_ps(value); }
+		static type add(type a, type b) noexcept { return _mm512_add_ps(a, b); }
+		static type madd(type a, type b, type c) noexcept { return _mm512_fmadd_ps(a, b, c); }
+		static type min(type a, type b) noexcept { return _mm512_min_ps(a, b); }
+		static UInt32 visible(type v) noexcept { return static_cast<UInt32>(_mm512_cmp_ps_mask(v, _mm512_setzero_ps(), _CMP_GE_OQ)); }
+	};
+#endif
+
+	/// <summary>
+	/// Tests <paramref name="count" /> bounding volumes, starting at <paramref name="offset" />, against the frustum planes and calls <paramref name="emit" /> with
+	/// the index of each visible one. Returns the number of volumes that have been tested, which is the largest multiple of the pack width that fits into
+	/// <paramref name="count" />.
+	/// </summary>
+	/// <remarks>
+	/// A volume is visible, if its signed distance, extended by its projected radius, is not negative for any plane. Instead of testing each plane separately,
+	/// the minimum over all planes is computed and tested once.
+	/// </remarks>
+	template <typename TPack, typename TBounds, typename TEmit>
+	size_t cull(const Frustum& frustum, const TBounds& bounds, size_t offset, size_t count, TEmit& emit) noexcept
+	{
+		using pack = TPack::type;
+		constexpr auto width = TPack::width;
+		constexpr bool isBox = std::is_same_v<TBounds, BoundingBoxComponents>;
+
+		// Broadcast the planes once for all objects.
+		std::array<pack, 6> nx, ny, nz, d, ax, ay, az;
+
+		for (size_t p{ 0 }; p < 6; ++p)
+		{
+			auto& plane = frustum.planes()[p];
+			nx[p] = TPack::splat(plane.x());
+			ny[p] = TPack::splat(plane.y());
+			nz[p] = TPack::splat(plane.z());
+			d[p] = TPack::splat(plane.w());
+			ax[p] = TPack::splat(std::abs(plane.x()));
+			ay[p] = TPack::splat(std::abs(plane.y()));
+			az[p] = TPack::splat(std::abs(plane.z()));
+		}
+
+		size_t i{ 0 };
+
+		for (; i + width <= count; i += width)
+		{
+			auto index = offset + i;
+			pack cx = TPack::load(bounds.CenterX.data() + index), cy = TPack::load(bounds.CenterY.data() + index), cz = TPack::load(bounds.CenterZ.data() + index);
+			pack distance;
+
+			if constexpr (isBox)
+			{
+				pack ex = TPack::load(bounds.ExtentX.data() + index), ey = TPack::load(bounds.ExtentY.data() + index), ez = TPack::load(bounds.ExtentZ.data() + index);
+
+				auto planeDistance = [&](size_t p) {
+					auto projected = TPack::madd(ax[p], ex, TPack::madd(ay[p], ey, TPack::madd(az[p], ez, d[p])));
+					return TPack::madd(nx[p], cx, TPack::madd(ny[p], cy, TPack::madd(nz[p], cz, projected)));
+				};
+
+				distance = planeDistance(0);
+
+				for (size_t p{ 1 }; p < 6; ++p)
+					distance = TPack::min(distance, planeDistance(p));
+			}
+			else
+			{
+				pack r = TPack::load(bounds.Radius.data() + index);
+
+				auto planeDistance = [&](size_t p) {
+					return TPack::madd(nx[p], cx, TPack::madd(ny[p], cy, TPack::madd(nz[p], cz, TPack::add(d[p], r))));
+				};
+
+				distance = planeDistance(0);
+
+				for (size_t p{ 1 }; p < 6; ++p)
+					distance = TPack::min(distance, planeDistance(p));
+			}
+
+			for (auto mask = TPack::visible(distance); mask != 0; mask &= mask - 1)
+				emit(index + std::countr_zero(mask));
+		}
+
+		return i;
+	}
+
+	template <typename TBounds, typename TEmit>
+	void cullBatch(const Frustum& frustum, const TBounds& bounds, size_t offset, size_t count, TEmit& emit)
+	{
+		if (offset + count > bounds.size()) [[unlikely]]
+			throw ArgumentOutOfRangeException("bounds", 0ull, static_cast<unsigned long long>(bounds.size()), static_cast<unsigned long long>(offset + count),
+				"The bounding volumes do not contain enough elements after offset {0}.", offset);
+
+		size_t tested{ 0 };
+
+#if defined(LITEFX_MATH_SIMD_AVX512)
+		tested += cull<Pack16>(frustum, bounds, offset, count, emit);
+#endif
+#if defined(LITEFX_MATH_SIMD_AVX2)
+		tested += cull<Pack8>(frustum, bounds, offset + tested, count - tested, emit);
+#endif
+		tested += cull<Pack4>(frustum, bounds, offset + tested, count - tested, emit);
+		cull<Pack1>(frustum, bounds, offset + tested, count - tested, emit);
+	}
+
+	template <typename TBounds>
+	size_t cullIndices(const Frustum& frustum, const TBounds& bounds, std::span<UInt32> visible, size_t offset, size_t count)
+	{
+		if (visible.size() < count) [[unlikely]]
+			throw ArgumentOutOfRangeException("visible", 0ull, static_cast<unsigned long long>(visible.size()), static_cast<unsigned long long>(count),
+				"The destination must be able to hold an index for each bounding volume.");
+
+		size_t written{ 0 };
+		auto emit = [&](size_t index) { visible[written++] = static_cast<UInt32>(index); };
+		cullBatch(frustum, bounds, offset, count, emit);
+		return written;
+	}
+
+	template <typename TBounds>
+	size_t compactRecords(const Frustum& frustum, const TBounds& bounds, const Byte* source, Byte* destination, size_t stride, size_t count, size_t offset)
+	{
+		if (count > 0 && source == nullptr) [[unlikely]]
+			throw ArgumentNotInitializedException("source", "The source records must be initialized.");
+
+		if (count > 0 && destination == nullptr) [[unlikely]]
+			throw ArgumentNotInitializedException("destination", "The destination must be initialized.");
+
+		size_t written{ 0 };
+		auto emit = [&](size_t index) { std::memcpy(destination + (written++) * stride, source + (index - offset) * stride, stride); };
+		cullBatch(frustum, bounds, offset, count, emit);
+		return written;
+	}
+
+}
+
+// ------------------------------------------------------------------------------------------------
+// Bounding volume components.
+// ------------------------------------------------------------------------------------------------
+
+size_t BoundingSphereComponents::size() const noexcept
+{
+	return std::min({ this->CenterX.size(), this->CenterY.size(), this->CenterZ.size(), this->Radius.size() });
+}
+
+size_t BoundingBoxComponents::size() const noexcept
+{
+	return std::min({ this->CenterX.size(), this->CenterY.size(), this->CenterZ.size(), this->ExtentX.size(), this->ExtentY.size(), this->ExtentZ.size() });
+}
+
+// ------------------------------------------------------------------------------------------------
+// Frustum culling.
+// ------------------------------------------------------------------------------------------------
+
+size_t FrustumCulling::cull(const Frustum& frustum, const BoundingSphereComponents& spheres, std::span<UInt32> visible, size_t offset, size_t count)
+{
+	return cullIndices(frustum, spheres, visible, offset, count);
+}
+
+size_t FrustumCulling::cull(const Frustum& frustum, const BoundingSphereComponents& spheres, std::span<UInt32> visible)
+{
+	return cullIndices(frustum, spheres, visible, 0, spheres.size());
+}
+
+size_t FrustumCulling::cull(const Frustum& frustum, const BoundingBoxComponents& boxes, std::span<UInt32> visible, size_t offset, size_t count)
+{
+	return cullIndices(frustum, boxes, visible, offset, count);
+}
+
+size_t FrustumCulling::cull(const Frustum& frustum, const BoundingBoxComponents& boxes, std::span<UInt32> visible)
+{
+	return cullIndices(frustum, boxes, visible, 0, boxes.size());
+}
+
+size_t FrustumCulling::compact(const Frustum& frustum, const BoundingSphereComponents& spheres, const Byte* source, Byte* destination, size_t stride, size_t count, size_t offset)
+{
+	return compactRecords(frustum, spheres, source, destination, stride, count, offset);
+}
+
+size_t FrustumCulling::compact(const Frustum& frustum, const BoundingBoxComponents& boxes, const Byte* source, Byte* destination, size_t stride, size_t count, size_t offset)
+{
+	return compactRecords(frustum, boxes, source, destination, stride, count, offset);
+}
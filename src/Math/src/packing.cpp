@@ -0,0 +1,379 @@
+#include <litefx/math.hpp>
+#include <litefx/simd.hpp>
+#include <bit>
+
+using namespace LiteFX::Math;
+
+static_assert(sizeof(Vector3f) == 3 * sizeof(Float), "Vectors must be tightly packed.");
+
+// ------------------------------------------------------------------------------------------------
+// Helpers.
+// ------------------------------------------------------------------------------------------------
+
+namespace {
+
+	template <typename TSource, typename TDestination>
+	void validate(std::span<TSource> source, std::span<TDestination> destination, size_t factor = 1)
+	{
+		if (destination.size() < source.size() * factor) [[unlikely]]
+			throw ArgumentOutOfRangeException("destination", 0ull, static_cast<unsigned long long>(destination.size()), static_cast<unsigned long long>(source.size() * factor),
+				"The destination is not large enough to hold all converted values.");
+	}
+
+	inline Float saturate(Float value, Float minimum) noexcept
+	{
+		// NOTE: NaN compares false, so it gets clamped to the minimum, which is the same behavior as the SIMD implementation.
+		return value > minimum ? std::min(value, 1.f) : minimum;
+	}
+
+	inline Float signNotZero(Float value) noexcept
+	{
+		return value >= 0.f ? 1.f : -1.f;
+	}
+
+	/// <summary>
+	/// Maps the vectors onto the octahedron and writes the resulting coordinates into <paramref name="encoded" />.
+	/// </summary>
+	void encodeOctahedral(const Float* normals, Float* encoded, size_t count) noexcept
+	{
+		size_t i{ 0 };
+
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		const auto one = _mm_set1_ps(1.f);
+		const auto signMask = _mm_set1_ps(-0.f);
+
+		for (; i + 4 <= count; i += 4, normals += 12, encoded += 8)
+		{
+			// Transpose from xyz xyz xyz xyz into xxxx yyyy zzzz.
+			auto a = _mm_loadu_ps(normals), b = _mm_loadu_ps(normals + 4), c = _mm_loadu_ps(normals + 8);
+			auto x = _mm_blend_ps(_mm_blend_ps(a, b, 0b0100), c, 0b0010);
+			auto y = _mm_blend_ps(_mm_blend_ps(a, b, 0b1001), c, 0b0100);
+			auto z = _mm_blend_ps(_mm_blend_ps(a, b, 0b0010), c, 0b1001);
+			x = _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 2, 3, 0));
+			y = _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+			z = _mm_shuffle_ps(z, z, _MM_SHUFFLE(3, 0, 1, 2));
+
+			// Project onto the octahedron.
+			auto norm = _mm_add_ps(_mm_add_ps(_mm_andnot_ps(signMask, x), _mm_andnot_ps(signMask, y)), _mm_andnot_ps(signMask, z));
+			x = _mm_div_ps(x, norm);
+			y = _mm_div_ps(y, norm);
+
+			// Fold the lower hemisphere over the diagonals.
+			auto foldedX = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, y)), _mm_or_ps(_mm_and_ps(x, signMask), one));
+			auto foldedY = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, x)), _mm_or_ps(_mm_and_ps(y, signMask), one));
+			auto lower = _mm_cmplt_ps(z, _mm_setzero_ps());
+			x = _mm_blendv_ps(x, foldedX, lower);
+			y = _mm_blendv_ps(y, foldedY, lower);
+
+			_mm_storeu_ps(encoded, _mm_unpacklo_ps(x, y));
+			_mm_storeu_ps(encoded + 4, _mm_unpackhi_ps(x, y));
+		}
+#endif
+
+		for (; i < count; ++i, normals += 3, encoded += 2)
+		{
+			auto norm = std::abs(normals[0]) + std::abs(normals[1]) + std::abs(normals[2]);
+			auto x = normals[0] / norm, y = normals[1] / norm;
+
+			if (normals[2] < 0.f)
+			{
+				auto foldedX = (1.f - std::abs(y)) * signNotZero(x);
+				y = (1.f - std::abs(x)) * signNotZero(y);
+				x = foldedX;
+			}
+
+			encoded[0] = x;
+			encoded[1] = y;
+		}
+	}
+
+	/// <summary>
+	/// Maps the coordinates on the octahedron back onto the unit sphere.
+	/// </summary>
+	void decodeOctahedral(const Float* encoded, Float* normals, size_t count) noexcept
+	{
+		size_t i{ 0 };
+
+#if defined(LITEFX_MATH_SIMD_SSE4)
+		const auto one = _mm_set1_ps(1.f);
+		const auto signMask = _mm_set1_ps(-0.f);
+
+		for (; i + 4 <= count; i += 4, encoded += 8, normals += 12)
+		{
+			auto lo = _mm_loadu_ps(encoded), hi = _mm_loadu_ps(encoded + 4);
+			auto x = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+			auto y = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+			auto z = _mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, x)), _mm_andnot_ps(signMask, y));
+
+			// Unfold the lower hemisphere.
+			auto t = _mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), z), _mm_setzero_ps());
+			x = _mm_sub_ps(x, _mm_or_ps(t, _mm_and_ps(x, signMask)));
+			y = _mm_sub_ps(y, _mm_or_ps(t, _mm_and_ps(y, signMask)));
+
+			auto length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+			x = _mm_div_ps(x, length);
+			y = _mm_div_ps(y, length);
+			z = _mm_div_ps(z, length);
+
+			// Transpose from xxxx yyyy zzzz into xyz xyz xyz xyz.
+			x = _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 2, 3, 0));
+			y = _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+			z = _mm_shuffle_ps(z, z, _MM_SHUFFLE(3, 0, 1, 2));
+			_mm_storeu_ps(normals, _mm_blend_ps(_mm_blend_ps(x, y, 0b0010), z, 0b0100));
+			_mm_storeu_ps(normals + 4, _mm_blend_ps(_mm_blend_ps(y, z, 0b0010), x, 0b0100));
+			_mm_storeu_ps(normals + 8, _mm_blend_ps(_mm_blend_ps(z, x, 0b0010), y, 0b0100));
+		}
+#endif
+
+		for (; i < count; ++i, encoded += 2, normals += 3)
+		{
+			auto x = encoded[0], y = encoded[1];
+			auto z = 1.f - std::abs(x) - std::abs(y);
+			auto t = std::max(-z, 0.f);
+			x -= std::copysign(t, x);
+			y -= std::copysign(t, y);
+
+			auto length = std::sqrt(x * x + y * y + z * z);
+			normals[0] = x / length;
+			normals[1] = y / length;
+			normals[2] = z / length;
+		}
+	}
+
+}
+
+// ------------------------------------------------------------------------------------------------
+// Half precision.
+// ------------------------------------------------------------------------------------------------
+
+UInt16 Packing::toHalf(Float value) noexcept
+{
+	// Round to nearest even, including denormals, infinity and NaN (see Fabian Giesen, "float->half variants").
+	constexpr UInt32 infinity = 255u << 23;
+	constexpr UInt32 overflow = (127u + 16u) << 23;
+	constexpr UInt32 denormalMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+	auto bits = std::bit_cast<UInt32>(value);
+	auto sign = bits & 0x80000000u;
+	bits ^= sign;
+	UInt32 result{ 0 };
+
+	if (bits >= overflow)
+		result = bits > infinity ? 0x7E00u : 0x7C00u;
+	else if (bits < (113u << 23))
+		result = std::bit_cast<UInt32>(std::bit_cast<Float>(bits) + std::bit_cast<Float>(denormalMagic)) - denormalMagic;
+	else
+		result = (bits + ((15u - 127u) << 23) + 0xFFFu + ((bits >> 13) & 1u)) >> 13;
+
+	return static_cast<UInt16>(result | (sign >> 16));
+}
+
+Float Packing::fromHalf(UInt16 value) noexcept
+{
+	constexpr UInt32 exponentMask = 0x7C00u << 13;
+	constexpr UInt32 magic = 113u << 23;
+
+	auto bits = static_cast<UInt32>(value & 0x7FFFu) << 13;
+	auto exponent = bits & exponentMask;
+	bits += (127u - 15u) << 23;
+
+	if (exponent == exponentMask)
+		bits += (128u - 16u) << 23;		// Infinity or NaN.
+	else if (exponent == 0)
+		bits = std::bit_cast<UInt32>(std::bit_cast<Float>(bits + (1u << 23)) - std::bit_cast<Float>(magic));	// Denormal.
+
+	return std::bit_cast<Float>(bits | (static_cast<UInt32>(value & 0x8000u) << 16));
+}
+
+void Packing::toHalf(std::span<const Float> source, std::span<UInt16> destination)
+{
+	validate(source, destination);
+	size_t i{ 0 };
+
+#if defined(LITEFX_MATH_SIMD_F16C)
+	for (; i + 8 <= source.size(); i += 8)
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i), _mm256_cvtps_ph(_mm256_loadu_ps(source.data() + i), _MM_FROUND_TO_NEAREST_INT));
+#elif defined(LITEFX_MATH_SIMD_NEON)
+	for (; i + 4 <= source.size(); i += 4)
+		vst1_u16(destination.data() + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(source.data() + i))));
+#endif
+
+	for (; i < source.size(); ++i)
+		destination[i] = toHalf(source[i]);
+}
+
+void Packing::fromHalf(std::span<const UInt16> source, std::span<Float> destination)
+{
+	validate(source, destination);
+	size_t i{ 0 };
+
+#if defined(LITEFX_MATH_SIMD_F16C)
+	for (; i + 8 <= source.size(); i += 8)
+		_mm256_storeu_ps(destination.data() + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i))));
+#elif defined(LITEFX_MATH_SIMD_NEON)
+	for (; i + 4 <= source.size(); i += 4)
+		vst1q_f32(destination.data() + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(source.data() + i))));
+#endif
+
+	for (; i < source.size(); ++i)
+		destination[i] = fromHalf(source[i]);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Normalized integers.
+// ------------------------------------------------------------------------------------------------
+
+void Packing::toUnorm8(std::span<const Float> source, std::span<Byte> destination)
+{
+	validate(source, destination);
+	size_t i{ 0 };
+
+#if defined(LITEFX_MATH_SIMD_SSE4)
+	const auto zero = _mm_setzero_ps(), one = _mm_set1_ps(1.f), scale = _mm_set1_ps(255.f);
+	auto convert = [&](const Float* p) { return _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(p), zero), one), scale)); };
+
+	for (; i + 16 <= source.size(); i += 16)
+	{
+		auto lo = _mm_packs_epi32(convert(source.data() + i), convert(source.data() + i + 4));
+		auto hi = _mm_packs_epi32(convert(source.data() + i + 8), convert(source.data() + i + 12));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i), _mm_packus_epi16(lo, hi));
+	}
+#endif
+
+	for (; i < source.size(); ++i)
+		destination[i] = static_cast<Byte>(std::nearbyint(saturate(source[i], 0.f) * 255.f));
+}
+
+void Packing::fromUnorm8(std::span<const Byte> source, std::span<Float> destination)
+{
+	validate(source, destination);
+	constexpr Float scale = 1.f / 255.f;
+	size_t i{ 0 };
+
+#if defined(LITEFX_MATH_SIMD_SSE4)
+	for (; i + 16 <= source.size(); i += 16)
+	{
+		auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i));
+		_mm_storeu_ps(destination.data() + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(values)), _mm_set1_ps(scale)));
+		_mm_storeu_ps(destination.data() + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(values, 4))), _mm_set1_ps(scale)));
+		_mm_storeu_ps(destination.data() + i + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(values, 8))), _mm_set1_ps(scale)));
+		_mm_storeu_ps(destination.data() + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(values, 12))), _mm_set1_ps(scale)));
+	}
+#endif
+
+	for (; i < source.size(); ++i)
+		destination[i] = static_cast<Float>(source[i]) * scale;
+}
+
+void Packing::toUnorm16(std::span<const Float> source, std::span<UInt16> destination)
+{
+	validate(source, destination);
+	size_t i{ 0 };
+
+#if defined(LITEFX_MATH_SIMD_SSE4)
+	const auto zero = _mm_setzero_ps(), one = _mm_set1_ps(1.f), scale = _mm_set1_ps(65535.f);
+	auto convert = [&](const Float* p) { return _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(p), zero), one), scale)); };
+
+	for (; i + 8 <= source.size(); i += 8)
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i), _mm_packus_epi32(convert(source.data() + i), convert(source.data() + i + 4)));
+#endif
+
+	for (; i < source.size(); ++i)
+		destination[i] = static_cast<UInt16>(std::nearbyint(saturate(source[i], 0.f) * 65535.f));
+}
+
+void Packing::fromUnorm16(std::span<const UInt16> source, std::span<Float> destination)
+{
+	validate(source, destination);
+	constexpr Float scale = 1.f / 65535.f;
+	size_t i{ 0 };
+
+#if defined(LITEFX_MATH_SIMD_SSE4)
+	for (; i + 8 <= source.size(); i += 8)
+	{
+		auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i));
+		_mm_storeu_ps(destination.data() + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu16_epi32(values)), _mm_set1_ps(scale)));
+		_mm_storeu_ps(destination.data() + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_srli_si128(values, 8))), _mm_set1_ps(scale)));
+	}
+#endif
+
+	for (; i < source.size(); ++i)
+		destination[i] = static_cast<Float>(source[i]) * scale;
+}
+
+void Packing::toSnorm16(std::span<const Float> source, std::span<Int16> destination)
+{
+	validate(source, destination);
+	size_t i{ 0 };
+
+#if defined(LITEFX_MATH_SIMD_SSE4)
+	const auto minimum = _mm_set1_ps(-1.f), one = _mm_set1_ps(1.f), scale = _mm_set1_ps(32767.f);
+	auto convert = [&](const Float* p) { return _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(p), minimum), one), scale)); };
+
+	for (; i + 8 <= source.size(); i += 8)
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(destination.data() + i), _mm_packs_epi32(convert(source.data() + i), convert(source.data() + i + 4)));
+#endif
+
+	for (; i < source.size(); ++i)
+		destination[i] = static_cast<Int16>(std::nearbyint(saturate(source[i], -1.f) * 32767.f));
+}
+
+void Packing::fromSnorm16(std::span<const Int16> source, std::span<Float> destination)
+{
+	validate(source, destination);
+	constexpr Float scale = 1.f / 32767.f;
+	size_t i{ 0 };
+
+#if defined(LITEFX_MATH_SIMD_SSE4)
+	const auto minimum = _mm_set1_ps(-1.f);
+
+	for (; i + 8 <= source.size(); i += 8)
+	{
+		auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + i));
+		_mm_storeu_ps(destination.data() + i, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(values)), _mm_set1_ps(scale)), minimum));
+		_mm_storeu_ps(destination.data() + i + 4, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(values, 8))), _mm_set1_ps(scale)), minimum));
+	}
+#endif
+
+	// NOTE: -32768 maps to a value slightly below -1, so it gets clamped, as required by the graphics APIs.
+	for (; i < source.size(); ++i)
+		destination[i] = std::max(static_cast<Float>(source[i]) * scale, -1.f);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Octahedral encoding.
+// ------------------------------------------------------------------------------------------------
+
+void Packing::encodeOctahedral(std::span<const Vector3f> normals, std::span<Int16> destination)
+{
+	validate(normals, destination, 2);
+
+	// Encode the vectors in blocks, so that the intermediate values stay in the cache.
+	constexpr size_t BLOCK_SIZE = 256;
+	std::array<Float, 2 * BLOCK_SIZE> encoded;
+
+	for (size_t i{ 0 }; i < normals.size(); i += BLOCK_SIZE)
+	{
+		auto count = std::min(BLOCK_SIZE, normals.size() - i);
+		::encodeOctahedral(normals[i].elements(), encoded.data(), count);
+		toSnorm16(std::span(encoded).first(2 * count), destination.subspan(2 * i, 2 * count));
+	}
+}
+
+void Packing::decodeOctahedral(std::span<const Int16> source, std::span<Vector3f> normals)
+{
+	if (normals.size() * 2 < source.size()) [[unlikely]]
+		throw ArgumentOutOfRangeException("normals", 0ull, static_cast<unsigned long long>(normals.size()), static_cast<unsigned long long>(source.size() / 2),
+			"The destination is not large enough to hold all decoded vectors.");
+
+	constexpr size_t BLOCK_SIZE = 256;
+	std::array<Float, 2 * BLOCK_SIZE> encoded;
+	auto count = source.size() / 2;
+
+	for (size_t i{ 0 }; i < count; i += BLOCK_SIZE)
+	{
+		auto block = std::min(BLOCK_SIZE, count - i);
+		fromSnorm16(source.subspan(2 * i, 2 * block), encoded);
+		::decodeOctahedral(encoded.data(), normals[i].elements(), block);
+	}
+}
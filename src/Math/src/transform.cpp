@@ -0,0 +1,259 @@
+#include <litefx/math.hpp>
+#include <litefx/simd.hpp>
+#include <cstring>
+
+#if defined(LITEFX_MATH_SIMD_AVX2) && defined(__AVX512F__)
+#define LITEFX_MATH_SIMD_AVX512
+#endif
+
+using namespace LiteFX::Math;
+
+// ------------------------------------------------------------------------------------------------
+// Kernels.
+// ------------------------------------------------------------------------------------------------
+
+namespace {
+
+	/// <summary>
+	/// Implements the kernel using 4-wide registers.
+	/// </summary>
+	struct Pack4 {
+		using type = SIMD::float4;
+		static constexpr size_t width = 4;
+
+		static type load(const Float* p) noexcept { return SIMD::load(p); }
+		static type splat(Float value) noexcept { return SIMD::splat(value); }
+		static type add(type a, type b) noexcept { return SIMD::add(a, b); }
+		static type sub(type a, type b) noexcept { return SIMD::sub(a, b); }
+		static type mul(type a, type b) noexcept { return SIMD::mul(a, b); }
+
+		static void store(type a, type b, type c, type d, Byte* destination, size_t stride) noexcept
+		{
+			SIMD::transpose(a, b, c, d);
+			SIMD::store(reinterpret_cast<Float*>(destination), a);
+			SIMD::store(reinterpret_cast<Float*>(destination + stride), b);
+			SIMD::store(reinterpret_cast<Float*>(destination + 2 * stride), c);
+			SIMD::store(reinterpret_cast<Float*>(destination + 3 * stride), d);
+		}
+	};
+
+#if defined(LITEFX_MATH_SIMD_AVX2)
+	/// <summary>
+	/// Implements the kernel using 8-wide AVX2 registers.
+	/// </summary>
+	struct Pack8 {
+		using type = __m256;
+		static constexpr size_t width = 8;
+
+		static type load(const Float* p) noexcept { return _mm256_loadu_ps(p); }
+		static type splat(Float value) noexcept { return _mm256_set1_ps(value); }
+		static type add(type a, type b) noexcept { return _mm256_add_ps(a, b); }
+		static type sub(type a, type b) noexcept { return _mm256_sub_ps(a, b); }
+		static type mul(type a, type b) noexcept { return _mm256_mul_ps(a, b); }
+
+		static void store(type a, type b, type c, type d, Byte* destination, size_t stride) noexcept
+		{
+			// Transpose within each 128 bit lane, so that the lower lanes contain the rows of the first four instances and the upper lanes the ones of the next four.
+			auto t0 = _mm256_unpacklo_ps(a, b);
+			auto t1 = _mm256_unpackhi_ps(a, b);
+			auto t2 = _mm256_unpacklo_ps(c, d);
+			auto t3 = _mm256_unpackhi_ps(c, d);
+
+			const __m256 rows[4] = {
+				_mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)),
+				_mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2)),
+				_mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)),
+				_mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2))
+			};
+
+			for (size_t i{ 0 }; i < 4; ++i)
+			{
+				_mm_storeu_ps(reinterpret_cast<Float*>(destination + i * stride), _mm256_castps256_ps128(rows[i]));
+				_mm_storeu_ps(reinterpret_cast<Float*>(destination + (i + 4) * stride), _mm256_extractf128_ps(rows[i], 1));
+			}
+		}
+	};
+#endif
+
+#if defined(LITEFX_MATH_SIMD_AVX512)
+	/// <summary>
+	/// Implements the kernel using 16-wide AVX-512 registers.
+	/// </summary>
+	struct Pack16 {
+		using type = __m512;
+		static constexpr size_t width = 16;
+
+		static type load(const Float* p) noexcept { return _mm512_loadu_ps(p); }
+		static type splat(Float value) noexcept { return _mm512_set1_ps(value); }
+		static type add(type a, type b) noexcept { return _mm512_add_ps(a, b); }
+		static type sub(type a, type b) noexcept { return _mm512_sub_ps(a, b); }
+		static type mul(type a, type b) noexcept { return _mm512_mul_ps(a, b); }
+
+		static void store(type a, type b, type c, type d, Byte* destination, size_t stride) noexcept
+		{
+			// Same as for AVX2, but with four 128 bit lanes per register.
+			auto t0 = _mm512_unpacklo_ps(a, b);
+			auto t1 = _mm512_unpackhi_ps(a, b);
+			auto t2 = _mm512_unpacklo_ps(c, d);
+			auto t3 = _mm512_unpackhi_ps(c, d);
+
+			const __m512 rows[4] = {
+				_mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)),
+				_mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2)),
+				_mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)),
+				_mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2))
+			};
+
+			for (size_t i{ 0 }; i < 4; ++i)
+			{
+				_mm_storeu_ps(reinterpret_cast<Float*>(destination + i * stride), _mm512_castps512_ps128(rows[i]));
+				_mm_storeu_ps(reinterpret_cast<Float*>(destination + (i + 4) * stride), _mm512_extractf32x4_ps(rows[i], 1));
+				_mm_storeu_ps(reinterpret_cast<Float*>(destination + (i + 8) * stride), _mm512_extractf32x4_ps(rows[i], 2));
+				_mm_storeu_ps(reinterpret_cast<Float*>(destination + (i + 12) * stride), _mm512_extractf32x4_ps(rows[i], 3));
+			}
+		}
+	};
+#endif
+
+	/// <summary>
+	/// Composes <paramref name="count" /> transforms, starting at <paramref name="offset" />. Returns the number of transforms that have been composed, which is
+	/// the largest multiple of the pack width that fits into <paramref name="count" />.
+	/// </summary>
+	template <typename TPack>
+	size_t compose(const TransformComponents& components, size_t offset, size_t count, Byte* destination, size_t stride, bool homogeneous) noexcept
+	{
+		using pack = TPack::type;
+		constexpr auto width = TPack::width;
+		const auto one = TPack::splat(1.f);
+		const std::array<Float, 4> lastRow = { 0.f, 0.f, 0.f, 1.f };
+
+		size_t i{ 0 };
+
+		for (; i + width <= count; i += width, destination += width * stride)
+		{
+			auto index = offset + i;
+			pack qx = TPack::load(components.RotationX.data() + index), qy = TPack::load(components.RotationY.data() + index),
+				qz = TPack::load(components.RotationZ.data() + index), qw = TPack::load(components.RotationW.data() + index);
+			pack sx = TPack::load(components.ScaleX.data() + index), sy = TPack::load(components.ScaleY.data() + index),
+				sz = TPack::load(components.ScaleZ.data() + index);
+
+			pack x2 = TPack::add(qx, qx), y2 = TPack::add(qy, qy), z2 = TPack::add(qz, qz);
+			pack xx = TPack::mul(qx, x2), yy = TPack::mul(qy, y2), zz = TPack::mul(qz, z2);
+			pack xy = TPack::mul(qx, y2), xz = TPack::mul(qx, z2), yz = TPack::mul(qy, z2);
+			pack wx = TPack::mul(qw, x2), wy = TPack::mul(qw, y2), wz = TPack::mul(qw, z2);
+
+			// Compute each row for all instances and transpose them into the destination.
+			TPack::store(
+				TPack::mul(TPack::sub(one, TPack::add(yy, zz)), sx),
+				TPack::mul(TPack::sub(xy, wz), sy),
+				TPack::mul(TPack::add(xz, wy), sz),
+				TPack::load(components.TranslationX.data() + index),
+				destination, stride);
+
+			TPack::store(
+				TPack::mul(TPack::add(xy, wz), sx),
+				TPack::mul(TPack::sub(one, TPack::add(xx, zz)), sy),
+				TPack::mul(TPack::sub(yz, wx), sz),
+				TPack::load(components.TranslationY.data() + index),
+				destination + 4 * sizeof(Float), stride);
+
+			TPack::store(
+				TPack::mul(TPack::sub(xz, wy), sx),
+				TPack::mul(TPack::add(yz, wx), sy),
+				TPack::mul(TPack::sub(one, TPack::add(xx, yy)), sz),
+				TPack::load(components.TranslationZ.data() + index),
+				destination + 8 * sizeof(Float), stride);
+
+			if (homogeneous)
+				for (size_t j{ 0 }; j < width; ++j)
+					std::memcpy(destination + j * stride + 12 * sizeof(Float), lastRow.data(), sizeof(lastRow));
+		}
+
+		return i;
+	}
+
+	/// <summary>
+	/// Composes the remaining transforms that do not fill an entire pack.
+	/// </summary>
+	void composeScalar(const TransformComponents& components, size_t offset, size_t count, Byte* destination, size_t stride, bool homogeneous) noexcept
+	{
+		for (size_t i{ offset }; i < offset + count; ++i, destination += stride)
+		{
+			Float qx = components.RotationX[i], qy = components.RotationY[i], qz = components.RotationZ[i], qw = components.RotationW[i];
+			Float sx = components.ScaleX[i], sy = components.ScaleY[i], sz = components.ScaleZ[i];
+
+			Float x2 = qx + qx, y2 = qy + qy, z2 = qz + qz;
+			Float xx = qx * x2, yy = qy * y2, zz = qz * z2;
+			Float xy = qx * y2, xz = qx * z2, yz = qy * z2;
+			Float wx = qw * x2, wy = qw * y2, wz = qw * z2;
+
+			const std::array<Float, 16> matrix = {
+				(1.f - (yy + zz)) * sx, (xy - wz) * sy, (xz + wy) * sz, components.TranslationX[i],
+				(xy + wz) * sx, (1.f - (xx + zz)) * sy, (yz - wx) * sz, components.TranslationY[i],
+				(xz - wy) * sx, (yz + wx) * sy, (1.f - (xx + yy)) * sz, components.TranslationZ[i],
+				0.f, 0.f, 0.f, 1.f
+			};
+
+			std::memcpy(destination, matrix.data(), (homogeneous ? 16 : 12) * sizeof(Float));
+		}
+	}
+
+	void composeBatch(const TransformComponents& components, size_t offset, size_t count, Byte* destination, size_t stride, bool homogeneous)
+	{
+		if (offset + count > components.size()) [[unlikely]]
+			throw ArgumentOutOfRangeException("components", 0ull, static_cast<unsigned long long>(components.size()), static_cast<unsigned long long>(offset + count),
+				"The components do not contain enough transforms after offset {0}.", offset);
+
+		size_t composed{ 0 };
+
+#if defined(LITEFX_MATH_SIMD_AVX512)
+		composed += compose<Pack16>(components, offset, count, destination, stride, homogeneous);
+#endif
+#if defined(LITEFX_MATH_SIMD_AVX2)
+		composed += compose<Pack8>(components, offset + composed, count - composed, destination + composed * stride, stride, homogeneous);
+#endif
+		composed += compose<Pack4>(components, offset + composed, count - composed, destination + composed * stride, stride, homogeneous);
+		composeScalar(components, offset + composed, count - composed, destination + composed * stride, stride, homogeneous);
+	}
+
+}
+
+// ------------------------------------------------------------------------------------------------
+// Transform components.
+// ------------------------------------------------------------------------------------------------
+
+size_t TransformComponents::size() const noexcept
+{
+	return std::min({
+		this->TranslationX.size(), this->TranslationY.size(), this->TranslationZ.size(),
+		this->RotationX.size(), this->RotationY.size(), this->RotationZ.size(), this->RotationW.size(),
+		this->ScaleX.size(), this->ScaleY.size(), this->ScaleZ.size()
+	});
+}
+
+// ------------------------------------------------------------------------------------------------
+// Transform batch.
+// ------------------------------------------------------------------------------------------------
+
+void TransformBatch::compose(const TransformComponents& components, std::span<TMatrix3x4<Float>> transforms, size_t offset)
+{
+	static_assert(sizeof(TMatrix3x4<Float>) == 12 * sizeof(Float), "Transform matrices must be tightly packed.");
+	composeBatch(components, offset, transforms.size(), reinterpret_cast<Byte*>(transforms.data()), sizeof(TMatrix3x4<Float>), false);
+}
+
+void TransformBatch::compose(const TransformComponents& components, std::span<TMatrix4<Float>> transforms, size_t offset)
+{
+	static_assert(sizeof(TMatrix4<Float>) == 16 * sizeof(Float), "Transform matrices must be tightly packed.");
+	composeBatch(components, offset, transforms.size(), reinterpret_cast<Byte*>(transforms.data()), sizeof(TMatrix4<Float>), true);
+}
+
+void TransformBatch::compose(const TransformComponents& components, Byte* destination, size_t stride, size_t count, size_t offset)
+{
+	if (stride < 12 * sizeof(Float) || stride % sizeof(Float) != 0) [[unlikely]]
+		throw ArgumentOutOfRangeException("stride", "The stride must be a multiple of 4 and large enough to contain a 3x4 matrix.");
+
+	if (destination == nullptr && count > 0) [[unlikely]]
+		throw ArgumentNotInitializedException("destination", "The destination must be initialized.");
+
+	composeBatch(components, offset, count, destination, stride, false);
+}
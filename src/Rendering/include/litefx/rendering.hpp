@@ -574,6 +574,12 @@ namespace LiteFX::Rendering {
         /// <inheritdoc />
         virtual void bind(const descriptor_set_type& descriptorSet, const pipeline_type& pipeline) const noexcept = 0;
 
+        /// <inheritdoc />
+        virtual void bind(const descriptor_set_type& descriptorSet, Span<const UInt32> dynamicOffsets) const = 0;
+
+        /// <inheritdoc />
+        virtual void bind(const descriptor_set_type& descriptorSet, Span<const UInt32> dynamicOffsets, const pipeline_type& pipeline) const noexcept = 0;
+
         /// <inheritdoc />
         virtual void bind(Span<const descriptor_set_type*> descriptorSets, const pipeline_type& pipeline) const noexcept = 0;
 
@@ -638,6 +644,9 @@ namespace LiteFX::Rendering {
         /// <inheritdoc />
         virtual void buildAccelerationStructure(top_level_acceleration_structure_type& tlas, const SharedPtr<const buffer_type> scratchBuffer, const buffer_type& buffer, UInt64 offset = 0) const = 0;
 
+        /// <inheritdoc />
+        virtual void buildAccelerationStructures(Span<bottom_level_acceleration_structure_type* const> blas, const SharedPtr<const buffer_type> scratchBuffer, Span<const UInt64> scratchOffsets, const SharedPtr<const buffer_type> buffer, Span<const UInt64> offsets) const = 0;
+
         /// <inheritdoc />
         virtual void updateAccelerationStructure(bottom_level_acceleration_structure_type& blas, const SharedPtr<const buffer_type> scratchBuffer, const buffer_type& buffer, UInt64 offset = 0) const = 0;
 
@@ -736,6 +745,14 @@ namespace LiteFX::Rendering {
             this->bind(dynamic_cast<const descriptor_set_type&>(descriptorSet), dynamic_cast<const pipeline_type&>(pipeline));
         }
 
+        inline void cmdBind(const IDescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets) const override {
+            this->bind(dynamic_cast<const descriptor_set_type&>(descriptorSet), dynamicOffsets);
+        }
+
+        inline void cmdBind(const IDescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets, const IPipeline& pipeline) const noexcept override {
+            this->bind(dynamic_cast<const descriptor_set_type&>(descriptorSet), dynamicOffsets, dynamic_cast<const pipeline_type&>(pipeline));
+        }
+
         inline void cmdBind(Span<const IDescriptorSet*> descriptorSets, const IPipeline& pipeline) const noexcept override {
             auto sets = descriptorSets | std::views::transform([](auto set) { return dynamic_cast<const descriptor_set_type*>(set); }) | std::ranges::to<Array<const descriptor_set_type*>>();
             this->bind(Span<const descriptor_set_type*>(sets), dynamic_cast<const pipeline_type&>(pipeline));
@@ -809,6 +826,11 @@ namespace LiteFX::Rendering {
             this->buildAccelerationStructure(dynamic_cast<top_level_acceleration_structure_type&>(tlas), std::dynamic_pointer_cast<const buffer_type>(scratchBuffer), dynamic_cast<const buffer_type&>(buffer), offset);
         }
 
+        void cmdBuildAccelerationStructures(Span<IBottomLevelAccelerationStructure* const> blas, const SharedPtr<const IBuffer> scratchBuffer, Span<const UInt64> scratchOffsets, const SharedPtr<const IBuffer> buffer, Span<const UInt64> offsets) const override {
+            auto accelerationStructures = blas | std::views::transform([](IBottomLevelAccelerationStructure* as) { return &dynamic_cast<bottom_level_acceleration_structure_type&>(*as); }) | std::ranges::to<Array<bottom_level_acceleration_structure_type*>>();
+            this->buildAccelerationStructures(accelerationStructures, std::dynamic_pointer_cast<const buffer_type>(scratchBuffer), scratchOffsets, std::dynamic_pointer_cast<const buffer_type>(buffer), offsets);
+        }
+
         void cmdUpdateAccelerationStructure(IBottomLevelAccelerationStructure& blas, const SharedPtr<const IBuffer> scratchBuffer, const IBuffer& buffer, UInt64 offset) const override {
             this->updateAccelerationStructure(dynamic_cast<bottom_level_acceleration_structure_type&>(blas), std::dynamic_pointer_cast<const buffer_type>(scratchBuffer), dynamic_cast<const buffer_type&>(buffer), offset);
         }
@@ -332,6 +332,11 @@ namespace LiteFX::Rendering {
     /// <summary>
     /// Describes a buffer attribute format.
     /// </summary>
+    /// <remarks>
+    /// The suffix of each format describes the data type of its channels: <c>F</c> for floating point, <c>I</c> for signed integer and <c>U</c> for unsigned
+    /// integer values. Formats with the <c>SN</c> or <c>UN</c> suffix store signed or unsigned normalized integers, that are converted into floating point 
+    /// values in the range <c>[-1, 1]</c> or <c>[0, 1]</c> when read by a shader.
+    /// </remarks>
     /// <seealso cref="getBufferFormatChannels" />
     /// <seealso cref="getBufferFormatChannelSize" />
     /// <seealso cref="getBufferFormatType" />
@@ -360,7 +365,23 @@ namespace LiteFX::Rendering {
         XYZ32U = 0x20000403,
         XYZW32F = 0x20000104,
         XYZW32I = 0x20000204,
-        XYZW32U = 0x20000404
+        XYZW32U = 0x20000404,
+        X8SN = 0x08000801,
+        XY8SN = 0x08000802,
+        XYZ8SN = 0x08000803,
+        XYZW8SN = 0x08000804,
+        X8UN = 0x08001001,
+        XY8UN = 0x08001002,
+        XYZ8UN = 0x08001003,
+        XYZW8UN = 0x08001004,
+        X16SN = 0x10000801,
+        XY16SN = 0x10000802,
+        XYZ16SN = 0x10000803,
+        XYZW16SN = 0x10000804,
+        X16UN = 0x10001001,
+        XY16UN = 0x10001002,
+        XYZ16UN = 0x10001003,
+        XYZW16UN = 0x10001004
     };
 
     /// <summary>
@@ -529,7 +550,35 @@ namespace LiteFX::Rendering {
         /// <summary>
         /// Represents a ray-tracing acceleration structure.
         /// </summary>
-        AccelerationStructure = 0x00000008
+        AccelerationStructure = 0x00000008,
+
+        /// <summary>
+        /// A uniform buffer, whose offset is provided when binding the descriptor set (dynamic uniform buffer).
+        /// </summary>
+        /// <remarks>
+        /// In shaders, dynamic uniform buffers are declared like <see cref="ConstantBuffer" />. Unlike regular constant buffers, the offset of the buffer within its backend resource
+        /// (see <see cref="IBuffer::offset" />) is not baked into the descriptor. Instead, it is provided as a dynamic offset when binding the descriptor set (see 
+        /// <see cref="ICommandBuffer::bind" />). This allows to re-bind the same descriptor set with different per-draw constants, without updating or allocating descriptor sets.
+        /// 
+        /// Dynamic descriptors are currently only supported by the Vulkan backend. They cannot be used within unbounded descriptor arrays.
+        /// </remarks>
+        DynamicConstantBuffer = 0x00000009,
+
+        /// <summary>
+        /// A read-only storage buffer, whose offset is provided when binding the descriptor set (dynamic storage buffer).
+        /// </summary>
+        /// <remarks>
+        /// In shaders, dynamic storage buffers are declared like <see cref="StructuredBuffer" />. See <see cref="DynamicConstantBuffer" /> for how dynamic offsets are applied.
+        /// </remarks>
+        DynamicStructuredBuffer = 0x0000000A,
+
+        /// <summary>
+        /// A writable storage buffer, whose offset is provided when binding the descriptor set (dynamic storage buffer).
+        /// </summary>
+        /// <remarks>
+        /// In shaders, dynamic storage buffers are declared like <see cref="RWStructuredBuffer" />. See <see cref="DynamicConstantBuffer" /> for how dynamic offsets are applied.
+        /// </remarks>
+        RWDynamicStructuredBuffer = 0x0000001A
     };
 
     /// <summary>
@@ -731,6 +780,19 @@ namespace LiteFX::Rendering {
         /// <seealso cref="IAccelerationStructure" />
         AccelerationStructureBuildInput = 0x0100,
 
+        /// <summary>
+        /// Allows the resource to be accessed concurrently by all queues, without transferring ownership between them.
+        /// </summary>
+        /// <remarks>
+        /// By default, vertex and index buffers are owned by a single queue family at a time and the engine transfers ownership when the buffer is used by a queue of another 
+        /// family. This allows the driver to keep the buffer in the most efficient state for the owning queue (e.g., compressed), but requires two barriers for each transfer. 
+        /// If a buffer is frequently accessed by queues of different families, it should be created with this flag instead. Buffers that can be bound to descriptors are 
+        /// always shared concurrently, since their accesses can not be tracked.
+        /// 
+        /// This flag is only evaluated by backends that distinguish between exclusive and concurrent resource sharing (i.e., Vulkan). Other backends ignore it.
+        /// </remarks>
+        Concurrent = 0x0200,
+
         /// <summary>
         /// Shortcut for commonly used `TransferSource | TransferDestination` combination.
         /// </summary>
@@ -743,6 +805,29 @@ namespace LiteFX::Rendering {
         FrameBufferImage = TransferSource | RenderTarget,
     };
 
+    /// <summary>
+    /// Describes how a <see cref="BufferSuballocator" /> places allocations within a memory range.
+    /// </summary>
+    /// <seealso cref="BufferSuballocator" />
+    enum class LITEFX_RENDERING_API BufferArenaPolicy {
+        /// <summary>
+        /// Allocations are placed one after another and can only be released all at once by resetting the allocator.
+        /// </summary>
+        /// <remarks>
+        /// This policy has the lowest overhead and is intended for data that is only valid for a single frame, such as per-object constants. 
+        /// </remarks>
+        Linear = 0x01,
+
+        /// <summary>
+        /// Allocations are placed using a two-level segregated fit (TLSF) free list and can be released individually.
+        /// </summary>
+        /// <remarks>
+        /// This policy finds a suitable free range in constant time and merges adjacent free ranges when allocations are released. It is intended for long-lived data, such as
+        /// the vertex and index buffers of individual meshes.
+        /// </remarks>
+        FreeList = 0x02
+    };
+
     /// <summary>
     /// Describes the element type of an index buffer.
     /// </summary>
@@ -1044,6 +1129,39 @@ namespace LiteFX::Rendering {
         Volatile = 0x04
     };
 
+    /// <summary>
+    /// Describes how a render pass records the commands that are issued between beginning and ending it.
+    /// </summary>
+    /// <remarks>
+    /// Note that the recording mode is currently only respected by the Vulkan backend. Other backends always record into the command buffers they expose.
+    /// </remarks>
+    /// <seealso cref="IRenderPass" />
+    enum class LITEFX_RENDERING_API RenderPassRecordingMode {
+        /// <summary>
+        /// Commands are recorded directly into the primary command buffer of the render pass.
+        /// </summary>
+        /// <remarks>
+        /// In this mode, the render pass does not allocate any secondary command buffers. Instead, the primary command buffer is returned as the only command buffer
+        /// of the render pass. This avoids the overhead of executing secondary command buffers for single-threaded render passes, but prevents recording commands from 
+        /// multiple threads.
+        /// </remarks>
+        Inline = 0x01,
+
+        /// <summary>
+        /// Commands are recorded into secondary command buffers, which are executed by the primary command buffer when the render pass ends.
+        /// </summary>
+        Secondary = 0x02,
+
+        /// <summary>
+        /// Commands are recorded into secondary command buffers, if more than one command buffer has been requested, or directly into the primary command buffer
+        /// otherwise.
+        /// </summary>
+        /// <remarks>
+        /// The actual mode is selected when the render pass is built and does not change afterwards.
+        /// </remarks>
+        Parallel = 0x03
+    };
+
     /// <summary>
     /// Describes the dimensions of a image resource, i.e. the dimensions that are required to access a texel or describe the image extent.
     /// </summary>
@@ -2053,14 +2171,61 @@ namespace LiteFX::Rendering {
         const String& name() const noexcept override;
     };
 
+    /// <summary>
+    /// A handle that refers to a resource stored within a <see cref="DeviceState" />.
+    /// </summary>
+    /// <remarks>
+    /// A handle stores the index of the slot that contains the resource, as well as the generation of the slot at the time the resource has been added. 
+    /// Each time a resource is released, the generation of its slot is increased. This way, a handle to a released resource can never resolve another 
+    /// resource that later re-uses the same slot. Default-initialized handles are invalid.
+    /// </remarks>
+    /// <typeparam name="TResource">The type of the resource referred to by the handle.</typeparam>
+    /// <seealso cref="DeviceState" />
+    template <typename TResource>
+    struct StateHandle {
+    public:
+        /// <summary>
+        /// The index of the slot that stores the resource.
+        /// </summary>
+        UInt32 index{ std::numeric_limits<UInt32>::max() };
+
+        /// <summary>
+        /// The generation of the slot at the time the resource has been added.
+        /// </summary>
+        UInt32 generation{ 0 };
+
+    public:
+        /// <summary>
+        /// Returns <c>true</c>, if the handle has been returned by a device state and <c>false</c>, if it is default-initialized.
+        /// </summary>
+        /// <remarks>
+        /// Note that a valid handle may still refer to a resource that has already been released.
+        /// </remarks>
+        /// <returns><c>true</c>, if the handle has been returned by a device state and <c>false</c>, if it is default-initialized.</returns>
+        constexpr bool valid() const noexcept {
+            return this->index != std::numeric_limits<UInt32>::max();
+        }
+
+        /// <summary>
+        /// Compares two handles for equality.
+        /// </summary>
+        constexpr bool operator==(const StateHandle&) const noexcept = default;
+    };
+
     /// <summary>
     /// A class that can be used to manage the state of a <see cref="IGraphicsDevice" />.
     /// </summary>
     /// <remarks>
     /// The device state makes managing resources created by a device easier, since you do not have to worry about storage and release order. Note,
-    /// however, that this is not free. Requesting a resource requires a lookup within a hash-map. Also device states are not specialized for the 
-    /// concrete device, so you can only work with interfaces. This implies potentially inefficient upcasting of the state resource when its passed to 
-    /// another object. You have to decide if or to which degree you want to rely on storing resources in a device state.
+    /// however, that this is not free. Requesting a resource by its identifier requires a lookup within a hash-map. If you need to access a resource 
+    /// frequently, store the <see cref="StateHandle" /> returned by <see cref="add" /> instead, which resolves the resource with a single array access.
+    /// Also device states are not specialized for the concrete device, so you can only work with interfaces. This implies potentially inefficient 
+    /// upcasting of the state resource when its passed to another object. You have to decide if or to which degree you want to rely on storing 
+    /// resources in a device state.
+    /// 
+    /// All methods of the device state are thread-safe. Multiple threads can resolve resources concurrently, whilst adding or releasing resources of a
+    /// type blocks resolving resources of the same type for the duration of the change. Note that this does not extend to the lifetime of a resource: 
+    /// releasing a resource invalidates all references to it, even those that have been obtained by another thread.
     /// </remarks>
     /// <seealso cref="StateResource" />
     /// <seealso cref="IGraphicsDevice" />
@@ -2087,144 +2252,163 @@ namespace LiteFX::Rendering {
         /// Adds a new render pass to the device state and uses its name as identifier.
         /// </summary>
         /// <param name="renderPass">The render pass to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the render pass.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another render pass with the same identifier has already been added.</exception>
-        void add(UniquePtr<IRenderPass>&& renderPass);
+        StateHandle<IRenderPass> add(UniquePtr<IRenderPass>&& renderPass);
 
         /// <summary>
         /// Adds a new render pass to the device state.
         /// </summary>
         /// <param name="id">The identifier for the render pass.</param>
         /// <param name="renderPass">The render pass to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the render pass.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another render pass with the same <paramref name="id" /> has already been added.</exception>
-        void add(const String& id, UniquePtr<IRenderPass>&& renderPass);
+        StateHandle<IRenderPass> add(const String& id, UniquePtr<IRenderPass>&& renderPass);
 
         /// <summary>
         /// Adds a new frame buffer to the device state and uses its name as identifier.
         /// </summary>
         /// <param name="frameBuffer">The render pass to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the render pass.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another frame buffer with the same identifier has already been added.</exception>
-        void add(UniquePtr<IFrameBuffer>&& frameBuffer);
+        StateHandle<IFrameBuffer> add(UniquePtr<IFrameBuffer>&& frameBuffer);
 
         /// <summary>
         /// Adds a new frame buffer to the device state.
         /// </summary>
         /// <param name="id">The identifier for the frame buffer.</param>
         /// <param name="renderPass">The frame buffer to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the frame buffer.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another frame buffer with the same <paramref name="id" /> has already been added.</exception>
-        void add(const String& id, UniquePtr<IFrameBuffer>&& frameBuffer);
+        StateHandle<IFrameBuffer> add(const String& id, UniquePtr<IFrameBuffer>&& frameBuffer);
 
         /// <summary>
         /// Adds a new pipeline to the device state and uses its name as identifier.
         /// </summary>
         /// <param name="pipeline">The pipeline to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the pipeline.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another pipeline with the same identifier has already been added.</exception>
-        void add(UniquePtr<IPipeline>&& pipeline);
+        StateHandle<IPipeline> add(UniquePtr<IPipeline>&& pipeline);
 
         /// <summary>
         /// Adds a new pipeline to the device state.
         /// </summary>
         /// <param name="id">The identifier for the pipeline.</param>
         /// <param name="pipeline">The pipeline to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the pipeline.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another pipeline with the same <paramref name="id" /> has already been added.</exception>
-        void add(const String& id, UniquePtr<IPipeline>&& pipeline);
+        StateHandle<IPipeline> add(const String& id, UniquePtr<IPipeline>&& pipeline);
 
         /// <summary>
         /// Adds a new buffer to the device state and uses its name as identifier.
         /// </summary>
         /// <param name="buffer">The buffer to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the buffer.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another buffer with the same identifier has already been added.</exception>
-        void add(UniquePtr<IBuffer>&& buffer);
+        StateHandle<IBuffer> add(UniquePtr<IBuffer>&& buffer);
 
         /// <summary>
         /// Adds a new buffer to the device state.
         /// </summary>
         /// <param name="id">The identifier for the buffer.</param>
         /// <param name="buffer">The buffer to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the buffer.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another buffer with the same <paramref name="id" /> has already been added.</exception>
-        void add(const String& id, UniquePtr<IBuffer>&& buffer);
+        StateHandle<IBuffer> add(const String& id, UniquePtr<IBuffer>&& buffer);
 
         /// <summary>
         /// Adds a new vertex buffer to the device state and uses its name as identifier.
         /// </summary>
         /// <param name="vertexBuffer">The vertex buffer to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the vertex buffer.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another vertex buffer with the same identifier has already been added.</exception>
-        void add(UniquePtr<IVertexBuffer>&& vertexBuffer);
+        StateHandle<IVertexBuffer> add(UniquePtr<IVertexBuffer>&& vertexBuffer);
 
         /// <summary>
         /// Adds a new vertex buffer to the device state.
         /// </summary>
         /// <param name="id">The identifier for the vertex buffer.</param>
         /// <param name="vertexBuffer">The vertex buffer to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the vertex buffer.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another vertex buffer with the same <paramref name="id" /> has already been added.</exception>
-        void add(const String& id, UniquePtr<IVertexBuffer>&& vertexBuffer);
+        StateHandle<IVertexBuffer> add(const String& id, UniquePtr<IVertexBuffer>&& vertexBuffer);
 
         /// <summary>
         /// Adds a new index buffer to the device state and uses its name as identifier.
         /// </summary>
         /// <param name="indexBuffer">The index buffer to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the index buffer.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another index buffer with the same identifier has already been added.</exception>
-        void add(UniquePtr<IIndexBuffer>&& indexBuffer);
+        StateHandle<IIndexBuffer> add(UniquePtr<IIndexBuffer>&& indexBuffer);
 
         /// <summary>
         /// Adds a new index buffer to the device state.
         /// </summary>
         /// <param name="id">The identifier for the index buffer.</param>
         /// <param name="indexBuffer">The index buffer to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the index buffer.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another index buffer with the same <paramref name="id" /> has already been added.</exception>
-        void add(const String& id, UniquePtr<IIndexBuffer>&& indexBuffer);
+        StateHandle<IIndexBuffer> add(const String& id, UniquePtr<IIndexBuffer>&& indexBuffer);
 
         /// <summary>
         /// Adds a new image to the device state and uses its name as identifier.
         /// </summary>
         /// <param name="image">The image to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the image.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another image with the same identifier has already been added.</exception>
-        void add(UniquePtr<IImage>&& image);
+        StateHandle<IImage> add(UniquePtr<IImage>&& image);
 
         /// <summary>
         /// Adds a new image to the device state.
         /// </summary>
         /// <param name="id">The identifier for the image.</param>
         /// <param name="image">The image to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the image.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another image with the same <paramref name="id" /> has already been added.</exception>
-        void add(const String& id, UniquePtr<IImage>&& image);
+        StateHandle<IImage> add(const String& id, UniquePtr<IImage>&& image);
 
         /// <summary>
         /// Adds a new sampler to the device state and uses its name as identifier.
         /// </summary>
         /// <param name="sampler">The sampler to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the sampler.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another sampler with the same identifier has already been added.</exception>
-        void add(UniquePtr<ISampler>&& sampler);
+        StateHandle<ISampler> add(UniquePtr<ISampler>&& sampler);
 
         /// <summary>
         /// Adds a new sampler to the device state.
         /// </summary>
         /// <param name="id">The identifier for the sampler.</param>
         /// <param name="sampler">The sampler to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the sampler.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another sampler with the same <paramref name="id" /> has already been added.</exception>
-        void add(const String& id, UniquePtr<ISampler>&& sampler);
+        StateHandle<ISampler> add(const String& id, UniquePtr<ISampler>&& sampler);
 
         /// <summary>
         /// Adds a new acceleration structure to the device state and uses its name as identifier.
         /// </summary>
         /// <param name="accelerationStructure">The acceleration structure to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the acceleration structure.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another acceleration structure with the same <paramref name="id" /> has already been added.</exception>
-        void add(UniquePtr<IAccelerationStructure>&& accelerationStructure);
+        StateHandle<IAccelerationStructure> add(UniquePtr<IAccelerationStructure>&& accelerationStructure);
 
         /// <summary>
         /// Adds a new acceleration structure to the device state.
         /// </summary>
         /// <param name="id">The identifier for the acceleration structure.</param>
         /// <param name="accelerationStructure">The acceleration structure to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the acceleration structure.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another acceleration structure with the same <paramref name="id" /> has already been added.</exception>
-        void add(const String& id, UniquePtr<IAccelerationStructure>&& accelerationStructure);
+        StateHandle<IAccelerationStructure> add(const String& id, UniquePtr<IAccelerationStructure>&& accelerationStructure);
         
         /// <summary>
         /// Adds a new descriptor set to the device state.
         /// </summary>
         /// <param name="id">The identifier for the descriptor set.</param>
         /// <param name="sampler">The descriptor set to add to the device state.</param>
+        /// <returns>A handle that can be used to resolve or release the descriptor set.</returns>
         /// <exception cref="InvalidArgumentException">Thrown, if another descriptor set with the same <paramref name="id" /> has already been added.</exception>
-        void add(const String& id, UniquePtr<IDescriptorSet>&& descriptorSet);
+        StateHandle<IDescriptorSet> add(const String& id, UniquePtr<IDescriptorSet>&& descriptorSet);
 
         /// <summary>
         /// Returns a render pass from the device state.
@@ -2367,12 +2551,65 @@ namespace LiteFX::Rendering {
         /// <returns><c>true</c>, if the sampler was properly released, <c>false</c> otherwise.</returns>
         bool release(const ISampler& sampler);
 
+        /// <summary>
+        /// Releases an acceleration structure.
+        /// </summary>
+        /// <param name="accelerationStructure">The acceleration structure to release.</param>
+        /// <returns><c>true</c>, if the acceleration structure was properly released, <c>false</c> otherwise.</returns>
+        bool release(const IAccelerationStructure& accelerationStructure);
+
         /// <summary>
         /// Releases a descriptor set.
         /// </summary>
         /// <param name="descriptorSet">The descriptor set to release.</param>
         /// <returns><c>true</c>, if the descriptor set was properly released, <c>false</c> otherwise.</returns>
         bool release(const IDescriptorSet& descriptorSet);
+
+    public:
+        /// <summary>
+        /// Returns a handle for the resource associated with <paramref name="id" />.
+        /// </summary>
+        /// <remarks>
+        /// Use this method to resolve the handle once and use it to access the resource afterwards, which avoids hashing the identifier on each access.
+        /// </remarks>
+        /// <typeparam name="TResource">The type of the resource. Must be one of the resource types that can be added to the device state.</typeparam>
+        /// <param name="id">The identifier associated with the resource.</param>
+        /// <returns>A handle for the resource, or an invalid handle, if no resource of type <typeparamref name="TResource" /> has been added for the 
+        /// provided <paramref name="id" />.</returns>
+        template <typename TResource>
+        StateHandle<TResource> handle(StringView id) const;
+
+        /// <summary>
+        /// Returns a resource from the device state.
+        /// </summary>
+        /// <typeparam name="TResource">The type of the resource. Must be one of the resource types that can be added to the device state.</typeparam>
+        /// <param name="handle">The handle returned when the resource has been added.</param>
+        /// <returns>A reference of the resource.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="handle" /> does not refer to a resource managed by the device state.</exception>
+        template <typename TResource>
+        TResource& get(StateHandle<TResource> handle) const;
+
+        /// <summary>
+        /// Returns <c>true</c>, if <paramref name="handle" /> refers to a resource managed by the device state.
+        /// </summary>
+        /// <typeparam name="TResource">The type of the resource. Must be one of the resource types that can be added to the device state.</typeparam>
+        /// <param name="handle">The handle to check.</param>
+        /// <returns><c>true</c>, if <paramref name="handle" /> refers to a resource managed by the device state and <c>false</c>, if the resource has 
+        /// been released or the handle is invalid.</returns>
+        template <typename TResource>
+        bool contains(StateHandle<TResource> handle) const;
+
+        /// <summary>
+        /// Releases a resource using its handle.
+        /// </summary>
+        /// <remarks>
+        /// After this method has been executed, all references to the resource, as well as <paramref name="handle" /> will be invalid.
+        /// </remarks>
+        /// <typeparam name="TResource">The type of the resource. Must be one of the resource types that can be added to the device state.</typeparam>
+        /// <param name="handle">The handle of the resource to release.</param>
+        /// <returns><c>true</c>, if the resource was properly released, <c>false</c> if the handle does not refer to a resource managed by the device state.</returns>
+        template <typename TResource>
+        bool release(StateHandle<TResource> handle);
     };
 
     /// <summary>
@@ -2468,6 +2705,174 @@ namespace LiteFX::Rendering {
         UInt32 Space { 0 };
     };
 
+    /// <summary>
+    /// Provides read-only access to the contents of a file that is mapped into memory.
+    /// </summary>
+    /// <remarks>
+    /// Mapping a file avoids copying its contents into a separate buffer. The operating system only loads the pages that are actually accessed and is free to evict them again,
+    /// since they are backed by the file. The mapped memory starts at a page boundary, so it is suitably aligned for any data type, which allows shader bytecode to be passed to
+    /// the driver directly. The file stays mapped for the lifetime of the instance.
+    /// </remarks>
+    class LITEFX_RENDERING_API MappedFile final {
+        LITEFX_IMPLEMENTATION(MappedFileImpl);
+
+    public:
+        /// <summary>
+        /// Maps the file <paramref name="fileName" /> into memory.
+        /// </summary>
+        /// <param name="fileName">The name of the file to map.</param>
+        /// <exception cref="RuntimeException">Thrown, if the file could not be opened or mapped.</exception>
+        explicit MappedFile(const String& fileName);
+        MappedFile(MappedFile&&) = delete;
+        MappedFile(const MappedFile&) = delete;
+        virtual ~MappedFile() noexcept;
+
+    public:
+        /// <summary>
+        /// Returns the name of the mapped file.
+        /// </summary>
+        /// <returns>The name of the mapped file.</returns>
+        const String& fileName() const noexcept;
+
+        /// <summary>
+        /// Returns the contents of the mapped file.
+        /// </summary>
+        /// <returns>The contents of the mapped file.</returns>
+        Span<const std::byte> data() const noexcept;
+
+        /// <summary>
+        /// Returns the size of the mapped file in bytes.
+        /// </summary>
+        /// <returns>The size of the mapped file in bytes.</returns>
+        size_t size() const noexcept;
+    };
+
+    /// <summary>
+    /// Describes a shader module that is stored in a <see cref="ShaderArchive" />.
+    /// </summary>
+    struct LITEFX_RENDERING_API ShaderArchiveEntry final {
+        /// <summary>
+        /// The unique name of the shader module within the archive.
+        /// </summary>
+        String Name;
+
+        /// <summary>
+        /// The name of the shader module entry point.
+        /// </summary>
+        String EntryPoint;
+
+        /// <summary>
+        /// The shader stage of the module, or <see cref="ShaderStage::Other" />, if the module is a shader library (i.e., a ray-tracing module).
+        /// </summary>
+        ShaderStage Stage { ShaderStage::Other };
+
+        /// <summary>
+        /// The hash of the uncompressed shader bytecode.
+        /// </summary>
+        /// <remarks>
+        /// The hash is computed using <see cref="LiteFX::hash" />, so it can be used to look up cached reflection results without hashing the bytecode again.
+        /// </remarks>
+        UInt64 Hash { 0 };
+
+        /// <summary>
+        /// The offset of the shader bytecode from the beginning of the archive in bytes.
+        /// </summary>
+        UInt64 Offset { 0 };
+
+        /// <summary>
+        /// The size of the shader bytecode as stored in the archive in bytes.
+        /// </summary>
+        UInt64 Size { 0 };
+
+        /// <summary>
+        /// The size of the uncompressed shader bytecode in bytes.
+        /// </summary>
+        UInt64 UncompressedSize { 0 };
+
+        /// <summary>
+        /// `true`, if the shader bytecode is LZ4-compressed, otherwise `false`.
+        /// </summary>
+        bool Compressed { false };
+    };
+
+    /// <summary>
+    /// Provides access to a packed shader archive that contains the bytecode of multiple shader modules.
+    /// </summary>
+    /// <remarks>
+    /// Shader archives are created at build time by the `ADD_SHADER_ARCHIVE` function of the shader build script. They store an index of all contained shader modules,
+    /// followed by the bytecode of each module and an optional block of precomputed reflection data. The whole archive is mapped into memory using a single
+    /// <see cref="MappedFile" />, so loading a module from an archive does not open another file. Uncompressed modules are returned as a view into the mapped archive,
+    /// whilst compressed modules are decompressed into a buffer owned by the archive the first time they are requested.
+    ///
+    /// Shader program builders can load modules directly from an archive by their name. Modules that have been loaded from an archive keep the archive alive as long as
+    /// they require access to its contents.
+    /// </remarks>
+    /// <seealso cref="ShaderArchiveEntry" />
+    class LITEFX_RENDERING_API ShaderArchive final {
+        LITEFX_IMPLEMENTATION(ShaderArchiveImpl);
+
+    public:
+        /// <summary>
+        /// Opens the shader archive <paramref name="fileName" />.
+        /// </summary>
+        /// <param name="fileName">The name of the archive file.</param>
+        /// <exception cref="RuntimeException">Thrown, if the file could not be mapped or does not contain a valid shader archive.</exception>
+        explicit ShaderArchive(const String& fileName);
+        ShaderArchive(ShaderArchive&&) = delete;
+        ShaderArchive(const ShaderArchive&) = delete;
+        virtual ~ShaderArchive() noexcept;
+
+    public:
+        /// <summary>
+        /// Returns the name of the archive file.
+        /// </summary>
+        /// <returns>The name of the archive file.</returns>
+        const String& fileName() const noexcept;
+
+        /// <summary>
+        /// Returns all shader modules stored in the archive.
+        /// </summary>
+        /// <returns>The shader modules stored in the archive.</returns>
+        const Array<ShaderArchiveEntry>& entries() const noexcept;
+
+        /// <summary>
+        /// Returns `true`, if the archive contains a shader module with the name <paramref name="name" />.
+        /// </summary>
+        /// <param name="name">The name of the shader module.</param>
+        /// <returns>`true`, if the archive contains the shader module, otherwise `false`.</returns>
+        bool contains(const String& name) const noexcept;
+
+        /// <summary>
+        /// Returns the description of the shader module <paramref name="name" />.
+        /// </summary>
+        /// <param name="name">The name of the shader module.</param>
+        /// <returns>The description of the shader module.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if the archive does not contain a shader module with the name <paramref name="name" />.</exception>
+        const ShaderArchiveEntry& entry(const String& name) const;
+
+        /// <summary>
+        /// Returns the uncompressed bytecode of the shader module <paramref name="name" />.
+        /// </summary>
+        /// <remarks>
+        /// The returned memory is aligned to at least 4 bytes and remains valid for the lifetime of the archive.
+        /// </remarks>
+        /// <param name="name">The name of the shader module.</param>
+        /// <returns>The uncompressed bytecode of the shader module.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if the archive does not contain a shader module with the name <paramref name="name" />.</exception>
+        /// <exception cref="RuntimeException">Thrown, if the bytecode of the shader module could not be decompressed.</exception>
+        Span<const std::byte> bytecode(const String& name) const;
+
+        /// <summary>
+        /// Returns the precomputed reflection data stored in the archive.
+        /// </summary>
+        /// <remarks>
+        /// The format of the reflection data depends on the backend the archive has been built for. For Vulkan archives, it can be passed to
+        /// `VulkanShaderProgram::loadReflectionCache`. If the archive does not contain any reflection data, an empty span is returned.
+        /// </remarks>
+        /// <returns>The precomputed reflection data stored in the archive.</returns>
+        Span<const std::byte> reflectionData() const noexcept;
+    };
+
     /// <summary>
     /// Represents a single shader module, i.e. a part of a <see cref="IShaderProgram" />.
     /// </summary>
@@ -3510,6 +3915,81 @@ namespace LiteFX::Rendering {
         virtual IndexType indexType() const noexcept = 0;
     };
 
+    /// <summary>
+    /// Converts vertices into the compact representation described by a vertex buffer layout and back.
+    /// </summary>
+    /// <remarks>
+    /// The vertex compressor maps the members of <see cref="Graphics::Vertex" /> onto the attributes of a vertex buffer layout, based on their semantics. Each 
+    /// attribute can use a format that is smaller than the one of the vertex member, which reduces the memory footprint and bandwidth required to draw the
+    /// vertices. The following semantics and formats are supported:
+    /// 
+    /// <list type="bullet">
+    ///     <item><description><see cref="AttributeSemantic::Position" />: 3 or 4 channels of 32 or 16 bit floating point values.</description></item>
+    ///     <item><description><see cref="AttributeSemantic::Color" />: 3 or 4 channels of 32 or 16 bit floating point values or 8 or 16 bit unsigned normalized integers.</description></item>
+    ///     <item><description><see cref="AttributeSemantic::Normal" />: 3 or 4 channels of 32 or 16 bit floating point values or 16 bit signed normalized integers. If only 2 
+    ///         channels of 16 bit signed normalized integers are provided, the normal is stored using an octahedral encoding, which needs to be decoded in the
+    ///         vertex shader.</description></item>
+    ///     <item><description><see cref="AttributeSemantic::TextureCoordinate" /> with semantic index 0: 2 channels of 32 or 16 bit floating point values or 16 bit 
+    ///         normalized integers.</description></item>
+    /// </list>
+    /// 
+    /// For example, a layout that stores the position as <see cref="BufferFormat::XYZW16F" />, the color as <see cref="BufferFormat::XYZW8UN" />, the normal as
+    /// <see cref="BufferFormat::XY16SN" /> and the texture coordinate as <see cref="BufferFormat::XY16UN" /> requires 20 bytes per vertex, instead of 48.
+    /// </remarks>
+    /// <seealso cref="IVertexBufferLayout" />
+    /// <seealso cref="Packing" />
+    class LITEFX_RENDERING_API VertexCompressor {
+        LITEFX_IMPLEMENTATION(VertexCompressorImpl);
+
+    public:
+        /// <summary>
+        /// Initializes a new vertex compressor for a vertex buffer layout.
+        /// </summary>
+        /// <param name="layout">The layout that describes the compressed vertices.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if the layout contains an attribute with an unsupported semantic or format.</exception>
+        explicit VertexCompressor(const IVertexBufferLayout& layout);
+
+        VertexCompressor(VertexCompressor&&) noexcept;
+        VertexCompressor(const VertexCompressor&);
+        virtual ~VertexCompressor() noexcept;
+
+    public:
+        /// <summary>
+        /// Returns the size of a single compressed vertex in bytes.
+        /// </summary>
+        /// <returns>The size of a single compressed vertex in bytes.</returns>
+        size_t elementSize() const noexcept;
+
+        /// <summary>
+        /// Compresses <paramref name="vertices" /> and writes them into <paramref name="destination" />.
+        /// </summary>
+        /// <remarks>
+        /// The destination can be a mapped vertex buffer. Bytes that are not covered by any attribute are not written.
+        /// </remarks>
+        /// <param name="vertices">The vertices to compress.</param>
+        /// <param name="destination">The destination for the compressed vertices.</param>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="destination" /> is not large enough to hold all vertices.</exception>
+        void compress(std::span<const Graphics::Vertex> vertices, std::span<Byte> destination) const;
+
+        /// <summary>
+        /// Compresses <paramref name="vertices" /> into a new byte array.
+        /// </summary>
+        /// <param name="vertices">The vertices to compress.</param>
+        /// <returns>The compressed vertices.</returns>
+        Array<Byte> compress(std::span<const Graphics::Vertex> vertices) const;
+
+        /// <summary>
+        /// Restores vertices from their compressed representation.
+        /// </summary>
+        /// <remarks>
+        /// Vertex members that are not covered by any attribute are set to their defaults. If the color has no alpha channel, it is set to one.
+        /// </remarks>
+        /// <param name="source">The compressed vertices.</param>
+        /// <param name="vertices">The destination for the restored vertices. Must be able to hold <c>source.size() / elementSize()</c> vertices.</param>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="vertices" /> is not large enough to hold all vertices.</exception>
+        void decompress(std::span<const Byte> source, std::span<Graphics::Vertex> vertices) const;
+    };
+
     /// <summary>
     /// Describes a the layout of a single descriptor within a <see cref="DescriptorSet" />.
     /// </summary>
@@ -3714,6 +4194,16 @@ namespace LiteFX::Rendering {
         /// </summary>
         /// <returns>The type of the buffer.</returns>
         virtual BufferType type() const noexcept = 0;
+
+        /// <summary>
+        /// Returns the offset (in bytes) of the buffer within the backend resource that stores it.
+        /// </summary>
+        /// <remarks>
+        /// Buffers that are created by a graphics factory own their backend resource and always return <c>0</c>. Buffers that are sub-allocated from a larger resource (e.g., 
+        /// by a buffer arena) share the resource with other buffers. All element offsets, that are passed to commands or descriptors, are relative to this offset.
+        /// </remarks>
+        /// <returns>The offset of the buffer within the backend resource.</returns>
+        virtual UInt64 offset() const noexcept = 0;
     };
 
     /// <summary>
@@ -4397,6 +4887,52 @@ namespace LiteFX::Rendering {
             /// </summary>
             InstanceFlags Flags : 8 = InstanceFlags::None;
         };
+
+        /// <summary>
+        /// Stores an instance in the packed layout that is read by the device when building the acceleration structure.
+        /// </summary>
+        /// <remarks>
+        /// The layout matches `VkAccelerationStructureInstanceKHR` and `D3D12_RAYTRACING_INSTANCE_DESC`, so that arrays of packed instances can be written into an instance buffer
+        /// directly, either from the CPU or from a shader. Contrary to <see cref="Instance" />, packed instances do not own a reference to the bottom-level acceleration structure, but 
+        /// store its device address. It is up to the application to keep the bottom-level acceleration structure alive, as long as the instance is in use.
+        /// </remarks>
+        /// <seealso cref="useInstanceBuffer" />
+        struct alignas(16) PackedInstance final {
+            /// <summary>
+            /// The row-major 3x4 transformation matrix for the instance.
+            /// </summary>
+            std::array<Float, 12> Transform;
+
+            /// <summary>
+            /// The instance ID used in shaders to identify the instance.
+            /// </summary>
+            UInt32 Id : 24;
+
+            /// <summary>
+            /// A user-defined mask value that is matched with another mask value during ray-tracing to include or discard the instance.
+            /// </summary>
+            UInt32 Mask : 8;
+
+            /// <summary>
+            /// An offset added to the address of the shader-local data of the shader record that is invoked for the instance.
+            /// </summary>
+            /// <seealso cref="Instance::HitGroupOffset" />
+            UInt32 HitGroupOffset : 24;
+
+            /// <summary>
+            /// The flags that control the behavior of this instance.
+            /// </summary>
+            /// <seealso cref="InstanceFlags" />
+            UInt32 Flags : 8;
+
+            /// <summary>
+            /// The device address of the bottom-level acceleration structure.
+            /// </summary>
+            UInt64 BottomLevelAccelerationStructure;
+        };
+
+        static_assert(sizeof(PackedInstance) == 64, "Packed instances must have the same layout as the native instance descriptions.");
+
     public:
         virtual ~ITopLevelAccelerationStructure() noexcept = default;
 
@@ -4452,17 +4988,112 @@ namespace LiteFX::Rendering {
         virtual bool remove(const Instance& instance) noexcept = 0;
 
         /// <summary>
-        /// Copies the acceleration structure into the acceleration structure provided by <paramref name="destination" />.
+        /// Sets a buffer that contains the instances of the TLAS in packed layout.
         /// </summary>
         /// <remarks>
-        /// This method copies the acceleration structure into another one, which is especially useful for compression. If called without any arguments besides <paramref name="commandBuffer" /> and
-        /// <paramref name="destination" />, the method will create a clone of the current acceleration structure, including any build info (i.e., triangle mesh or bounding box data). If the destination
-        /// acceleration structure already contains a buffer and the buffer contains enough memory to store the copy, it will be re-used and its contents will be overwritten. Otherwise, a new buffer with enough
-        /// memory to store the copy will be allocated.
+        /// If an instance buffer is set, builds and updates read the instances directly from it, instead of converting the instances returned by <see cref="instances" /> into
+        /// a temporary buffer each time. This allows to keep large numbers of instances in a persistent buffer and only update ranges of instances that have changed (for example, by 
+        /// calling <see cref="writeInstances" /> or writing them from a shader), before updating the acceleration structure.
         /// 
-        /// If the <paramref name="compress" /> option is set to `true`, the copy will be compressed. Note that this is only possible, if the acceleration structure was created with the 
-        /// <see cref="AccelerationStructureFlags::AllowCompaction" /> flag enabled. Note that compression requires a query for the size of the compressed data, which can only be determined *after* the 
-        /// acceleration structure was built or updated. This implies that a copy command that is used for compression is not valid on the same command buffer that did also record the build or update commands
+        /// The buffer must store one <see cref="PackedInstance" /> per element without additional padding and must be created with 
+        /// <see cref="ResourceUsage::AccelerationStructureBuildInput" />. The application is responsible for synchronizing writes to the buffer with builds and updates that read it.
+        /// 
+        /// While an instance buffer is set, instances can not be added to the TLAS. Passing `nullptr` removes the instance buffer. Note that updates require the same number of 
+        /// instances that was used to build the acceleration structure.
+        /// </remarks>
+        /// <param name="buffer">The buffer that contains the packed instances, or `nullptr` to use the instances of the TLAS.</param>
+        /// <param name="instances">The number of instances to read from the buffer.</param>
+        /// <param name="firstInstance">The index of the first instance to read from the buffer.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if the elements of <paramref name="buffer" /> are not tightly packed instances.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if the buffer does not contain enough elements.</exception>
+        /// <exception cref="RuntimeException">Thrown, if the TLAS already contains instances.</exception>
+        inline void useInstanceBuffer(SharedPtr<const IBuffer> buffer, UInt32 instances, UInt32 firstInstance = 0) {
+            this->doUseInstanceBuffer(buffer, instances, firstInstance);
+        }
+
+        /// <summary>
+        /// Returns the buffer that contains the packed instances, or `nullptr`, if the instances of the TLAS are used.
+        /// </summary>
+        /// <returns>The buffer that contains the packed instances.</returns>
+        /// <seealso cref="useInstanceBuffer" />
+        inline SharedPtr<const IBuffer> instanceBuffer() const noexcept {
+            return this->getInstanceBuffer();
+        }
+
+        /// <summary>
+        /// Returns the index of the first instance within the instance buffer.
+        /// </summary>
+        /// <returns>The index of the first instance within the instance buffer.</returns>
+        /// <seealso cref="useInstanceBuffer" />
+        virtual UInt32 firstInstance() const noexcept = 0;
+
+        /// <summary>
+        /// Returns the number of instances in the TLAS.
+        /// </summary>
+        /// <returns>The number of instances read from the instance buffer, if one is set, or the number of elements returned by <see cref="instances" /> otherwise.</returns>
+        virtual UInt32 instanceCount() const noexcept = 0;
+
+        /// <summary>
+        /// Packs an instance into the layout that is read by the device.
+        /// </summary>
+        /// <param name="blas">The bottom-level acceleration structure that contains the geometries of the instance. Must have been built before.</param>
+        /// <param name="transform">The transformation matrix applied to the instance geometry.</param>
+        /// <param name="id">The instance ID used in shaders to identify the instance.</param>
+        /// <param name="hitGroupOffset">An offset added to the shader-local data for a hit-group shader record.</param>
+        /// <param name="mask">A user defined mask value that can be used to include or exclude the instance during a ray-tracing pass.</param>
+        /// <param name="flags">The flags that control the behavior of the instance.</param>
+        /// <returns>The packed instance.</returns>
+        static inline PackedInstance pack(const IBottomLevelAccelerationStructure& blas, const TMatrix3x4<Float>& transform, UInt32 id, UInt32 hitGroupOffset = 0, Byte mask = 0xFF, InstanceFlags flags = InstanceFlags::None) noexcept {
+            auto buffer = blas.buffer();
+            PackedInstance instance { 
+                .Id = id, 
+                .Mask = mask, 
+                .HitGroupOffset = hitGroupOffset, 
+                .Flags = static_cast<UInt32>(flags),
+                .BottomLevelAccelerationStructure = buffer == nullptr ? 0ull : buffer->virtualAddress() + blas.offset()
+            };
+
+            std::copy(transform.elements(), transform.elements() + 12, instance.Transform.begin());
+            return instance;
+        }
+
+        /// <summary>
+        /// Packs an instance into the layout that is read by the device.
+        /// </summary>
+        /// <param name="instance">The instance to pack.</param>
+        /// <returns>The packed instance.</returns>
+        static inline PackedInstance pack(const Instance& instance) noexcept {
+            return pack(*instance.BottomLevelAccelerationStructure, instance.Transform, instance.Id, instance.HitGroupOffset, instance.Mask, instance.Flags);
+        }
+
+        /// <summary>
+        /// Writes a range of packed instances into an instance buffer.
+        /// </summary>
+        /// <param name="buffer">The instance buffer to write to.</param>
+        /// <param name="instances">The instances to write.</param>
+        /// <param name="firstInstance">The index of the first instance in the buffer to overwrite.</param>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if the buffer does not contain enough elements.</exception>
+        /// <seealso cref="useInstanceBuffer" />
+        static inline void writeInstances(IBuffer& buffer, Span<const PackedInstance> instances, UInt32 firstInstance = 0) {
+            if (static_cast<UInt64>(firstInstance) + instances.size() > buffer.elements()) [[unlikely]]
+                throw ArgumentOutOfRangeException("instances", 0ull, static_cast<UInt64>(buffer.elements()), static_cast<UInt64>(firstInstance) + instances.size(), "The buffer does not contain enough elements to write {0} instances, starting at instance {1}.", instances.size(), firstInstance);
+
+            if (!instances.empty())
+                buffer.map(instances.data(), instances.size_bytes(), firstInstance);
+        }
+
+        /// <summary>
+        /// Copies the acceleration structure into the acceleration structure provided by <paramref name="destination" />.
+        /// </summary>
+        /// <remarks>
+        /// This method copies the acceleration structure into another one, which is especially useful for compression. If called without any arguments besides <paramref name="commandBuffer" /> and
+        /// <paramref name="destination" />, the method will create a clone of the current acceleration structure, including any build info (i.e., triangle mesh or bounding box data). If the destination
+        /// acceleration structure already contains a buffer and the buffer contains enough memory to store the copy, it will be re-used and its contents will be overwritten. Otherwise, a new buffer with enough
+        /// memory to store the copy will be allocated.
+        /// 
+        /// If the <paramref name="compress" /> option is set to `true`, the copy will be compressed. Note that this is only possible, if the acceleration structure was created with the 
+        /// <see cref="AccelerationStructureFlags::AllowCompaction" /> flag enabled. Note that compression requires a query for the size of the compressed data, which can only be determined *after* the 
+        /// acceleration structure was built or updated. This implies that a copy command that is used for compression is not valid on the same command buffer that did also record the build or update commands
         /// for it. You have to use a fence to wait for the build to finish before attempting a compression.
         /// 
         /// It is possible to provide a buffer for the destination acceleration structure to use after copying. This buffer can be set by providing the <paramref name="buffer" /> parameter. This allows to
@@ -4534,6 +5165,126 @@ namespace LiteFX::Rendering {
 
     private:
         virtual void doCopy(const ICommandBuffer& commandBuffer, ITopLevelAccelerationStructure& destination, bool compress, SharedPtr<const IBuffer> buffer, UInt64 offset, bool copyBuildInfo) const = 0;
+        virtual void doUseInstanceBuffer(SharedPtr<const IBuffer> buffer, UInt32 instances, UInt32 firstInstance) = 0;
+        virtual SharedPtr<const IBuffer> getInstanceBuffer() const noexcept = 0;
+    };
+
+    /// <summary>
+    /// Stores statistics about the memory used by an <see cref="AccelerationStructureBatch" />.
+    /// </summary>
+    struct LITEFX_RENDERING_API AccelerationStructureBatchStatistics final {
+        /// <summary>
+        /// The number of acceleration structures in the batch.
+        /// </summary>
+        UInt32 AccelerationStructures { 0 };
+
+        /// <summary>
+        /// The number of build commands that have been recorded to build the batch.
+        /// </summary>
+        UInt32 BuildCommands { 0 };
+
+        /// <summary>
+        /// The size of the pooled scratch buffer in bytes.
+        /// </summary>
+        UInt64 ScratchMemory { 0 };
+
+        /// <summary>
+        /// The size of the buffer that stores the acceleration structures after building in bytes.
+        /// </summary>
+        UInt64 BuildMemory { 0 };
+
+        /// <summary>
+        /// The size of the buffer that stores the acceleration structures after compaction in bytes, or `0`, if the batch has not been compacted.
+        /// </summary>
+        UInt64 CompactedMemory { 0 };
+
+        /// <summary>
+        /// The amount of memory in bytes that has been saved by compacting the batch.
+        /// </summary>
+        UInt64 MemorySaved { 0 };
+    };
+
+    /// <summary>
+    /// Builds and compacts large sets of bottom-level acceleration structures.
+    /// </summary>
+    /// <remarks>
+    /// Building many bottom-level acceleration structures individually requires a scratch buffer for each build and a build command for each acceleration structure. A batch instead computes 
+    /// the sizes of all acceleration structures once, stores them in a single tightly packed buffer and sub-allocates their scratch memory from one pooled scratch buffer. The acceleration
+    /// structures are then built with as few build commands as possible: if the pooled scratch buffer is large enough to hold the scratch memory of all acceleration structures, a single build 
+    /// command is recorded. Otherwise, the acceleration structures are split into groups that fit into the scratch buffer, which are separated by barriers, as they re-use the same memory.
+    /// 
+    /// After the command buffer that builds the batch has been executed, the batch can be compacted by calling <see cref="compact" />. This copies all acceleration structures into a new, tightly
+    /// packed buffer, using the compacted sizes for acceleration structures that have been created with <see cref="AccelerationStructureFlags::AllowCompaction" />. As compaction creates new 
+    /// acceleration structures, top-level acceleration structures need to be re-built to refer to them. The original acceleration structures are kept alive by the batch, until it is built or
+    /// compacted again, so that the copy commands can safely read them.
+    /// </remarks>
+    /// <seealso cref="ICommandBuffer::buildAccelerationStructures" />
+    /// <seealso cref="AccelerationStructureBatchStatistics" />
+    class LITEFX_RENDERING_API AccelerationStructureBatch final {
+        LITEFX_IMPLEMENTATION(AccelerationStructureBatchImpl);
+
+    public:
+        /// <summary>
+        /// Initializes a new acceleration structure batch.
+        /// </summary>
+        /// <param name="device">The device that is used to compute the acceleration structure sizes and allocate the buffers.</param>
+        /// <param name="maxScratchMemory">The maximum size of the pooled scratch buffer in bytes, or `0` to allocate enough scratch memory to build all acceleration structures at once.</param>
+        explicit AccelerationStructureBatch(const IGraphicsDevice& device, UInt64 maxScratchMemory = 0) noexcept;
+        AccelerationStructureBatch(AccelerationStructureBatch&&) = delete;
+        AccelerationStructureBatch(const AccelerationStructureBatch&) = delete;
+        virtual ~AccelerationStructureBatch() noexcept;
+
+    public:
+        /// <summary>
+        /// Adds a bottom-level acceleration structure to the batch.
+        /// </summary>
+        /// <param name="blas">The bottom-level acceleration structure to add.</param>
+        /// <exception cref="ArgumentNotInitializedException">Thrown, if <paramref name="blas" /> is not initialized.</exception>
+        void add(SharedPtr<IBottomLevelAccelerationStructure> blas);
+
+        /// <summary>
+        /// Removes all acceleration structures from the batch.
+        /// </summary>
+        void clear() noexcept;
+
+        /// <summary>
+        /// Returns the acceleration structures of the batch.
+        /// </summary>
+        /// <remarks>
+        /// Note that after calling <see cref="compact" />, this returns the compacted acceleration structures.
+        /// </remarks>
+        /// <returns>The acceleration structures of the batch.</returns>
+        const Array<SharedPtr<IBottomLevelAccelerationStructure>>& accelerationStructures() const noexcept;
+
+        /// <summary>
+        /// Returns the buffer that stores all acceleration structures of the batch, or `nullptr`, if the batch has not been built yet.
+        /// </summary>
+        /// <returns>The buffer that stores all acceleration structures of the batch.</returns>
+        SharedPtr<const IBuffer> buffer() const noexcept;
+
+        /// <summary>
+        /// Returns the memory statistics of the last build and compaction.
+        /// </summary>
+        /// <returns>The memory statistics of the batch.</returns>
+        const AccelerationStructureBatchStatistics& statistics() const noexcept;
+
+        /// <summary>
+        /// Records the commands to build all acceleration structures of the batch.
+        /// </summary>
+        /// <param name="commandBuffer">The command buffer to record the build commands to.</param>
+        /// <exception cref="RuntimeException">Thrown, if the batch does not contain any acceleration structures.</exception>
+        void build(const ICommandBuffer& commandBuffer);
+
+        /// <summary>
+        /// Records the commands to copy all acceleration structures of the batch into a tightly packed buffer, using their compacted sizes.
+        /// </summary>
+        /// <remarks>
+        /// The compacted sizes are only available after the command buffer that built the batch has been executed. Wait for the fence that has been returned when submitting it, before 
+        /// calling this method.
+        /// </remarks>
+        /// <param name="commandBuffer">The command buffer to record the copy commands to.</param>
+        /// <exception cref="RuntimeException">Thrown, if the batch has not been built.</exception>
+        void compact(const ICommandBuffer& commandBuffer);
     };
 
     /// <summary>
@@ -6356,6 +7107,36 @@ namespace LiteFX::Rendering {
             this->cmdBind(descriptorSet, pipeline);
         }
 
+        /// <summary>
+        /// Binds the provided descriptor set to the last pipeline that was used by the command buffer and provides the offsets of its dynamic descriptors.
+        /// </summary>
+        /// <remarks>
+        /// The descriptor set must provide one offset for each element of each dynamic descriptor (<see cref="DescriptorType::DynamicConstantBuffer" />,
+        /// <see cref="DescriptorType::DynamicStructuredBuffer" /> or <see cref="DescriptorType::RWDynamicStructuredBuffer" />), ordered by their binding. Each offset is added to the
+        /// element offset, the descriptor has been updated with, and needs to be aligned to the offset alignment of the buffer type. For buffers that are sub-allocated from a
+        /// larger resource, the offset must include <see cref="IBuffer::offset" />.
+        /// </remarks>
+        /// <param name="descriptorSet">The descriptor set to bind.</param>
+        /// <param name="dynamicOffsets">The offsets (in bytes) of the dynamic descriptors.</param>
+        /// <exception cref="RuntimeException">Thrown, if no pipeline has been used before attempting to bind the descriptor set, or if the backend does not support dynamic descriptors.</exception>
+        /// <seealso cref="use" />
+        inline void bind(const IDescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets) const {
+            this->cmdBind(descriptorSet, dynamicOffsets);
+        }
+
+        /// <summary>
+        /// Binds the provided descriptor set to the provided pipeline and provides the offsets of its dynamic descriptors.
+        /// </summary>
+        /// <remarks>
+        /// See <see cref="bind(const IDescriptorSet&, Span<const UInt32>)" /> for how dynamic offsets are applied.
+        /// </remarks>
+        /// <param name="descriptorSet">The descriptor set to bind.</param>
+        /// <param name="dynamicOffsets">The offsets (in bytes) of the dynamic descriptors.</param>
+        /// <param name="pipeline">The pipeline to bind the descriptor set to.</param>
+        inline void bind(const IDescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets, const IPipeline& pipeline) const noexcept {
+            this->cmdBind(descriptorSet, dynamicOffsets, pipeline);
+        }
+
         /// <summary>
         /// Binds an arbitrary input range of descriptor sets to the last pipeline that was used by the command buffer.
         /// </summary>
@@ -6761,6 +7542,32 @@ namespace LiteFX::Rendering {
             this->cmdBuildAccelerationStructure(tlas, scratchBuffer, buffer, offset);
         }
 
+        /// <summary>
+        /// Builds a set of bottom-level acceleration structures with as few build commands as possible.
+        /// </summary>
+        /// <remarks>
+        /// Each acceleration structure is written into <paramref name="buffer" /> at the respective element of <paramref name="offsets" /> and uses the scratch memory at the respective element of
+        /// <paramref name="scratchOffsets" /> within <paramref name="scratchBuffer" />. Both offsets must be aligned to 256 bytes and the memory ranges must not overlap, as all acceleration structures
+        /// are built simultaneously. The sizes of each range can be obtained from <see cref="IGraphicsDevice::computeAccelerationStructureSizes" />. After the build, the acceleration structures
+        /// store <paramref name="buffer" /> as their backing buffer and compacted sizes are queried for all acceleration structures that allow compaction, just as with <see cref="IAccelerationStructure::build" />.
+        /// 
+        /// Prefer using <see cref="AccelerationStructureBatch" /> over calling this method directly, as it computes the offsets and allocates the buffers for you.
+        /// 
+        /// This method is only supported if the <see cref="GraphicsDeviceFeature::RayTracing" /> feature is enabled.
+        /// </remarks>
+        /// <param name="blas">The bottom-level acceleration structures to build.</param>
+        /// <param name="scratchBuffer">The scratch buffer to use for building the acceleration structures.</param>
+        /// <param name="scratchOffsets">The offsets into <paramref name="scratchBuffer" /> for each acceleration structure.</param>
+        /// <param name="buffer">The buffer that contains the acceleration structures after the build.</param>
+        /// <param name="offsets">The offsets into <paramref name="buffer" /> at which each acceleration structure gets stored after the build.</param>
+        /// <exception cref="ArgumentNotInitializedException">Thrown, if the provided <paramref name="scratchBuffer" /> or <paramref name="buffer" /> is not initialized.</exception>
+        /// <exception cref="InvalidArgumentException">Thrown, if the number of offsets does not match the number of acceleration structures, or any offset is not aligned to 256 bytes.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if an acceleration structure or its scratch memory is not fully contained by the respective buffer.</exception>
+        /// <seealso cref="AccelerationStructureBatch" />
+        inline void buildAccelerationStructures(Span<IBottomLevelAccelerationStructure* const> blas, const SharedPtr<const IBuffer> scratchBuffer, Span<const UInt64> scratchOffsets, const SharedPtr<const IBuffer> buffer, Span<const UInt64> offsets) const {
+            this->cmdBuildAccelerationStructures(blas, scratchBuffer, scratchOffsets, buffer, offsets);
+        }
+
         /// <summary>
         /// Updates a bottom-level acceleration structure.
         /// </summary>
@@ -6853,6 +7660,8 @@ namespace LiteFX::Rendering {
         virtual void cmdBind(const IDescriptorSet& descriptorSet) const = 0;
         virtual void cmdBind(Span<const IDescriptorSet*> descriptorSets) const = 0;
         virtual void cmdBind(const IDescriptorSet& descriptorSet, const IPipeline& pipeline) const noexcept = 0;
+        virtual void cmdBind(const IDescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets) const = 0;
+        virtual void cmdBind(const IDescriptorSet& descriptorSet, Span<const UInt32> dynamicOffsets, const IPipeline& pipeline) const noexcept = 0;
         virtual void cmdBind(Span<const IDescriptorSet*> descriptorSets, const IPipeline& pipeline) const noexcept = 0;
         virtual void cmdBind(const IVertexBuffer& buffer) const noexcept = 0;
         virtual void cmdBind(const IIndexBuffer& buffer) const noexcept = 0;
@@ -6871,6 +7680,7 @@ namespace LiteFX::Rendering {
         virtual void cmdExecute(Enumerable<SharedPtr<const ICommandBuffer>> commandBuffer) const = 0;
         virtual void cmdBuildAccelerationStructure(IBottomLevelAccelerationStructure& blas, const SharedPtr<const IBuffer> scratchBuffer, const IBuffer& buffer, UInt64 offset) const = 0;
         virtual void cmdBuildAccelerationStructure(ITopLevelAccelerationStructure& tlas, const SharedPtr<const IBuffer> scratchBuffer, const IBuffer& buffer, UInt64 offset) const = 0;
+        virtual void cmdBuildAccelerationStructures(Span<IBottomLevelAccelerationStructure* const> blas, const SharedPtr<const IBuffer> scratchBuffer, Span<const UInt64> scratchOffsets, const SharedPtr<const IBuffer> buffer, Span<const UInt64> offsets) const = 0;
         virtual void cmdUpdateAccelerationStructure(IBottomLevelAccelerationStructure& blas, const SharedPtr<const IBuffer> scratchBuffer, const IBuffer& buffer, UInt64 offset) const = 0;
         virtual void cmdUpdateAccelerationStructure(ITopLevelAccelerationStructure& tlas, const SharedPtr<const IBuffer> scratchBuffer, const IBuffer& buffer, UInt64 offset) const = 0;
         virtual void cmdCopyAccelerationStructure(const IBottomLevelAccelerationStructure& from, const IBottomLevelAccelerationStructure& to, bool compress) const noexcept = 0;
@@ -7016,6 +7826,256 @@ namespace LiteFX::Rendering {
         virtual UniquePtr<IBuffer> getShaderBindingTable(ShaderBindingTableOffsets& offsets, ShaderBindingGroup groups) const noexcept = 0;
     };
 
+    /// <summary>
+    /// Describes the memory requirements and the lifetime of a transient resource.
+    /// </summary>
+    /// <remarks>
+    /// The lifetime of a transient resource is described by the indices of the first and last use within a frame, for example the indices of the render passes that write to 
+    /// or read from the resource. Two resources whose lifetimes do not overlap can be placed into the same memory.
+    /// </remarks>
+    /// <seealso cref="TransientMemoryPlanner" />
+    struct LITEFX_RENDERING_API TransientResourceRequirements final {
+        /// <summary>
+        /// The size of the resource memory in bytes.
+        /// </summary>
+        UInt64 Size { 0 };
+
+        /// <summary>
+        /// The required alignment of the resource memory in bytes. Must be a power of two.
+        /// </summary>
+        UInt64 Alignment { 1 };
+
+        /// <summary>
+        /// A bit mask of memory types that the resource can be placed into.
+        /// </summary>
+        /// <remarks>
+        /// Resources can only share a memory block, if they have at least one memory type in common. The meaning of each bit is defined by the backend.
+        /// </remarks>
+        UInt32 MemoryTypes { 0xFFFFFFFF };
+
+        /// <summary>
+        /// The index of the first use of the resource within a frame.
+        /// </summary>
+        UInt32 FirstUse { 0 };
+
+        /// <summary>
+        /// The index of the last use of the resource within a frame.
+        /// </summary>
+        UInt32 LastUse { 0 };
+    };
+
+    /// <summary>
+    /// Describes where a transient resource has been placed by a <see cref="TransientMemoryPlanner" />.
+    /// </summary>
+    struct LITEFX_RENDERING_API TransientResourcePlacement final {
+        /// <summary>
+        /// The index of the memory block that contains the resource.
+        /// </summary>
+        UInt32 Block { 0 };
+
+        /// <summary>
+        /// The offset of the resource from the beginning of the memory block in bytes.
+        /// </summary>
+        UInt64 Offset { 0 };
+
+        /// <summary>
+        /// The indices of the resources that occupy overlapping memory and are last used before the resource is first used.
+        /// </summary>
+        /// <remarks>
+        /// If this array is not empty, an aliasing barrier is required before the first use of the resource.
+        /// </remarks>
+        Array<UInt32> Aliases;
+    };
+
+    /// <summary>
+    /// Describes a memory block that is shared between transient resources.
+    /// </summary>
+    struct LITEFX_RENDERING_API TransientMemoryBlock final {
+        /// <summary>
+        /// The size of the memory block in bytes.
+        /// </summary>
+        UInt64 Size { 0 };
+
+        /// <summary>
+        /// The alignment of the memory block in bytes, which is the largest alignment of all resources placed into it.
+        /// </summary>
+        UInt64 Alignment { 1 };
+
+        /// <summary>
+        /// The memory types that are supported by all resources placed into the block.
+        /// </summary>
+        UInt32 MemoryTypes { 0xFFFFFFFF };
+    };
+
+    /// <summary>
+    /// Stores statistics about the memory used by transient resources.
+    /// </summary>
+    struct LITEFX_RENDERING_API TransientMemoryStatistics final {
+        /// <summary>
+        /// The number of transient resources.
+        /// </summary>
+        UInt32 Resources { 0 };
+
+        /// <summary>
+        /// The number of memory blocks that are shared between the resources.
+        /// </summary>
+        UInt32 Blocks { 0 };
+
+        /// <summary>
+        /// The amount of memory in bytes that is required if resources are aliased, i.e., the total size of all memory blocks.
+        /// </summary>
+        UInt64 AliasedMemory { 0 };
+
+        /// <summary>
+        /// The amount of memory in bytes that would be required if each resource was allocated individually.
+        /// </summary>
+        UInt64 UnaliasedMemory { 0 };
+    };
+
+    /// <summary>
+    /// Places transient resources into shared memory blocks, so that resources whose lifetimes do not overlap alias the same memory.
+    /// </summary>
+    /// <remarks>
+    /// Intermediate resources, such as G-buffer targets, bloom chains or ambient occlusion buffers are only used by a few passes of a frame. If each of them is allocated individually,
+    /// their memory is reserved for the whole frame. The planner instead computes a layout, where resources that are not alive at the same time share memory. Resources are placed
+    /// from largest to smallest into the lowest offset of a compatible memory block, where they do not overlap with another resource that is alive at the same time. A new memory
+    /// block is only created, if no existing block shares a memory type with the resource.
+    /// 
+    /// The planner only computes the layout. Backends use it to allocate the memory blocks and bind the resources (see `VulkanTransientAllocator`). As the contents of aliased
+    /// memory are undefined, each resource with a non-empty <see cref="TransientResourcePlacement::Aliases" /> array must be transitioned from an undefined state before its first
+    /// use.
+    /// </remarks>
+    /// <seealso cref="TransientResourceRequirements" />
+    class LITEFX_RENDERING_API TransientMemoryPlanner final {
+        LITEFX_IMPLEMENTATION(TransientMemoryPlannerImpl);
+
+    public:
+        /// <summary>
+        /// Initializes a new transient memory planner.
+        /// </summary>
+        TransientMemoryPlanner() noexcept;
+        TransientMemoryPlanner(TransientMemoryPlanner&&) = delete;
+        TransientMemoryPlanner(const TransientMemoryPlanner&) = delete;
+        virtual ~TransientMemoryPlanner() noexcept;
+
+    public:
+        /// <summary>
+        /// Adds a transient resource to the planner.
+        /// </summary>
+        /// <param name="requirements">The memory requirements and lifetime of the resource.</param>
+        /// <returns>The index of the resource, which is used to look up its placement.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if the requirements are invalid, i.e., the alignment is not a power of two, no memory type is supported or the last use is before the first one.</exception>
+        UInt32 add(const TransientResourceRequirements& requirements);
+
+        /// <summary>
+        /// Removes all resources from the planner and resets the layout.
+        /// </summary>
+        void clear() noexcept;
+
+        /// <summary>
+        /// Computes the placement of all resources that have been added to the planner.
+        /// </summary>
+        void plan();
+
+        /// <summary>
+        /// Returns the requirements of all resources that have been added to the planner.
+        /// </summary>
+        /// <returns>The requirements of all resources.</returns>
+        const Array<TransientResourceRequirements>& resources() const noexcept;
+
+        /// <summary>
+        /// Returns the placement of each resource, computed by the last call to <see cref="plan" />.
+        /// </summary>
+        /// <returns>The placement of each resource.</returns>
+        const Array<TransientResourcePlacement>& placements() const noexcept;
+
+        /// <summary>
+        /// Returns the memory blocks, computed by the last call to <see cref="plan" />.
+        /// </summary>
+        /// <returns>The memory blocks that need to be allocated.</returns>
+        const Array<TransientMemoryBlock>& blocks() const noexcept;
+
+        /// <summary>
+        /// Returns the memory statistics of the last call to <see cref="plan" />.
+        /// </summary>
+        /// <returns>The memory statistics of the layout.</returns>
+        const TransientMemoryStatistics& statistics() const noexcept;
+    };
+
+    /// <summary>
+    /// Manages the placement of allocations within a fixed-size memory range.
+    /// </summary>
+    /// <remarks>
+    /// The sub-allocator only manages offsets and does not own any memory itself. Backends use it to place many small logical buffers within a large backend resource, so that
+    /// they do not need a separate allocation each (see `VulkanBufferArena`). This avoids wasting memory to alignment padding of individual allocations and allows to bind 
+    /// multiple logical buffers using the same resource.
+    /// </remarks>
+    /// <seealso cref="BufferArenaPolicy" />
+    class LITEFX_RENDERING_API BufferSuballocator final {
+        LITEFX_IMPLEMENTATION(BufferSuballocatorImpl);
+
+    public:
+        /// <summary>
+        /// Initializes a new sub-allocator.
+        /// </summary>
+        /// <param name="size">The size (in bytes) of the memory range managed by the sub-allocator.</param>
+        /// <param name="policy">The policy used to place allocations.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="size" /> is <c>0</c>.</exception>
+        explicit BufferSuballocator(UInt64 size, BufferArenaPolicy policy);
+        BufferSuballocator(BufferSuballocator&&) = delete;
+        BufferSuballocator(const BufferSuballocator&) = delete;
+        virtual ~BufferSuballocator() noexcept;
+
+    public:
+        /// <summary>
+        /// Returns the size (in bytes) of the memory range managed by the sub-allocator.
+        /// </summary>
+        /// <returns>The size of the memory range managed by the sub-allocator.</returns>
+        UInt64 size() const noexcept;
+
+        /// <summary>
+        /// Returns the policy used to place allocations.
+        /// </summary>
+        /// <returns>The policy used to place allocations.</returns>
+        BufferArenaPolicy policy() const noexcept;
+
+        /// <summary>
+        /// Returns the number of bytes that are currently allocated, excluding alignment padding.
+        /// </summary>
+        /// <returns>The number of bytes that are currently allocated.</returns>
+        UInt64 used() const noexcept;
+
+        /// <summary>
+        /// Returns the number of allocations that have not been released yet.
+        /// </summary>
+        /// <returns>The number of live allocations.</returns>
+        UInt32 allocations() const noexcept;
+
+        /// <summary>
+        /// Allocates a range of memory.
+        /// </summary>
+        /// <param name="size">The size (in bytes) of the range.</param>
+        /// <param name="alignment">The alignment of the offset of the range. Must be a power of two.</param>
+        /// <returns>The offset of the allocated range, or `std::nullopt`, if there is no free range that is large enough.</returns>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="size" /> is <c>0</c> or <paramref name="alignment" /> is not a power of two.</exception>
+        Optional<UInt64> allocate(UInt64 size, UInt64 alignment = 1);
+
+        /// <summary>
+        /// Releases an allocation.
+        /// </summary>
+        /// <remarks>
+        /// For the <see cref="BufferArenaPolicy::Linear" /> policy, the memory of the allocation is only re-used after the sub-allocator has been <see cref="reset" />.
+        /// </remarks>
+        /// <param name="offset">The offset returned by <see cref="allocate" />.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if <paramref name="offset" /> does not refer to a live allocation.</exception>
+        void free(UInt64 offset);
+
+        /// <summary>
+        /// Releases all allocations at once.
+        /// </summary>
+        void reset() noexcept;
+    };
+
     /// <summary>
     /// The interface for a frame buffer.
     /// </summary>
@@ -8006,6 +9066,160 @@ namespace LiteFX::Rendering {
         }
     };
 
+    /// <summary>
+    /// Stores the number of live allocations and the number of bytes they occupy.
+    /// </summary>
+    struct LITEFX_RENDERING_API MemoryUsage final {
+        /// <summary>
+        /// The number of live allocations.
+        /// </summary>
+        UInt64 Allocations { 0 };
+
+        /// <summary>
+        /// The number of bytes occupied by the live allocations.
+        /// </summary>
+        UInt64 Bytes { 0 };
+    };
+
+    /// <summary>
+    /// Describes the memory budget of a physical memory heap of the device.
+    /// </summary>
+    /// <remarks>
+    /// The budget is an estimate of how much memory the application can use from a heap without causing the operating system to page out resources. It is provided by the
+    /// driver and can change at runtime, for example if other applications allocate video memory.
+    /// </remarks>
+    struct LITEFX_RENDERING_API MemoryHeapBudget final {
+        /// <summary>
+        /// The index of the memory heap.
+        /// </summary>
+        UInt32 Heap { 0 };
+
+        /// <summary>
+        /// `true`, if the heap is located in device-local (video) memory, `false` if it is located in system memory.
+        /// </summary>
+        bool DeviceLocal { false };
+
+        /// <summary>
+        /// The number of bytes that are currently used from the heap by the process.
+        /// </summary>
+        UInt64 Usage { 0 };
+
+        /// <summary>
+        /// The number of bytes that the process can use from the heap.
+        /// </summary>
+        UInt64 Budget { 0 };
+    };
+
+    /// <summary>
+    /// Stores statistics about the memory that is allocated by a graphics factory.
+    /// </summary>
+    /// <seealso cref="IGraphicsFactory::memoryStatistics" />
+    struct LITEFX_RENDERING_API GraphicsMemoryStatistics final {
+        /// <summary>
+        /// The memory used by all live allocations.
+        /// </summary>
+        MemoryUsage Total { };
+
+        /// <summary>
+        /// The memory used by live allocations on each resource heap.
+        /// </summary>
+        Dictionary<ResourceHeap, MemoryUsage> Heaps { };
+
+        /// <summary>
+        /// The memory used by live buffers of each buffer type.
+        /// </summary>
+        Dictionary<BufferType, MemoryUsage> Buffers { };
+
+        /// <summary>
+        /// The memory used by live images.
+        /// </summary>
+        MemoryUsage Images { };
+
+        /// <summary>
+        /// The budget of each memory heap of the device.
+        /// </summary>
+        Array<MemoryHeapBudget> Budgets { };
+    };
+
+    /// <summary>
+    /// Tracks the memory of live allocations by resource heap and resource type.
+    /// </summary>
+    /// <remarks>
+    /// Graphics factories create an allocation record for each buffer and image they allocate and store it alongside the allocation (e.g., in the user data of the allocator).
+    /// When the resource is destroyed, the record is released and its size is subtracted from the statistics. Tracking is thread-safe, so resources can be created and 
+    /// destroyed from multiple threads.
+    /// 
+    /// The tracker also implements the budget check: it remembers which memory heaps exceeded the budget threshold, so that an exceeded budget is only reported once until the
+    /// usage of the heap drops below the threshold again.
+    /// </remarks>
+    /// <seealso cref="GraphicsMemoryStatistics" />
+    class LITEFX_RENDERING_API MemoryTracker final {
+        LITEFX_IMPLEMENTATION(MemoryTrackerImpl);
+
+    public:
+        /// <summary>
+        /// An opaque record of a tracked allocation.
+        /// </summary>
+        struct Allocation;
+
+    public:
+        /// <summary>
+        /// Initializes a new memory tracker.
+        /// </summary>
+        MemoryTracker() noexcept;
+        MemoryTracker(MemoryTracker&&) = delete;
+        MemoryTracker(const MemoryTracker&) = delete;
+        virtual ~MemoryTracker() noexcept;
+
+    public:
+        /// <summary>
+        /// Starts tracking an allocation.
+        /// </summary>
+        /// <remarks>
+        /// The tracker must outlive the returned record. Release the record using <see cref="release" />, when the allocation is freed.
+        /// </remarks>
+        /// <param name="heap">The resource heap the allocation is placed on.</param>
+        /// <param name="type">The type of the buffer, or `std::nullopt`, if the allocation backs an image.</param>
+        /// <param name="size">The size of the allocation in bytes.</param>
+        /// <returns>A record that identifies the allocation.</returns>
+        Allocation* track(ResourceHeap heap, Optional<BufferType> type, UInt64 size);
+
+        /// <summary>
+        /// Stops tracking an allocation and releases its record.
+        /// </summary>
+        /// <param name="allocation">The record of the allocation. If this is `nullptr`, the call is ignored.</param>
+        static void release(Allocation* allocation) noexcept;
+
+        /// <summary>
+        /// Returns the memory statistics of all live allocations.
+        /// </summary>
+        /// <remarks>
+        /// The tracker has no knowledge of the memory heaps of the device, so the <see cref="GraphicsMemoryStatistics::Budgets" /> array is always empty.
+        /// </remarks>
+        /// <returns>The memory statistics of all live allocations.</returns>
+        GraphicsMemoryStatistics statistics() const;
+
+        /// <summary>
+        /// Returns the fraction of the budget of a heap, above which the budget is considered exceeded.
+        /// </summary>
+        /// <returns>The fraction of the budget of a heap, above which the budget is considered exceeded.</returns>
+        Float budgetThreshold() const noexcept;
+
+        /// <summary>
+        /// Sets the fraction of the budget of a heap, above which the budget is considered exceeded.
+        /// </summary>
+        /// <param name="threshold">The fraction of the budget. Must be greater than 0 and not greater than 1.</param>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="threshold" /> is not within (0, 1].</exception>
+        void setBudgetThreshold(Float threshold);
+
+        /// <summary>
+        /// Returns the heaps whose usage exceeds the budget threshold, but did not exceed it during the previous check.
+        /// </summary>
+        /// <param name="budgets">The current budgets of the memory heaps.</param>
+        /// <returns>The budgets of all heaps that newly exceeded the threshold.</returns>
+        Array<MemoryHeapBudget> checkBudgets(Span<const MemoryHeapBudget> budgets);
+    };
+
     /// <summary>
     /// The interface for a graphics factory.
     /// </summary>
@@ -8013,6 +9227,85 @@ namespace LiteFX::Rendering {
     public:
         virtual ~IGraphicsFactory() noexcept = default;
 
+    public:
+        /// <summary>
+        /// Event arguments that are published to subscribers when the memory usage of a heap exceeds its budget threshold.
+        /// </summary>
+        /// <seealso cref="IGraphicsFactory::budgetExceeded" />
+        struct MemoryBudgetEventArgs : public EventArgs {
+        private:
+            const MemoryHeapBudget& m_budget;
+            Float m_threshold;
+
+        public:
+            MemoryBudgetEventArgs(const MemoryHeapBudget& budget, Float threshold) :
+                EventArgs(), m_budget(budget), m_threshold(threshold) { }
+            MemoryBudgetEventArgs(const MemoryBudgetEventArgs&) = default;
+            MemoryBudgetEventArgs(MemoryBudgetEventArgs&&) = default;
+            virtual ~MemoryBudgetEventArgs() noexcept = default;
+
+        public:
+            MemoryBudgetEventArgs& operator=(const MemoryBudgetEventArgs&) = default;
+            MemoryBudgetEventArgs& operator=(MemoryBudgetEventArgs&&) = default;
+
+        public:
+            /// <summary>
+            /// Returns the budget of the heap that exceeded the threshold.
+            /// </summary>
+            /// <returns>The budget of the heap that exceeded the threshold.</returns>
+            inline const MemoryHeapBudget& budget() const noexcept {
+                return m_budget;
+            }
+
+            /// <summary>
+            /// Returns the fraction of the budget that has been exceeded.
+            /// </summary>
+            /// <returns>The fraction of the budget that has been exceeded.</returns>
+            inline Float threshold() const noexcept {
+                return m_threshold;
+            }
+        };
+
+    public:
+        /// <summary>
+        /// Invoked, when the memory usage of a heap exceeds the budget threshold after allocating a resource.
+        /// </summary>
+        /// <remarks>
+        /// The event is raised once when a heap exceeds the threshold. It is raised again only after the usage of the heap has dropped below the threshold in between. Handlers
+        /// are invoked from the thread that allocated the resource. A typical reaction is to release cached resources or stream out texture mip levels.
+        /// </remarks>
+        /// <seealso cref="memoryBudgetThreshold" />
+        mutable Event<MemoryBudgetEventArgs> budgetExceeded;
+
+    public:
+        /// <summary>
+        /// Returns statistics about the memory of all live resources created by the factory, as well as the current budget of each memory heap.
+        /// </summary>
+        /// <returns>The memory statistics of the factory.</returns>
+        virtual GraphicsMemoryStatistics memoryStatistics() const = 0;
+
+        /// <summary>
+        /// Returns a JSON string that describes all memory blocks and live allocations of the factory, including the names of the resources.
+        /// </summary>
+        /// <remarks>
+        /// The format of the string is defined by the memory allocator of the backend. It can be used to inspect memory fragmentation and to find leaking resources.
+        /// </remarks>
+        /// <returns>A JSON string that describes all live allocations.</returns>
+        virtual String dumpMemoryAllocations() const = 0;
+
+        /// <summary>
+        /// Returns the fraction of the budget of a heap, above which <see cref="budgetExceeded" /> is invoked.
+        /// </summary>
+        /// <returns>The fraction of the budget of a heap, above which <see cref="budgetExceeded" /> is invoked.</returns>
+        virtual Float memoryBudgetThreshold() const noexcept = 0;
+
+        /// <summary>
+        /// Sets the fraction of the budget of a heap, above which <see cref="budgetExceeded" /> is invoked.
+        /// </summary>
+        /// <param name="threshold">The fraction of the budget. Must be greater than 0 and not greater than 1. The default value is `0.9`.</param>
+        /// <exception cref="ArgumentOutOfRangeException">Thrown, if <paramref name="threshold" /> is not within (0, 1].</exception>
+        virtual void setMemoryBudgetThreshold(Float threshold) = 0;
+
     public:
         /// <summary>
         /// Creates a buffer of type <paramref name="type" />.
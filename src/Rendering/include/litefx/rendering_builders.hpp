@@ -396,6 +396,16 @@ namespace LiteFX::Rendering {
         /// <returns>The shader module instance.</return>
         constexpr virtual UniquePtr<shader_module_type> makeShaderModule(ShaderStage type, std::istream& stream, const String& name, const String& entryPoint, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor) = 0;
 
+        /// <summary>
+        /// Called to create a new shader module in the program that is loaded from a shader archive.
+        /// </summary>
+        /// <param name="type">The type of the shader module.</param>
+        /// <param name="archive">The shader archive that contains the module.</param>
+        /// <param name="name">The name of the module within the archive.</param>
+        /// <param name="shaderLocalDescriptor">The descriptor that binds shader-local data for ray-tracing shaders.</param>
+        /// <returns>The shader module instance.</return>
+        constexpr virtual UniquePtr<shader_module_type> makeShaderModule(ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor) = 0;
+
     public:
         /// <summary>
         /// Adds a shader module to the program.
@@ -424,6 +434,46 @@ namespace LiteFX::Rendering {
             return std::forward<TSelf>(self);
         }
 
+        /// <summary>
+        /// Adds a shader module from a shader archive to the program.
+        /// </summary>
+        /// <remarks>
+        /// The shader stage and entry point are read from the archive. Shader libraries (i.e., ray-tracing modules) are stored without a shader stage, so they must be
+        /// added by explicitly providing the shader stage.
+        /// </remarks>
+        /// <param name="archive">The shader archive that contains the module.</param>
+        /// <param name="name">The name of the module within the archive.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if the archive does not contain the module or the module does not define a shader stage.</exception>
+        template<typename TSelf>
+        constexpr [[nodiscard]] auto withShaderModule(this TSelf&& self, const SharedPtr<const ShaderArchive>& archive, const String& name) -> TSelf&& {
+            if (archive == nullptr) [[unlikely]]
+                throw ArgumentNotInitializedException("archive", "The shader archive must be initialized.");
+
+            auto type = archive->entry(name).Stage;
+
+            if (type == ShaderStage::Other) [[unlikely]]
+                throw InvalidArgumentException("name", "The shader module {0} does not define a shader stage. Provide the shader stage explicitly in order to load it.", name);
+
+            return std::forward<TSelf>(self.withShaderModule(type, archive, name));
+        }
+
+        /// <summary>
+        /// Adds a shader module from a shader archive to the program.
+        /// </summary>
+        /// <param name="type">The type of the shader module.</param>
+        /// <param name="archive">The shader archive that contains the module.</param>
+        /// <param name="name">The name of the module within the archive.</param>
+        /// <param name="shaderLocalDescriptor">The descriptor that binds shader-local data for ray-tracing shaders.</param>
+        /// <exception cref="InvalidArgumentException">Thrown, if the archive does not contain the module.</exception>
+        template<typename TSelf>
+        constexpr [[nodiscard]] auto withShaderModule(this TSelf&& self, ShaderStage type, const SharedPtr<const ShaderArchive>& archive, const String& name, const Optional<DescriptorBindingPoint>& shaderLocalDescriptor = std::nullopt) -> TSelf&& {
+            if (archive == nullptr) [[unlikely]]
+                throw ArgumentNotInitializedException("archive", "The shader archive must be initialized.");
+
+            self.m_state.modules.push_back(std::move(static_cast<ShaderProgramBuilder&>(self).makeShaderModule(type, archive, name, shaderLocalDescriptor)));
+            return std::forward<TSelf>(self);
+        }
+
         /// <summary>
         /// Adds a vertex shader module to the program.
         /// </summary>
@@ -1086,6 +1136,19 @@ namespace LiteFX::Rendering {
             return std::forward<TSelf>(self);
         }
 
+        /// <summary>
+        /// Adds a dynamic uniform/constant buffer descriptor, whose offset is provided when binding the descriptor set.
+        /// </summary>
+        /// <param name="binding">The binding point or register index of the descriptor.</param>
+        /// <param name="descriptorSize">The size of a single descriptor.</param>
+        /// <param name="descriptors">The number of descriptors in the array.</param>
+        /// <seealso cref="DescriptorType::DynamicConstantBuffer" />
+        template <typename TSelf>
+        constexpr [[nodiscard]] auto withDynamicConstantBuffer(this TSelf&& self, UInt32 binding, UInt32 descriptorSize, UInt32 descriptors = 1) -> TSelf&& {
+            self.m_state.descriptorLayouts.push_back(std::move(self.makeDescriptor(DescriptorType::DynamicConstantBuffer, binding, descriptorSize, descriptors)));
+            return std::forward<TSelf>(self);
+        }
+
         /// <summary>
         /// Adds a texel buffer descriptor.
         /// </summary>
@@ -1110,6 +1173,19 @@ namespace LiteFX::Rendering {
             return std::forward<TSelf>(self);
         }
 
+        /// <summary>
+        /// Adds a dynamic storage/structured buffer descriptor, whose offset is provided when binding the descriptor set.
+        /// </summary>
+        /// <param name="binding">The binding point or register index of the descriptor.</param>
+        /// <param name="descriptors">The number of descriptors in the array.</param>
+        /// <param name="writable"><c>true</c>, if the buffer should be writable.</param>
+        /// <seealso cref="DescriptorType::DynamicStructuredBuffer" />
+        template <typename TSelf>
+        constexpr [[nodiscard]] auto withDynamicStructuredBuffer(this TSelf&& self, UInt32 binding, UInt32 descriptors = 1, bool writable = false) -> TSelf&& {
+            self.m_state.descriptorLayouts.push_back(std::move(self.makeDescriptor(writable ? DescriptorType::RWDynamicStructuredBuffer : DescriptorType::DynamicStructuredBuffer, binding, 0, descriptors)));
+            return std::forward<TSelf>(self);
+        }
+
         /// <summary>
         /// Adds a byte address buffer descriptor.
         /// </summary>
@@ -1676,6 +1752,11 @@ namespace LiteFX::Rendering {
             /// The binding point for input attachment samplers, if required.
             /// </summary>
             Optional<DescriptorBindingPoint> inputAttachmentSamplerBinding{ std::nullopt };
+
+            /// <summary>
+            /// The mode that describes how commands are recorded during the render pass.
+            /// </summary>
+            RenderPassRecordingMode recordingMode{ RenderPassRecordingMode::Secondary };
         } m_state;
 
         /// <summary>
@@ -1711,6 +1792,17 @@ namespace LiteFX::Rendering {
             return std::forward<TSelf>(self);
         }
 
+        /// <summary>
+        /// Sets the mode that describes how commands are recorded during the render pass.
+        /// </summary>
+        /// <param name="mode">The recording mode of the render pass.</param>
+        /// <seealso cref="RenderPassRecordingMode" />
+        template <typename TSelf>
+        constexpr auto recordingMode(this TSelf&& self, RenderPassRecordingMode mode) -> TSelf&& {
+            self.m_state.recordingMode = mode;
+            return std::forward<TSelf>(self);
+        }
+
         /// <summary>
         /// Adds a render target to the render pass by assigning it an incremental location number.
         /// </summary>
@@ -237,6 +237,9 @@ struct LITEFX_RENDERING_API std::formatter<DescriptorType> : std::formatter<std:
 		case RWByteAddressBuffer: name = "RWByteAddressBuffer"; break;
 		case InputAttachment: name = "Input Attachment"; break;
 		case AccelerationStructure: name = "Acceleration Structure"; break;
+		case DynamicConstantBuffer: name = "DynamicConstantBuffer"; break;
+		case DynamicStructuredBuffer: name = "DynamicStructuredBuffer"; break;
+		case RWDynamicStructuredBuffer: name = "RWDynamicStructuredBuffer"; break;
 		}
 		return formatter<string_view>::format(name, ctx);
 	}
@@ -280,6 +283,8 @@ struct LITEFX_RENDERING_API std::formatter<ResourceUsage> : std::formatter<std::
 				names.push_back("TransferDestination");
 			if ((t & ResourceUsage::AccelerationStructureBuildInput) == ResourceUsage::AccelerationStructureBuildInput)
 				names.push_back("AccelerationStructureBuildInput");
+			if ((t & ResourceUsage::Concurrent) == ResourceUsage::Concurrent)
+				names.push_back("Concurrent");
 		}
 
 		String name = Join(names, " | ");
@@ -287,6 +292,19 @@ struct LITEFX_RENDERING_API std::formatter<ResourceUsage> : std::formatter<std::
 	}
 };
 
+template <>
+struct LITEFX_RENDERING_API std::formatter<BufferArenaPolicy> : std::formatter<std::string_view> {
+	auto format(BufferArenaPolicy t, std::format_context& ctx) const {
+		string_view name = "Invalid";
+		switch (t) {
+		using enum BufferArenaPolicy;
+		case Linear:   name = "Linear";   break;
+		case FreeList: name = "FreeList"; break;
+		}
+		return formatter<string_view>::format(name, ctx);
+	}
+};
+
 template <>
 struct LITEFX_RENDERING_API std::formatter<ResourceHeap> : std::formatter<std::string_view> {
 	auto format(ResourceHeap t, std::format_context& ctx) const {
@@ -415,6 +433,12 @@ struct LITEFX_RENDERING_API std::formatter<BufferFormat> : std::formatter<std::s
 		case 0x04:
 			names.push_back("S");
 			break;
+		case 0x08:
+			names.push_back("SN");
+			break;
+		case 0x10:
+			names.push_back("UN");
+			break;
 		default:
 			return formatter<string_view>::format("Invalid", ctx);
 		}
@@ -492,6 +516,23 @@ struct LITEFX_RENDERING_API std::formatter<RenderTargetType> : std::formatter<st
 	}
 };
 
+template <>
+struct LITEFX_RENDERING_API std::formatter<RenderPassRecordingMode> : std::formatter<std::string_view> {
+	auto format(RenderPassRecordingMode t, std::format_context& ctx) const {
+		string_view name;
+
+		switch (t) {
+		using enum RenderPassRecordingMode;
+		case Inline: name = "Inline"; break;
+		case Secondary: name = "Secondary"; break;
+		case Parallel: name = "Parallel"; break;
+		default: name = "Invalid"; break;
+		}
+
+		return formatter<string_view>::format(name, ctx);
+	}
+};
+
 template <>
 struct LITEFX_RENDERING_API std::formatter<MultiSamplingLevel> : std::formatter<std::string_view> {
 	auto format(MultiSamplingLevel t, std::format_context& ctx) const {
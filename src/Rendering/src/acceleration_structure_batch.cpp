@@ -0,0 +1,194 @@
+#include <litefx/rendering.hpp>
+
+using namespace LiteFX::Rendering;
+
+// NOTE: Acceleration structures must be placed at offsets that are aligned to 256 bytes. This is also the upper bound for the scratch offset alignment on all supported
+//       backends, so we use it for both.
+constexpr UInt64 ACCELERATION_STRUCTURE_ALIGNMENT = 256;
+
+static inline UInt64 align(UInt64 size) noexcept {
+	return (size + ACCELERATION_STRUCTURE_ALIGNMENT - 1) & ~(ACCELERATION_STRUCTURE_ALIGNMENT - 1);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class AccelerationStructureBatch::AccelerationStructureBatchImpl : public Implement<AccelerationStructureBatch> {
+public:
+	friend class AccelerationStructureBatch;
+
+private:
+	const IGraphicsDevice& m_device;
+	UInt64 m_maxScratchMemory;
+	Array<SharedPtr<IBottomLevelAccelerationStructure>> m_accelerationStructures, m_retired;
+	SharedPtr<const IBuffer> m_buffer;
+	AccelerationStructureBatchStatistics m_statistics { };
+
+public:
+	AccelerationStructureBatchImpl(AccelerationStructureBatch* parent, const IGraphicsDevice& device, UInt64 maxScratchMemory) :
+		base(parent), m_device(device), m_maxScratchMemory(align(maxScratchMemory))
+	{
+	}
+
+public:
+	void build(const ICommandBuffer& commandBuffer)
+	{
+		if (m_accelerationStructures.empty()) [[unlikely]]
+			throw RuntimeException("The batch does not contain any acceleration structures.");
+
+		// Compute the offsets of all acceleration structures within the buffer, as well as the amount of scratch memory required to build them.
+		const auto count = m_accelerationStructures.size();
+		Array<UInt64> offsets(count), scratchSizes(count), scratchOffsets(count);
+		UInt64 bufferSize { 0 }, totalScratchSize { 0 }, maxScratchSize { 0 };
+
+		for (size_t i { 0 }; i < count; ++i)
+		{
+			UInt64 size, scratchSize;
+			m_device.computeAccelerationStructureSizes(*m_accelerationStructures[i], size, scratchSize);
+
+			offsets[i] = bufferSize;
+			bufferSize += align(size);
+			scratchSizes[i] = align(scratchSize);
+			totalScratchSize += scratchSizes[i];
+			maxScratchSize = std::max(maxScratchSize, scratchSizes[i]);
+		}
+
+		// The scratch buffer must at least be able to build the largest acceleration structure.
+		auto poolSize = m_maxScratchMemory == 0 ? totalScratchSize : std::max(maxScratchSize, std::min(m_maxScratchMemory, totalScratchSize));
+
+		// Release the acceleration structures that have been replaced by the last compaction and allocate the buffers.
+		m_retired.clear();
+		m_buffer = m_device.factory().createBuffer(BufferType::AccelerationStructure, ResourceHeap::Resource, bufferSize, 1, ResourceUsage::AllowWrite);
+		SharedPtr<const IBuffer> scratchBuffer = m_device.factory().createBuffer(BufferType::Storage, ResourceHeap::Resource, poolSize, 1, ResourceUsage::AllowWrite);
+
+		m_statistics = {
+			.AccelerationStructures = static_cast<UInt32>(count),
+			.ScratchMemory = poolSize,
+			.BuildMemory = bufferSize
+		};
+
+		// Split the acceleration structures into groups, whose scratch memory fits into the pool and build each group with a single command.
+		auto accelerationStructures = m_accelerationStructures | std::views::transform([](const auto& blas) { return blas.get(); }) | std::ranges::to<Array<IBottomLevelAccelerationStructure*>>();
+		Span<IBottomLevelAccelerationStructure* const> structures(accelerationStructures);
+		size_t first { 0 };
+		UInt64 scratchOffset { 0 };
+
+		auto buildGroup = [&](size_t last) {
+			if (m_statistics.BuildCommands > 0)
+			{
+				// The group re-uses the scratch memory of the previous one, so we need to wait for it to finish.
+				auto barrier = m_device.makeBarrier(PipelineStage::AccelerationStructureBuild, PipelineStage::AccelerationStructureBuild);
+				barrier->transition(*scratchBuffer, ResourceAccess::AccelerationStructureWrite, ResourceAccess::AccelerationStructureWrite);
+				commandBuffer.barrier(*barrier);
+			}
+
+			commandBuffer.buildAccelerationStructures(structures.subspan(first, last - first), scratchBuffer, Span<const UInt64>(scratchOffsets).subspan(first, last - first),
+				m_buffer, Span<const UInt64>(offsets).subspan(first, last - first));
+			m_statistics.BuildCommands++;
+		};
+
+		for (size_t i { 0 }; i < count; ++i)
+		{
+			if (scratchOffset + scratchSizes[i] > poolSize)
+			{
+				buildGroup(i);
+				first = i;
+				scratchOffset = 0;
+			}
+
+			scratchOffsets[i] = scratchOffset;
+			scratchOffset += scratchSizes[i];
+		}
+
+		buildGroup(count);
+	}
+
+	void compact(const ICommandBuffer& commandBuffer)
+	{
+		if (m_buffer == nullptr) [[unlikely]]
+			throw RuntimeException("The batch must be built before it can be compacted.");
+
+		// Acquire the compacted sizes. Acceleration structures that do not allow compaction are copied as they are.
+		const auto count = m_accelerationStructures.size();
+		Array<UInt64> offsets(count);
+		UInt64 bufferSize { 0 };
+
+		for (size_t i { 0 }; i < count; ++i)
+		{
+			offsets[i] = bufferSize;
+			bufferSize += align(m_accelerationStructures[i]->size());
+		}
+
+		// Copy the acceleration structures into the compacted buffer.
+		SharedPtr<const IBuffer> buffer = m_device.factory().createBuffer(BufferType::AccelerationStructure, ResourceHeap::Resource, bufferSize, 1, ResourceUsage::AllowWrite);
+		Array<SharedPtr<IBottomLevelAccelerationStructure>> compacted;
+		compacted.reserve(count);
+
+		for (size_t i { 0 }; i < count; ++i)
+		{
+			const auto& source = m_accelerationStructures[i];
+			auto destination = asShared(std::move(m_device.factory().createBottomLevelAccelerationStructure(source->name(), source->flags())));
+			source->copy(commandBuffer, *destination, LITEFX_FLAG_IS_SET(source->flags(), AccelerationStructureFlags::AllowCompaction), buffer, offsets[i], true);
+			compacted.push_back(std::move(destination));
+		}
+
+		// Keep the original acceleration structures alive until the copies have been executed.
+		m_retired = std::exchange(m_accelerationStructures, std::move(compacted));
+		m_buffer = buffer;
+		m_statistics.CompactedMemory = bufferSize;
+		m_statistics.MemorySaved = m_statistics.BuildMemory > bufferSize ? m_statistics.BuildMemory - bufferSize : 0;
+	}
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+AccelerationStructureBatch::AccelerationStructureBatch(const IGraphicsDevice& device, UInt64 maxScratchMemory) noexcept :
+	m_impl(makePimpl<AccelerationStructureBatchImpl>(this, device, maxScratchMemory))
+{
+}
+
+AccelerationStructureBatch::~AccelerationStructureBatch() noexcept = default;
+
+void AccelerationStructureBatch::add(SharedPtr<IBottomLevelAccelerationStructure> blas)
+{
+	if (blas == nullptr) [[unlikely]]
+		throw ArgumentNotInitializedException("blas", "The acceleration structure must be initialized.");
+
+	m_impl->m_accelerationStructures.push_back(std::move(blas));
+}
+
+void AccelerationStructureBatch::clear() noexcept
+{
+	m_impl->m_accelerationStructures.clear();
+	m_impl->m_retired.clear();
+	m_impl->m_buffer = nullptr;
+	m_impl->m_statistics = { };
+}
+
+const Array<SharedPtr<IBottomLevelAccelerationStructure>>& AccelerationStructureBatch::accelerationStructures() const noexcept
+{
+	return m_impl->m_accelerationStructures;
+}
+
+SharedPtr<const IBuffer> AccelerationStructureBatch::buffer() const noexcept
+{
+	return m_impl->m_buffer;
+}
+
+const AccelerationStructureBatchStatistics& AccelerationStructureBatch::statistics() const noexcept
+{
+	return m_impl->m_statistics;
+}
+
+void AccelerationStructureBatch::build(const ICommandBuffer& commandBuffer)
+{
+	m_impl->build(commandBuffer);
+}
+
+void AccelerationStructureBatch::compact(const ICommandBuffer& commandBuffer)
+{
+	m_impl->compact(commandBuffer);
+}
\ No newline at end of file
@@ -0,0 +1,306 @@
+#include <litefx/rendering.hpp>
+#include <bit>
+#include <map>
+
+using namespace LiteFX::Rendering;
+
+// NOTE: Each first level class covers a power of two range of sizes, which is split into `SECOND_LEVEL_COUNT` linear sub-classes. Sizes below `SECOND_LEVEL_COUNT` are
+//       all stored in the first class.
+constexpr UInt32 SECOND_LEVEL_BITS = 4;
+constexpr UInt32 SECOND_LEVEL_COUNT = 1 << SECOND_LEVEL_BITS;
+constexpr UInt32 FIRST_LEVEL_COUNT = 64 - SECOND_LEVEL_BITS + 1;
+
+static inline UInt64 align(UInt64 offset, UInt64 alignment) noexcept {
+	return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+static inline std::pair<UInt32, UInt32> sizeClass(UInt64 size) noexcept {
+	if (size < SECOND_LEVEL_COUNT)
+		return { 0, static_cast<UInt32>(size) };
+
+	const auto firstLevel = static_cast<UInt32>(std::bit_width(size) - 1);
+	const auto secondLevel = static_cast<UInt32>(size >> (firstLevel - SECOND_LEVEL_BITS)) - SECOND_LEVEL_COUNT;
+	return { firstLevel - SECOND_LEVEL_BITS + 1, secondLevel };
+}
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class BufferSuballocator::BufferSuballocatorImpl : public Implement<BufferSuballocator> {
+public:
+	friend class BufferSuballocator;
+
+private:
+	struct Block {
+		UInt64 Size;
+		bool Free;
+	};
+
+	UInt64 m_size, m_used{ 0 }, m_offset{ 0 };
+	UInt32 m_allocations{ 0 };
+	BufferArenaPolicy m_policy;
+
+	// Physical blocks, ordered by their offset, so that neighbors can be merged when a block is released.
+	std::map<UInt64, Block> m_blocks;
+	Array<Array<UInt64>> m_freeLists;
+	UInt64 m_firstLevelMap{ 0 };
+	Array<UInt32> m_secondLevelMaps;
+
+public:
+	BufferSuballocatorImpl(BufferSuballocator* parent, UInt64 size, BufferArenaPolicy policy) :
+		base(parent), m_size(size), m_policy(policy), m_freeLists(FIRST_LEVEL_COUNT * SECOND_LEVEL_COUNT), m_secondLevelMaps(FIRST_LEVEL_COUNT, 0)
+	{
+	}
+
+private:
+	void insertFree(UInt64 offset, UInt64 size)
+	{
+		const auto [firstLevel, secondLevel] = sizeClass(size);
+		m_blocks[offset] = { .Size = size, .Free = true };
+		m_freeLists[firstLevel * SECOND_LEVEL_COUNT + secondLevel].push_back(offset);
+		m_firstLevelMap |= 1ull << firstLevel;
+		m_secondLevelMaps[firstLevel] |= 1u << secondLevel;
+	}
+
+	void removeFree(UInt64 offset, UInt64 size)
+	{
+		const auto [firstLevel, secondLevel] = sizeClass(size);
+		auto& freeList = m_freeLists[firstLevel * SECOND_LEVEL_COUNT + secondLevel];
+		freeList.erase(std::ranges::find(freeList, offset));
+
+		if (freeList.empty())
+		{
+			m_secondLevelMaps[firstLevel] &= ~(1u << secondLevel);
+
+			if (m_secondLevelMaps[firstLevel] == 0)
+				m_firstLevelMap &= ~(1ull << firstLevel);
+		}
+	}
+
+	Optional<UInt64> findFree(UInt64 size) const
+	{
+		// Round the size up to the next size class, so that any block of the class found is large enough.
+		auto rounded = size;
+
+		if (size >= SECOND_LEVEL_COUNT)
+			rounded += (1ull << (std::bit_width(size) - 1 - SECOND_LEVEL_BITS)) - 1;
+
+		auto [firstLevel, secondLevel] = sizeClass(rounded);
+
+		if (firstLevel < FIRST_LEVEL_COUNT)
+		{
+			auto secondLevelMap = m_secondLevelMaps[firstLevel] & (~0u << secondLevel);
+
+			if (secondLevelMap == 0)
+			{
+				auto firstLevelMap = firstLevel + 1 < 64 ? m_firstLevelMap & (~0ull << (firstLevel + 1)) : 0ull;
+
+				if (firstLevelMap != 0)
+				{
+					firstLevel = static_cast<UInt32>(std::countr_zero(firstLevelMap));
+					secondLevelMap = m_secondLevelMaps[firstLevel];
+				}
+			}
+
+			if (secondLevelMap != 0)
+				return m_freeLists[firstLevel * SECOND_LEVEL_COUNT + static_cast<UInt32>(std::countr_zero(secondLevelMap))].back();
+		}
+
+		// The blocks in the class of the requested size might still be large enough, so search them before giving up.
+		const auto [exactFirstLevel, exactSecondLevel] = sizeClass(size);
+		const auto& freeList = m_freeLists[exactFirstLevel * SECOND_LEVEL_COUNT + exactSecondLevel];
+		auto match = std::ranges::find_if(freeList, [this, size](UInt64 offset) { return m_blocks.at(offset).Size >= size; });
+
+		return match == freeList.end() ? std::nullopt : Optional<UInt64>(*match);
+	}
+
+	Optional<UInt64> findAligned(UInt64 size, UInt64 alignment) const
+	{
+		// Blocks, which are not large enough for the padded size, may still fit the allocation, if their offset is already aligned. Only the classes between the requested 
+		// and the padded size need to be searched, since larger ones have already been checked.
+		const auto padded = alignment - 1 <= m_size - size ? size + alignment - 1 : m_size;
+		const auto [firstLevel, secondLevel] = sizeClass(size);
+		const auto [lastFirstLevel, lastSecondLevel] = sizeClass(padded);
+
+		for (auto index = firstLevel * SECOND_LEVEL_COUNT + secondLevel; index <= lastFirstLevel * SECOND_LEVEL_COUNT + lastSecondLevel; ++index)
+		{
+			auto match = std::ranges::find_if(m_freeLists[index], [this, size, alignment](UInt64 offset) { return align(offset, alignment) - offset + size <= m_blocks.at(offset).Size; });
+
+			if (match != m_freeLists[index].end())
+				return *match;
+		}
+
+		return std::nullopt;
+	}
+
+public:
+	void reset()
+	{
+		m_blocks.clear();
+		std::ranges::for_each(m_freeLists, [](auto& freeList) { freeList.clear(); });
+		std::ranges::fill(m_secondLevelMaps, 0u);
+		m_firstLevelMap = 0;
+		m_used = 0;
+		m_offset = 0;
+		m_allocations = 0;
+
+		if (m_policy == BufferArenaPolicy::FreeList)
+			this->insertFree(0, m_size);
+	}
+
+	Optional<UInt64> allocate(UInt64 size, UInt64 alignment)
+	{
+		if (size > m_size)
+			return std::nullopt;
+
+		if (m_policy == BufferArenaPolicy::Linear)
+		{
+			auto offset = align(m_offset, alignment);
+
+			if (offset + size > m_size)
+				return std::nullopt;
+
+			m_offset = offset + size;
+			m_used += size;
+			m_allocations++;
+			return offset;
+		}
+
+		// Find a block that is large enough to hold the allocation, even if its offset needs to be aligned. If there is none, look for a block that fits without padding.
+		Optional<UInt64> match;
+
+		if (alignment - 1 <= m_size - size)
+			match = this->findFree(size + alignment - 1);
+
+		if (!match.has_value())
+			match = this->findAligned(size, alignment);
+
+		if (!match.has_value())
+			return std::nullopt;
+
+		const auto blockOffset = *match;
+		const auto blockSize = m_blocks[blockOffset].Size;
+		this->removeFree(blockOffset, blockSize);
+		m_blocks.erase(blockOffset);
+
+		// Return the padding in front of the allocation and the remainder behind it to the free lists.
+		const auto offset = align(blockOffset, alignment);
+		const auto padding = offset - blockOffset;
+		const auto remainder = blockSize - padding - size;
+
+		if (padding > 0)
+			this->insertFree(blockOffset, padding);
+
+		if (remainder > 0)
+			this->insertFree(offset + size, remainder);
+
+		m_blocks[offset] = { .Size = size, .Free = false };
+		m_used += size;
+		m_allocations++;
+		return offset;
+	}
+
+	void free(UInt64 offset)
+	{
+		if (m_policy == BufferArenaPolicy::Linear)
+		{
+			if (offset >= m_offset || m_allocations == 0) [[unlikely]]
+				throw InvalidArgumentException("offset", "The offset {0} does not refer to an allocation.", offset);
+
+			m_allocations--;
+			return;
+		}
+
+		auto block = m_blocks.find(offset);
+
+		if (block == m_blocks.end() || block->second.Free) [[unlikely]]
+			throw InvalidArgumentException("offset", "The offset {0} does not refer to an allocation.", offset);
+
+		auto size = block->second.Size;
+		m_used -= size;
+		m_allocations--;
+
+		// Merge the block with its free neighbors.
+		auto next = std::next(block);
+
+		if (next != m_blocks.end() && next->second.Free)
+		{
+			this->removeFree(next->first, next->second.Size);
+			size += next->second.Size;
+			m_blocks.erase(next);
+		}
+
+		if (block != m_blocks.begin())
+		{
+			auto previous = std::prev(block);
+
+			if (previous->second.Free)
+			{
+				this->removeFree(previous->first, previous->second.Size);
+				offset = previous->first;
+				size += previous->second.Size;
+				m_blocks.erase(previous);
+			}
+		}
+
+		m_blocks.erase(block);
+		this->insertFree(offset, size);
+	}
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+BufferSuballocator::BufferSuballocator(UInt64 size, BufferArenaPolicy policy) :
+	m_impl(makePimpl<BufferSuballocatorImpl>(this, size, policy))
+{
+	if (size == 0) [[unlikely]]
+		throw InvalidArgumentException("size", "The size of a sub-allocator must not be 0.");
+
+	m_impl->reset();
+}
+
+BufferSuballocator::~BufferSuballocator() noexcept = default;
+
+UInt64 BufferSuballocator::size() const noexcept
+{
+	return m_impl->m_size;
+}
+
+BufferArenaPolicy BufferSuballocator::policy() const noexcept
+{
+	return m_impl->m_policy;
+}
+
+UInt64 BufferSuballocator::used() const noexcept
+{
+	return m_impl->m_used;
+}
+
+UInt32 BufferSuballocator::allocations() const noexcept
+{
+	return m_impl->m_allocations;
+}
+
+Optional<UInt64> BufferSuballocator::allocate(UInt64 size, UInt64 alignment)
+{
+	if (size == 0) [[unlikely]]
+		throw InvalidArgumentException("size", "The size of an allocation must not be 0.");
+
+	if (alignment == 0 || (alignment & (alignment - 1)) != 0) [[unlikely]]
+		throw InvalidArgumentException("alignment", "The alignment of an allocation must be a power of two, but was {0}.", alignment);
+
+	return m_impl->allocate(size, alignment);
+}
+
+void BufferSuballocator::free(UInt64 offset)
+{
+	m_impl->free(offset);
+}
+
+void BufferSuballocator::reset() noexcept
+{
+	m_impl->reset();
+}
@@ -1,7 +1,210 @@
 #include <litefx/rendering.hpp>
+#include <shared_mutex>
 
 using namespace LiteFX::Rendering;
 
+// ------------------------------------------------------------------------------------------------
+// Resource registry.
+// ------------------------------------------------------------------------------------------------
+
+/// <summary>
+/// Stores resources of a single type in a dense array of slots that can be addressed by generational handles.
+/// </summary>
+/// <remarks>
+/// Released slots are put into a free list and re-used by subsequently added resources. Each time a slot is released, its generation is increased, which 
+/// invalidates all handles that still refer to it. Identifiers are stored once in the identifier index and the slot only refers to the stored key. A 
+/// second index maps resource addresses to slots, so that releasing a resource by reference does not require to search the slots. All access is 
+/// guarded by a reader/writer lock.
+/// </remarks>
+/// <typeparam name="TResource">The type of the resources stored in the registry.</typeparam>
+template <typename TResource>
+class ResourceRegistry final {
+public:
+    using handle_type = StateHandle<TResource>;
+
+private:
+    struct IdHash {
+        using is_transparent = void;
+
+        inline size_t operator()(StringView id) const noexcept {
+            return std::hash<StringView>{}(id);
+        }
+    };
+
+    struct Slot {
+        UniquePtr<TResource> resource{ nullptr };
+        const String* id{ nullptr };
+        UInt32 generation{ 1 };
+    };
+
+private:
+    Array<Slot> m_slots{ };
+    Array<UInt32> m_freeSlots{ };
+    std::unordered_map<String, UInt32, IdHash, std::equal_to<>> m_ids{ };
+    Dictionary<const TResource*, UInt32> m_addresses{ };
+    mutable std::shared_mutex m_mutex{ };
+
+public:
+    /// <summary>
+    /// Adds a resource to the registry and returns its handle, or an invalid handle, if another resource with the same identifier has already been added.
+    /// </summary>
+    handle_type add(const String& id, UniquePtr<TResource>&& resource)
+    {
+        std::unique_lock lock(m_mutex);
+
+        if (m_ids.contains(id)) [[unlikely]]
+            return { };
+
+        // Reserve storage up-front, so that nothing throws after the indices have been updated.
+        if (m_freeSlots.empty())
+            m_slots.reserve(m_slots.size() + 1);
+
+        m_addresses.reserve(m_addresses.size() + 1);
+        auto [key, inserted] = m_ids.emplace(id, 0);
+
+        UInt32 index{ };
+
+        if (m_freeSlots.empty())
+        {
+            index = static_cast<UInt32>(m_slots.size());
+            m_slots.emplace_back();
+        }
+        else
+        {
+            index = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+
+        auto& slot = m_slots[index];
+        key->second = index;
+        slot.id = &key->first;
+        slot.resource = std::move(resource);
+        m_addresses.emplace(slot.resource.get(), index);
+
+        return { index, slot.generation };
+    }
+
+    /// <summary>
+    /// Returns the handle of the resource with the provided identifier, or an invalid handle, if no such resource exists.
+    /// </summary>
+    handle_type handle(StringView id) const
+    {
+        std::shared_lock lock(m_mutex);
+
+        if (auto match = m_ids.find(id); match != m_ids.end()) [[likely]]
+            return { match->second, m_slots[match->second].generation };
+        else
+            return { };
+    }
+
+    /// <summary>
+    /// Returns the resource with the provided identifier, or <c>nullptr</c>, if no such resource exists.
+    /// </summary>
+    TResource* find(StringView id) const
+    {
+        std::shared_lock lock(m_mutex);
+
+        if (auto match = m_ids.find(id); match != m_ids.end()) [[likely]]
+            return m_slots[match->second].resource.get();
+        else
+            return nullptr;
+    }
+
+    /// <summary>
+    /// Returns the resource referred to by the handle, or <c>nullptr</c>, if the handle is invalid or the resource has been released.
+    /// </summary>
+    TResource* find(handle_type handle) const
+    {
+        std::shared_lock lock(m_mutex);
+
+        if (handle.index >= m_slots.size()) [[unlikely]]
+            return nullptr;
+
+        const auto& slot = m_slots[handle.index];
+        return slot.generation == handle.generation ? slot.resource.get() : nullptr;
+    }
+
+    /// <summary>
+    /// Releases the resource referred to by the handle.
+    /// </summary>
+    bool release(handle_type handle)
+    {
+        UniquePtr<TResource> resource;
+
+        {
+            std::unique_lock lock(m_mutex);
+
+            if (handle.index >= m_slots.size() || m_slots[handle.index].generation != handle.generation) [[unlikely]]
+                return false;
+
+            resource = this->take(handle.index);
+        }
+
+        // Destroy the resource outside of the lock, so that readers are not blocked by it.
+        return resource != nullptr;
+    }
+
+    /// <summary>
+    /// Releases the provided resource.
+    /// </summary>
+    bool release(const TResource& resource)
+    {
+        UniquePtr<TResource> released;
+
+        {
+            std::unique_lock lock(m_mutex);
+
+            auto match = m_addresses.find(&resource);
+
+            if (match == m_addresses.end()) [[unlikely]]
+                return false;
+
+            released = this->take(match->second);
+        }
+
+        return released != nullptr;
+    }
+
+    /// <summary>
+    /// Releases all resources in the registry.
+    /// </summary>
+    void clear()
+    {
+        Array<UniquePtr<TResource>> resources;
+
+        {
+            std::unique_lock lock(m_mutex);
+            resources.reserve(m_addresses.size());
+
+            for (UInt32 i{ 0 }; i < static_cast<UInt32>(m_slots.size()); ++i)
+                if (m_slots[i].resource != nullptr)
+                    resources.push_back(this->take(i));
+        }
+
+        resources.clear();
+    }
+
+private:
+    inline UniquePtr<TResource> take(UInt32 index)
+    {
+        auto& slot = m_slots[index];
+
+        if (slot.resource == nullptr) [[unlikely]]
+            return nullptr;
+
+        m_addresses.erase(slot.resource.get());
+        m_ids.erase(m_ids.find(*slot.id));
+        slot.id = nullptr;
+        slot.generation++;
+
+        // The free list has at most as many entries as there are slots, so reserving them in advance avoids allocations here.
+        m_freeSlots.reserve(m_slots.size());
+        m_freeSlots.push_back(index);
+
+        return std::move(slot.resource);
+    }
+};
+
 // ------------------------------------------------------------------------------------------------
 // Implementation.
 // ------------------------------------------------------------------------------------------------
@@ -11,22 +214,50 @@ public:
     friend class DeviceState;
 
 private:
-    Dictionary<String, UniquePtr<IRenderPass>> m_renderPasses;
-    Dictionary<String, UniquePtr<IFrameBuffer>> m_frameBuffers;
-    Dictionary<String, UniquePtr<IPipeline>> m_pipelines;
-    Dictionary<String, UniquePtr<IBuffer>> m_buffers;
-    Dictionary<String, UniquePtr<IVertexBuffer>> m_vertexBuffers;
-    Dictionary<String, UniquePtr<IIndexBuffer>> m_indexBuffers;
-    Dictionary<String, UniquePtr<IImage>> m_images;
-    Dictionary<String, UniquePtr<ISampler>> m_samplers;
-    Dictionary<String, UniquePtr<IAccelerationStructure>> m_accelerationStructures;
-    Dictionary<String, UniquePtr<IDescriptorSet>> m_descriptorSets;
+    ResourceRegistry<IRenderPass> m_renderPasses;
+    ResourceRegistry<IFrameBuffer> m_frameBuffers;
+    ResourceRegistry<IPipeline> m_pipelines;
+    ResourceRegistry<IBuffer> m_buffers;
+    ResourceRegistry<IVertexBuffer> m_vertexBuffers;
+    ResourceRegistry<IIndexBuffer> m_indexBuffers;
+    ResourceRegistry<IImage> m_images;
+    ResourceRegistry<ISampler> m_samplers;
+    ResourceRegistry<IAccelerationStructure> m_accelerationStructures;
+    ResourceRegistry<IDescriptorSet> m_descriptorSets;
 
 public:
     DeviceStateImpl(DeviceState* parent) :
         base(parent)
     {
     }
+
+public:
+    template <typename TResource>
+    inline ResourceRegistry<TResource>& registry() noexcept
+    {
+        if constexpr (std::is_same_v<TResource, IRenderPass>)
+            return m_renderPasses;
+        else if constexpr (std::is_same_v<TResource, IFrameBuffer>)
+            return m_frameBuffers;
+        else if constexpr (std::is_same_v<TResource, IPipeline>)
+            return m_pipelines;
+        else if constexpr (std::is_same_v<TResource, IBuffer>)
+            return m_buffers;
+        else if constexpr (std::is_same_v<TResource, IVertexBuffer>)
+            return m_vertexBuffers;
+        else if constexpr (std::is_same_v<TResource, IIndexBuffer>)
+            return m_indexBuffers;
+        else if constexpr (std::is_same_v<TResource, IImage>)
+            return m_images;
+        else if constexpr (std::is_same_v<TResource, ISampler>)
+            return m_samplers;
+        else if constexpr (std::is_same_v<TResource, IAccelerationStructure>)
+            return m_accelerationStructures;
+        else if constexpr (std::is_same_v<TResource, IDescriptorSet>)
+            return m_descriptorSets;
+        else
+            static_assert(!std::is_same_v<TResource, TResource>, "The resource type cannot be stored in a device state.");
+    }
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -48,409 +279,430 @@ void DeviceState::clear()
     // Make sure that everything is destroyed in order.
 
     // Clear descriptor sets.
-    for (auto& pair : m_impl->m_descriptorSets)
-        pair.second = nullptr;
-
     m_impl->m_descriptorSets.clear();
 
     // Clear images, samplers and buffers.
-    for (auto& pair : m_impl->m_buffers)
-        pair.second = nullptr;
-
     m_impl->m_buffers.clear();
-
-    for (auto& pair : m_impl->m_vertexBuffers)
-        pair.second = nullptr;
-
     m_impl->m_vertexBuffers.clear();
-
-    for (auto& pair : m_impl->m_indexBuffers)
-        pair.second = nullptr;
-
     m_impl->m_indexBuffers.clear();
-
-    for (auto& pair : m_impl->m_images)
-        pair.second = nullptr;
-
     m_impl->m_images.clear();
-
-    for (auto& pair : m_impl->m_samplers)
-        pair.second = nullptr;
-
     m_impl->m_samplers.clear();
-
-    for (auto& pair : m_impl->m_accelerationStructures)
-        pair.second = nullptr;
-
     m_impl->m_accelerationStructures.clear();
 
     // Clear pipelines.
-    for (auto& pair : m_impl->m_pipelines)
-        pair.second = nullptr;
-
     m_impl->m_pipelines.clear();
 
     // Clear render passes.
-    for (auto& pair : m_impl->m_renderPasses)
-        pair.second = nullptr;
-
     m_impl->m_renderPasses.clear();
 
     // Clear the frame buffers.
-    for (auto& pair : m_impl->m_frameBuffers)
-        pair.second = nullptr;
-
     m_impl->m_frameBuffers.clear();
 }
 
-void DeviceState::add(UniquePtr<IRenderPass>&& renderPass)
+StateHandle<IRenderPass> DeviceState::add(UniquePtr<IRenderPass>&& renderPass)
 {
-    this->add(renderPass->name(), std::move(renderPass));
+    return this->add(renderPass->name(), std::move(renderPass));
 }
 
-void DeviceState::add(const String& id, UniquePtr<IRenderPass>&& renderPass)
+StateHandle<IRenderPass> DeviceState::add(const String& id, UniquePtr<IRenderPass>&& renderPass)
 {
     if (renderPass == nullptr) [[unlikely]]
         throw InvalidArgumentException("renderPass", "The render pass must be initialized.");
 
-    if (m_impl->m_renderPasses.contains(id)) [[unlikely]]
+    auto handle = m_impl->m_renderPasses.add(id, std::move(renderPass));
+
+    if (!handle.valid()) [[unlikely]]
         throw InvalidArgumentException("id", "Another render pass with the identifier \"{0}\" has already been registered in the device state.", id);
 
-    m_impl->m_renderPasses.insert(std::make_pair(id, std::move(renderPass)));
+    return handle;
 }
 
-void DeviceState::add(UniquePtr<IFrameBuffer>&& frameBuffer)
+StateHandle<IFrameBuffer> DeviceState::add(UniquePtr<IFrameBuffer>&& frameBuffer)
 {
-    this->add(frameBuffer->name(), std::move(frameBuffer));
+    return this->add(frameBuffer->name(), std::move(frameBuffer));
 }
 
-void DeviceState::add(const String& id, UniquePtr<IFrameBuffer>&& frameBuffer)
+StateHandle<IFrameBuffer> DeviceState::add(const String& id, UniquePtr<IFrameBuffer>&& frameBuffer)
 {
     if (frameBuffer == nullptr) [[unlikely]]
         throw InvalidArgumentException("frameBuffer", "The frame buffer must be initialized.");
 
-    if (m_impl->m_frameBuffers.contains(id)) [[unlikely]]
+    auto handle = m_impl->m_frameBuffers.add(id, std::move(frameBuffer));
+
+    if (!handle.valid()) [[unlikely]]
         throw InvalidArgumentException("id", "Another frame buffer with the identifier \"{0}\" has already been registered in the device state.", id);
 
-    m_impl->m_frameBuffers.insert(std::make_pair(id, std::move(frameBuffer)));
+    return handle;
 }
 
-void DeviceState::add(UniquePtr<IPipeline>&& pipeline)
+StateHandle<IPipeline> DeviceState::add(UniquePtr<IPipeline>&& pipeline)
 {
-    this->add(pipeline->name(), std::move(pipeline));
+    return this->add(pipeline->name(), std::move(pipeline));
 }
 
-void DeviceState::add(const String& id, UniquePtr<IPipeline>&& pipeline)
+StateHandle<IPipeline> DeviceState::add(const String& id, UniquePtr<IPipeline>&& pipeline)
 {
     if (pipeline == nullptr) [[unlikely]]
         throw InvalidArgumentException("pipeline", "The pipeline must be initialized.");
 
-    if (m_impl->m_pipelines.contains(id)) [[unlikely]]
+    auto handle = m_impl->m_pipelines.add(id, std::move(pipeline));
+
+    if (!handle.valid()) [[unlikely]]
         throw InvalidArgumentException("id", "Another pipeline with the identifier \"{0}\" has already been registered in the device state.", id);
 
-    m_impl->m_pipelines.insert(std::make_pair(id, std::move(pipeline)));
+    return handle;
 }
 
-void DeviceState::add(UniquePtr<IBuffer>&& buffer)
+StateHandle<IBuffer> DeviceState::add(UniquePtr<IBuffer>&& buffer)
 {
-    this->add(buffer->name(), std::move(buffer));
+    return this->add(buffer->name(), std::move(buffer));
 }
 
-void DeviceState::add(const String& id, UniquePtr<IBuffer>&& buffer)
+StateHandle<IBuffer> DeviceState::add(const String& id, UniquePtr<IBuffer>&& buffer)
 {
     if (buffer == nullptr) [[unlikely]]
         throw InvalidArgumentException("buffer", "The buffer must be initialized.");
 
-    if (m_impl->m_buffers.contains(id)) [[unlikely]]
+    auto handle = m_impl->m_buffers.add(id, std::move(buffer));
+
+    if (!handle.valid()) [[unlikely]]
         throw InvalidArgumentException("id", "Another buffer with the identifier \"{0}\" has already been registered in the device state.", id);
 
-    m_impl->m_buffers.insert(std::make_pair(id, std::move(buffer)));
+    return handle;
 }
 
-void DeviceState::add(UniquePtr<IVertexBuffer>&& vertexBuffer)
+StateHandle<IVertexBuffer> DeviceState::add(UniquePtr<IVertexBuffer>&& vertexBuffer)
 {
-    this->add(vertexBuffer->name(), std::move(vertexBuffer));
+    return this->add(vertexBuffer->name(), std::move(vertexBuffer));
 }
 
-void DeviceState::add(const String& id, UniquePtr<IVertexBuffer>&& vertexBuffer)
+StateHandle<IVertexBuffer> DeviceState::add(const String& id, UniquePtr<IVertexBuffer>&& vertexBuffer)
 {
     if (vertexBuffer == nullptr) [[unlikely]]
         throw InvalidArgumentException("vertexBuffer", "The vertex buffer must be initialized.");
 
-    if (m_impl->m_vertexBuffers.contains(id)) [[unlikely]]
+    auto handle = m_impl->m_vertexBuffers.add(id, std::move(vertexBuffer));
+
+    if (!handle.valid()) [[unlikely]]
         throw InvalidArgumentException("id", "Another vertex buffer with the identifier \"{0}\" has already been registered in the device state.", id);
 
-    m_impl->m_vertexBuffers.insert(std::make_pair(id, std::move(vertexBuffer)));
+    return handle;
 }
 
-void DeviceState::add(UniquePtr<IIndexBuffer>&& indexBuffer)
+StateHandle<IIndexBuffer> DeviceState::add(UniquePtr<IIndexBuffer>&& indexBuffer)
 {
-    this->add(indexBuffer->name(), std::move(indexBuffer));
+    return this->add(indexBuffer->name(), std::move(indexBuffer));
 }
 
-void DeviceState::add(const String& id, UniquePtr<IIndexBuffer>&& indexBuffer)
+StateHandle<IIndexBuffer> DeviceState::add(const String& id, UniquePtr<IIndexBuffer>&& indexBuffer)
 {
     if (indexBuffer == nullptr) [[unlikely]]
         throw InvalidArgumentException("indexBuffer", "The index buffer must be initialized.");
 
-    if (m_impl->m_indexBuffers.contains(id)) [[unlikely]]
+    auto handle = m_impl->m_indexBuffers.add(id, std::move(indexBuffer));
+
+    if (!handle.valid()) [[unlikely]]
         throw InvalidArgumentException("id", "Another index buffer with the identifier \"{0}\" has already been registered in the device state.", id);
 
-    m_impl->m_indexBuffers.insert(std::make_pair(id, std::move(indexBuffer)));
+    return handle;
 }
 
-void DeviceState::add(UniquePtr<IImage>&& image)
+StateHandle<IImage> DeviceState::add(UniquePtr<IImage>&& image)
 {
-    this->add(image->name(), std::move(image));
+    return this->add(image->name(), std::move(image));
 }
 
-void DeviceState::add(const String& id, UniquePtr<IImage>&& image)
+StateHandle<IImage> DeviceState::add(const String& id, UniquePtr<IImage>&& image)
 {
     if (image == nullptr) [[unlikely]]
         throw InvalidArgumentException("image", "The image must be initialized.");
 
-    if (m_impl->m_images.contains(id)) [[unlikely]]
+    auto handle = m_impl->m_images.add(id, std::move(image));
+
+    if (!handle.valid()) [[unlikely]]
         throw InvalidArgumentException("id", "Another image with the identifier \"{0}\" has already been registered in the device state.", id);
 
-    m_impl->m_images.insert(std::make_pair(id, std::move(image)));
+    return handle;
 }
 
-void DeviceState::add(UniquePtr<ISampler>&& sampler)
+StateHandle<ISampler> DeviceState::add(UniquePtr<ISampler>&& sampler)
 {
-    this->add(sampler->name(), std::move(sampler));
+    return this->add(sampler->name(), std::move(sampler));
 }
 
-void DeviceState::add(const String& id, UniquePtr<ISampler>&& sampler)
+StateHandle<ISampler> DeviceState::add(const String& id, UniquePtr<ISampler>&& sampler)
 {
     if (sampler == nullptr) [[unlikely]]
         throw InvalidArgumentException("sampler", "The sampler must be initialized.");
 
-    if (m_impl->m_samplers.contains(id)) [[unlikely]]
+    auto handle = m_impl->m_samplers.add(id, std::move(sampler));
+
+    if (!handle.valid()) [[unlikely]]
         throw InvalidArgumentException("id", "Another sampler with the identifier \"{0}\" has already been registered in the device state.", id);
 
-    m_impl->m_samplers.insert(std::make_pair(id, std::move(sampler)));
+    return handle;
 }
 
-void DeviceState::add(UniquePtr<IAccelerationStructure>&& accelerationStructure)
+StateHandle<IAccelerationStructure> DeviceState::add(UniquePtr<IAccelerationStructure>&& accelerationStructure)
 {
-    this->add(accelerationStructure->name(), std::move(accelerationStructure));
+    return this->add(accelerationStructure->name(), std::move(accelerationStructure));
 }
 
-void DeviceState::add(const String& id, UniquePtr<IAccelerationStructure>&& accelerationStructure)
+StateHandle<IAccelerationStructure> DeviceState::add(const String& id, UniquePtr<IAccelerationStructure>&& accelerationStructure)
 {
     if (accelerationStructure == nullptr) [[unlikely]]
         throw InvalidArgumentException("accelerationStructure", "The acceleration structure must be initialized.");
 
-    if (m_impl->m_samplers.contains(id)) [[unlikely]]
+    auto handle = m_impl->m_accelerationStructures.add(id, std::move(accelerationStructure));
+
+    if (!handle.valid()) [[unlikely]]
         throw InvalidArgumentException("id", "Another acceleration structure with the identifier \"{0}\" has already been registered in the device state.", id);
 
-    m_impl->m_accelerationStructures.insert(std::make_pair(id, std::move(accelerationStructure)));
+    return handle;
 }
 
-void DeviceState::add(const String& id, UniquePtr<IDescriptorSet>&& descriptorSet)
+StateHandle<IDescriptorSet> DeviceState::add(const String& id, UniquePtr<IDescriptorSet>&& descriptorSet)
 {
     if (descriptorSet == nullptr) [[unlikely]]
         throw InvalidArgumentException("descriptorSet", "The descriptor set must be initialized.");
 
-    if (m_impl->m_descriptorSets.contains(id)) [[unlikely]]
+    auto handle = m_impl->m_descriptorSets.add(id, std::move(descriptorSet));
+
+    if (!handle.valid()) [[unlikely]]
         throw InvalidArgumentException("id", "Another descriptor set with the identifier \"{0}\" has already been registered in the device state.", id);
 
-    m_impl->m_descriptorSets.insert(std::make_pair(id, std::move(descriptorSet)));
+    return handle;
 }
 
 IRenderPass& DeviceState::renderPass(const String& id) const
 {
-    if (!m_impl->m_renderPasses.contains(id)) [[unlikely]]
+    auto renderPass = m_impl->m_renderPasses.find(id);
+
+    if (renderPass == nullptr) [[unlikely]]
         throw InvalidArgumentException("id", "No render pass with the identifier \"{0}\" has been registered in the device state.", id);
 
-    return *m_impl->m_renderPasses[id];
+    return *renderPass;
 }
 
 IFrameBuffer& DeviceState::frameBuffer(const String& id) const
 {
-    if (!m_impl->m_frameBuffers.contains(id)) [[unlikely]]
+    auto frameBuffer = m_impl->m_frameBuffers.find(id);
+
+    if (frameBuffer == nullptr) [[unlikely]]
         throw InvalidArgumentException("id", "No frame buffer with the identifier \"{0}\" has been registered in the device state.", id);
 
-    return *m_impl->m_frameBuffers[id];
+    return *frameBuffer;
 }
 
 IPipeline& DeviceState::pipeline(const String& id) const
 {
-    if (!m_impl->m_pipelines.contains(id)) [[unlikely]]
+    auto pipeline = m_impl->m_pipelines.find(id);
+
+    if (pipeline == nullptr) [[unlikely]]
         throw InvalidArgumentException("id", "No pipelines with the identifier \"{0}\" has been registered in the device state.", id);
 
-    return *m_impl->m_pipelines[id];
+    return *pipeline;
 }
 
 IBuffer& DeviceState::buffer(const String& id) const
 {
-    if (!m_impl->m_buffers.contains(id)) [[unlikely]]
+    auto buffer = m_impl->m_buffers.find(id);
+
+    if (buffer == nullptr) [[unlikely]]
         throw InvalidArgumentException("id", "No buffers with the identifier \"{0}\" has been registered in the device state.", id);
 
-    return *m_impl->m_buffers[id];
+    return *buffer;
 }
 
 IVertexBuffer& DeviceState::vertexBuffer(const String& id) const
 {
-    if (!m_impl->m_vertexBuffers.contains(id)) [[unlikely]]
+    auto vertexBuffer = m_impl->m_vertexBuffers.find(id);
+
+    if (vertexBuffer == nullptr) [[unlikely]]
         throw InvalidArgumentException("id", "No vertex buffers with the identifier \"{0}\" has been registered in the device state.", id);
 
-    return *m_impl->m_vertexBuffers[id];
+    return *vertexBuffer;
 }
 
 IIndexBuffer& DeviceState::indexBuffer(const String& id) const
 {
-    if (!m_impl->m_indexBuffers.contains(id)) [[unlikely]]
+    auto indexBuffer = m_impl->m_indexBuffers.find(id);
+
+    if (indexBuffer == nullptr) [[unlikely]]
         throw InvalidArgumentException("id", "No index buffers with the identifier \"{0}\" has been registered in the device state.", id);
 
-    return *m_impl->m_indexBuffers[id];
+    return *indexBuffer;
 }
 
 IImage& DeviceState::image(const String& id) const
 {
-    if (!m_impl->m_images.contains(id)) [[unlikely]]
+    auto image = m_impl->m_images.find(id);
+
+    if (image == nullptr) [[unlikely]]
         throw InvalidArgumentException("id", "No images with the identifier \"{0}\" has been registered in the device state.", id);
 
-    return *m_impl->m_images[id];
+    return *image;
 }
 
 ISampler& DeviceState::sampler(const String& id) const
 {
-    if (!m_impl->m_samplers.contains(id)) [[unlikely]]
+    auto sampler = m_impl->m_samplers.find(id);
+
+    if (sampler == nullptr) [[unlikely]]
         throw InvalidArgumentException("id", "No samplers with the identifier \"{0}\" has been registered in the device state.", id);
 
-    return *m_impl->m_samplers[id];
+    return *sampler;
 }
 
 IAccelerationStructure& DeviceState::accelerationStructure(const String& id) const
 {
-    if (!m_impl->m_accelerationStructures.contains(id)) [[unlikely]]
+    auto accelerationStructure = m_impl->m_accelerationStructures.find(id);
+
+    if (accelerationStructure == nullptr) [[unlikely]]
         throw InvalidArgumentException("id", "No acceleration structure with the identifier \"{0}\" has been registered in the device state.", id);
 
-    return *m_impl->m_accelerationStructures[id];
+    return *accelerationStructure;
 }
 
 IDescriptorSet& DeviceState::descriptorSet(const String& id) const
 {
-    if (!m_impl->m_descriptorSets.contains(id)) [[unlikely]]
+    auto descriptorSet = m_impl->m_descriptorSets.find(id);
+
+    if (descriptorSet == nullptr) [[unlikely]]
         throw InvalidArgumentException("id", "No descriptor sets with the identifier \"{0}\" has been registered in the device state.", id);
 
-    return *m_impl->m_descriptorSets[id];
+    return *descriptorSet;
 }
 
 bool DeviceState::release(const IRenderPass& renderPass)
 {
-    auto match = std::find_if(m_impl->m_renderPasses.begin(), m_impl->m_renderPasses.end(), [&renderPass](const auto& pair) { return pair.second.get() == &renderPass; });
-    
-    if (match == m_impl->m_renderPasses.end()) [[unlikely]]
-        return false;
-
-    match->second = nullptr;
-    m_impl->m_renderPasses.erase(match->first);
-
-    return true;
+    return m_impl->m_renderPasses.release(renderPass);
 }
 
 bool DeviceState::release(const IFrameBuffer& frameBuffer)
 {
-    auto match = std::find_if(m_impl->m_frameBuffers.begin(), m_impl->m_frameBuffers.end(), [&frameBuffer](const auto& pair) { return pair.second.get() == &frameBuffer; });
-    
-    if (match == m_impl->m_frameBuffers.end()) [[unlikely]]
-        return false;
-
-    match->second = nullptr;
-    m_impl->m_frameBuffers.erase(match->first);
-
-    return true;
+    return m_impl->m_frameBuffers.release(frameBuffer);
 }
 
 bool DeviceState::release(const IPipeline& pipeline)
 {
-    auto match = std::find_if(m_impl->m_pipelines.begin(), m_impl->m_pipelines.end(), [&pipeline](const auto& pair) { return pair.second.get() == &pipeline; });
-
-    if (match == m_impl->m_pipelines.end()) [[unlikely]]
-        return false;
-
-    match->second = nullptr;
-    m_impl->m_pipelines.erase(match->first);
-
-    return true;
+    return m_impl->m_pipelines.release(pipeline);
 }
 
 bool DeviceState::release(const IBuffer& buffer)
 {
-    auto match = std::find_if(m_impl->m_buffers.begin(), m_impl->m_buffers.end(), [&buffer](const auto& pair) { return pair.second.get() == &buffer; });
-
-    if (match == m_impl->m_buffers.end()) [[unlikely]]
-        return false;
-
-    match->second = nullptr;
-    m_impl->m_buffers.erase(match->first);
-
-    return true;
+    return m_impl->m_buffers.release(buffer);
 }
 
 bool DeviceState::release(const IVertexBuffer& vertexBuffer)
 {
-    auto match = std::find_if(m_impl->m_vertexBuffers.begin(), m_impl->m_vertexBuffers.end(), [&vertexBuffer](const auto& pair) { return pair.second.get() == &vertexBuffer; });
-
-    if (match == m_impl->m_vertexBuffers.end()) [[unlikely]]
-        return false;
-
-    match->second = nullptr;
-    m_impl->m_vertexBuffers.erase(match->first);
-
-    return true;
+    return m_impl->m_vertexBuffers.release(vertexBuffer);
 }
 
 bool DeviceState::release(const IIndexBuffer& indexBuffer)
 {
-    auto match = std::find_if(m_impl->m_indexBuffers.begin(), m_impl->m_indexBuffers.end(), [&indexBuffer](const auto& pair) { return pair.second.get() == &indexBuffer; });
-
-    if (match == m_impl->m_indexBuffers.end()) [[unlikely]]
-        return false;
-
-    match->second = nullptr;
-    m_impl->m_indexBuffers.erase(match->first);
-
-    return true;
+    return m_impl->m_indexBuffers.release(indexBuffer);
 }
 
 bool DeviceState::release(const IImage& image)
 {
-    auto match = std::find_if(m_impl->m_images.begin(), m_impl->m_images.end(), [&image](const auto& pair) { return pair.second.get() == &image; });
+    return m_impl->m_images.release(image);
+}
 
-    if (match == m_impl->m_images.end()) [[unlikely]]
-        return false;
+bool DeviceState::release(const ISampler& sampler)
+{
+    return m_impl->m_samplers.release(sampler);
+}
 
-    match->second = nullptr;
-    m_impl->m_images.erase(match->first);
+bool DeviceState::release(const IAccelerationStructure& accelerationStructure)
+{
+    return m_impl->m_accelerationStructures.release(accelerationStructure);
+}
 
-    return true;
+bool DeviceState::release(const IDescriptorSet& descriptorSet)
+{
+    return m_impl->m_descriptorSets.release(descriptorSet);
 }
 
-bool DeviceState::release(const ISampler& sampler)
+template <typename TResource>
+StateHandle<TResource> DeviceState::handle(StringView id) const
 {
-    auto match = std::find_if(m_impl->m_samplers.begin(), m_impl->m_samplers.end(), [&sampler](const auto& pair) { return pair.second.get() == &sampler; });
+    return m_impl->registry<TResource>().handle(id);
+}
 
-    if (match == m_impl->m_samplers.end()) [[unlikely]]
-        return false;
+template <typename TResource>
+TResource& DeviceState::get(StateHandle<TResource> handle) const
+{
+    auto resource = m_impl->registry<TResource>().find(handle);
 
-    match->second = nullptr;
-    m_impl->m_samplers.erase(match->first);
+    if (resource == nullptr) [[unlikely]]
+        throw InvalidArgumentException("handle", "The handle does not refer to a resource that is managed by the device state.");
 
-    return true;
+    return *resource;
 }
 
-bool DeviceState::release(const IDescriptorSet& descriptorSet)
+template <typename TResource>
+bool DeviceState::contains(StateHandle<TResource> handle) const
 {
-    auto match = std::find_if(m_impl->m_descriptorSets.begin(), m_impl->m_descriptorSets.end(), [&descriptorSet](const auto& pair) { return pair.second.get() == &descriptorSet; });
+    return m_impl->registry<TResource>().find(handle) != nullptr;
+}
 
-    if (match == m_impl->m_descriptorSets.end()) [[unlikely]]
-        return false;
+template <typename TResource>
+bool DeviceState::release(StateHandle<TResource> handle)
+{
+    return m_impl->registry<TResource>().release(handle);
+}
 
-    match->second = nullptr;
-    m_impl->m_descriptorSets.erase(match->first);
+// ------------------------------------------------------------------------------------------------
+// Explicit template instantiations.
+// ------------------------------------------------------------------------------------------------
 
-    return true;
-}
\ No newline at end of file
+template StateHandle<IRenderPass> DeviceState::handle<IRenderPass>(StringView) const;
+template IRenderPass& DeviceState::get<IRenderPass>(StateHandle<IRenderPass>) const;
+template bool DeviceState::contains<IRenderPass>(StateHandle<IRenderPass>) const;
+template bool DeviceState::release<IRenderPass>(StateHandle<IRenderPass>);
+
+template StateHandle<IFrameBuffer> DeviceState::handle<IFrameBuffer>(StringView) const;
+template IFrameBuffer& DeviceState::get<IFrameBuffer>(StateHandle<IFrameBuffer>) const;
+template bool DeviceState::contains<IFrameBuffer>(StateHandle<IFrameBuffer>) const;
+template bool DeviceState::release<IFrameBuffer>(StateHandle<IFrameBuffer>);
+
+template StateHandle<IPipeline> DeviceState::handle<IPipeline>(StringView) const;
+template IPipeline& DeviceState::get<IPipeline>(StateHandle<IPipeline>) const;
+template bool DeviceState::contains<IPipeline>(StateHandle<IPipeline>) const;
+template bool DeviceState::release<IPipeline>(StateHandle<IPipeline>);
+
+template StateHandle<IBuffer> DeviceState::handle<IBuffer>(StringView) const;
+template IBuffer& DeviceState::get<IBuffer>(StateHandle<IBuffer>) const;
+template bool DeviceState::contains<IBuffer>(StateHandle<IBuffer>) const;
+template bool DeviceState::release<IBuffer>(StateHandle<IBuffer>);
+
+template StateHandle<IVertexBuffer> DeviceState::handle<IVertexBuffer>(StringView) const;
+template IVertexBuffer& DeviceState::get<IVertexBuffer>(StateHandle<IVertexBuffer>) const;
+template bool DeviceState::contains<IVertexBuffer>(StateHandle<IVertexBuffer>) const;
+template bool DeviceState::release<IVertexBuffer>(StateHandle<IVertexBuffer>);
+
+template StateHandle<IIndexBuffer> DeviceState::handle<IIndexBuffer>(StringView) const;
+template IIndexBuffer& DeviceState::get<IIndexBuffer>(StateHandle<IIndexBuffer>) const;
+template bool DeviceState::contains<IIndexBuffer>(StateHandle<IIndexBuffer>) const;
+template bool DeviceState::release<IIndexBuffer>(StateHandle<IIndexBuffer>);
+
+template StateHandle<IImage> DeviceState::handle<IImage>(StringView) const;
+template IImage& DeviceState::get<IImage>(StateHandle<IImage>) const;
+template bool DeviceState::contains<IImage>(StateHandle<IImage>) const;
+template bool DeviceState::release<IImage>(StateHandle<IImage>);
+
+template StateHandle<ISampler> DeviceState::handle<ISampler>(StringView) const;
+template ISampler& DeviceState::get<ISampler>(StateHandle<ISampler>) const;
+template bool DeviceState::contains<ISampler>(StateHandle<ISampler>) const;
+template bool DeviceState::release<ISampler>(StateHandle<ISampler>);
+
+template StateHandle<IAccelerationStructure> DeviceState::handle<IAccelerationStructure>(StringView) const;
+template IAccelerationStructure& DeviceState::get<IAccelerationStructure>(StateHandle<IAccelerationStructure>) const;
+template bool DeviceState::contains<IAccelerationStructure>(StateHandle<IAccelerationStructure>) const;
+template bool DeviceState::release<IAccelerationStructure>(StateHandle<IAccelerationStructure>);
+
+template StateHandle<IDescriptorSet> DeviceState::handle<IDescriptorSet>(StringView) const;
+template IDescriptorSet& DeviceState::get<IDescriptorSet>(StateHandle<IDescriptorSet>) const;
+template bool DeviceState::contains<IDescriptorSet>(StateHandle<IDescriptorSet>) const;
+template bool DeviceState::release<IDescriptorSet>(StateHandle<IDescriptorSet>);
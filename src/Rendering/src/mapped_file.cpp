@@ -0,0 +1,173 @@
+#include <litefx/rendering.hpp>
+
+#if defined _WIN32 || defined WINCE
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#define LITEFX_MAPPED_FILE_USE_WIN32
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace LiteFX::Rendering;
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class MappedFile::MappedFileImpl : public Implement<MappedFile> {
+public:
+	friend class MappedFile;
+
+private:
+	String m_fileName;
+	const std::byte* m_data { nullptr };
+	size_t m_size { 0 };
+
+#ifdef LITEFX_MAPPED_FILE_USE_WIN32
+	HANDLE m_file { INVALID_HANDLE_VALUE }, m_mapping { nullptr };
+#else
+	int m_file { -1 };
+#endif
+
+public:
+	MappedFileImpl(MappedFile* parent, const String& fileName) :
+		base(parent), m_fileName(fileName)
+	{
+	}
+
+	~MappedFileImpl() noexcept
+	{
+		this->release();
+	}
+
+public:
+#ifdef LITEFX_MAPPED_FILE_USE_WIN32
+	void initialize()
+	{
+		m_file = ::CreateFileW(Widen(m_fileName).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+		if (m_file == INVALID_HANDLE_VALUE) [[unlikely]]
+			throw RuntimeException("Unable to open file {0} (Error {1:#x}).", m_fileName, ::GetLastError());
+
+		LARGE_INTEGER size;
+
+		if (!::GetFileSizeEx(m_file, &size)) [[unlikely]]
+		{
+			auto error = ::GetLastError();
+			this->release();
+			throw RuntimeException("Unable to query size of file {0} (Error {1:#x}).", m_fileName, error);
+		}
+
+		// Empty files cannot be mapped.
+		if ((m_size = static_cast<size_t>(size.QuadPart)) == 0)
+			return;
+
+		m_mapping = ::CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (m_mapping == nullptr || (m_data = static_cast<const std::byte*>(::MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0))) == nullptr) [[unlikely]]
+		{
+			auto error = ::GetLastError();
+			this->release();
+			throw RuntimeException("Unable to map file {0} into memory (Error {1:#x}).", m_fileName, error);
+		}
+	}
+
+	void release() noexcept
+	{
+		if (m_data != nullptr)
+			::UnmapViewOfFile(m_data);
+
+		if (m_mapping != nullptr)
+			::CloseHandle(m_mapping);
+
+		if (m_file != INVALID_HANDLE_VALUE)
+			::CloseHandle(m_file);
+
+		m_data = nullptr;
+		m_mapping = nullptr;
+		m_file = INVALID_HANDLE_VALUE;
+		m_size = 0;
+	}
+#else
+	void initialize()
+	{
+		m_file = ::open(m_fileName.c_str(), O_RDONLY | O_CLOEXEC);
+
+		if (m_file == -1) [[unlikely]]
+			throw RuntimeException("Unable to open file {0} (Error {1}).", m_fileName, errno);
+
+		struct stat status;
+
+		if (::fstat(m_file, &status) == -1) [[unlikely]]
+		{
+			auto error = errno;
+			this->release();
+			throw RuntimeException("Unable to query size of file {0} (Error {1}).", m_fileName, error);
+		}
+
+		// Empty files cannot be mapped.
+		if ((m_size = static_cast<size_t>(status.st_size)) == 0)
+			return;
+
+		auto data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_file, 0);
+
+		if (data == MAP_FAILED) [[unlikely]]
+		{
+			auto error = errno;
+			this->release();
+			throw RuntimeException("Unable to map file {0} into memory (Error {1}).", m_fileName, error);
+		}
+
+		m_data = static_cast<const std::byte*>(data);
+	}
+
+	void release() noexcept
+	{
+		if (m_data != nullptr)
+			::munmap(const_cast<std::byte*>(m_data), m_size);
+
+		if (m_file != -1)
+			::close(m_file);
+
+		m_data = nullptr;
+		m_file = -1;
+		m_size = 0;
+	}
+#endif
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+MappedFile::MappedFile(const String& fileName) :
+	m_impl(makePimpl<MappedFileImpl>(this, fileName))
+{
+	m_impl->initialize();
+}
+
+MappedFile::~MappedFile() noexcept = default;
+
+const String& MappedFile::fileName() const noexcept
+{
+	return m_impl->m_fileName;
+}
+
+Span<const std::byte> MappedFile::data() const noexcept
+{
+	return { m_impl->m_data, m_impl->m_size };
+}
+
+size_t MappedFile::size() const noexcept
+{
+	return m_impl->m_size;
+}
@@ -0,0 +1,121 @@
+#include <litefx/rendering.hpp>
+#include <mutex>
+
+using namespace LiteFX::Rendering;
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class MemoryTracker::MemoryTrackerImpl : public Implement<MemoryTracker> {
+public:
+	friend class MemoryTracker;
+
+private:
+	mutable std::mutex m_mutex;
+	GraphicsMemoryStatistics m_statistics { };
+	Dictionary<UInt32, bool> m_exceeded;
+	Float m_threshold { 0.9f };
+
+public:
+	MemoryTrackerImpl(MemoryTracker* parent) :
+		base(parent)
+	{
+	}
+
+public:
+	void add(ResourceHeap heap, Optional<BufferType> type, UInt64 size, bool release)
+	{
+		auto update = [size, release](MemoryUsage& usage) {
+			if (release)
+			{
+				usage.Allocations--;
+				usage.Bytes -= size;
+			}
+			else
+			{
+				usage.Allocations++;
+				usage.Bytes += size;
+			}
+		};
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		update(m_statistics.Total);
+		update(m_statistics.Heaps[heap]);
+		update(type.has_value() ? m_statistics.Buffers[*type] : m_statistics.Images);
+	}
+};
+
+struct MemoryTracker::Allocation {
+	MemoryTrackerImpl* Tracker;
+	ResourceHeap Heap;
+	Optional<BufferType> Type;
+	UInt64 Size;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+MemoryTracker::MemoryTracker() noexcept :
+	m_impl(makePimpl<MemoryTrackerImpl>(this))
+{
+}
+
+MemoryTracker::~MemoryTracker() noexcept = default;
+
+MemoryTracker::Allocation* MemoryTracker::track(ResourceHeap heap, Optional<BufferType> type, UInt64 size)
+{
+	auto allocation = new Allocation { .Tracker = m_impl.get(), .Heap = heap, .Type = type, .Size = size };
+	m_impl->add(heap, type, size, false);
+	return allocation;
+}
+
+void MemoryTracker::release(Allocation* allocation) noexcept
+{
+	if (allocation == nullptr)
+		return;
+
+	allocation->Tracker->add(allocation->Heap, allocation->Type, allocation->Size, true);
+	delete allocation;
+}
+
+GraphicsMemoryStatistics MemoryTracker::statistics() const
+{
+	std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+	return m_impl->m_statistics;
+}
+
+Float MemoryTracker::budgetThreshold() const noexcept
+{
+	std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+	return m_impl->m_threshold;
+}
+
+void MemoryTracker::setBudgetThreshold(Float threshold)
+{
+	if (!(threshold > 0.f && threshold <= 1.f)) [[unlikely]]
+		throw ArgumentOutOfRangeException("threshold", 0.f, 1.f, threshold, "The budget threshold must be greater than 0 and not greater than 1, but was {0}.", threshold);
+
+	std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+	m_impl->m_threshold = threshold;
+}
+
+Array<MemoryHeapBudget> MemoryTracker::checkBudgets(Span<const MemoryHeapBudget> budgets)
+{
+	Array<MemoryHeapBudget> exceeded;
+	std::lock_guard<std::mutex> lock(m_impl->m_mutex);
+
+	for (const auto& budget : budgets)
+	{
+		auto isExceeded = budget.Budget > 0 && static_cast<Float>(budget.Usage) > static_cast<Float>(budget.Budget) * m_impl->m_threshold;
+		auto& wasExceeded = m_impl->m_exceeded[budget.Heap];
+
+		if (isExceeded && !wasExceeded)
+			exceeded.push_back(budget);
+
+		wasExceeded = isExceeded;
+	}
+
+	return exceeded;
+}
@@ -0,0 +1,276 @@
+#include <litefx/rendering.hpp>
+#include <bit>
+#include <cstring>
+#include <mutex>
+
+using namespace LiteFX::Rendering;
+
+// NOTE: The layout of the archive must match the one written by the `pckar` tool of the shader build script (see `cmake/Shaders.cmake`). All values are stored in
+//       little endian byte order. The header is followed by the entry table, the string table, the bytecode of each module (aligned to 16 bytes) and the reflection data.
+constexpr UInt32 SHADER_ARCHIVE_MAGIC = 0x4158464C; // "LFXA"
+constexpr UInt32 SHADER_ARCHIVE_VERSION = 1;
+constexpr UInt32 SHADER_ARCHIVE_FLAG_LZ4 = 0x00000001;
+
+// An LZ4 block can not expand to more than 255 bytes per compressed byte, since each byte of a match length adds at most 255 to the length.
+constexpr UInt64 LZ4_MAX_EXPANSION = 255;
+
+struct ShaderArchiveHeader {
+	UInt32 Magic;
+	UInt32 Version;
+	UInt32 Entries;
+	UInt32 StringTableSize;
+	UInt64 ReflectionOffset;
+	UInt64 ReflectionSize;
+};
+
+struct ShaderArchiveRecord {
+	UInt32 NameOffset;
+	UInt32 NameLength;
+	UInt32 EntryPointOffset;
+	UInt32 EntryPointLength;
+	UInt32 Stage;
+	UInt32 Flags;
+	UInt64 Hash;
+	UInt64 Offset;
+	UInt64 Size;
+	UInt64 UncompressedSize;
+};
+
+static_assert(sizeof(ShaderArchiveHeader) == 32 && sizeof(ShaderArchiveRecord) == 56, "The shader archive layout must not contain any padding.");
+
+// Returns `true`, if the range of `length` bytes at `offset` lies within a buffer of `size` bytes. Written so that corrupt values can not overflow.
+static constexpr bool isInRange(UInt64 offset, UInt64 length, UInt64 size) noexcept
+{
+	return offset <= size && length <= size - offset;
+}
+
+// Returns `true`, if the value describes exactly one shader stage, or an unknown stage.
+static constexpr bool isValidStage(UInt32 stage) noexcept
+{
+	return stage == static_cast<UInt32>(ShaderStage::Other) || (std::has_single_bit(stage) && stage <= static_cast<UInt32>(ShaderStage::Callable));
+}
+
+// Decompresses a single LZ4 block. Returns `false`, if the block is malformed or does not decompress to exactly `destination.size()` bytes.
+static bool decompressLZ4(Span<const std::byte> source, Span<std::byte> destination) noexcept
+{
+	const auto* in = reinterpret_cast<const UInt8*>(source.data());
+	const auto* inEnd = in + source.size();
+	auto* out = reinterpret_cast<UInt8*>(destination.data());
+	auto* outStart = out;
+	auto* outEnd = out + destination.size();
+
+	auto readLength = [&](size_t length) -> Optional<size_t> {
+		if (length != 15)
+			return length;
+
+		UInt8 next { 255 };
+
+		while (next == 255)
+		{
+			if (in == inEnd)
+				return std::nullopt;
+
+			next = *in++;
+			length += next;
+		}
+
+		return length;
+	};
+
+	while (in < inEnd)
+	{
+		const auto token = *in++;
+
+		// Copy the literals.
+		auto literals = readLength(token >> 4);
+
+		if (!literals.has_value() || static_cast<size_t>(inEnd - in) < *literals || static_cast<size_t>(outEnd - out) < *literals)
+			return false;
+
+		std::memcpy(out, in, *literals);
+		in += *literals;
+		out += *literals;
+
+		// The last sequence only contains literals.
+		if (in == inEnd)
+			break;
+
+		// Copy the match. Matches may overlap with the output, so they are copied byte by byte.
+		if (inEnd - in < 2)
+			return false;
+
+		const size_t offset = static_cast<size_t>(in[0]) | (static_cast<size_t>(in[1]) << 8);
+		in += 2;
+		auto match = readLength(token & 0x0F);
+
+		if (offset == 0 || offset > static_cast<size_t>(out - outStart) || !match.has_value() || static_cast<size_t>(outEnd - out) < *match + 4)
+			return false;
+
+		const auto* from = out - offset;
+
+		for (size_t i { 0 }, length = *match + 4; i < length; ++i)
+			*out++ = *from++;
+	}
+
+	return out == outEnd;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class ShaderArchive::ShaderArchiveImpl : public Implement<ShaderArchive> {
+public:
+	friend class ShaderArchive;
+
+private:
+	MappedFile m_file;
+	Array<ShaderArchiveEntry> m_entries;
+	Dictionary<String, size_t> m_index;
+	Span<const std::byte> m_reflectionData;
+
+	// NOTE: Decompressed modules are stored in buffers of 32 bit words to satisfy the alignment requirements of SPIR-V.
+	mutable std::mutex m_mutex;
+	Array<Array<UInt32>> m_decompressed;
+
+public:
+	ShaderArchiveImpl(ShaderArchive* parent, const String& fileName) :
+		base(parent), m_file(fileName)
+	{
+	}
+
+public:
+	void initialize()
+	{
+		const auto data = m_file.data();
+		ShaderArchiveHeader header;
+
+		if (data.size() < sizeof(header)) [[unlikely]]
+			throw RuntimeException("The file {0} is not a valid shader archive.", m_file.fileName());
+
+		std::memcpy(&header, data.data(), sizeof(header));
+
+		if (header.Magic != SHADER_ARCHIVE_MAGIC) [[unlikely]]
+			throw RuntimeException("The file {0} is not a valid shader archive.", m_file.fileName());
+
+		if (header.Version != SHADER_ARCHIVE_VERSION) [[unlikely]]
+			throw RuntimeException("The shader archive {0} has an unsupported version {1} (expected version {2}).", m_file.fileName(), header.Version, SHADER_ARCHIVE_VERSION);
+
+		const auto recordsOffset = sizeof(header);
+		const auto stringsOffset = recordsOffset + static_cast<UInt64>(header.Entries) * sizeof(ShaderArchiveRecord);
+
+		if (!isInRange(stringsOffset, header.StringTableSize, data.size()) || !isInRange(header.ReflectionOffset, header.ReflectionSize, data.size())) [[unlikely]]
+			throw RuntimeException("The shader archive {0} is truncated.", m_file.fileName());
+
+		const auto strings = StringView(reinterpret_cast<const char*>(data.data()) + stringsOffset, header.StringTableSize);
+		m_reflectionData = data.subspan(static_cast<size_t>(header.ReflectionOffset), static_cast<size_t>(header.ReflectionSize));
+		m_entries.reserve(header.Entries);
+		m_decompressed.resize(header.Entries);
+
+		for (UInt32 i { 0 }; i < header.Entries; ++i)
+		{
+			ShaderArchiveRecord record;
+			std::memcpy(&record, data.data() + recordsOffset + i * sizeof(record), sizeof(record));
+
+			if (!isInRange(record.NameOffset, record.NameLength, strings.size()) || !isInRange(record.EntryPointOffset, record.EntryPointLength, strings.size()) ||
+				!isInRange(record.Offset, record.Size, data.size()) || !isValidStage(record.Stage)) [[unlikely]]
+				throw RuntimeException("The shader archive {0} contains an invalid entry at index {1}.", m_file.fileName(), i);
+
+			auto& entry = m_entries.emplace_back(ShaderArchiveEntry {
+				.Name = String(strings.substr(record.NameOffset, record.NameLength)),
+				.EntryPoint = String(strings.substr(record.EntryPointOffset, record.EntryPointLength)),
+				.Stage = static_cast<ShaderStage>(record.Stage),
+				.Hash = record.Hash,
+				.Offset = record.Offset,
+				.Size = record.Size,
+				.UncompressedSize = record.UncompressedSize,
+				.Compressed = (record.Flags & SHADER_ARCHIVE_FLAG_LZ4) != 0
+			});
+
+			// Uncompressed modules are used in place, so they must be aligned to SPIR-V words. Compressed modules are decompressed into a buffer of the uncompressed size,
+			// which must not exceed what the compressed data can expand to.
+			if (entry.Compressed ? entry.UncompressedSize > entry.Size * LZ4_MAX_EXPANSION : 
+				(entry.Size != entry.UncompressedSize || entry.Offset % sizeof(UInt32) != 0 || entry.Size % sizeof(UInt32) != 0)) [[unlikely]]
+				throw RuntimeException("The shader archive {0} contains an invalid entry at index {1}.", m_file.fileName(), i);
+
+			if (!m_index.emplace(entry.Name, i).second) [[unlikely]]
+				throw RuntimeException("The shader archive {0} contains multiple shader modules with the name {1}.", m_file.fileName(), entry.Name);
+		}
+	}
+
+	size_t indexOf(const String& name) const
+	{
+		auto match = m_index.find(name);
+
+		if (match == m_index.end()) [[unlikely]]
+			throw InvalidArgumentException("name", "The shader archive {0} does not contain a shader module with the name {1}.", m_file.fileName(), name);
+
+		return match->second;
+	}
+
+	Span<const std::byte> bytecode(size_t index)
+	{
+		const auto& entry = m_entries[index];
+		const auto stored = m_file.data().subspan(static_cast<size_t>(entry.Offset), static_cast<size_t>(entry.Size));
+
+		if (!entry.Compressed)
+			return stored;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto& buffer = m_decompressed[index];
+
+		if (buffer.empty() && entry.UncompressedSize > 0)
+		{
+			Array<UInt32> decompressed((static_cast<size_t>(entry.UncompressedSize) + sizeof(UInt32) - 1) / sizeof(UInt32));
+
+			if (!decompressLZ4(stored, { reinterpret_cast<std::byte*>(decompressed.data()), static_cast<size_t>(entry.UncompressedSize) })) [[unlikely]]
+				throw RuntimeException("Unable to decompress shader module {0} from archive {1}.", entry.Name, m_file.fileName());
+
+			buffer = std::move(decompressed);
+		}
+
+		return { reinterpret_cast<const std::byte*>(buffer.data()), static_cast<size_t>(entry.UncompressedSize) };
+	}
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+ShaderArchive::ShaderArchive(const String& fileName) :
+	m_impl(makePimpl<ShaderArchiveImpl>(this, fileName))
+{
+	m_impl->initialize();
+}
+
+ShaderArchive::~ShaderArchive() noexcept = default;
+
+const String& ShaderArchive::fileName() const noexcept
+{
+	return m_impl->m_file.fileName();
+}
+
+const Array<ShaderArchiveEntry>& ShaderArchive::entries() const noexcept
+{
+	return m_impl->m_entries;
+}
+
+bool ShaderArchive::contains(const String& name) const noexcept
+{
+	return m_impl->m_index.contains(name);
+}
+
+const ShaderArchiveEntry& ShaderArchive::entry(const String& name) const
+{
+	return m_impl->m_entries[m_impl->indexOf(name)];
+}
+
+Span<const std::byte> ShaderArchive::bytecode(const String& name) const
+{
+	return m_impl->bytecode(m_impl->indexOf(name));
+}
+
+Span<const std::byte> ShaderArchive::reflectionData() const noexcept
+{
+	return m_impl->m_reflectionData;
+}
@@ -0,0 +1,196 @@
+#include <litefx/rendering.hpp>
+
+using namespace LiteFX::Rendering;
+
+static inline UInt64 align(UInt64 offset, UInt64 alignment) noexcept {
+	return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+static inline bool overlaps(const TransientResourceRequirements& a, const TransientResourceRequirements& b) noexcept {
+	return a.FirstUse <= b.LastUse && b.FirstUse <= a.LastUse;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class TransientMemoryPlanner::TransientMemoryPlannerImpl : public Implement<TransientMemoryPlanner> {
+public:
+	friend class TransientMemoryPlanner;
+
+private:
+	Array<TransientResourceRequirements> m_resources;
+	Array<TransientResourcePlacement> m_placements;
+	Array<TransientMemoryBlock> m_blocks;
+	TransientMemoryStatistics m_statistics { };
+
+public:
+	TransientMemoryPlannerImpl(TransientMemoryPlanner* parent) :
+		base(parent)
+	{
+	}
+
+private:
+	UInt64 findOffset(UInt32 block, UInt32 resource, Span<const UInt32> placed) const
+	{
+		// Collect the memory ranges of all resources in the block, that are alive at the same time.
+		const auto& requirements = m_resources[resource];
+		Array<std::pair<UInt64, UInt64>> occupied;
+
+		for (auto other : placed)
+		{
+			if (m_placements[other].Block == block && overlaps(requirements, m_resources[other]))
+				occupied.emplace_back(m_placements[other].Offset, m_placements[other].Offset + m_resources[other].Size);
+		}
+
+		std::ranges::sort(occupied);
+
+		// Find the first gap that is large enough to hold the resource.
+		UInt64 offset { 0 };
+
+		for (const auto& [begin, end] : occupied)
+		{
+			if (align(offset, requirements.Alignment) + requirements.Size <= begin)
+				break;
+
+			offset = std::max(offset, end);
+		}
+
+		return align(offset, requirements.Alignment);
+	}
+
+public:
+	void plan()
+	{
+		const auto count = static_cast<UInt32>(m_resources.size());
+		m_placements.assign(count, { });
+		m_blocks.clear();
+
+		// Place the largest resources first, as they are the hardest to fit into gaps.
+		auto order = std::views::iota(0u, count) | std::ranges::to<Array<UInt32>>();
+		std::ranges::stable_sort(order, [this](UInt32 a, UInt32 b) { return m_resources[a].Size > m_resources[b].Size; });
+
+		for (UInt32 i { 0 }; i < count; ++i)
+		{
+			const auto resource = order[i];
+			const auto& requirements = m_resources[resource];
+			const auto placed = Span<const UInt32>(order).subspan(0, i);
+
+			// Choose the compatible block that needs to grow the least.
+			Optional<UInt32> bestBlock;
+			UInt64 bestOffset { 0 }, bestGrowth { 0 };
+
+			for (UInt32 block { 0 }; block < static_cast<UInt32>(m_blocks.size()); ++block)
+			{
+				if ((m_blocks[block].MemoryTypes & requirements.MemoryTypes) == 0)
+					continue;
+
+				auto offset = this->findOffset(block, resource, placed);
+				auto end = offset + requirements.Size;
+				auto growth = end > m_blocks[block].Size ? end - m_blocks[block].Size : 0;
+
+				if (!bestBlock.has_value() || growth < bestGrowth)
+				{
+					bestBlock = block;
+					bestOffset = offset;
+					bestGrowth = growth;
+				}
+			}
+
+			if (!bestBlock.has_value())
+			{
+				bestBlock = static_cast<UInt32>(m_blocks.size());
+				m_blocks.push_back({ .Size = 0, .Alignment = requirements.Alignment, .MemoryTypes = requirements.MemoryTypes });
+			}
+
+			auto& block = m_blocks[*bestBlock];
+			block.Size = std::max(block.Size, bestOffset + requirements.Size);
+			block.Alignment = std::max(block.Alignment, requirements.Alignment);
+			block.MemoryTypes &= requirements.MemoryTypes;
+			m_placements[resource].Block = *bestBlock;
+			m_placements[resource].Offset = bestOffset;
+		}
+
+		// Find the resources that previously occupied the memory of each resource.
+		for (UInt32 resource { 0 }; resource < count; ++resource)
+		{
+			const auto& placement = m_placements[resource];
+			const auto& requirements = m_resources[resource];
+
+			for (UInt32 other { 0 }; other < count; ++other)
+			{
+				const auto& otherPlacement = m_placements[other];
+
+				if (other != resource && otherPlacement.Block == placement.Block && m_resources[other].LastUse < requirements.FirstUse &&
+					otherPlacement.Offset < placement.Offset + requirements.Size && placement.Offset < otherPlacement.Offset + m_resources[other].Size)
+					m_placements[resource].Aliases.push_back(other);
+			}
+		}
+
+		m_statistics = {
+			.Resources = count,
+			.Blocks = static_cast<UInt32>(m_blocks.size()),
+			.AliasedMemory = std::ranges::fold_left(m_blocks | std::views::transform([](const auto& block) { return block.Size; }), 0ull, std::plus<>{}),
+			.UnaliasedMemory = std::ranges::fold_left(m_resources | std::views::transform([](const auto& resource) { return align(resource.Size, resource.Alignment); }), 0ull, std::plus<>{})
+		};
+	}
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+TransientMemoryPlanner::TransientMemoryPlanner() noexcept :
+	m_impl(makePimpl<TransientMemoryPlannerImpl>(this))
+{
+}
+
+TransientMemoryPlanner::~TransientMemoryPlanner() noexcept = default;
+
+UInt32 TransientMemoryPlanner::add(const TransientResourceRequirements& requirements)
+{
+	if (requirements.Alignment == 0 || (requirements.Alignment & (requirements.Alignment - 1)) != 0) [[unlikely]]
+		throw InvalidArgumentException("requirements", "The alignment of a transient resource must be a power of two, but was {0}.", requirements.Alignment);
+
+	if (requirements.MemoryTypes == 0) [[unlikely]]
+		throw InvalidArgumentException("requirements", "A transient resource must support at least one memory type.");
+
+	if (requirements.LastUse < requirements.FirstUse) [[unlikely]]
+		throw InvalidArgumentException("requirements", "The last use of a transient resource ({0}) must not be before its first use ({1}).", requirements.LastUse, requirements.FirstUse);
+
+	m_impl->m_resources.push_back(requirements);
+	return static_cast<UInt32>(m_impl->m_resources.size() - 1);
+}
+
+void TransientMemoryPlanner::clear() noexcept
+{
+	m_impl->m_resources.clear();
+	m_impl->m_placements.clear();
+	m_impl->m_blocks.clear();
+	m_impl->m_statistics = { };
+}
+
+void TransientMemoryPlanner::plan()
+{
+	m_impl->plan();
+}
+
+const Array<TransientResourceRequirements>& TransientMemoryPlanner::resources() const noexcept
+{
+	return m_impl->m_resources;
+}
+
+const Array<TransientResourcePlacement>& TransientMemoryPlanner::placements() const noexcept
+{
+	return m_impl->m_placements;
+}
+
+const Array<TransientMemoryBlock>& TransientMemoryPlanner::blocks() const noexcept
+{
+	return m_impl->m_blocks;
+}
+
+const TransientMemoryStatistics& TransientMemoryPlanner::statistics() const noexcept
+{
+	return m_impl->m_statistics;
+}
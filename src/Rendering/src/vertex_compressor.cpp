@@ -0,0 +1,335 @@
+#include <litefx/rendering.hpp>
+
+using namespace LiteFX::Rendering;
+using Vertex = LiteFX::Graphics::Vertex;
+
+// ------------------------------------------------------------------------------------------------
+// Implementation.
+// ------------------------------------------------------------------------------------------------
+
+class VertexCompressor::VertexCompressorImpl : public Implement<VertexCompressor> {
+public:
+    friend class VertexCompressor;
+
+private:
+    enum class Encoding {
+        Float32,
+        Float16,
+        Unorm8,
+        Unorm16,
+        Snorm16,
+        Octahedral
+    };
+
+    struct Attribute {
+        AttributeSemantic semantic;
+        BufferFormat format;
+        UInt32 offset;
+        UInt32 channels;
+        Encoding encoding;
+    };
+
+    /// <summary>
+    /// The number of vertices that are converted at once. Each member is gathered from a block of vertices into a contiguous array, which is then converted
+    /// using the bulk conversions.
+    /// </summary>
+    static constexpr size_t BLOCK_SIZE = 256;
+
+private:
+    Array<Attribute> m_attributes;
+    size_t m_elementSize;
+
+public:
+    VertexCompressorImpl(VertexCompressor* parent, const IVertexBufferLayout& layout) :
+        base(parent), m_elementSize(layout.elementSize())
+    {
+        for (auto attribute : layout.attributes())
+            m_attributes.push_back(this->validate(*attribute));
+    }
+
+    VertexCompressorImpl(VertexCompressor* parent, const VertexCompressorImpl& other) :
+        base(parent), m_attributes(other.m_attributes), m_elementSize(other.m_elementSize)
+    {
+    }
+
+private:
+    Attribute validate(const BufferAttribute& attribute) const
+    {
+        auto format = attribute.format();
+        auto semantic = attribute.semantic();
+        auto channels = getBufferFormatChannels(format);
+        auto channelSize = getBufferFormatChannelSize(format);
+        Encoding encoding;
+
+        switch (getBufferFormatType(format))
+        {
+        case 0x01: // Floating point.
+            if (channelSize != 16 && channelSize != 32) [[unlikely]]
+                throw InvalidArgumentException("layout", "The format {0} of the {1} attribute is not supported.", format, semantic);
+
+            encoding = channelSize == 32 ? Encoding::Float32 : Encoding::Float16;
+            break;
+        case 0x08: // Signed normalized.
+            if (channelSize != 16) [[unlikely]]
+                throw InvalidArgumentException("layout", "The format {0} of the {1} attribute is not supported.", format, semantic);
+
+            encoding = semantic == AttributeSemantic::Normal && channels == 2 ? Encoding::Octahedral : Encoding::Snorm16;
+            break;
+        case 0x10: // Unsigned normalized.
+            if (channelSize != 8 && channelSize != 16) [[unlikely]]
+                throw InvalidArgumentException("layout", "The format {0} of the {1} attribute is not supported.", format, semantic);
+
+            encoding = channelSize == 8 ? Encoding::Unorm8 : Encoding::Unorm16;
+            break;
+        default: [[unlikely]]
+            throw InvalidArgumentException("layout", "The format {0} of the {1} attribute is not supported.", format, semantic);
+        }
+
+        bool supported = false;
+
+        switch (semantic)
+        {
+        case AttributeSemantic::Position:
+            supported = (channels == 3 || channels == 4) && (encoding == Encoding::Float32 || encoding == Encoding::Float16);
+            break;
+        case AttributeSemantic::Color:
+            supported = (channels == 3 || channels == 4) && encoding != Encoding::Snorm16;
+            break;
+        case AttributeSemantic::Normal:
+            supported = encoding == Encoding::Octahedral || ((channels == 3 || channels == 4) && encoding != Encoding::Unorm8 && encoding != Encoding::Unorm16);
+            break;
+        case AttributeSemantic::TextureCoordinate:
+            supported = attribute.semanticIndex() == 0 && channels == 2 && encoding != Encoding::Unorm8;
+            break;
+        default:
+            break;
+        }
+
+        if (!supported) [[unlikely]]
+            throw InvalidArgumentException("layout", "The format {0} of the {1} attribute (semantic index {2}) is not supported.", format, semantic, attribute.semanticIndex());
+
+        if (attribute.offset() + channels * channelSize / 8 > m_elementSize) [[unlikely]]
+            throw InvalidArgumentException("layout", "The {0} attribute exceeds the size of a vertex.", semantic);
+
+        return { semantic, format, attribute.offset(), channels, encoding };
+    }
+
+    static Float read(const Vertex& vertex, AttributeSemantic semantic, UInt32 channel) noexcept
+    {
+        switch (semantic)
+        {
+        case AttributeSemantic::Position: return channel < 3 ? vertex.Position[channel] : 1.f;
+        case AttributeSemantic::Color: return vertex.Color[channel];
+        case AttributeSemantic::Normal: return channel < 3 ? vertex.Normal[channel] : 0.f;
+        default: return vertex.TextureCoordinate0[channel];
+        }
+    }
+
+    static void write(Vertex& vertex, AttributeSemantic semantic, UInt32 channel, Float value) noexcept
+    {
+        switch (semantic)
+        {
+        case AttributeSemantic::Position: if (channel < 3) vertex.Position[channel] = value; break;
+        case AttributeSemantic::Color: vertex.Color[channel] = value; break;
+        case AttributeSemantic::Normal: if (channel < 3) vertex.Normal[channel] = value; break;
+        default: vertex.TextureCoordinate0[channel] = value; break;
+        }
+    }
+
+    template <typename T>
+    void scatter(std::span<const T> values, const Attribute& attribute, Byte* destination, size_t count) const noexcept
+    {
+        auto size = attribute.channels * sizeof(T);
+
+        for (size_t i{ 0 }; i < count; ++i)
+            std::memcpy(destination + i * m_elementSize + attribute.offset, values.data() + i * attribute.channels, size);
+    }
+
+    template <typename T>
+    void gather(std::span<T> values, const Attribute& attribute, const Byte* source, size_t count) const noexcept
+    {
+        auto size = attribute.channels * sizeof(T);
+
+        for (size_t i{ 0 }; i < count; ++i)
+            std::memcpy(values.data() + i * attribute.channels, source + i * m_elementSize + attribute.offset, size);
+    }
+
+public:
+    void compress(std::span<const Vertex> vertices, Byte* destination) const
+    {
+        std::array<Float, BLOCK_SIZE * 4> values;
+        std::array<Vector3f, BLOCK_SIZE> normals;
+        std::array<UInt16, BLOCK_SIZE * 4> shorts;
+        std::array<Byte, BLOCK_SIZE * 4> bytes;
+
+        for (size_t block{ 0 }; block < vertices.size(); block += BLOCK_SIZE, destination += BLOCK_SIZE * m_elementSize)
+        {
+            auto count = std::min(BLOCK_SIZE, vertices.size() - block);
+
+            for (auto& attribute : m_attributes)
+            {
+                auto elements = count * attribute.channels;
+
+                if (attribute.encoding == Encoding::Octahedral)
+                {
+                    std::ranges::copy(vertices.subspan(block, count) | std::views::transform(&Vertex::Normal), normals.begin());
+                    auto encoded = std::span(reinterpret_cast<Int16*>(shorts.data()), elements);
+                    Packing::encodeOctahedral(std::span(normals).first(count), encoded);
+                    this->scatter<Int16>(encoded, attribute, destination, count);
+                    continue;
+                }
+
+                for (size_t i{ 0 }; i < count; ++i)
+                    for (UInt32 c{ 0 }; c < attribute.channels; ++c)
+                        values[i * attribute.channels + c] = read(vertices[block + i], attribute.semantic, c);
+
+                auto source = std::span(values).first(elements);
+
+                switch (attribute.encoding)
+                {
+                case Encoding::Float32:
+                    this->scatter<Float>(source, attribute, destination, count);
+                    break;
+                case Encoding::Float16:
+                    Packing::toHalf(source, shorts);
+                    this->scatter<UInt16>(shorts, attribute, destination, count);
+                    break;
+                case Encoding::Unorm8:
+                    Packing::toUnorm8(source, bytes);
+                    this->scatter<Byte>(bytes, attribute, destination, count);
+                    break;
+                case Encoding::Unorm16:
+                    Packing::toUnorm16(source, shorts);
+                    this->scatter<UInt16>(shorts, attribute, destination, count);
+                    break;
+                case Encoding::Snorm16:
+                    Packing::toSnorm16(source, std::span(reinterpret_cast<Int16*>(shorts.data()), elements));
+                    this->scatter<UInt16>(shorts, attribute, destination, count);
+                    break;
+                default:
+                    std::unreachable();
+                }
+            }
+        }
+    }
+
+    void decompress(const Byte* source, std::span<Vertex> vertices) const
+    {
+        std::array<Float, BLOCK_SIZE * 4> values;
+        std::array<Vector3f, BLOCK_SIZE> normals;
+        std::array<UInt16, BLOCK_SIZE * 4> shorts;
+        std::array<Byte, BLOCK_SIZE * 4> bytes;
+
+        std::ranges::fill(vertices, Vertex{ });
+
+        for (size_t block{ 0 }; block < vertices.size(); block += BLOCK_SIZE, source += BLOCK_SIZE * m_elementSize)
+        {
+            auto count = std::min(BLOCK_SIZE, vertices.size() - block);
+
+            for (auto& attribute : m_attributes)
+            {
+                auto elements = count * attribute.channels;
+                auto destination = std::span(values).first(elements);
+
+                switch (attribute.encoding)
+                {
+                case Encoding::Float32:
+                    this->gather<Float>(destination, attribute, source, count);
+                    break;
+                case Encoding::Float16:
+                    this->gather<UInt16>(shorts, attribute, source, count);
+                    Packing::fromHalf(std::span(shorts).first(elements), destination);
+                    break;
+                case Encoding::Unorm8:
+                    this->gather<Byte>(bytes, attribute, source, count);
+                    Packing::fromUnorm8(std::span(bytes).first(elements), destination);
+                    break;
+                case Encoding::Unorm16:
+                    this->gather<UInt16>(shorts, attribute, source, count);
+                    Packing::fromUnorm16(std::span(shorts).first(elements), destination);
+                    break;
+                case Encoding::Snorm16:
+                    this->gather<UInt16>(shorts, attribute, source, count);
+                    Packing::fromSnorm16(std::span(reinterpret_cast<const Int16*>(shorts.data()), elements), destination);
+                    break;
+                case Encoding::Octahedral:
+                {
+                    auto encoded = std::span(reinterpret_cast<Int16*>(shorts.data()), elements);
+                    this->gather<Int16>(encoded, attribute, source, count);
+                    Packing::decodeOctahedral(encoded, normals);
+
+                    for (size_t i{ 0 }; i < count; ++i)
+                        vertices[block + i].Normal = normals[i];
+
+                    continue;
+                }
+                default:
+                    std::unreachable();
+                }
+
+                for (size_t i{ 0 }; i < count; ++i)
+                {
+                    for (UInt32 c{ 0 }; c < attribute.channels; ++c)
+                        write(vertices[block + i], attribute.semantic, c, values[i * attribute.channels + c]);
+
+                    if (attribute.semantic == AttributeSemantic::Color && attribute.channels == 3)
+                        vertices[block + i].Color.w() = 1.f;
+                }
+            }
+        }
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// Shared interface.
+// ------------------------------------------------------------------------------------------------
+
+VertexCompressor::VertexCompressor(const IVertexBufferLayout& layout) :
+    m_impl(makePimpl<VertexCompressorImpl>(this, layout))
+{
+}
+
+VertexCompressor::VertexCompressor(const VertexCompressor& _other) :
+    m_impl(makePimpl<VertexCompressorImpl>(this, *_other.m_impl))
+{
+}
+
+VertexCompressor::VertexCompressor(VertexCompressor&& _other) noexcept :
+    m_impl(std::move(_other.m_impl))
+{
+    m_impl->m_parent = this;
+}
+
+VertexCompressor::~VertexCompressor() noexcept = default;
+
+size_t VertexCompressor::elementSize() const noexcept
+{
+    return m_impl->m_elementSize;
+}
+
+void VertexCompressor::compress(std::span<const Graphics::Vertex> vertices, std::span<Byte> destination) const
+{
+    if (destination.size() < vertices.size() * m_impl->m_elementSize) [[unlikely]]
+        throw ArgumentOutOfRangeException("destination", 0ull, static_cast<unsigned long long>(destination.size()), static_cast<unsigned long long>(vertices.size() * m_impl->m_elementSize),
+            "The destination is not large enough to hold {0} vertices.", vertices.size());
+
+    m_impl->compress(vertices, destination.data());
+}
+
+Array<Byte> VertexCompressor::compress(std::span<const Graphics::Vertex> vertices) const
+{
+    Array<Byte> result(vertices.size() * m_impl->m_elementSize);
+    m_impl->compress(vertices, result.data());
+    return result;
+}
+
+void VertexCompressor::decompress(std::span<const Byte> source, std::span<Graphics::Vertex> vertices) const
+{
+    auto count = source.size() / m_impl->m_elementSize;
+
+    if (vertices.size() < count) [[unlikely]]
+        throw ArgumentOutOfRangeException("vertices", 0ull, static_cast<unsigned long long>(vertices.size()), static_cast<unsigned long long>(count),
+            "The destination is not large enough to hold {0} vertices.", count);
+
+    m_impl->decompress(source.data(), vertices.first(count));
+}
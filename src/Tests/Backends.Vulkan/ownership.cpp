@@ -0,0 +1,120 @@
+#include <litefx/app.hpp>
+#include <litefx/backends/vulkan.hpp>
+#include <iostream>
+
+using namespace LiteFX;
+using namespace LiteFX::Rendering;
+using namespace LiteFX::Rendering::Backends;
+
+class TestApp : public App {
+public:
+    String name() const noexcept override { return "Vulkan Ownership Test"; }
+    AppVersion version() const noexcept override { return AppVersion(1, 0, 0, 0); }
+};
+
+struct Vertex {
+    Float Position[4];
+};
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+static Array<String> SURFACE_EXTENSIONS = { VK_KHR_SURFACE_EXTENSION_NAME, VK_KHR_WIN32_SURFACE_EXTENSION_NAME };
+#else
+static Array<String> SURFACE_EXTENSIONS = { VK_KHR_SURFACE_EXTENSION_NAME, VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME };
+#endif
+
+static int skip(StringView reason)
+{
+    std::cout << "Skipping test: " << reason << std::endl;
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    if (!VulkanBackend::validateInstanceExtensions(SURFACE_EXTENSIONS))
+        return skip("The instance does not support the required surface extensions.");
+
+    TestApp app;
+    VulkanBackend backend(app, SURFACE_EXTENSIONS);
+    auto adapter = backend.findAdapter(std::nullopt);
+
+    if (adapter == nullptr)
+        return skip("No Vulkan adapter is available.");
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    // NOTE: The swap chain requires a window, but it never needs to be shown.
+    auto window = ::CreateWindowExW(0, L"STATIC", L"", WS_OVERLAPPEDWINDOW, 0, 0, 64, 64, nullptr, nullptr, ::GetModuleHandleW(nullptr), nullptr);
+    auto surface = backend.createSurface(window);
+#else
+    auto surface = backend.createSurface([](const VkInstance& instance) {
+        auto createHeadlessSurface = reinterpret_cast<PFN_vkCreateHeadlessSurfaceEXT>(::vkGetInstanceProcAddr(instance, "vkCreateHeadlessSurfaceEXT"));
+        VkHeadlessSurfaceCreateInfoEXT createInfo = { .sType = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT };
+        VkSurfaceKHR surface { VK_NULL_HANDLE };
+        raiseIfFailed(createHeadlessSurface(instance, &createInfo, nullptr, &surface), "Unable to create headless surface.");
+        return surface;
+    });
+#endif
+
+    int result = 0;
+
+    {
+        auto device = backend.createDevice("Default", *adapter, std::move(surface), Format::B8G8R8A8_UNORM, Size2d(64, 64), 2);
+        auto& graphicsQueue = device->defaultQueue(QueueType::Graphics);
+        auto& transferQueue = device->defaultQueue(QueueType::Transfer);
+
+        if (graphicsQueue.familyId() == transferQueue.familyId())
+            result = skip("The adapter does not provide a separate transfer queue family.");
+        else
+        {
+            // Upload a vertex buffer on the transfer queue, so that the transfer queue family owns it.
+            const Array<Vertex> vertices(3, Vertex { { 0.f, 0.f, 0.f, 1.f } });
+            VulkanVertexBufferLayout layout(sizeof(Vertex), 0);
+            auto vertexBuffer = device->factory().createVertexBuffer("Vertex Buffer", layout, ResourceHeap::Resource, static_cast<UInt32>(vertices.size()));
+            auto commandBuffer = transferQueue.createCommandBuffer(true);
+            commandBuffer->transfer(vertices.data(), vertices.size() * sizeof(Vertex), *vertexBuffer, 0, static_cast<UInt32>(vertices.size()));
+            auto transferFence = transferQueue.submit(commandBuffer);
+
+            // Bind the vertex buffer within a secondary command buffer of a render pass.
+            Array<RenderTarget> renderTargets = { RenderTarget("Color Target", 0, RenderTargetType::Color, Format::R8G8B8A8_UNORM, RenderTargetFlags::Clear, { 0.f, 0.f, 0.f, 1.f }) };
+            VulkanRenderPass renderPass(*device, renderTargets);
+
+            if (renderPass.recordingMode() != RenderPassRecordingMode::Secondary)
+                result = -1;
+
+            auto frameBuffer = device->makeFrameBuffer("Frame Buffer", Size2d(64, 64));
+            frameBuffer->addImage("Color Target", renderTargets.front());
+
+            graphicsQueue.waitFor(transferQueue, transferFence);
+            auto releaseFence = transferQueue.currentFence();
+            auto acquireFence = graphicsQueue.currentFence();
+
+            renderPass.begin(*frameBuffer);
+            renderPass.commandBuffer(0)->bind(*vertexBuffer);
+            auto fence = renderPass.end();
+
+            // The transfer queue must have released the buffer and the graphics queue must have acquired it before executing the render pass.
+            if (transferQueue.currentFence() != releaseFence + 1 || fence != acquireFence + 2)
+                result = -2;
+
+            // Using the buffer on the same queue again must not transfer its ownership.
+            graphicsQueue.waitFor(fence);
+            releaseFence = transferQueue.currentFence();
+            renderPass.begin(*frameBuffer);
+            renderPass.commandBuffer(0)->bind(*vertexBuffer);
+            acquireFence = fence;
+            fence = renderPass.end();
+
+            if (transferQueue.currentFence() != releaseFence || fence != acquireFence + 1)
+                result = -3;
+
+            device->wait();
+        }
+    }
+
+    backend.releaseDevice("Default");
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    ::DestroyWindow(window);
+#endif
+
+    return result;
+}
@@ -0,0 +1,82 @@
+#include <litefx/backends/vulkan.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace LiteFX;
+using namespace LiteFX::Rendering;
+using namespace LiteFX::Rendering::Backends;
+
+template <typename TCallback>
+static double measure(TCallback callback)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    callback();
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[])
+{
+    // Collect all compiled shaders from the directory.
+    std::filesystem::path directory = argc > 1 ? argv[1] : LITEFX_TEST_SHADER_DIRECTORY;
+    Array<String> fileNames;
+
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+        if (entry.is_regular_file() && entry.path().extension() == ".spv")
+            fileNames.push_back(entry.path().string());
+
+    if (fileNames.empty())
+    {
+        std::cout << std::format("No SPIR-V shaders found in {0}.", directory.string()) << std::endl;
+        return 0;
+    }
+
+    // Compare streaming the shader files into strings against mapping them into memory. Both variants hash the bytecode, which is required to look up reflection results.
+    Array<String> streamed;
+    Array<SharedPtr<const MappedFile>> mapped;
+    UInt64 checksum { 0 };
+
+    auto streaming = measure([&]() {
+        for (const auto& fileName : fileNames)
+        {
+            std::ifstream file(fileName, std::ios::in | std::ios::binary);
+            checksum ^= LiteFX::hash(streamed.emplace_back(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+        }
+    });
+
+    auto mapping = measure([&]() {
+        for (const auto& fileName : fileNames)
+        {
+            auto& file = mapped.emplace_back(makeShared<MappedFile>(fileName));
+            checksum ^= LiteFX::hash(StringView(reinterpret_cast<const char*>(file->data().data()), file->size()));
+        }
+    });
+
+    // Both variants must see the same bytecode, so their hashes cancel each other out.
+    if (checksum != 0) [[unlikely]]
+        return -1;
+
+    auto modules = mapped | std::views::transform([](const auto& file) { return StringView(reinterpret_cast<const char*>(file->data().data()), file->size()); }) | std::ranges::to<Array<StringView>>();
+    std::cout << std::format("Loading {0} shader modules: {1:.3f} ms streamed, {2:.3f} ms mapped", modules.size(), streaming, mapping) << std::endl;
+
+    // Cold start: every module is parsed by SPIRV-Reflect.
+    VulkanShaderProgram::clearReflectionCache();
+    auto cold = measure([&]() { std::ranges::for_each(modules, VulkanShaderProgram::cacheReflection); });
+
+    std::stringstream cache(std::ios::in | std::ios::out | std::ios::binary);
+    VulkanShaderProgram::saveReflectionCache(cache);
+    auto cacheSize = cache.str().size();
+
+    // Warm start: the reflection results are restored from the serialized cache, so no module needs to be parsed.
+    VulkanShaderProgram::clearReflectionCache();
+    auto load = measure([&]() { VulkanShaderProgram::loadReflectionCache(cache); });
+    auto warm = measure([&]() { std::ranges::for_each(modules, VulkanShaderProgram::cacheReflection); });
+
+    std::cout << std::format("Reflected {0} shader modules from {1}.", modules.size(), directory.string()) << std::endl;
+    std::cout << std::format("Cold start: {0:.3f} ms ({1:.3f} ms per module)", cold, cold / modules.size()) << std::endl;
+    std::cout << std::format("Warm start: {0:.3f} ms loading {1} bytes of cache data, {2:.3f} ms lookup ({3:.3f} ms per module)", load, cacheSize, warm, warm / modules.size()) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include <litefx/backends/vulkan.hpp>
+#include <sstream>
+
+using namespace LiteFX;
+using namespace LiteFX::Rendering;
+using namespace LiteFX::Rendering::Backends;
+
+class CacheWriter {
+private:
+    std::stringstream m_stream { std::ios::in | std::ios::out | std::ios::binary };
+
+public:
+    template <typename T>
+    CacheWriter& operator<<(T value) {
+        m_stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        return *this;
+    }
+
+    String str() const {
+        return m_stream.str();
+    }
+};
+
+static bool rejects(const String& data)
+{
+    std::stringstream stream(data, std::ios::in | std::ios::binary);
+
+    try
+    {
+        VulkanShaderProgram::loadReflectionCache(stream);
+        return false;
+    }
+    catch (const RuntimeException&)
+    {
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    constexpr UInt32 MAGIC = 0x52584C4C, VERSION = 1;
+
+    // Build a cache with a single module, that contains two descriptor sets and a push constant range.
+    CacheWriter writer;
+    writer << MAGIC << VERSION << 1u;
+    writer << 0x0123456789ABCDEFull << 1024ull;
+    writer << 2u;
+    writer << 0u << 2u;
+    writer << 0u << 64u << 1u << 0u << static_cast<UInt32>(DescriptorType::ConstantBuffer);
+    writer << 1u << 16u << std::numeric_limits<UInt32>::max() << 0u << static_cast<UInt32>(DescriptorType::RWStructuredBuffer);
+    writer << 1u << 1u;
+    writer << 0u << 0u << 1u << 2u << static_cast<UInt32>(DescriptorType::InputAttachment);
+    writer << 1u;
+    writer << 16u << 32u;
+    auto data = writer.str();
+
+    // Loading and saving the cache must restore the exact same data.
+    VulkanShaderProgram::clearReflectionCache();
+    std::stringstream input(data, std::ios::in | std::ios::binary);
+    VulkanShaderProgram::loadReflectionCache(input);
+
+    std::stringstream output(std::ios::in | std::ios::out | std::ios::binary);
+    VulkanShaderProgram::saveReflectionCache(output);
+
+    if (output.str() != data)
+        return -1;
+
+    // Truncated streams must be rejected at any position.
+    VulkanShaderProgram::clearReflectionCache();
+
+    for (size_t length { 0 }; length < data.size(); ++length)
+        if (!rejects(data.substr(0, length)))
+            return -2;
+
+    // Corrupted counts must be rejected before anything is allocated.
+    CacheWriter entries;
+    entries << MAGIC << VERSION << std::numeric_limits<UInt32>::max();
+
+    if (!rejects(entries.str()))
+        return -3;
+
+    CacheWriter descriptors;
+    descriptors << MAGIC << VERSION << 1u << 0ull << 0ull << 1u << 0u << std::numeric_limits<UInt32>::max();
+
+    if (!rejects(descriptors.str()))
+        return -4;
+
+    // Invalid descriptor types must be rejected.
+    CacheWriter types;
+    types << MAGIC << VERSION << 1u << 0ull << 0ull << 1u << 0u << 1u << 0u << 0u << 1u << 0u << 0xFFu << 0u;
+
+    if (!rejects(types.str()))
+        return -5;
+
+    // Failed loads must not leave any entries in the cache.
+    std::stringstream empty(std::ios::in | std::ios::out | std::ios::binary);
+    VulkanShaderProgram::saveReflectionCache(empty);
+
+    CacheWriter expected;
+    expected << MAGIC << VERSION << 0u;
+
+    if (empty.str() != expected.str())
+        return -6;
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <litefx/graphics.hpp>
+#include <array>
+#include <numbers>
+#include <random>
+
+using namespace LiteFX;
+using namespace LiteFX::Graphics;
+
+struct Mesh {
+    Array<Vector3f> Positions;
+    Array<UInt32> Indices;
+
+    IndexedMesh view() const noexcept {
+        return IndexedMesh(Positions, Indices);
+    }
+};
+
+/// <summary>
+/// Creates a unit sphere around <paramref name="center" /> with <paramref name="rings" /> rings and <paramref name="segments" /> segments, with counter-clockwise triangles that face outwards.
+/// </summary>
+inline Mesh makeSphere(UInt32 rings, UInt32 segments, Vector3f center = Vector3f{ }) {
+    Mesh mesh;
+
+    for (UInt32 r{ 0 }; r <= rings; ++r)
+    {
+        auto theta = std::numbers::pi_v<Float> * static_cast<Float>(r) / static_cast<Float>(rings);
+
+        for (UInt32 s{ 0 }; s <= segments; ++s)
+        {
+            auto phi = 2.f * std::numbers::pi_v<Float> * static_cast<Float>(s) / static_cast<Float>(segments);
+            mesh.Positions.push_back(center + Vector3f(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi)));
+        }
+    }
+
+    for (UInt32 r{ 0 }; r < rings; ++r)
+    {
+        for (UInt32 s{ 0 }; s < segments; ++s)
+        {
+            UInt32 a = r * (segments + 1) + s, b = a + segments + 1;
+            mesh.Indices.insert(mesh.Indices.end(), { a, a + 1, b, a + 1, b + 1, b });
+        }
+    }
+
+    return mesh;
+}
+
+/// <summary>
+/// Creates a grid of <paramref name="size" /> x <paramref name="size" /> quads in the xy-plane, where the triangles are stored in random order, which 
+/// resembles a poorly authored mesh.
+/// </summary>
+inline Mesh makeShuffledGrid(UInt32 size, std::mt19937& generator) {
+    Mesh mesh;
+
+    for (UInt32 y{ 0 }; y <= size; ++y)
+        for (UInt32 x{ 0 }; x <= size; ++x)
+            mesh.Positions.push_back(Vector3f(static_cast<Float>(x), static_cast<Float>(y), 0.f));
+
+    Array<std::array<UInt32, 3>> triangles;
+
+    for (UInt32 y{ 0 }; y < size; ++y)
+    {
+        for (UInt32 x{ 0 }; x < size; ++x)
+        {
+            UInt32 a = y * (size + 1) + x, b = a + size + 1;
+            triangles.push_back({ a, a + 1, b });
+            triangles.push_back({ a + 1, b + 1, b });
+        }
+    }
+
+    std::ranges::shuffle(triangles, generator);
+
+    for (auto& triangle : triangles)
+        mesh.Indices.insert(mesh.Indices.end(), triangle.begin(), triangle.end());
+
+    return mesh;
+}
+
+/// <summary>
+/// Creates a grid of <paramref name="size" /> x <paramref name="size" /> quads in the xy-plane. The vertices of the center column are duplicated, so that the
+/// grid contains an attribute seam, similar to a texture seam.
+/// </summary>
+inline Mesh makeSeamedGrid(UInt32 size) {
+    Mesh mesh;
+    UInt32 seam = size / 2, columns = size + 2;
+
+    for (UInt32 y{ 0 }; y <= size; ++y)
+        for (UInt32 x{ 0 }; x <= size + 1; ++x)
+            mesh.Positions.push_back(Vector3f(static_cast<Float>(x <= seam ? x : x - 1), static_cast<Float>(y), 0.f));
+
+    for (UInt32 y{ 0 }; y < size; ++y)
+    {
+        for (UInt32 x{ 0 }; x < size; ++x)
+        {
+            // Quads right of the seam use the duplicated vertices.
+            UInt32 a = y * columns + (x < seam ? x : x + 1), b = a + columns;
+            mesh.Indices.insert(mesh.Indices.end(), { a, a + 1, b, a + 1, b + 1, b });
+        }
+    }
+
+    return mesh;
+}
@@ -0,0 +1,40 @@
+#include "common.h"
+#include <chrono>
+#include <iostream>
+
+template <typename TCallback>
+static double measure(TCallback callback)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    callback();
+    return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+static void report(StringView name, const VertexCacheStatistics& statistics)
+{
+    std::cout << std::format("{0}: ACMR {1:.3f}, ATVR {2:.3f}", name, statistics.ACMR, statistics.ATVR) << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    // A grid with 724 x 724 quads has about one million triangles.
+    std::mt19937 generator(42);
+    auto mesh = makeShuffledGrid(724, generator);
+    auto triangles = mesh.Indices.size() / 3;
+    report("Input", MeshOptimizer::analyzeVertexCache(mesh.Indices, mesh.Positions.size()));
+
+    Array<UInt32> optimized, sorted, remap;
+    auto duration = measure([&]() { optimized = MeshOptimizer::optimizeVertexCache(mesh.Indices, mesh.Positions.size()); });
+    report("Vertex cache", MeshOptimizer::analyzeVertexCache(optimized, mesh.Positions.size()));
+    std::cout << std::format("Vertex cache optimization: {0:.2f} million triangles/s", triangles / duration / 1000000.0) << std::endl;
+
+    IndexedMesh optimizedMesh(mesh.Positions, optimized);
+    duration = measure([&]() { sorted = MeshOptimizer::optimizeOverdraw(optimizedMesh); });
+    report("Overdraw", MeshOptimizer::analyzeVertexCache(sorted, mesh.Positions.size()));
+    std::cout << std::format("Overdraw optimization: {0:.2f} million triangles/s", triangles / duration / 1000000.0) << std::endl;
+
+    duration = measure([&]() { remap = MeshOptimizer::optimizeVertexFetch(sorted, mesh.Positions.size()); });
+    std::cout << std::format("Vertex fetch optimization: {0:.2f} million triangles/s", triangles / duration / 1000000.0) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "../Graphics.Common/meshes.h"
+
+using namespace LiteFX;
+using namespace LiteFX::Graphics;
+
+/// <summary>
+/// Returns the triangles of an index buffer, rotated so that the smallest index comes first and sorted, which allows to compare index buffers regardless of
+/// the order of their triangles.
+/// </summary>
+inline Array<std::array<UInt32, 3>> sortedTriangles(std::span<const UInt32> indices) {
+    Array<std::array<UInt32, 3>> triangles;
+
+    for (size_t t{ 0 }; t < indices.size(); t += 3)
+    {
+        std::array<UInt32, 3> triangle = { indices[t], indices[t + 1], indices[t + 2] };
+        std::ranges::rotate(triangle, std::ranges::min_element(triangle));
+        triangles.push_back(triangle);
+    }
+
+    std::ranges::sort(triangles);
+    return triangles;
+}
@@ -0,0 +1,69 @@
+#include "common.h"
+
+int main(int argc, char* argv[])
+{
+    std::mt19937 generator(42);
+    auto mesh = makeShuffledGrid(100, generator);
+    auto before = MeshOptimizer::analyzeVertexCache(mesh.Indices, mesh.Positions.size());
+
+    // A randomly ordered mesh transforms almost every vertex of every triangle.
+    if (before.ACMR < 2.5f || before.ATVR < 5.f)
+        return -1;
+
+    // Re-ordering must keep all triangles, including their winding, and bring the cache miss ratio close to the optimum.
+    auto optimized = MeshOptimizer::optimizeVertexCache(mesh.Indices, mesh.Positions.size());
+    auto after = MeshOptimizer::analyzeVertexCache(optimized, mesh.Positions.size());
+
+    if (sortedTriangles(optimized) != sortedTriangles(mesh.Indices))
+        return -2;
+
+    if (after.ACMR > 0.8f || after.ATVR > 1.6f)
+        return -3;
+
+    // Overdraw optimization must keep all triangles and may only degrade the cache efficiency slightly.
+    Mesh optimizedMesh{ mesh.Positions, optimized };
+    auto sorted = MeshOptimizer::optimizeOverdraw(optimizedMesh.view(), 1.05f);
+
+    if (sortedTriangles(sorted) != sortedTriangles(mesh.Indices))
+        return -4;
+
+    if (MeshOptimizer::analyzeVertexCache(sorted, mesh.Positions.size()).ACMR > after.ACMR * 1.25f)
+        return -5;
+
+    // Re-ordering the vertices must preserve the positions referenced by each index and reference them in order.
+    auto indices = sorted;
+    auto remap = MeshOptimizer::optimizeVertexFetch(indices, mesh.Positions.size());
+    auto vertices = MeshOptimizer::remapVertices<Vector3f>(mesh.Positions, remap);
+
+    if (vertices.size() != mesh.Positions.size())
+        return -6;
+
+    UInt32 next{ 0 };
+
+    for (size_t i{ 0 }; i < indices.size(); ++i)
+    {
+        auto& position = vertices[indices[i]];
+        auto& expected = mesh.Positions[sorted[i]];
+
+        if (indices[i] > next || position.x() != expected.x() || position.y() != expected.y() || position.z() != expected.z())
+            return -7;
+
+        next = std::max(next, indices[i] + 1);
+    }
+
+    // Unreferenced vertices must be removed.
+    Array<UInt32> partial = { 3, 1, 2 };
+    remap = MeshOptimizer::optimizeVertexFetch(partial, 5);
+
+    if (remap != Array<UInt32>{ MeshOptimizer::UNUSED_VERTEX, 1, 2, 0, MeshOptimizer::UNUSED_VERTEX } || partial != Array<UInt32>{ 0, 1, 2 })
+        return -8;
+
+    try
+    {
+        MeshOptimizer::optimizeVertexCache(Array<UInt32>{ 0, 1 }, 2);
+        return -9;
+    }
+    catch (const InvalidArgumentException&) { }
+
+    return 0;
+}
@@ -0,0 +1,27 @@
+#include "common.h"
+#include <chrono>
+#include <iostream>
+
+template <typename TCallback>
+static double measure(TCallback callback)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    callback();
+    return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[])
+{
+    // A sphere with 512 rings and 1024 segments has about one million triangles.
+    auto mesh = makeSphere(512, 1024);
+    auto triangles = mesh.Indices.size() / 3;
+
+    LevelOfDetailChain chain;
+    auto duration = measure([&]() { chain = MeshSimplifier::buildLevelsOfDetail(mesh.view(), 8, 0.5f, 0.05f); });
+    std::cout << std::format("Level of detail generation: {0:.2f} million triangles/s", triangles / duration / 1000000.0) << std::endl;
+
+    for (size_t level{ 0 }; level < chain.Levels.size(); ++level)
+        std::cout << std::format("Level {0}: {1} triangles, error {2:.5f}", level, chain.Levels[level].IndexCount / 3, chain.Levels[level].Error) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "../Graphics.Common/meshes.h"
+
+using namespace LiteFX;
+using namespace LiteFX::Graphics;
+
+/// <summary>
+/// Returns the signed area of the triangles of <paramref name="indices" />, projected onto the xy-plane.
+/// </summary>
+inline Float projectedArea(const Mesh& mesh, std::span<const UInt32> indices) {
+    Float area{ 0.f };
+
+    for (size_t t{ 0 }; t < indices.size(); t += 3)
+    {
+        auto& a = mesh.Positions[indices[t]];
+        auto& b = mesh.Positions[indices[t + 1]];
+        auto& c = mesh.Positions[indices[t + 2]];
+        area += 0.5f * ((b.x() - a.x()) * (c.y() - a.y()) - (c.x() - a.x()) * (b.y() - a.y()));
+    }
+
+    return area;
+}
+
+/// <summary>
+/// Returns the distance between <paramref name="p" /> and the closest point on the triangle <paramref name="a" />, <paramref name="b" />, <paramref name="c" />.
+/// </summary>
+inline Float distanceToTriangle(const Vector3f& p, const Vector3f& a, const Vector3f& b, const Vector3f& c) {
+    Vector3f ab = b - a, ac = c - a, ap = p - a, bp = p - b, cp = p - c;
+    auto d1 = dot(ab, ap), d2 = dot(ac, ap), d3 = dot(ab, bp), d4 = dot(ac, bp), d5 = dot(ab, cp), d6 = dot(ac, cp);
+
+    // Check the vertex and edge regions first (see Ericson, "Real-Time Collision Detection", 5.1.5).
+    if (d1 <= 0.f && d2 <= 0.f)
+        return length(ap);
+
+    if (d3 >= 0.f && d4 <= d3)
+        return length(bp);
+
+    if (d6 >= 0.f && d5 <= d6)
+        return length(cp);
+
+    auto vc = d1 * d4 - d3 * d2, vb = d5 * d2 - d1 * d6, va = d3 * d6 - d5 * d4;
+
+    if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
+        return length(Vector3f(ap - ab * (d1 / (d1 - d3))));
+
+    if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
+        return length(Vector3f(ap - ac * (d2 / (d2 - d6))));
+
+    if (va <= 0.f && d4 - d3 >= 0.f && d5 - d6 >= 0.f)
+        return length(Vector3f(bp - (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)))));
+
+    auto denominator = 1.f / (va + vb + vc);
+    return length(Vector3f(ap - ab * (vb * denominator) - ac * (vc * denominator)));
+}
+
+/// <summary>
+/// Returns the largest distance between a vertex of <paramref name="mesh" /> and the surface of the simplified triangles in <paramref name="indices" />.
+/// </summary>
+inline Float maxDeviation(const Mesh& mesh, std::span<const UInt32> indices) {
+    Float deviation{ 0.f };
+
+    for (auto& position : mesh.Positions)
+    {
+        Float closest{ std::numeric_limits<Float>::max() };
+
+        for (size_t t{ 0 }; t < indices.size(); t += 3)
+            closest = std::min(closest, distanceToTriangle(position, mesh.Positions[indices[t]], mesh.Positions[indices[t + 1]], mesh.Positions[indices[t + 2]]));
+
+        deviation = std::max(deviation, closest);
+    }
+
+    return deviation;
+}
@@ -0,0 +1,91 @@
+#include "common.h"
+
+int main(int argc, char* argv[])
+{
+    // A flat grid can be reduced to very few triangles without any error. The seam and the borders must be kept intact, so that the simplified grid still
+    // covers the same area without holes or overlapping triangles.
+    auto grid = makeSeamedGrid(32);
+    Float error{ -1.f };
+    auto simplified = MeshSimplifier::simplify(grid.view(), 48, 0.001f, &error);
+
+    if (simplified.size() >= grid.Indices.size() / 8 || error < 0.f || error > 0.001f)
+        return -1;
+
+    if (std::abs(projectedArea(grid, simplified) - 32.f * 32.f) > 0.01f)
+        return -2;
+
+    for (size_t t{ 0 }; t < simplified.size(); t += 3)
+        if (projectedArea(grid, std::span(simplified).subspan(t, 3)) <= 0.f)
+            return -3;
+
+    // Triangles must never reference vertices from both sides of the seam, which would mix their attributes.
+    for (size_t t{ 0 }; t < simplified.size(); t += 3)
+    {
+        auto indices = std::span(simplified).subspan(t, 3);
+        auto left = std::ranges::any_of(indices, [](UInt32 index) { return index % 34 < 16; });
+        auto right = std::ranges::any_of(indices, [](UInt32 index) { return index % 34 > 17; });
+
+        if (left && right)
+            return -4;
+    }
+
+    // Simplifying a curved surface stops at the target error. The error is a mean over the planes around each vertex, so the actual deviation of the 
+    // simplified surface from the original vertices can be larger, but must stay within a small multiple of the target error (relative to the extent of 2).
+    auto sphere = makeSphere(32, 64);
+    simplified = MeshSimplifier::simplify(sphere.view(), 0, 0.01f, &error);
+
+    if (simplified.empty() || simplified.size() >= sphere.Indices.size() / 2 || error > 0.01f || maxDeviation(sphere, simplified) > 3.f * 0.01f * 2.f)
+        return -5;
+
+    if (maxDeviation(sphere, MeshSimplifier::simplify(sphere.view(), 0, 0.001f)) > 3.f * 0.001f * 2.f)
+        return -5;
+
+    // Vertices that are not referenced by the mesh must not affect the scale of the error.
+    auto padded = sphere;
+    padded.Positions.push_back(Vector3f(100.f, 100.f, 100.f));
+
+    if (MeshSimplifier::simplify(padded.view(), 0, 0.01f) != simplified)
+        return -5;
+
+    // A more tolerant target error yields fewer triangles.
+    if (MeshSimplifier::simplify(sphere.view(), 0, 0.05f).size() >= simplified.size())
+        return -6;
+
+    // Meshes that already meet the target index count are returned unchanged.
+    if (MeshSimplifier::simplify(sphere.view(), sphere.Indices.size()) != sphere.Indices)
+        return -7;
+
+    // Each level of detail is stored directly behind the previous one, starts with the original mesh and gets coarser with each level.
+    auto chain = MeshSimplifier::buildLevelsOfDetail(sphere.view(), 4, 0.5f, 0.05f);
+
+    if (chain.Levels.size() < 2 || chain.Levels.size() > 4)
+        return -8;
+
+    if (!std::equal(sphere.Indices.begin(), sphere.Indices.end(), chain.Indices.begin()) || chain.Levels[0].FirstIndex != 0 ||
+        chain.Levels[0].IndexCount != sphere.Indices.size() || chain.Levels[0].Error != 0.f)
+        return -9;
+
+    for (size_t level{ 1 }; level < chain.Levels.size(); ++level)
+    {
+        auto& previous = chain.Levels[level - 1];
+        auto& current = chain.Levels[level];
+
+        if (current.FirstIndex != previous.FirstIndex + previous.IndexCount || current.IndexCount >= previous.IndexCount || current.Error < previous.Error)
+            return -10;
+    }
+
+    if (chain.Levels.back().FirstIndex + chain.Levels.back().IndexCount != chain.Indices.size())
+        return -11;
+
+    // Invalid arguments must be rejected.
+    try
+    {
+        chain = MeshSimplifier::buildLevelsOfDetail(sphere.view(), 4, 1.f);
+        return -12;
+    }
+    catch (const ArgumentOutOfRangeException&)
+    {
+    }
+
+    return 0;
+}
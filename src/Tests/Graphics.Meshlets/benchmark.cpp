@@ -0,0 +1,36 @@
+#include "common.h"
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <thread>
+
+template <typename TCallback>
+static double measure(TCallback callback)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    callback();
+    return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[])
+{
+    // A sphere with 512 rings and 1024 segments has about one million triangles.
+    auto sphere = makeSphere(512, 1024);
+    auto triangles = sphere.Indices.size() / 3;
+    MeshletBuilder builder;
+    MeshletData meshlets;
+
+    auto duration = measure([&]() { meshlets = builder.build(sphere.view()); });
+    std::cout << std::format("Single mesh: {0} triangles in {1} meshlets, {2:.2f} million triangles/s", triangles, meshlets.Meshlets.size(), triangles / duration / 1000000.0) << std::endl;
+
+    const auto average = std::accumulate(meshlets.Meshlets.begin(), meshlets.Meshlets.end(), 0.0, [](double sum, const Meshlet& meshlet) { return sum + meshlet.PrimitiveCount; }) / meshlets.Meshlets.size();
+    std::cout << std::format("Average primitives per meshlet: {0:.1f} of {1}", average, builder.maxPrimitives()) << std::endl;
+
+    // Build the same mesh multiple times in parallel.
+    const auto threads = std::max(std::thread::hardware_concurrency(), 1u);
+    Array<IndexedMesh> meshes(threads, sphere.view());
+    duration = measure([&]() { builder.build(meshes); });
+    std::cout << std::format("{0} meshes ({1} threads): {2:.2f} million triangles/s", meshes.size(), threads, triangles * meshes.size() / duration / 1000000.0) << std::endl;
+
+    return 0;
+}
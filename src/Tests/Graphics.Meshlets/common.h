@@ -0,0 +1,7 @@
+#pragma once
+
+#include "../Graphics.Common/meshes.h"
+#include <random>
+
+using namespace LiteFX;
+using namespace LiteFX::Graphics;
@@ -0,0 +1,137 @@
+#include "common.h"
+
+static int validate(const MeshletBuilder& builder, const Mesh& mesh, const MeshletData& data)
+{
+    if (data.Meshlets.size() != data.Bounds.size() || data.Primitives.size() != mesh.Indices.size() / 3)
+        return -1;
+
+    Array<UInt32> triangles;
+
+    for (size_t m{ 0 }; m < data.Meshlets.size(); ++m)
+    {
+        auto& meshlet = data.Meshlets[m];
+        auto& bounds = data.Bounds[m];
+
+        if (meshlet.VertexCount > builder.maxVertices() || meshlet.PrimitiveCount > builder.maxPrimitives() || meshlet.PrimitiveCount == 0)
+            return -2;
+
+        // Every vertex must be inside the bounding sphere.
+        for (UInt32 v{ 0 }; v < meshlet.VertexCount; ++v)
+            if (length(mesh.Positions[data.Vertices[meshlet.VertexOffset + v]] - bounds.Center) > bounds.Radius * 1.0001f + 1e-5f)
+                return -3;
+
+        for (UInt32 p{ 0 }; p < meshlet.PrimitiveCount; ++p)
+        {
+            auto primitive = data.Primitives[meshlet.PrimitiveOffset + p];
+            std::array<UInt32, 3> local = { primitive & 0xFF, (primitive >> 8) & 0xFF, (primitive >> 16) & 0xFF };
+
+            if (primitive >> 24 != 0 || std::ranges::any_of(local, [&](UInt32 i) { return i >= meshlet.VertexCount; }))
+                return -4;
+
+            // Store the triangle with the smallest index first, to be able to compare it against the input, regardless of the winding.
+            std::array<UInt32, 3> triangle = { data.Vertices[meshlet.VertexOffset + local[0]], data.Vertices[meshlet.VertexOffset + local[1]], data.Vertices[meshlet.VertexOffset + local[2]] };
+            std::ranges::rotate(triangle, std::ranges::min_element(triangle));
+            triangles.insert(triangles.end(), triangle.begin(), triangle.end());
+        }
+    }
+
+    // Each triangle of the input must be emitted exactly once, with its original winding.
+    Array<UInt32> expected;
+
+    for (size_t t{ 0 }; t < mesh.Indices.size(); t += 3)
+    {
+        std::array<UInt32, 3> triangle = { mesh.Indices[t], mesh.Indices[t + 1], mesh.Indices[t + 2] };
+        std::ranges::rotate(triangle, std::ranges::min_element(triangle));
+        expected.insert(expected.end(), triangle.begin(), triangle.end());
+    }
+
+    auto sort = [](Array<UInt32>& indices) {
+        Array<std::array<UInt32, 3>> triangles(indices.size() / 3);
+        std::memcpy(triangles.data(), indices.data(), indices.size() * sizeof(UInt32));
+        std::ranges::sort(triangles);
+        return triangles;
+    };
+
+    return sort(triangles) == sort(expected) ? 0 : -5;
+}
+
+int main(int argc, char* argv[])
+{
+    auto sphere = makeSphere(64, 96);
+
+    for (auto [vertices, primitives] : { std::pair{ 64u, 124u }, std::pair{ 128u, 256u }, std::pair{ 3u, 1u }, std::pair{ 256u, 64u } })
+    {
+        MeshletBuilder builder(vertices, primitives);
+
+        if (auto result = validate(builder, sphere, builder.build(sphere.view())); result != 0)
+            return result;
+    }
+
+    // Full meshlets of a regular mesh should use most of the primitive budget.
+    MeshletBuilder builder;
+    auto meshlets = builder.build(sphere.view());
+
+    if (meshlets.Meshlets.size() > 2 * (sphere.Indices.size() / 3) / builder.maxPrimitives())
+        return -10;
+
+    // A camera far outside of the sphere sees the back-faces of the meshlets on the far side, so some of them must be culled, but not all of them.
+    Vector3f camera(0.f, 0.f, 10.f);
+    auto culled = std::ranges::count_if(meshlets.Bounds, [&](const MeshletBounds& bounds) { return dot(normalize(bounds.ConeApex - camera), bounds.ConeAxis) >= bounds.ConeCutoff; });
+
+    if (culled == 0 || culled >= static_cast<std::ptrdiff_t>(meshlets.Meshlets.size()) / 2)
+        return -11;
+
+    // Culled meshlets must not contain any front-facing triangle.
+
+    for (size_t m{ 0 }; m < meshlets.Meshlets.size(); ++m)
+    {
+        auto& bounds = meshlets.Bounds[m];
+        auto& meshlet = meshlets.Meshlets[m];
+
+        if (dot(normalize(bounds.ConeApex - camera), bounds.ConeAxis) < bounds.ConeCutoff)
+            continue;
+
+        for (UInt32 p{ 0 }; p < meshlet.PrimitiveCount; ++p)
+        {
+            auto primitive = meshlets.Primitives[meshlet.PrimitiveOffset + p];
+            auto& a = sphere.Positions[meshlets.Vertices[meshlet.VertexOffset + (primitive & 0xFF)]];
+            auto& b = sphere.Positions[meshlets.Vertices[meshlet.VertexOffset + ((primitive >> 8) & 0xFF)]];
+            auto& c = sphere.Positions[meshlets.Vertices[meshlet.VertexOffset + ((primitive >> 16) & 0xFF)]];
+
+            if (dot(cross(b - a, c - a), camera - a) > 1e-6f)
+                return -12;
+        }
+    }
+
+    // Building multiple meshes in parallel must yield the same result as building them one by one.
+    Array<Mesh> meshes = { makeSphere(16, 24), makeSphere(32, 48, Vector3f(3.f, 0.f, 0.f)), Mesh{ }, makeSphere(8, 8, Vector3f(0.f, 3.f, 0.f)) };
+    Array<IndexedMesh> views;
+    std::ranges::transform(meshes, std::back_inserter(views), &Mesh::view);
+    auto results = builder.build(views, 3);
+
+    for (size_t i{ 0 }; i < meshes.size(); ++i)
+    {
+        auto single = builder.build(views[i]);
+
+        if (results[i].Primitives != single.Primitives || results[i].Vertices != single.Vertices)
+            return -13;
+    }
+
+    // Invalid inputs must be rejected.
+    try
+    {
+        Mesh invalid{ { Vector3f{ }, Vector3f{ }, Vector3f{ } }, { 0, 1, 3 } };
+        builder.build(invalid.view());
+        return -14;
+    }
+    catch (const ArgumentOutOfRangeException&) { }
+
+    try
+    {
+        MeshletBuilder(257, 124);
+        return -15;
+    }
+    catch (const ArgumentOutOfRangeException&) { }
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include <litefx/logging.hpp>
+#include <barrier>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+using namespace LiteFX;
+using namespace LiteFX::Logging;
+
+struct ConvertedEvent {
+    double timestamp;
+    UInt32 thread;
+    UInt64 payload;
+};
+
+static Optional<String> findValue(const String& line, StringView key)
+{
+    auto position = line.find(std::format("\"{0}\":", key));
+
+    if (position == String::npos)
+        return std::nullopt;
+
+    position += key.size() + 3;
+    return line.substr(position, line.find_first_of(",}", position) - position);
+}
+
+int main(int argc, char* argv[])
+{
+    constexpr UInt32 THREADS = 4;
+    constexpr UInt64 EVENTS = 1000;
+    const String traceFile = "logging_trace_sink.lfxt";
+    const String jsonFile = "logging_trace_sink.json";
+
+    {
+        TraceSink sink(traceFile, 2 * EVENTS);
+        sink.registerEvent(1, "Event");
+
+        // Start all threads at the same time, so that their records interleave. Each thread writes a sequence number as payload.
+        std::barrier start(THREADS);
+        Array<std::jthread> threads;
+
+        for (UInt32 t { 0 }; t < THREADS; ++t)
+        {
+            threads.emplace_back([&sink, &start, t]() {
+                start.arrive_and_wait();
+
+                for (UInt64 i { 0 }; i < EVENTS; ++i)
+                    sink.write(1, TraceEventType::Instant, i, t);
+            });
+        }
+
+        threads.clear();
+
+        if (sink.dropped() != 0)
+            return -1;
+    }
+
+    TraceSink::convert(traceFile, jsonFile);
+
+    // Parse the events. Each event is written into its own line.
+    std::ifstream input(jsonFile);
+    Array<ConvertedEvent> events;
+    String line;
+
+    while (std::getline(input, line))
+    {
+        auto timestamp = findValue(line, "ts");
+        auto thread = findValue(line, "tid");
+        auto payload = findValue(line, "payload0");
+
+        if (!timestamp.has_value() || !thread.has_value() || !payload.has_value())
+            continue;
+
+        events.push_back({ std::stod(*timestamp), static_cast<UInt32>(std::stoul(*thread)), std::stoull(*payload) });
+    }
+
+    if (events.size() != THREADS * EVENTS)
+        return -2;
+
+    // The earliest event over all threads must be the time origin and the events must be sorted by their time stamps.
+    if (events.front().timestamp != 0.0)
+        return -3;
+
+    for (size_t i { 1 }; i < events.size(); ++i)
+    {
+        if (events[i].timestamp < events[i - 1].timestamp)
+            return -4;
+    }
+
+    // The events of each thread must still appear in the order they have been written.
+    Dictionary<UInt32, UInt64> nextPayload;
+
+    for (const auto& event : events)
+    {
+        if (event.payload != nextPayload[event.thread]++)
+            return -5;
+    }
+
+    if (nextPayload.size() != THREADS)
+        return -6;
+
+    std::remove(traceFile.c_str());
+    std::remove(jsonFile.c_str());
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include "common.h"
+
+// Make sure the arithmetic is still available at compile time.
+constexpr Matrix4f Scale = { 2.f, 0.f, 0.f, 1.f, 0.f, 4.f, 0.f, 2.f, 0.f, 0.f, 8.f, 3.f, 0.f, 0.f, 0.f, 1.f };
+static_assert(inverse(Scale).at(0, 0) == 0.5f && inverse(Scale).at(0, 3) == -0.5f);
+static_assert((Scale * inverse(Scale)).at(2, 2) == 1.f);
+static_assert(cross(Vector<Float, 3>(1.f, 0.f, 0.f), Vector<Float, 3>(0.f, 1.f, 0.f)).z() == 1.f);
+static_assert(dot(Vector<Float, 4>(1.f, 2.f, 3.f, 4.f), Vector<Float, 4>(1.f)) == 10.f);
+
+static Matrix4f multiply(const Matrix4f& lhs, const Matrix4f& rhs) {
+	Matrix4f result;
+
+	for (unsigned r{ 0 }; r < 4; ++r)
+		for (unsigned c{ 0 }; c < 4; ++c)
+			for (unsigned i{ 0 }; i < 4; ++i)
+				result.at(r, c) += lhs.at(r, i) * rhs.at(i, c);
+
+	return result;
+}
+
+int main(int argc, char* argv[])
+{
+	std::mt19937 generator(42);
+
+	for (int i{ 0 }; i < 1000; ++i)
+	{
+		auto a = random<Matrix4f>(generator);
+		auto b = random<Matrix4f>(generator);
+		auto v = random<Vector4f>(generator);
+
+		if (!equal(a * b, multiply(a, b)))
+			return -1;
+
+		if (std::abs(determinant(a)) > 1e-2f && !equal(a * inverse(a), Matrix4f::identity(), 1e-2f))
+			return -2;
+
+		Vector4f transformed = a * v;
+
+		for (unsigned r{ 0 }; r < 4; ++r)
+			if (std::abs(transformed[r] - dot(Vector4f(a.row(r)), v)) > 1e-4f)
+				return -3;
+
+		if (a.transpose().at(1, 2) != a.at(2, 1) || a.transpose().at(3, 0) != a.at(0, 3))
+			return -4;
+
+		// Affine transforms must behave like 4x4 matrices with an implicit last row.
+		auto x = random<Matrix3x4f>(generator);
+		auto y = random<Matrix3x4f>(generator);
+		Matrix4f x4(x), y4(y);
+		x4.at(3, 3) = y4.at(3, 3) = 1.f;
+
+		Matrix4f xy(x * y);
+		xy.at(3, 3) = 1.f;
+
+		if (!equal(xy, multiply(x4, y4)))
+			return -5;
+
+		if (std::abs(determinant(TMatrix3<Float>{ x.at(0, 0), x.at(0, 1), x.at(0, 2), x.at(1, 0), x.at(1, 1), x.at(1, 2), x.at(2, 0), x.at(2, 1), x.at(2, 2) })) > 1e-2f && 
+			!equal(x * inverse(x), Matrix3x4f::identity(), 1e-2f))
+			return -6;
+
+		// Vector arithmetic.
+		auto p = random<Vector3f>(generator);
+		auto q = random<Vector3f>(generator);
+		Vector3f c = cross(p, q);
+
+		if (std::abs(dot(c, p)) > 1e-4f || std::abs(dot(c, q)) > 1e-4f)
+			return -7;
+
+		if ((p + q).y() != p.y() + q.y() || (p - q).z() != p.z() - q.z() || (p * 2.f).x() != p.x() * 2.f || (-p).x() != -p.x())
+			return -8;
+
+		if (std::abs(length(normalize(p)) - 1.f) > 1e-5f)
+			return -9;
+
+		auto s = random<Vector2f>(generator);
+		s += s;
+
+		if (std::abs((s / 2.f).x() * 2.f - s.x()) > 1e-5f)
+			return -10;
+	}
+}
@@ -0,0 +1,71 @@
+#include "common.h"
+#include <chrono>
+#include <iostream>
+#include <glm/gtc/matrix_inverse.hpp>
+
+constexpr int ITERATIONS = 1000000;
+constexpr int COUNT = 256;
+
+static glm::mat4 toGlm(const Matrix4f& m) {
+	glm::mat4 result;
+
+	// NOTE: glm stores matrices in column-major order.
+	for (int r{ 0 }; r < 4; ++r)
+		for (int c{ 0 }; c < 4; ++c)
+			result[c][r] = m.at(r, c);
+
+	return result;
+}
+
+template <typename TCallback>
+static double measure(StringView name, TCallback callback)
+{
+	auto start = std::chrono::high_resolution_clock::now();
+	callback();
+	auto duration = std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / ITERATIONS;
+	std::cout << std::format("{0}: {1:.2f} ns", name, duration) << std::endl;
+	return duration;
+}
+
+int main(int argc, char* argv[])
+{
+	std::mt19937 generator(42);
+	Array<Matrix4f> matrices(COUNT);
+	Array<Vector4f> vectors(COUNT);
+	Array<glm::mat4> glmMatrices(COUNT);
+	Array<glm::vec4> glmVectors(COUNT);
+
+	for (int i{ 0 }; i < COUNT; ++i)
+	{
+		matrices[i] = random<Matrix4f>(generator);
+		vectors[i] = random<Vector4f>(generator);
+		glmMatrices[i] = toGlm(matrices[i]);
+		glmVectors[i] = glm::vec4(vectors[i].x(), vectors[i].y(), vectors[i].z(), vectors[i].w());
+	}
+
+	// Make sure both libraries compute the same results, before comparing their performance.
+	for (int i{ 0 }; i < COUNT - 1; ++i)
+	{
+		if (!equal(matrices[i] * matrices[i + 1], Matrix4f(toGlm(matrices[i]) * toGlm(matrices[i + 1]))))
+			return -1;
+
+		if (std::abs(determinant(matrices[i])) > 1e-2f && !equal(inverse(matrices[i]), Matrix4f(glm::inverse(glmMatrices[i])), 1e-2f))
+			return -2;
+	}
+
+	// Accumulate the results, so that the compiler does not optimize the loops away.
+	Matrix4f matrix;
+	Vector4f vector;
+	glm::mat4 glmMatrix(0.f);
+	glm::vec4 glmVector(0.f);
+
+	auto mat4xMat4 = measure("LiteFX mat4 x mat4", [&]() { for (int i{ 0 }; i < ITERATIONS; ++i) matrix = matrix + matrices[i % COUNT] * matrices[(i + 1) % COUNT]; });
+	auto glmMat4xMat4 = measure("glm mat4 x mat4", [&]() { for (int i{ 0 }; i < ITERATIONS; ++i) glmMatrix += glmMatrices[i % COUNT] * glmMatrices[(i + 1) % COUNT]; });
+	auto mat4xVec4 = measure("LiteFX mat4 x vec4", [&]() { for (int i{ 0 }; i < ITERATIONS; ++i) vector += Vector4f(matrices[i % COUNT] * vectors[(i + 1) % COUNT]); });
+	auto glmMat4xVec4 = measure("glm mat4 x vec4", [&]() { for (int i{ 0 }; i < ITERATIONS; ++i) glmVector += glmMatrices[i % COUNT] * glmVectors[(i + 1) % COUNT]; });
+	auto inverse4 = measure("LiteFX inverse", [&]() { for (int i{ 0 }; i < ITERATIONS; ++i) matrix = matrix + inverse(matrices[i % COUNT]); });
+	auto glmInverse4 = measure("glm inverse", [&]() { for (int i{ 0 }; i < ITERATIONS; ++i) glmMatrix += glm::inverse(glmMatrices[i % COUNT]); });
+
+	std::cout << std::format("Checksums: {0} {1}", matrix.at(0, 0) + vector.x(), glmMatrix[0][0] + glmVector.x) << std::endl;
+	std::cout << std::format("Speedup: mat4 x mat4 {0:.2f}x, mat4 x vec4 {1:.2f}x, inverse {2:.2f}x", glmMat4xMat4 / mat4xMat4, glmMat4xVec4 / mat4xVec4, glmInverse4 / inverse4) << std::endl;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <litefx/math.hpp>
+#include <random>
+
+using namespace LiteFX::Math;
+
+using Matrix4f = TMatrix4<Float>;
+using Matrix3x4f = TMatrix3x4<Float>;
+
+template <typename T>
+bool equal(const T& lhs, const T& rhs, Float epsilon = 1e-4f) {
+    return std::ranges::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(), [epsilon](Float a, Float b) { return std::abs(a - b) <= epsilon * (1.f + std::abs(b)); });
+}
+
+template <typename T>
+T random(std::mt19937& generator) {
+    std::uniform_real_distribution<Float> distribution(-2.f, 2.f);
+    T result;
+
+    for (auto it = result.begin(); it != result.end(); ++it)
+        *it = distribution(generator);
+
+    return result;
+}
@@ -0,0 +1,60 @@
+#include "common.h"
+#include <chrono>
+#include <iostream>
+
+constexpr size_t COUNT = 1 << 20;
+constexpr int ITERATIONS = 20;
+
+template <typename TCallback>
+static double measure(StringView name, TCallback callback)
+{
+	auto start = std::chrono::high_resolution_clock::now();
+
+	for (int i{ 0 }; i < ITERATIONS; ++i)
+		callback();
+
+	auto duration = std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - start).count() / (static_cast<double>(COUNT) * ITERATIONS);
+	std::cout << std::format("{0}: {1:.3f} ns", name, duration) << std::endl;
+	return duration;
+}
+
+int main(int argc, char* argv[])
+{
+	std::mt19937 generator(42);
+	Array<Vector4f> vectors(COUNT), results(COUNT);
+	Array<glm::vec4> glmVectors(COUNT), glmResults(COUNT);
+
+	std::ranges::generate(vectors, [&]() { return random<Vector4f>(generator); });
+	std::ranges::transform(vectors, glmVectors.begin(), [](const Vector4f& v) { return glm::vec4(v.x(), v.y(), v.z(), v.w()); });
+
+	// Make sure the conversions preserve all elements, before measuring them.
+	for (size_t i{ 0 }; i < COUNT; ++i)
+	{
+		glm::vec4 converted = vectors[i];
+		Vector4f back = converted;
+
+		if (converted != glmVectors[i] || !equal(back, vectors[i], 0.f))
+			return -1;
+	}
+
+	// Copying the vectors without conversion is the baseline. Inline conversions should not be measurably slower.
+	auto baseline = measure("Copy glm::vec4", [&]() { std::ranges::copy(glmVectors, glmResults.begin()); });
+	auto toGlm = measure("Vector4f to glm::vec4", [&]() { std::ranges::transform(vectors, glmResults.begin(), [](const Vector4f& v) { return static_cast<glm::vec4>(v); }); });
+	auto fromGlm = measure("glm::vec4 to Vector4f", [&]() { std::ranges::transform(glmVectors, results.begin(), [](const glm::vec4& v) { return Vector4f(v); }); });
+
+#if defined(LITEFX_BUILD_WITH_DIRECTX_MATH)
+	Array<DirectX::XMFLOAT4> xmVectors(COUNT);
+	auto toXm = measure("Vector4f to XMVECTOR to XMFLOAT4", [&]() { std::ranges::transform(vectors, xmVectors.begin(), [](const Vector4f& v) { 
+		DirectX::XMFLOAT4 result;
+		DirectX::XMStoreFloat4(&result, v);
+		return result; 
+	}); });
+	auto fromXm = measure("XMFLOAT4 to XMVECTOR to Vector4f", [&]() { std::ranges::transform(xmVectors, results.begin(), [](const DirectX::XMFLOAT4& v) { return Vector4f(DirectX::XMLoadFloat4(&v)); }); });
+	std::cout << std::format("Overhead: DirectXMath {0:.2f}x / {1:.2f}x", toXm / baseline, fromXm / baseline) << std::endl;
+#endif
+
+	std::cout << std::format("Checksums: {0} {1}", results[COUNT / 2].x(), glmResults[COUNT / 2].x) << std::endl;
+	std::cout << std::format("Overhead: glm {0:.2f}x / {1:.2f}x", toGlm / baseline, fromGlm / baseline) << std::endl;
+
+	return 0;
+}
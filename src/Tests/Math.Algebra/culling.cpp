@@ -0,0 +1,107 @@
+#include "common.h"
+
+struct Bounds {
+	Array<Float> Center[3], Extent[3], Radius;
+
+	Bounds(size_t count, std::mt19937& generator) {
+		std::uniform_real_distribution<Float> position(-3.f, 3.f), size(0.f, 0.5f);
+
+		for (size_t i{ 0 }; i < count; ++i)
+		{
+			for (int c{ 0 }; c < 3; ++c)
+			{
+				Center[c].push_back(position(generator));
+				Extent[c].push_back(size(generator));
+			}
+
+			Radius.push_back(size(generator));
+		}
+	}
+
+	BoundingSphereComponents spheres() const noexcept {
+		return { Center[0], Center[1], Center[2], Radius };
+	}
+
+	BoundingBoxComponents boxes() const noexcept {
+		return { Center[0], Center[1], Center[2], Extent[0], Extent[1], Extent[2] };
+	}
+
+	BoundingSphere sphere(size_t i) const noexcept {
+		return BoundingSphere(Vector3f(Center[0][i], Center[1][i], Center[2][i]), Radius[i]);
+	}
+
+	BoundingBox box(size_t i) const noexcept {
+		Vector3f center(Center[0][i], Center[1][i], Center[2][i]), extent(Extent[0][i], Extent[1][i], Extent[2][i]);
+		return BoundingBox(center - extent, center + extent);
+	}
+};
+
+int main(int argc, char* argv[])
+{
+	// Use an odd number of objects, so that every kernel width and the remainder are covered.
+	constexpr size_t COUNT = 10007;
+	constexpr size_t OFFSET = 7;
+
+	std::mt19937 generator(42);
+	Bounds bounds(COUNT, generator);
+
+	// The identity matrix maps onto the clip space, i.e., the frustum is the box [-1, 1] x [-1, 1] x [0, 1].
+	auto frustum = Frustum::fromMatrix(Matrix4f::identity());
+
+	if (!frustum.intersects(BoundingSphere(Vector3f(0.f, 0.f, 0.5f), 0.1f)) || frustum.intersects(BoundingSphere(Vector3f(0.f, 0.f, -0.5f), 0.1f)))
+		return -1;
+
+	if (!frustum.intersects(BoundingBox(Vector3f(0.9f, 0.9f, 0.9f), Vector3f(2.f, 2.f, 2.f))) || frustum.intersects(BoundingBox(Vector3f(1.1f, 0.f, 0.f), Vector3f(2.f, 1.f, 1.f))))
+		return -2;
+
+	// The kernels must return the same objects in the same order as the scalar tests.
+	Array<UInt32> visibleSpheres(COUNT), visibleBoxes(COUNT);
+	auto sphereCount = FrustumCulling::cull(frustum, bounds.spheres(), visibleSpheres);
+	auto boxCount = FrustumCulling::cull(frustum, bounds.boxes(), visibleBoxes);
+
+	if (sphereCount == 0 || boxCount == 0)
+		return -3;
+
+	size_t sphere{ 0 }, box{ 0 };
+
+	for (size_t i{ 0 }; i < COUNT; ++i)
+	{
+		if (frustum.intersects(bounds.sphere(i)) && (sphere >= sphereCount || visibleSpheres[sphere++] != i))
+			return -4;
+
+		if (frustum.intersects(bounds.box(i)) && (box >= boxCount || visibleBoxes[box++] != i))
+			return -5;
+	}
+
+	if (sphere != sphereCount || box != boxCount)
+		return -6;
+
+	// Compact per-object records, starting at an offset, and compare them against the visible indices.
+	Array<UInt32> records(COUNT), compacted(COUNT);
+	std::ranges::generate(records, [i = 0u]() mutable { return 3u * i++; });
+	auto recordCount = FrustumCulling::compact(frustum, bounds.boxes(), reinterpret_cast<const Byte*>(records.data() + OFFSET), reinterpret_cast<Byte*>(compacted.data()), sizeof(UInt32), COUNT - OFFSET, OFFSET);
+	auto expected = std::ranges::subrange(visibleBoxes.begin(), visibleBoxes.begin() + boxCount) | std::views::filter([](UInt32 index) { return index >= OFFSET; });
+
+	if (recordCount != static_cast<size_t>(std::ranges::distance(expected)))
+		return -7;
+
+	if (!std::ranges::equal(expected | std::views::transform([](UInt32 index) { return 3u * index; }), compacted | std::views::take(recordCount)))
+		return -8;
+
+	// Out of range requests should be rejected.
+	try
+	{
+		FrustumCulling::cull(frustum, bounds.spheres(), visibleSpheres, OFFSET, COUNT);
+		return -9;
+	}
+	catch (const ArgumentOutOfRangeException&) { }
+
+	try
+	{
+		FrustumCulling::cull(frustum, bounds.spheres(), std::span(visibleSpheres).first(COUNT - 1));
+		return -10;
+	}
+	catch (const ArgumentOutOfRangeException&) { }
+
+	return 0;
+}
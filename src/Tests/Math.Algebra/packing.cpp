@@ -0,0 +1,127 @@
+#include "common.h"
+#include <numbers>
+
+template <typename TSource, typename TDestination>
+static Float maxError(const TSource& expected, const TDestination& actual)
+{
+	Float error{ 0.f };
+
+	for (size_t i{ 0 }; i < expected.size(); ++i)
+		error = std::max(error, std::abs(expected[i] - actual[i]));
+
+	return error;
+}
+
+static double angle(const Vector3f& a, const Vector3f& b)
+{
+	// Compute the angle from the cross product in double precision, since acos is inaccurate for small angles.
+	double x = static_cast<double>(a.y()) * b.z() - static_cast<double>(a.z()) * b.y();
+	double y = static_cast<double>(a.z()) * b.x() - static_cast<double>(a.x()) * b.z();
+	double z = static_cast<double>(a.x()) * b.y() - static_cast<double>(a.y()) * b.x();
+	return std::asin(std::min(1.0, std::sqrt(x * x + y * y + z * z) / length(a))) * 180.0 / std::numbers::pi;
+}
+
+int main(int argc, char* argv[])
+{
+	// Use an odd number of values, so that every kernel width and the remainder are covered.
+	constexpr size_t COUNT = 10007;
+
+	std::mt19937 generator(42);
+
+	// Every half must survive a round trip through single precision.
+	for (UInt32 h{ 0 }; h <= 0xFFFF; ++h)
+	{
+		auto value = Packing::fromHalf(static_cast<UInt16>(h));
+		auto result = Packing::toHalf(value);
+
+		if (std::isnan(value) ? (result & 0x7C00) != 0x7C00 || (result & 0x03FF) == 0 : result != h)
+			return -1;
+	}
+
+	// The bulk conversion must match the scalar one, including overflow, underflow and rounding.
+	std::uniform_real_distribution<Float> wide(-70000.f, 70000.f);
+	Array<Float> values(COUNT), results(COUNT);
+	Array<UInt16> halfs(COUNT);
+	std::ranges::generate(values, [&]() { return wide(generator); });
+	values[1] = 1e-6f;
+	values[2] = -3e-8f;
+	values[3] = 65519.f;
+	values[4] = 65520.f;
+	values[5] = std::numeric_limits<Float>::infinity();
+
+	Packing::toHalf(values, halfs);
+
+	for (size_t i{ 0 }; i < COUNT; ++i)
+		if (halfs[i] != Packing::toHalf(values[i]))
+			return -2;
+
+	Packing::fromHalf(halfs, results);
+
+	for (size_t i{ 0 }; i < COUNT; ++i)
+		if (results[i] != Packing::fromHalf(halfs[i]))
+			return -3;
+
+	// Normalized values must be within half a step of the clamped input.
+	std::uniform_real_distribution<Float> unorm(-0.2f, 1.2f), snorm(-1.1f, 1.1f);
+	Array<Float> clamped(COUNT);
+	std::ranges::generate(values, [&]() { return unorm(generator); });
+	std::ranges::transform(values, clamped.begin(), [](Float v) { return std::clamp(v, 0.f, 1.f); });
+
+	Array<Byte> bytes(COUNT);
+	Packing::toUnorm8(values, bytes);
+	Packing::fromUnorm8(bytes, results);
+
+	if (maxError(clamped, results) > 0.5f / 255.f + 1e-6f)
+		return -4;
+
+	Array<UInt16> unorms(COUNT);
+	Packing::toUnorm16(values, unorms);
+	Packing::fromUnorm16(unorms, results);
+
+	if (maxError(clamped, results) > 0.5f / 65535.f + 1e-6f)
+		return -5;
+
+	std::ranges::generate(values, [&]() { return snorm(generator); });
+	std::ranges::transform(values, clamped.begin(), [](Float v) { return std::clamp(v, -1.f, 1.f); });
+
+	Array<Int16> snorms(COUNT);
+	Packing::toSnorm16(values, snorms);
+	Packing::fromSnorm16(snorms, results);
+
+	if (maxError(clamped, results) > 0.5f / 32767.f + 1e-6f)
+		return -6;
+
+	// Octahedral normals must decode to unit vectors close to the original direction.
+	std::uniform_real_distribution<Float> direction(-1.f, 1.f);
+	Array<Vector3f> normals(COUNT), decoded(COUNT);
+	Array<Int16> encoded(COUNT * 2);
+	std::ranges::generate(normals, [&]() { return Vector3f(direction(generator), direction(generator), direction(generator)); });
+	normals[0] = Vector3f(0.f, 0.f, -1.f);
+	normals[1] = Vector3f(0.f, 0.f, 1.f);
+	normals[2] = Vector3f(1.f, 0.f, 0.f);
+	normals[3] = Vector3f(-0.5f, 0.5f, -0.5f);
+
+	Packing::encodeOctahedral(normals, encoded);
+	Packing::decodeOctahedral(encoded, decoded);
+
+	for (size_t i{ 0 }; i < COUNT; ++i)
+	{
+		if (std::abs(length(decoded[i]) - 1.f) > 1e-5f)
+			return -7;
+
+		if (angle(normals[i], decoded[i]) > 0.01)
+			return -8;
+	}
+
+	// Insufficient destinations must be rejected.
+	try
+	{
+		Packing::toHalf(values, std::span(halfs).first(COUNT - 1));
+		return -9;
+	}
+	catch (const ArgumentOutOfRangeException&)
+	{
+	}
+
+	return 0;
+}
@@ -0,0 +1,44 @@
+#include "common.h"
+#include <chrono>
+#include <iostream>
+
+constexpr size_t COUNT = 1 << 20;
+constexpr int ITERATIONS = 20;
+
+template <typename TCallback>
+static void measure(StringView name, TCallback callback)
+{
+	auto start = std::chrono::high_resolution_clock::now();
+
+	for (int i{ 0 }; i < ITERATIONS; ++i)
+		callback();
+
+	auto duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+	std::cout << std::format("{0}: {1:.2f} million values/s", name, static_cast<double>(COUNT) * ITERATIONS / duration / 1000000.0) << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<Float> distribution(-1.f, 1.f);
+	Array<Float> values(COUNT), results(COUNT);
+	Array<Vector3f> normals(COUNT), decoded(COUNT);
+	Array<UInt16> halfs(COUNT), unorms(COUNT);
+	Array<Int16> snorms(COUNT), encoded(COUNT * 2);
+	Array<Byte> bytes(COUNT);
+
+	std::ranges::generate(values, [&]() { return distribution(generator); });
+	std::ranges::generate(normals, [&]() { return Vector3f(distribution(generator), distribution(generator), distribution(generator)); });
+
+	measure("Float to half", [&]() { Packing::toHalf(values, halfs); });
+	measure("Half to float", [&]() { Packing::fromHalf(halfs, results); });
+	measure("Float to unorm8", [&]() { Packing::toUnorm8(values, bytes); });
+	measure("Unorm8 to float", [&]() { Packing::fromUnorm8(bytes, results); });
+	measure("Float to unorm16", [&]() { Packing::toUnorm16(values, unorms); });
+	measure("Float to snorm16", [&]() { Packing::toSnorm16(values, snorms); });
+	measure("Snorm16 to float", [&]() { Packing::fromSnorm16(snorms, results); });
+	measure("Octahedral encode", [&]() { Packing::encodeOctahedral(normals, encoded); });
+	measure("Octahedral decode", [&]() { Packing::decodeOctahedral(encoded, decoded); });
+
+	return 0;
+}
@@ -0,0 +1,58 @@
+#include "common.h"
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <thread>
+
+constexpr size_t COUNT = 1 << 20;
+constexpr int ITERATIONS = 20;
+
+template <typename TCallback>
+static void measure(StringView name, TCallback callback)
+{
+	auto start = std::chrono::high_resolution_clock::now();
+
+	for (int i{ 0 }; i < ITERATIONS; ++i)
+		callback();
+
+	auto duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+	std::cout << std::format("{0}: {1:.2f} million matrices/s", name, static_cast<double>(COUNT) * ITERATIONS / duration / 1000000.0) << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<Float> distribution(-2.f, 2.f);
+	Array<Float> components[10];
+
+	for (auto& component : components)
+	{
+		component.resize(COUNT);
+		std::ranges::generate(component, [&]() { return distribution(generator); });
+	}
+
+	TransformComponents batch = { components[0], components[1], components[2], components[3], components[4], components[5], components[6], components[7], components[8], components[9] };
+	Array<Matrix3x4f> affineTransforms(COUNT);
+	Array<Matrix4f> transforms(COUNT);
+
+	measure("Compose 3x4 (single thread)", [&]() { TransformBatch::compose(batch, affineTransforms); });
+	measure("Compose 4x4 (single thread)", [&]() { TransformBatch::compose(batch, transforms); });
+
+	// Split the batch into chunks, which are processed in parallel.
+	const size_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+	const size_t chunkSize = (COUNT / threads + 15) & ~size_t{ 15 };
+
+	measure(std::format("Compose 3x4 ({0} threads)", threads), [&]() {
+		Array<std::future<void>> chunks;
+
+		for (size_t offset{ 0 }; offset < COUNT; offset += chunkSize)
+			chunks.push_back(std::async(std::launch::async, [&, offset]() { 
+				TransformBatch::compose(batch, std::span(affineTransforms).subspan(offset, std::min(chunkSize, COUNT - offset)), offset);
+			}));
+
+		for (auto& chunk : chunks)
+			chunk.get();
+	});
+
+	return 0;
+}
@@ -0,0 +1,107 @@
+#include "common.h"
+#include <cstring>
+
+struct Components {
+	Array<Float> Translation[3], Rotation[4], Scale[3];
+
+	Components(size_t count, std::mt19937& generator) {
+		std::uniform_real_distribution<Float> distribution(-2.f, 2.f);
+
+		for (size_t i{ 0 }; i < count; ++i)
+		{
+			auto q = random<Vector4f>(generator);
+			q = normalize(q);
+
+			for (int c{ 0 }; c < 3; ++c)
+			{
+				Translation[c].push_back(distribution(generator));
+				Scale[c].push_back(distribution(generator));
+			}
+
+			for (int c{ 0 }; c < 4; ++c)
+				Rotation[c].push_back(q[c]);
+		}
+	}
+
+	TransformComponents get() const noexcept {
+		return { Translation[0], Translation[1], Translation[2], Rotation[0], Rotation[1], Rotation[2], Rotation[3], Scale[0], Scale[1], Scale[2] };
+	}
+
+	Matrix4f compose(size_t i) const noexcept {
+		Float x = Rotation[0][i], y = Rotation[1][i], z = Rotation[2][i], w = Rotation[3][i];
+
+		Matrix4f translation = { 1.f, 0.f, 0.f, Translation[0][i], 0.f, 1.f, 0.f, Translation[1][i], 0.f, 0.f, 1.f, Translation[2][i], 0.f, 0.f, 0.f, 1.f };
+		Matrix4f scale = { Scale[0][i], 0.f, 0.f, 0.f, 0.f, Scale[1][i], 0.f, 0.f, 0.f, 0.f, Scale[2][i], 0.f, 0.f, 0.f, 0.f, 1.f };
+		Matrix4f rotation = {
+			1.f - 2.f * (y * y + z * z), 2.f * (x * y - w * z), 2.f * (x * z + w * y), 0.f,
+			2.f * (x * y + w * z), 1.f - 2.f * (x * x + z * z), 2.f * (y * z - w * x), 0.f,
+			2.f * (x * z - w * y), 2.f * (y * z + w * x), 1.f - 2.f * (x * x + y * y), 0.f,
+			0.f, 0.f, 0.f, 1.f
+		};
+
+		return translation * rotation * scale;
+	}
+};
+
+int main(int argc, char* argv[])
+{
+	// Use an odd number of transforms, so that every kernel width and the scalar remainder are covered.
+	constexpr size_t COUNT = 1037;
+	constexpr size_t OFFSET = 5;
+
+	std::mt19937 generator(42);
+	Components components(COUNT, generator);
+	auto batch = components.get();
+
+	if (batch.size() != COUNT)
+		return -1;
+
+	Array<Matrix4f> transforms(COUNT - OFFSET);
+	Array<Matrix3x4f> affineTransforms(COUNT - OFFSET);
+	TransformBatch::compose(batch, transforms, OFFSET);
+	TransformBatch::compose(batch, affineTransforms, OFFSET);
+
+	for (size_t i{ 0 }; i < transforms.size(); ++i)
+	{
+		auto expected = components.compose(i + OFFSET);
+
+		if (!equal(transforms[i], expected, 1e-3f))
+			return -2;
+
+		for (unsigned r{ 0 }; r < 3; ++r)
+			for (unsigned c{ 0 }; c < 4; ++c)
+				if (std::abs(affineTransforms[i].at(r, c) - expected.at(r, c)) > 1e-3f * (1.f + std::abs(expected.at(r, c))))
+					return -3;
+	}
+
+	// Write into a strided destination and make sure the gaps between the transforms are not touched.
+	constexpr size_t STRIDE = 64;
+	Array<Byte> buffer(STRIDE * 20, 0xCD);
+	TransformBatch::compose(batch, buffer.data(), STRIDE, 20);
+
+	for (size_t i{ 0 }; i < 20; ++i)
+	{
+		Matrix3x4f transform;
+		std::memcpy(transform.elements(), buffer.data() + i * STRIDE, sizeof(transform));
+
+		if (transform.at(1, 3) != components.Translation[1][i] || buffer[i * STRIDE + sizeof(transform)] != 0xCD || buffer[(i + 1) * STRIDE - 1] != 0xCD)
+			return -4;
+	}
+
+	// Out of range requests should be rejected.
+	try
+	{
+		TransformBatch::compose(batch, transforms, OFFSET + 1);
+		return -5;
+	}
+	catch (const ArgumentOutOfRangeException&) { }
+
+	try
+	{
+		TransformBatch::compose(batch, buffer.data(), 16, 1);
+		return -6;
+	}
+	catch (const ArgumentOutOfRangeException&) { }
+
+	return 0;
+}
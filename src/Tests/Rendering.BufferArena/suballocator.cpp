@@ -0,0 +1,87 @@
+#include <litefx/rendering.hpp>
+#include <random>
+
+using namespace LiteFX;
+using namespace LiteFX::Rendering;
+
+int main(int argc, char* argv[])
+{
+    // The linear policy places allocations one after another and only releases them all at once.
+    BufferSuballocator linear(1024, BufferArenaPolicy::Linear);
+
+    if (linear.allocate(100, 1) != 0 || linear.allocate(64, 256) != 256 || linear.allocate(1024, 1).has_value())
+        return -1;
+
+    linear.reset();
+
+    if (linear.used() != 0 || linear.allocate(1024, 1) != 0)
+        return -2;
+
+    // The free list policy must never hand out overlapping ranges and must honor the alignment.
+    constexpr UInt64 SIZE = 1 << 20;
+    BufferSuballocator freeList(SIZE, BufferArenaPolicy::FreeList);
+    Array<std::pair<UInt64, UInt64>> live;
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<UInt64> size(1, 4096);
+    std::uniform_int_distribution<UInt32> alignment(0, 8);
+
+    for (int i { 0 }; i < 10000; ++i)
+    {
+        if (!live.empty() && generator() % 3 == 0)
+        {
+            auto index = generator() % live.size();
+            freeList.free(live[index].first);
+            live.erase(live.begin() + index);
+            continue;
+        }
+
+        auto requested = size(generator);
+        auto alignTo = 1ull << alignment(generator);
+        auto offset = freeList.allocate(requested, alignTo);
+
+        if (!offset.has_value())
+            continue;
+
+        if (*offset % alignTo != 0 || *offset + requested > SIZE)
+            return -3;
+
+        for (const auto& [other, otherSize] : live)
+        {
+            if (*offset < other + otherSize && other < *offset + requested)
+                return -4;
+        }
+
+        live.emplace_back(*offset, requested);
+    }
+
+    if (freeList.allocations() != live.size())
+        return -5;
+
+    // After releasing everything, the free ranges must have been merged back into a single range.
+    for (const auto& allocation : live)
+        freeList.free(allocation.first);
+
+    if (freeList.used() != 0 || freeList.allocate(SIZE, 1) != 0)
+        return -6;
+
+    // A request that covers the whole range fits, if its offset is already aligned, but larger requests are rejected.
+    freeList.reset();
+
+    if (freeList.allocate(SIZE, 4) != 0 || freeList.allocate(1, 4).has_value())
+        return -7;
+
+    freeList.reset();
+
+    if (freeList.allocate(SIZE + 1, 1).has_value() || freeList.allocate(SIZE - 8, 4) != 0 || freeList.allocate(8, 8) != SIZE - 8)
+        return -8;
+
+    // Releasing a range that is not allocated is an error.
+    try
+    {
+        freeList.free(12);
+        return -9;
+    }
+    catch (const InvalidArgumentException&) { }
+
+    return 0;
+}
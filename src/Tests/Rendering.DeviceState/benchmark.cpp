@@ -0,0 +1,101 @@
+#include "common.h"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <thread>
+
+constexpr UInt32 RESOURCES = 100000;
+constexpr UInt32 READERS = 4;
+
+template <typename TCallback>
+static auto measure(StringView name, TCallback callback)
+{
+	auto start = std::chrono::high_resolution_clock::now();
+	auto result = callback();
+	auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start);
+	std::cout << std::format("{0}: {1} us ({2:.2f} ns per resource)", name, duration.count(), duration.count() * 1000.0 / RESOURCES) << std::endl;
+	return result;
+}
+
+int main(int argc, char* argv[])
+{
+	DeviceState state;
+	Array<String> names(RESOURCES);
+	Array<StateHandle<ISampler>> handles(RESOURCES);
+
+	for (UInt32 i{ 0 }; i < RESOURCES; ++i)
+		names[i] = std::format("Sampler {0}", i);
+
+	measure("Add", [&]() {
+		for (UInt32 i{ 0 }; i < RESOURCES; ++i)
+			handles[i] = state.add(makeUnique<TestSampler>(names[i]));
+
+		return true;
+	});
+
+	if (!measure("Resolve by identifier", [&]() {
+		for (UInt32 i{ 0 }; i < RESOURCES; ++i)
+			if (state.sampler(names[i]).name() != names[i])
+				return false;
+
+		return true;
+	})) return -1;
+
+	if (!measure("Resolve by handle", [&]() {
+		for (UInt32 i{ 0 }; i < RESOURCES; ++i)
+			if (state.get(handles[i]).name() != names[i])
+				return false;
+
+		return true;
+	})) return -2;
+
+	// Resolve resources from multiple threads, whilst the main thread keeps adding new ones.
+	std::atomic_bool failed{ false };
+
+	measure("Concurrent resolve and add", [&]() {
+		Array<std::jthread> readers;
+
+		for (UInt32 r{ 0 }; r < READERS; ++r)
+			readers.emplace_back([&, r]() {
+				for (UInt32 i{ r }; i < RESOURCES; i += READERS)
+					if (state.get(handles[i]).name() != names[i])
+						failed = true;
+			});
+
+		for (UInt32 i{ 0 }; i < RESOURCES / 10; ++i)
+			state.add(std::format("Concurrent Sampler {0}", i), makeUnique<TestSampler>(names[i]));
+
+		return true;
+	});
+
+	if (failed)
+		return -3;
+
+	// Release the resources in random order, alternating between releasing by reference and by handle.
+	std::mt19937 generator(42);
+	Array<UInt32> order(RESOURCES);
+	std::iota(order.begin(), order.end(), 0);
+	std::ranges::shuffle(order, generator);
+
+	if (!measure("Release", [&]() {
+		for (UInt32 i{ 0 }; i < RESOURCES; ++i)
+		{
+			auto index = order[i];
+
+			if (i % 2 == 0 ? !state.release(state.get(handles[index])) : !state.release(handles[index]))
+				return false;
+		}
+
+		return true;
+	})) return -4;
+
+	if (std::ranges::any_of(handles, [&](const auto& handle) { return state.contains(handle); }))
+		return -5;
+
+	measure("Clear", [&]() {
+		state.clear();
+		return true;
+	});
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <litefx/rendering.hpp>
+
+using namespace LiteFX;
+using namespace LiteFX::Rendering;
+
+class TestSampler : public virtual ISampler, public StateResource {
+public:
+    TestSampler(StringView name) : StateResource(name) { }
+    virtual ~TestSampler() noexcept = default;
+
+    FilterMode getMinifyingFilter() const noexcept override { return FilterMode::Linear; }
+    FilterMode getMagnifyingFilter() const noexcept override { return FilterMode::Linear; }
+    BorderMode getBorderModeU() const noexcept override { return BorderMode::Repeat; }
+    BorderMode getBorderModeV() const noexcept override { return BorderMode::Repeat; }
+    BorderMode getBorderModeW() const noexcept override { return BorderMode::Repeat; }
+    Float getAnisotropy() const noexcept override { return 0.f; }
+    MipMapMode getMipMapMode() const noexcept override { return MipMapMode::Linear; }
+    Float getMipMapBias() const noexcept override { return 0.f; }
+    Float getMaxLOD() const noexcept override { return 0.f; }
+    Float getMinLOD() const noexcept override { return 0.f; }
+};
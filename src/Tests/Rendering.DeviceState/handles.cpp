@@ -0,0 +1,54 @@
+#include "common.h"
+
+int main(int argc, char* argv[])
+{
+	DeviceState state;
+
+	auto first = state.add(makeUnique<TestSampler>("First"));
+	auto second = state.add(makeUnique<TestSampler>("Second"));
+
+	if (!first.valid() || !second.valid() || first == second)
+		return -1;
+
+	// Resolving by identifier and handle must return the same resource.
+	if (&state.sampler("First") != &state.get(first) || state.handle<ISampler>("Second") != second)
+		return -2;
+
+	// Adding a resource with the same identifier must fail.
+	try
+	{
+		state.add(makeUnique<TestSampler>("First"));
+		return -3;
+	}
+	catch (const InvalidArgumentException&) { }
+
+	// Releasing by reference must invalidate the handle.
+	if (!state.release(state.get(first)) || state.contains(first) || state.handle<ISampler>("First").valid())
+		return -4;
+
+	// A new resource that re-uses the slot must not be resolvable by the stale handle.
+	auto third = state.add(makeUnique<TestSampler>("First"));
+
+	if (third.index != first.index || third.generation == first.generation || state.contains(first) || !state.contains(third))
+		return -5;
+
+	try
+	{
+		state.get(first);
+		return -6;
+	}
+	catch (const InvalidArgumentException&) { }
+
+	// Releasing by handle must only succeed once.
+	if (!state.release(second) || state.release(second) || state.contains(second))
+		return -7;
+
+	// Default-initialized handles never resolve.
+	if (StateHandle<ISampler>{ }.valid() || state.contains(StateHandle<ISampler>{ }))
+		return -8;
+
+	state.clear();
+
+	if (state.contains(third))
+		return -9;
+}
@@ -0,0 +1,65 @@
+#include <litefx/rendering.hpp>
+
+using namespace LiteFX;
+using namespace LiteFX::Rendering;
+
+int main(int argc, char* argv[])
+{
+    MemoryTracker tracker;
+    auto vertices = tracker.track(ResourceHeap::Resource, BufferType::Vertex, 4096);
+    auto staging = tracker.track(ResourceHeap::Staging, BufferType::Storage, 1024);
+    auto texture = tracker.track(ResourceHeap::Resource, std::nullopt, 65536);
+
+    auto statistics = tracker.statistics();
+
+    if (statistics.Total.Allocations != 3 || statistics.Total.Bytes != 4096 + 1024 + 65536)
+        return -1;
+
+    if (statistics.Heaps[ResourceHeap::Resource].Bytes != 4096 + 65536 || statistics.Heaps[ResourceHeap::Staging].Allocations != 1)
+        return -2;
+
+    if (statistics.Buffers[BufferType::Vertex].Bytes != 4096 || statistics.Images.Allocations != 1 || statistics.Images.Bytes != 65536)
+        return -3;
+
+    // Released allocations must no longer be counted.
+    MemoryTracker::release(staging);
+    MemoryTracker::release(texture);
+    MemoryTracker::release(nullptr);
+    statistics = tracker.statistics();
+
+    if (statistics.Total.Allocations != 1 || statistics.Total.Bytes != 4096 || statistics.Images.Allocations != 0 || statistics.Heaps[ResourceHeap::Staging].Bytes != 0)
+        return -4;
+
+    MemoryTracker::release(vertices);
+
+    // An exceeded budget must only be reported once, until the usage drops below the threshold again.
+    tracker.setBudgetThreshold(0.5f);
+    Array<MemoryHeapBudget> budgets { { .Heap = 0, .DeviceLocal = true, .Usage = 600, .Budget = 1000 }, { .Heap = 1, .DeviceLocal = false, .Usage = 100, .Budget = 1000 } };
+
+    if (auto exceeded = tracker.checkBudgets(budgets); exceeded.size() != 1 || exceeded.front().Heap != 0)
+        return -5;
+
+    if (!tracker.checkBudgets(budgets).empty())
+        return -6;
+
+    budgets[0].Usage = 400;
+
+    if (!tracker.checkBudgets(budgets).empty())
+        return -7;
+
+    budgets[0].Usage = 900;
+
+    if (tracker.checkBudgets(budgets).size() != 1)
+        return -8;
+
+    try
+    {
+        tracker.setBudgetThreshold(0.f);
+        return -9;
+    }
+    catch (const ArgumentOutOfRangeException&)
+    {
+    }
+
+    return 0;
+}
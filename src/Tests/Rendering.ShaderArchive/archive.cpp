@@ -0,0 +1,168 @@
+#include <litefx/rendering.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+
+using namespace LiteFX;
+using namespace LiteFX::Rendering;
+
+// Offsets of the fields that are corrupted by the test. See `src/Rendering/src/shader_archive.cpp` for the layout.
+constexpr size_t HEADER_SIZE = 32, RECORD_SIZE = 56;
+constexpr size_t HEADER_REFLECTION_OFFSET = 16, HEADER_REFLECTION_SIZE = 24;
+constexpr size_t RECORD_STAGE = 16, RECORD_OFFSET = 32, RECORD_SIZE_FIELD = 40, RECORD_UNCOMPRESSED_SIZE = 48;
+
+static void writeFile(const String& fileName, const Array<char>& data)
+{
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+static Array<char> readFile(const String& fileName)
+{
+    std::ifstream file(fileName, std::ios::binary);
+    return Array<char>(std::istreambuf_iterator<char>(file), { });
+}
+
+template <typename T>
+static T read(const Array<char>& data, size_t offset)
+{
+    T value;
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    return value;
+}
+
+template <typename T>
+static Array<char> patch(Array<char> data, size_t offset, T value)
+{
+    std::memcpy(data.data() + offset, &value, sizeof(T));
+    return data;
+}
+
+static bool rejects(const String& fileName, const Array<char>& data)
+{
+    writeFile(fileName, data);
+
+    try
+    {
+        ShaderArchive archive(fileName);
+
+        // Corrupted compressed modules are only detected when they are decompressed.
+        for (const auto& entry : archive.entries())
+            archive.bytecode(entry.Name);
+
+        return false;
+    }
+    catch (const RuntimeException&)
+    {
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // Create modules that cover literal runs, long matches, incompressible data and blocks that are too small to contain a match.
+    std::mt19937 generator(42);
+    Array<std::pair<String, Array<char>>> modules(5);
+    modules[0].first = "words";
+    modules[1].first = "zeros";
+    modules[2].first = "noise";
+    modules[3].first = "tiny";
+    modules[4].first = "mixed";
+
+    for (UInt32 i { 0 }; i < 4096; ++i)
+    {
+        auto word = 0x07230203u + (i % 17) * 0x10000u;
+        modules[0].second.insert(modules[0].second.end(), reinterpret_cast<const char*>(&word), reinterpret_cast<const char*>(&word) + sizeof(word));
+    }
+
+    modules[1].second.resize(20000, '\0');
+    std::ranges::generate_n(std::back_inserter(modules[2].second), 4096, [&generator]() { return static_cast<char>(generator()); });
+    modules[3].second = { 'L', 'F', 'X', '!' };
+    std::ranges::generate_n(std::back_inserter(modules[4].second), 16384, [&generator, i = 0]() mutable { return (i++ % 64) < 32 ? static_cast<char>(i % 7) : static_cast<char>(generator()); });
+
+    Array<char> reflection(100, 'R');
+    String command = std::format("\"{0}\" rendering_shader_archive.lfxa -c -r rendering_shader_archive.reflection", LITEFX_TEST_PCKAR);
+    writeFile("rendering_shader_archive.reflection", reflection);
+
+    for (const auto& [name, data] : modules)
+    {
+        writeFile(std::format("rendering_shader_archive.{0}.spv", name), data);
+        command += std::format(" {0} {1} main_{0} rendering_shader_archive.{0}.spv", name, name == "noise" ? "COMPUTE" : "VERTEX");
+    }
+
+    if (std::system(command.c_str()) != 0)
+        return -1;
+
+    // Every module must be restored exactly, regardless of whether it has been compressed.
+    {
+        ShaderArchive archive("rendering_shader_archive.lfxa");
+
+        if (archive.entries().size() != modules.size())
+            return -2;
+
+        for (const auto& [name, data] : modules)
+        {
+            if (!archive.contains(name))
+                return -3;
+
+            const auto& entry = archive.entry(name);
+            const auto bytecode = archive.bytecode(name);
+
+            if (entry.EntryPoint != std::format("main_{0}", name) || entry.Stage != (name == "noise" ? ShaderStage::Compute : ShaderStage::Vertex))
+                return -4;
+
+            if (bytecode.size() != data.size() || std::memcmp(bytecode.data(), data.data(), data.size()) != 0)
+                return -5;
+        }
+
+        if (!archive.entry("words").Compressed || !archive.entry("zeros").Compressed || archive.entry("noise").Compressed || archive.entry("tiny").Compressed)
+            return -6;
+
+        const auto reflectionData = archive.reflectionData();
+
+        if (reflectionData.size() != reflection.size() || std::memcmp(reflectionData.data(), reflection.data(), reflection.size()) != 0)
+            return -7;
+    }
+
+    // Corrupted archives must be rejected, especially if offsets and sizes would overflow when added.
+    const auto data = readFile("rendering_shader_archive.lfxa");
+    const String corrupted = "rendering_shader_archive.corrupted.lfxa";
+    const auto record = [](size_t index, size_t field) { return HEADER_SIZE + index * RECORD_SIZE + field; };
+
+    if (rejects(corrupted, data))
+        return -8;
+
+    if (!rejects(corrupted, Array<char>(data.begin(), data.begin() + HEADER_SIZE + RECORD_SIZE)))
+        return -9;
+
+    if (!rejects(corrupted, patch(patch(data, record(0, RECORD_OFFSET), std::numeric_limits<UInt64>::max() - 7), record(0, RECORD_SIZE_FIELD), 16ull)))
+        return -10;
+
+    if (!rejects(corrupted, patch(patch(data, HEADER_REFLECTION_OFFSET, std::numeric_limits<UInt64>::max() - 7), HEADER_REFLECTION_SIZE, 16ull)))
+        return -11;
+
+    if (!rejects(corrupted, patch(data, record(0, RECORD_STAGE), 0x00000003u)))
+        return -12;
+
+    if (!rejects(corrupted, patch(data, record(0, RECORD_UNCOMPRESSED_SIZE), 4096ull * 4 + 1)))
+        return -13;
+
+    // Uncompressed sizes that can not be produced by the compressed data must be rejected before allocating memory for them.
+    if (!rejects(corrupted, patch(data, record(0, RECORD_UNCOMPRESSED_SIZE), std::numeric_limits<UInt64>::max())))
+        return -14;
+
+    // Uncompressed modules that are not aligned to SPIR-V words must be rejected.
+    if (!rejects(corrupted, patch(data, record(2, RECORD_OFFSET), read<UInt64>(data, record(2, RECORD_OFFSET)) + 2)))
+        return -15;
+
+    std::remove(corrupted.c_str());
+    std::remove("rendering_shader_archive.lfxa");
+    std::remove("rendering_shader_archive.reflection");
+
+    for (const auto& name : modules | std::views::keys)
+        std::remove(std::format("rendering_shader_archive.{0}.spv", name).c_str());
+
+    return 0;
+}
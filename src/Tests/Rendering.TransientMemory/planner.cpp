@@ -0,0 +1,80 @@
+#include <litefx/rendering.hpp>
+
+using namespace LiteFX;
+using namespace LiteFX::Rendering;
+
+int main(int argc, char* argv[])
+{
+    // Model a frame with a G-buffer, an ambient occlusion pass and a bloom chain.
+    constexpr UInt64 MB = 1024 * 1024;
+    TransientMemoryPlanner planner;
+    auto gBuffer = planner.add({ .Size = 32 * MB, .Alignment = 65536, .MemoryTypes = 0x03, .FirstUse = 0, .LastUse = 2 });
+    auto occlusion = planner.add({ .Size = 8 * MB, .Alignment = 65536, .MemoryTypes = 0x01, .FirstUse = 1, .LastUse = 2 });
+    auto bloom0 = planner.add({ .Size = 16 * MB, .Alignment = 65536, .MemoryTypes = 0x03, .FirstUse = 3, .LastUse = 4 });
+    auto bloom1 = planner.add({ .Size = 4 * MB, .Alignment = 65536, .MemoryTypes = 0x03, .FirstUse = 4, .LastUse = 5 });
+    auto history = planner.add({ .Size = 1 * MB, .Alignment = 256, .MemoryTypes = 0x04, .FirstUse = 0, .LastUse = 5 });
+    planner.plan();
+
+    const auto& placements = planner.placements();
+    const auto& resources = planner.resources();
+    const auto& blocks = planner.blocks();
+
+    // Resources that are alive at the same time must not overlap, all others in the same block must be reported as aliases.
+    for (UInt32 a{ 0 }; a < resources.size(); ++a)
+    {
+        if (placements[a].Offset % resources[a].Alignment != 0 || placements[a].Offset + resources[a].Size > blocks[placements[a].Block].Size)
+            return -1;
+
+        if ((blocks[placements[a].Block].MemoryTypes & resources[a].MemoryTypes) == 0)
+            return -2;
+
+        for (UInt32 b{ 0 }; b < resources.size(); ++b)
+        {
+            if (a == b || placements[a].Block != placements[b].Block)
+                continue;
+
+            bool memoryOverlaps = placements[a].Offset < placements[b].Offset + resources[b].Size && placements[b].Offset < placements[a].Offset + resources[a].Size;
+            bool lifetimeOverlaps = resources[a].FirstUse <= resources[b].LastUse && resources[b].FirstUse <= resources[a].LastUse;
+
+            if (memoryOverlaps && lifetimeOverlaps)
+                return -3;
+
+            bool aliased = std::ranges::find(placements[a].Aliases, b) != placements[a].Aliases.end();
+
+            if (aliased != (memoryOverlaps && resources[b].LastUse < resources[a].FirstUse))
+                return -4;
+        }
+    }
+
+    // The bloom chain can re-use the G-buffer memory, whilst the history buffer requires its own block.
+    if (placements[bloom0].Block != placements[gBuffer].Block || placements[bloom1].Block != placements[gBuffer].Block || placements[bloom0].Aliases.empty() ||
+        !placements[occlusion].Aliases.empty() || placements[history].Block == placements[gBuffer].Block)
+        return -5;
+
+    const auto& statistics = planner.statistics();
+
+    if (statistics.Resources != 5 || statistics.Blocks != 2 || statistics.UnaliasedMemory != 61 * MB || statistics.AliasedMemory != 41 * MB)
+        return -6;
+
+    // Invalid requirements must be rejected.
+    try
+    {
+        planner.add({ .Size = 1, .Alignment = 3 });
+        return -7;
+    }
+    catch (const InvalidArgumentException&) { }
+
+    try
+    {
+        planner.add({ .Size = 1, .FirstUse = 2, .LastUse = 1 });
+        return -8;
+    }
+    catch (const InvalidArgumentException&) { }
+
+    planner.clear();
+
+    if (!planner.placements().empty() || planner.statistics().Blocks != 0)
+        return -9;
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+#include <litefx/rendering.hpp>
+#include <random>
+
+using namespace LiteFX;
+using namespace LiteFX::Rendering;
+using Vertex = LiteFX::Graphics::Vertex;
+
+class TestVertexBufferLayout : public IVertexBufferLayout {
+private:
+    Array<BufferAttribute> m_attributes;
+    size_t m_elementSize;
+
+public:
+    TestVertexBufferLayout(size_t elementSize, Array<BufferAttribute>&& attributes) : m_attributes(std::move(attributes)), m_elementSize(elementSize) { }
+    virtual ~TestVertexBufferLayout() noexcept = default;
+
+    size_t elementSize() const noexcept override { return m_elementSize; }
+    UInt32 binding() const noexcept override { return 0; }
+    BufferType type() const noexcept override { return BufferType::Vertex; }
+    Enumerable<const BufferAttribute*> attributes() const noexcept override { return m_attributes | std::views::transform([](const BufferAttribute& attribute) { return &attribute; }); }
+};
+
+int main(int argc, char* argv[])
+{
+    // Use an odd number of vertices, so that the last block is only partially filled.
+    constexpr size_t COUNT = 1001;
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<Float> position(-10.f, 10.f), color(0.f, 1.f), direction(-1.f, 1.f), uv(0.f, 1.f);
+    Array<Vertex> vertices(COUNT);
+
+    std::ranges::generate(vertices, [&]() {
+        return Vertex {
+            .Position = Vector3f(position(generator), position(generator), position(generator)),
+            .Color = Vector4f(color(generator), color(generator), color(generator), 1.f),
+            .Normal = normalize(Vector3f(direction(generator), direction(generator), direction(generator))),
+            .TextureCoordinate0 = Vector2f(uv(generator), uv(generator))
+        };
+    });
+
+    // Half precision positions, 8-bit colors, octahedral normals and 16-bit texture coordinates fit into 20 bytes.
+    Array<BufferAttribute> attributes;
+    attributes.emplace_back(0, 0, BufferFormat::XYZW16F, AttributeSemantic::Position);
+    attributes.emplace_back(1, 8, BufferFormat::XYZW8UN, AttributeSemantic::Color);
+    attributes.emplace_back(2, 12, BufferFormat::XY16SN, AttributeSemantic::Normal);
+    attributes.emplace_back(3, 16, BufferFormat::XY16UN, AttributeSemantic::TextureCoordinate);
+    TestVertexBufferLayout layout(20, std::move(attributes));
+
+    VertexCompressor compressor(layout);
+    auto compressed = compressor.compress(vertices);
+
+    if (compressed.size() != COUNT * 20 || compressed.size() * 2 >= COUNT * sizeof(Vertex))
+        return -1;
+
+    Array<Vertex> decompressed(COUNT);
+    compressor.decompress(compressed, decompressed);
+
+    for (size_t i{ 0 }; i < COUNT; ++i)
+    {
+        auto& expected = vertices[i];
+        auto& actual = decompressed[i];
+
+        for (int c{ 0 }; c < 3; ++c)
+        {
+            // Half precision values have 11 significant bits.
+            if (std::abs(expected.Position[c] - actual.Position[c]) > std::abs(expected.Position[c]) / 2048.f)
+                return -2;
+
+            if (std::abs(expected.Color[c] - actual.Color[c]) > 0.5f / 255.f + 1e-6f)
+                return -3;
+
+            if (std::abs(expected.Normal[c] - actual.Normal[c]) > 1e-3f)
+                return -4;
+        }
+
+        for (int c{ 0 }; c < 2; ++c)
+            if (std::abs(expected.TextureCoordinate0[c] - actual.TextureCoordinate0[c]) > 0.5f / 65535.f + 1e-6f)
+                return -5;
+    }
+
+    // Unsupported formats must be rejected.
+    try
+    {
+        Array<BufferAttribute> invalid;
+        invalid.emplace_back(0, 0, BufferFormat::XYZ8UN, AttributeSemantic::Position);
+        TestVertexBufferLayout invalidLayout(3, std::move(invalid));
+        VertexCompressor invalidCompressor(invalidLayout);
+        return -6;
+    }
+    catch (const InvalidArgumentException&) { }
+
+    return 0;
+}
@@ -0,0 +1,35 @@
+#include <litefx/logging.hpp>
+#include <CLI/CLI.hpp>
+#include <iostream>
+
+using namespace LiteFX::Logging;
+
+int main(const int argc, const char** argv)
+{
+	String traceFile, jsonFile;
+
+	CLI::App app{ "Converts a binary LiteFX trace file into the Chrome trace event format, which can be opened in Perfetto or chrome://tracing." };
+	app.add_option("input", traceFile, "The binary trace file to convert.")->required()->check(CLI::ExistingFile);
+	app.add_option("output", jsonFile, "The name of the JSON file to write.")->required();
+
+	try
+	{
+		app.parse(argc, argv);
+	}
+	catch (const CLI::ParseError& ex)
+	{
+		return app.exit(ex);
+	}
+
+	try
+	{
+		TraceSink::convert(traceFile, jsonFile);
+	}
+	catch (const LiteFX::Exception& ex)
+	{
+		std::cerr << ex.what() << std::endl;
+		return -1;
+	}
+
+	return 0;
+}
@@ -16,12 +16,15 @@ OPTION(LITEFX_BUILD_EXAMPLES "When set to OFF, no samples will be built, regardl
 OPTION(LITEFX_BUILD_EXAMPLES_DX12_PIX_LOADER "Add code to samples to load PIX GPU capture library when starting with --dx-load-pix=1 command line argument." ON)
 
 OPTION(LITEFX_BUILD_TESTS "When set to ON, tests will be built for the project." OFF)
+OPTION(LITEFX_BUILD_TOOLS "When set to ON, offline tools, such as the trace converter, will be built for the project." OFF)
 
 # NOTE: In order for this to work, you should add the RenderDoc installation path to the PATH environment variable, so that the runtime can pick up the API dll.
 OPTION(LITEFX_BUILD_EXAMPLES_RENDERDOC_LOADER "Adds code to the samples to create additional RenderDoc capture triggers for simplified debugging, when starting with --load-render-doc=1 command line argument." OFF)
 
 OPTION(LITEFX_BUILD_WITH_GLM "Enables glm converters for math types." ON)
 OPTION(LITEFX_BUILD_WITH_DIRECTX_MATH "Enables DirectXMath converters for math types." ON)
+OPTION(LITEFX_BUILD_WITH_SIMD "Enables SIMD arithmetic for math types (SSE4.1, AVX2 or AVX-512 on x64, NEON on ARM64)." ON)
+SET(LITEFX_BUILD_SIMD_INSTRUCTION_SET "SSE4" CACHE STRING "The instruction set used for SIMD arithmetic on x64 targets. Valid values are SSE4, AVX2 and AVX512.")
 
 FIND_PROGRAM(LITEFX_BUILD_GLSLC_COMPILER glslc HINTS ENV VULKAN_SDK PATH_SUFFIXES bin DOC "The full path to the `glslc.exe` shader compiler binary.")
 FIND_PROGRAM(LITEFX_BUILD_DXC_COMPILER dxc HINTS ${DIRECTX_DXC_TOOL} ENV VULKAN_SDK PATH_SUFFIXES bin DOC "The full path to the `dxc.exe` shader compiler binary.")
@@ -66,10 +66,30 @@
 # This will define a dependency for the specified target for all shader module targets. Furthermore, it automatically creates an install command for the shader module 
 # binaries. The source file is build from the RUNTIME_OUTPUT_DIRECTORY, OUTPUT_NAME and SUFFIX properties of each shader module target. The install destination can be 
 # provided by the INSTALL_DESTINATION parameter. Note that it is always prepended with the CMAKE_INSTALL_PREFIX.
+#
+# Instead of loading each shader module binary from a separate file, multiple shader modules can be packed into a single shader archive using ADD_SHADER_ARCHIVE:
+#
+# ADD_SHADER_ARCHIVE(${PROJECT_NAME}.Shaders
+#   OUTPUT_NAME "shaders"
+#   SHADERS ${PROJECT_NAME}.VertexShader ${PROJECT_NAME}.PixelShader
+#   COMPRESS
+#   REFLECTION_DATA "${CMAKE_CURRENT_BINARY_DIR}/reflection.bin"
+# )
+#
+# The archive stores an index of all shader modules, which can be loaded from the archive at runtime by their name using the `ShaderArchive` class. The name of a shader 
+# module within the archive equals the OUTPUT_NAME property of its target. The shader stage is derived from the TYPE parameter, which is stored in the SHADER_TYPE property
+# of each shader module target. RAYTRACING modules are stored without a specific shader stage, which must then be provided when loading them. 
+#
+# If the COMPRESS option is set, the bytecode of each module is LZ4-compressed, if this reduces its size. The optional REFLECTION_DATA parameter provides a file that 
+# contains precomputed reflection data (e.g., a cache file written by `VulkanShaderProgram::saveReflectionCache`), which is appended to the archive. The OUTPUT_NAME
+# parameter is optional and defaults to the archive target name. The archive is written to the same directory as shader modules and its file extension is configured 
+# by the SHADER_ARCHIVE_DEFAULT_SUFFIX variable. As the archive target provides the same properties as a shader module target, it can also be passed to
+# TARGET_LINK_SHADERS.
 
 SET(SHADER_DEFAULT_SUBDIR "shaders" CACHE STRING "Default subdirectory for shader module binaries within the current binary directory (CMAKE_CURRENT_BINARY_DIR).")
 SET(DXIL_DEFAULT_SUFFIX ".dxi" CACHE STRING "Default file extension for DXIL shaders.")
 SET(SPIRV_DEFAULT_SUFFIX ".spv" CACHE STRING "Default file extension for SPIR-V shaders.")
+SET(SHADER_ARCHIVE_DEFAULT_SUFFIX ".lfxa" CACHE STRING "Default file extension for shader archives.")
 
 
 FUNCTION(TARGET_HLSL_SHADERS target_name shader_source shader_model compile_as compile_with shader_type compile_options)
@@ -318,6 +338,9 @@ FUNCTION(ADD_SHADER_MODULE module_name)
     MESSAGE(SEND_ERROR "Unsupported shader language: ${SHADER_LANGUAGE}.")
   ENDIF(${SHADER_LANGUAGE} STREQUAL "GLSL")
 
+  # Store the shader type, so that it can be written into shader archives.
+  SET_TARGET_PROPERTIES(${module_name} PROPERTIES SHADER_TYPE ${SHADER_TYPE})
+
   # If a library is specified, append the shader target it to the library target.
   IF(SHADER_LIBRARY)
     ADD_DEPENDENCIES(${SHADER_LIBRARY} ${module_name})
@@ -372,6 +395,60 @@ FUNCTION(ADD_SHADER_LIBRARY library_name)
 ENDFUNCTION(ADD_SHADER_LIBRARY library_name)
 
 
+FUNCTION(ADD_SHADER_ARCHIVE archive_name)
+  CMAKE_PARSE_ARGUMENTS(SHADER_ARCHIVE "COMPRESS" "OUTPUT_NAME;REFLECTION_DATA" "SHADERS" ${ARGN})
+
+  IF(NOT SHADER_ARCHIVE_OUTPUT_NAME)
+    SET(SHADER_ARCHIVE_OUTPUT_NAME ${archive_name})
+  ENDIF(NOT SHADER_ARCHIVE_OUTPUT_NAME)
+
+  IF(NOT DEFINED CMAKE_RUNTIME_OUTPUT_DIRECTORY)
+    SET(OUTPUT_DIR ${CMAKE_CURRENT_BINARY_DIR}/${SHADER_DEFAULT_SUBDIR})
+  ELSE()
+    SET(OUTPUT_DIR ${CMAKE_RUNTIME_OUTPUT_DIRECTORY}/${SHADER_DEFAULT_SUBDIR})
+  ENDIF(NOT DEFINED CMAKE_RUNTIME_OUTPUT_DIRECTORY)
+
+  SET(archive_options "")
+
+  IF(SHADER_ARCHIVE_COMPRESS)
+    LIST(APPEND archive_options -c)
+  ENDIF(SHADER_ARCHIVE_COMPRESS)
+
+  IF(SHADER_ARCHIVE_REFLECTION_DATA)
+    LIST(APPEND archive_options -r "${SHADER_ARCHIVE_REFLECTION_DATA}")
+  ENDIF(SHADER_ARCHIVE_REFLECTION_DATA)
+
+  # Each module is passed to the packer as a tuple of name, type, entry point and binary file.
+  FOREACH(shader_module ${SHADER_ARCHIVE_SHADERS})
+    GET_TARGET_PROPERTY(SHADER_PROGRAM_NAME ${shader_module} OUTPUT_NAME)
+    GET_TARGET_PROPERTY(SHADER_PROGRAM_SUFFIX ${shader_module} SUFFIX)
+    GET_TARGET_PROPERTY(SHADER_PROGRAM_BINARY_DIR ${shader_module} RUNTIME_OUTPUT_DIRECTORY)
+    GET_TARGET_PROPERTY(SHADER_PROGRAM_TYPE ${shader_module} SHADER_TYPE)
+
+    LIST(APPEND archive_options ${SHADER_PROGRAM_NAME} ${SHADER_PROGRAM_TYPE} main "${SHADER_PROGRAM_BINARY_DIR}/${SHADER_PROGRAM_NAME}${SHADER_PROGRAM_SUFFIX}")
+  ENDFOREACH(shader_module ${SHADER_ARCHIVE_SHADERS})
+
+  ADD_CUSTOM_TARGET(${archive_name}
+    COMMENT "Packing shader archive ${archive_name} to '${OUTPUT_DIR}/${SHADER_ARCHIVE_OUTPUT_NAME}${SHADER_ARCHIVE_DEFAULT_SUFFIX}'..."
+    COMMAND ${CMAKE_COMMAND} -E make_directory ${OUTPUT_DIR}
+  )
+
+  ADD_CUSTOM_COMMAND(TARGET ${archive_name}
+    WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}
+    COMMAND pckar "${OUTPUT_DIR}/${SHADER_ARCHIVE_OUTPUT_NAME}${SHADER_ARCHIVE_DEFAULT_SUFFIX}" ${archive_options}
+    DEPENDS pckar ${SHADER_ARCHIVE_SHADERS}
+  )
+
+  ADD_DEPENDENCIES(${archive_name} pckar ${SHADER_ARCHIVE_SHADERS})
+
+  SET_TARGET_PROPERTIES(${archive_name} PROPERTIES 
+    OUTPUT_NAME ${SHADER_ARCHIVE_OUTPUT_NAME}
+    SUFFIX ${SHADER_ARCHIVE_DEFAULT_SUFFIX}
+    RUNTIME_OUTPUT_DIRECTORY ${OUTPUT_DIR}
+  )
+ENDFUNCTION(ADD_SHADER_ARCHIVE archive_name)
+
+
 FUNCTION(TARGET_LINK_SHADER_LIBRARIES target_name)
   CMAKE_PARSE_ARGUMENTS(SHADER "" "" "LIBRARIES" ${ARGN})
   
@@ -480,4 +557,215 @@ int main(int argc, char* argv[]) {
 ]==])
 
 ADD_EXECUTABLE(pcksl "${CMAKE_BINARY_DIR}/Auxiliary/pcksl.cxx")
-SET_PROPERTY(TARGET pcksl PROPERTY FOLDER "Auxiliary")
\ No newline at end of file
+SET_PROPERTY(TARGET pcksl PROPERTY FOLDER "Auxiliary")
+
+FILE(GENERATE OUTPUT "${CMAKE_BINARY_DIR}/Auxiliary/pckar.cxx" CONTENT [==[
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+#include <map>
+
+// NOTE: The archive layout must match the reader in `src/Rendering/src/shader_archive.cpp`.
+struct Header {
+    uint32_t magic, version, entries, stringTableSize;
+    uint64_t reflectionOffset, reflectionSize;
+};
+
+struct Record {
+    uint32_t nameOffset, nameLength, entryPointOffset, entryPointLength, stage, flags;
+    uint64_t hash, offset, size, uncompressedSize;
+};
+
+struct Module {
+    Record record;
+    std::vector<char> data;
+};
+
+static uint64_t hash(const std::vector<char>& data) {
+    uint64_t seed = 0xcbf29ce484222325;
+
+    for (char c : data)
+        seed = (seed ^ c) * 0x00000100000001b3;
+
+    return seed;
+}
+
+static uint32_t stage(const std::string& type) {
+    static const std::map<std::string, uint32_t> stages = {
+        { "VERTEX", 0x00000001 }, { "HULL", 0x00000002 }, { "TESSELATION_CONTROL", 0x00000002 }, { "TESSELLATION_CONTROL", 0x00000002 }, { "DOMAIN", 0x00000004 }, { "TESSELATION_EVALUATION", 0x00000004 },
+        { "TESSELLATION_EVALUATION", 0x00000004 }, { "GEOMETRY", 0x00000008 }, { "FRAGMENT", 0x00000010 }, { "PIXEL", 0x00000010 }, { "COMPUTE", 0x00000020 }, { "TASK", 0x00000040 }, { "AMPLIFICATION", 0x00000040 },
+        { "MESH", 0x00000080 }
+    };
+
+    auto match = stages.find(type);
+    return match == stages.end() ? 0x7FFFFFFF : match->second;
+}
+
+static void writeLength(std::vector<char>& out, size_t length) {
+    for (; length >= 255; length -= 255)
+        out.push_back(static_cast<char>(255));
+
+    out.push_back(static_cast<char>(length));
+}
+
+static void writeSequence(std::vector<char>& out, const char* literals, size_t literalLength, size_t offset, size_t matchLength) {
+    size_t match = matchLength >= 4 ? matchLength - 4 : 0;
+    out.push_back(static_cast<char>(((literalLength < 15 ? literalLength : 15) << 4) | (offset == 0 ? 0 : (match < 15 ? match : 15))));
+
+    if (literalLength >= 15)
+        writeLength(out, literalLength - 15);
+
+    out.insert(out.end(), literals, literals + literalLength);
+
+    if (offset == 0)
+        return;
+
+    out.push_back(static_cast<char>(offset & 0xFF));
+    out.push_back(static_cast<char>(offset >> 8));
+
+    if (match >= 15)
+        writeLength(out, match - 15);
+}
+
+// Compresses the input into a single LZ4 block, using a greedy parser with a single hash table.
+static std::vector<char> compress(const std::vector<char>& in) {
+    std::vector<char> out;
+    std::vector<int64_t> table(1 << 16, -1);
+    const size_t size = in.size();
+    size_t anchor = 0, position = 0;
+
+    // The last match must start at least 12 bytes before the end of the block and the last 5 bytes must always be literals.
+    while (size >= 13 && position < size - 12) {
+        uint32_t sequence;
+        std::memcpy(&sequence, in.data() + position, sizeof(sequence));
+        auto& slot = table[(sequence * 2654435761u) >> 16];
+        int64_t candidate = slot;
+        slot = static_cast<int64_t>(position);
+
+        if (candidate < 0 || position - static_cast<size_t>(candidate) > 65535 || std::memcmp(in.data() + candidate, in.data() + position, sizeof(sequence)) != 0) {
+            position++;
+            continue;
+        }
+
+        size_t length = sizeof(sequence);
+
+        while (position + length < size - 5 && in[candidate + length] == in[position + length])
+            length++;
+
+        writeSequence(out, in.data() + anchor, position - anchor, position - static_cast<size_t>(candidate), length);
+        anchor = position += length;
+    }
+
+    writeSequence(out, in.data() + anchor, size - anchor, 0, 0);
+    return out;
+}
+
+static void pad(std::vector<char>& data) {
+    data.resize((data.size() + 15) & ~static_cast<size_t>(15));
+}
+
+int main(int argc, char* argv[]) {
+    // Usage: pckar <archive> [-c] [-r <reflection file>] {<name> <type> <entry point> <shader file>}...
+    if (argc < 2)
+        return -1;
+
+    std::string archiveFile(argv[1]);
+    std::string reflectionFile;
+    bool compressModules = false;
+    int arg = 2;
+
+    for (; arg < argc; ++arg) {
+        std::string option(argv[arg]);
+
+        if (option == "-c")
+            compressModules = true;
+        else if (option == "-r" && arg + 1 < argc)
+            reflectionFile = argv[++arg];
+        else
+            break;
+    }
+
+    if ((argc - arg) % 4 != 0)
+        return -1;
+
+    std::vector<Module> modules;
+    std::string strings;
+
+    for (; arg < argc; arg += 4) {
+        std::string name(argv[arg]), type(argv[arg + 1]), entryPoint(argv[arg + 2]);
+        std::ifstream file(argv[arg + 3], std::ios::binary);
+
+        if (!file.is_open()) {
+            std::cerr << "pckar: unable to open shader module " << argv[arg + 3] << "." << std::endl;
+            return -1;
+        }
+
+        Module module { };
+        module.data.assign(std::istreambuf_iterator<char>(file), { });
+        module.record.nameOffset = static_cast<uint32_t>(strings.size());
+        module.record.nameLength = static_cast<uint32_t>(name.size());
+        strings += name;
+        module.record.entryPointOffset = static_cast<uint32_t>(strings.size());
+        module.record.entryPointLength = static_cast<uint32_t>(entryPoint.size());
+        strings += entryPoint;
+        module.record.stage = stage(type);
+        module.record.hash = hash(module.data);
+        module.record.uncompressedSize = module.data.size();
+
+        // Only store the compressed bytecode, if it is actually smaller.
+        if (compressModules) {
+            auto compressed = compress(module.data);
+
+            if (compressed.size() < module.data.size()) {
+                module.data = std::move(compressed);
+                module.record.flags |= 0x00000001;
+            }
+        }
+
+        module.record.size = module.data.size();
+        modules.push_back(std::move(module));
+    }
+
+    std::vector<char> reflection;
+
+    if (!reflectionFile.empty()) {
+        std::ifstream file(reflectionFile, std::ios::binary);
+
+        if (!file.is_open()) {
+            std::cerr << "pckar: unable to open reflection data " << reflectionFile << "." << std::endl;
+            return -1;
+        }
+
+        reflection.assign(std::istreambuf_iterator<char>(file), { });
+    }
+
+    // Write the index, followed by the bytecode of all modules and the reflection data, each aligned to 16 bytes.
+    std::vector<char> archive(sizeof(Header) + modules.size() * sizeof(Record));
+    archive.insert(archive.end(), strings.begin(), strings.end());
+    pad(archive);
+
+    for (auto& module : modules) {
+        module.record.offset = archive.size();
+        archive.insert(archive.end(), module.data.begin(), module.data.end());
+        pad(archive);
+    }
+
+    Header header { 0x4158464C, 1, static_cast<uint32_t>(modules.size()), static_cast<uint32_t>(strings.size()), reflection.empty() ? 0 : archive.size(), reflection.size() };
+    archive.insert(archive.end(), reflection.begin(), reflection.end());
+    std::memcpy(archive.data(), &header, sizeof(header));
+
+    for (size_t i = 0; i < modules.size(); ++i)
+        std::memcpy(archive.data() + sizeof(Header) + i * sizeof(Record), &modules[i].record, sizeof(Record));
+
+    std::ofstream file(archiveFile, std::ios::binary | std::ios::trunc);
+    file.write(archive.data(), static_cast<std::streamsize>(archive.size()));
+    return file.good() ? 0 : -1;
+}
+]==])
+
+ADD_EXECUTABLE(pckar "${CMAKE_BINARY_DIR}/Auxiliary/pckar.cxx")
+SET_PROPERTY(TARGET pckar PROPERTY FOLDER "Auxiliary")
\ No newline at end of file